@@ -11,9 +11,7 @@
 #include "smtk/attribute/MeshSelectionItem.h"
 #include "smtk/attribute/Attribute.h"
 #include "smtk/attribute/MeshSelectionItemDefinition.h"
-#include <algorithm> // std::set_difference
 #include <iostream>
-#include <iterator>
 #include <stdio.h>
 
 using namespace smtk::attribute;
@@ -78,25 +76,36 @@ std::size_t MeshSelectionItem::numberOfValues() const
 
 void MeshSelectionItem::setValues(const smtk::common::UUID& uuid, const std::set<int>& vals)
 {
-  this->m_selectionValues[uuid] = vals;
+  this->m_selectionValues[uuid] = ValueSet(vals.begin(), vals.end());
 }
 
 void MeshSelectionItem::unionValues(const smtk::common::UUID& uuid, const std::set<int>& vals)
 {
-  this->m_selectionValues[uuid].insert(vals.begin(), vals.end());
+  this->m_selectionValues[uuid].unite(ValueSet(vals.begin(), vals.end()));
 }
 
 void MeshSelectionItem::removeValues(const smtk::common::UUID& uuid, const std::set<int>& vals)
 {
-  std::set<int> diffSet;
-  std::set_difference(this->m_selectionValues[uuid].begin(), this->m_selectionValues[uuid].end(),
-    vals.begin(), vals.end(), std::inserter(diffSet, diffSet.end()));
-  this->m_selectionValues[uuid] = diffSet;
+  this->m_selectionValues[uuid].subtract(ValueSet(vals.begin(), vals.end()));
+}
+
+void MeshSelectionItem::setValues(const smtk::common::UUID& uuid, const ValueSet& vals)
+{
+  this->m_selectionValues[uuid] = vals;
+}
+
+void MeshSelectionItem::unionValues(const smtk::common::UUID& uuid, const ValueSet& vals)
+{
+  this->m_selectionValues[uuid].unite(vals);
+}
+
+void MeshSelectionItem::removeValues(const smtk::common::UUID& uuid, const ValueSet& vals)
+{
+  this->m_selectionValues[uuid].subtract(vals);
 }
 
-const std::set<int>& MeshSelectionItem::values(const smtk::common::UUID& uuid)
+const MeshSelectionItem::ValueSet& MeshSelectionItem::values(const smtk::common::UUID& uuid)
 {
-  //std::advance(it,element);
   return this->m_selectionValues[uuid];
 }
 
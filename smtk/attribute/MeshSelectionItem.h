@@ -13,6 +13,7 @@
 #include "smtk/CoreExports.h"
 #include "smtk/PublicPointerDefs.h"
 #include "smtk/attribute/Item.h"
+#include "smtk/common/RangeSet.h"
 #include <map>
 #include <set>
 #include <string>
@@ -37,11 +38,16 @@ enum MeshModifyMode
 
 /**\brief Provide a way for an attribute to refer to mesh entities.
   *
+  * Selected values for each entity are held as runs of consecutive
+  * values (see smtk::common::RangeSet) so that selecting large, mostly
+  * contiguous blocks of cells remains compact and so that unions and
+  * differences of selections take time linear in the number of runs.
   */
 class SMTKCORE_EXPORT MeshSelectionItem : public Item
 {
 public:
-  typedef std::map<smtk::common::UUID, std::set<int> >::const_iterator const_sel_map_it;
+  typedef smtk::common::RangeSet<int> ValueSet;
+  typedef std::map<smtk::common::UUID, ValueSet>::const_iterator const_sel_map_it;
 
   smtkTypeMacro(MeshSelectionItem);
   ~MeshSelectionItem() override;
@@ -51,13 +57,16 @@ public:
   void setValues(const smtk::common::UUID&, const std::set<int>&);
   void unionValues(const smtk::common::UUID&, const std::set<int>&);
   void removeValues(const smtk::common::UUID&, const std::set<int>&);
+  void setValues(const smtk::common::UUID&, const ValueSet&);
+  void unionValues(const smtk::common::UUID&, const ValueSet&);
+  void removeValues(const smtk::common::UUID&, const ValueSet&);
   void setModifyMode(MeshModifyMode mode) { this->m_modifyMode = mode; }
   MeshModifyMode modifyMode() const { return this->m_modifyMode; }
   void setCtrlKeyDown(bool val) { this->m_isCtrlKeyDown = val; }
   bool isCtrlKeyDown() const { return this->m_isCtrlKeyDown; }
 
   std::size_t numberOfValues() const;
-  const std::set<int>& values(const smtk::common::UUID&);
+  const ValueSet& values(const smtk::common::UUID&);
   void reset() override;
   // Assigns this item to be equivalent to another.  Options are currently not used.
   // Returns true if success and false if a problem occured
@@ -75,7 +84,7 @@ protected:
   MeshSelectionItem(Attribute* owningAttribute, int itemPosition);
   MeshSelectionItem(Item* owningItem, int position, int subGroupPosition);
   bool setDefinition(smtk::attribute::ConstItemDefinitionPtr vdef) override;
-  std::map<smtk::common::UUID, std::set<int> > m_selectionValues;
+  std::map<smtk::common::UUID, ValueSet> m_selectionValues;
   MeshModifyMode m_modifyMode;
   bool m_isCtrlKeyDown;
 };
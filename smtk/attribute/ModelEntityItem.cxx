@@ -20,12 +20,14 @@ using namespace smtk::attribute;
 /// Construct an item given its owning attribute and location in the attribute.
 ModelEntityItem::ModelEntityItem(Attribute* owningAttribute, int itemPosition)
   : Item(owningAttribute, itemPosition)
+  , m_indexValid(false)
 {
 }
 
 /// Construct an item given its owning item and position inside the item.
 ModelEntityItem::ModelEntityItem(Item* inOwningItem, int itemPosition, int mySubGroupPosition)
   : Item(inOwningItem, itemPosition, mySubGroupPosition)
+  , m_indexValid(false)
 {
 }
 
@@ -81,6 +83,7 @@ bool ModelEntityItem::setDefinition(smtk::attribute::ConstItemDefinitionPtr adef
   if (n != 0)
   {
     this->m_values.resize(n);
+    this->invalidateIndex();
   }
   return true;
 }
@@ -127,7 +130,18 @@ bool ModelEntityItem::setNumberOfValues(std::size_t newSize)
   if (n > 0 && newSize > n)
     return false; // The number of values requested is too large.
 
+  // Unset values are added or removed at the end, so the index can be
+  // updated slot by slot.
+  for (std::size_t ii = this->m_values.size(); ii > newSize; --ii)
+  {
+    this->unindexValue(ii - 1);
+  }
+  std::size_t oldSize = this->m_values.size();
   this->m_values.resize(newSize);
+  for (std::size_t ii = oldSize; ii < newSize; ++ii)
+  {
+    this->indexValue(ii);
+  }
   return true;
 }
 
@@ -174,7 +188,9 @@ bool ModelEntityItem::setValue(std::size_t i, const smtk::model::EntityRef& val)
     static_cast<const ModelEntityItemDefinition*>(this->definition().get());
   if (i < this->m_values.size() && def->isValueValid(val))
   {
+    this->unindexValue(i);
     this->m_values[i] = val;
+    this->indexValue(i);
     return true;
   }
   return false;
@@ -191,24 +207,16 @@ bool ModelEntityItem::appendValue(const smtk::model::EntityRef& val)
   }
 
   // Second - is the value already in the item?
-  std::size_t emptyIndex, n = this->numberOfValues();
-  bool foundEmpty = false;
-  for (std::size_t i = 0; i < n; ++i)
+  this->updateIndex();
+  if (val.entity() && this->m_index.find(val.entity()) != this->m_index.end())
   {
-    if (this->isSet(i) && (this->value(i).entity() == val.entity()))
-    {
-      return true;
-    }
-    if (!this->isSet(i))
-    {
-      foundEmpty = true;
-      emptyIndex = i;
-    }
+    return true;
   }
   // If not, was there a space available?
-  if (foundEmpty)
+  auto empty = this->m_index.find(smtk::common::UUID::null());
+  if (empty != this->m_index.end())
   {
-    return this->setValue(emptyIndex, val);
+    return this->setValue(empty->second.m_position, val);
   }
   // Finally - are we allowed to change the number of values?
   if ((def->isExtensible() && def->maxNumberOfValues() &&
@@ -220,6 +228,7 @@ bool ModelEntityItem::appendValue(const smtk::model::EntityRef& val)
   }
 
   this->m_values.push_back(val);
+  this->indexValue(this->m_values.size() - 1);
   return true;
 }
 
@@ -233,7 +242,20 @@ bool ModelEntityItem::removeValue(std::size_t i)
     return this->setValue(i, smtk::model::EntityRef()); // The number of values is fixed
   }
 
+  this->unindexValue(i);
   this->m_values.erase(this->m_values.begin() + i);
+  if (this->m_indexValid)
+  {
+    // Values after the removed one move down a slot.
+    for (std::size_t jj = i; jj < this->m_values.size(); ++jj)
+    {
+      IndexEntry& entry(this->m_index[this->m_values[jj].entity()]);
+      if (entry.m_position == jj + 1)
+      {
+        entry.m_position = jj;
+      }
+    }
+  }
   return true;
 }
 
@@ -243,6 +265,7 @@ void ModelEntityItem::reset()
   this->m_values.clear();
   if (this->numberOfRequiredValues() > 0)
     this->m_values.resize(this->numberOfRequiredValues());
+  this->invalidateIndex();
 }
 
 /// A convenience method to obtain the first value in the item as a string.
@@ -358,11 +381,23 @@ smtk::model::EntityRefArray::const_iterator ModelEntityItem::end() const
   return this->m_values.end();
 }
 
-/**\brief
+/**\brief Return the position of the first value that refers to \a entity (or -1).
   *
+  * Lookups take constant time on average.
   */
 std::ptrdiff_t ModelEntityItem::find(const smtk::common::UUID& entity) const
 {
+  if (entity)
+  {
+    this->updateIndex();
+    auto entry = this->m_index.find(entity);
+    if (entry == this->m_index.end())
+    {
+      return -1;
+    }
+    return static_cast<std::ptrdiff_t>(entry->second.m_position);
+  }
+
   std::ptrdiff_t idx = 0;
   smtk::model::EntityRefArray::const_iterator it;
   for (it = this->begin(); it != this->end(); ++it, ++idx)
@@ -375,12 +410,20 @@ std::ptrdiff_t ModelEntityItem::find(const smtk::common::UUID& entity) const
   return -1;
 }
 
-/**\brief
+/**\brief Return the position of the first value equal to \a entity (or -1).
   *
   */
 std::ptrdiff_t ModelEntityItem::find(const smtk::model::EntityRef& entity) const
 {
-  std::ptrdiff_t idx = 0;
+  // The same entity is rarely held with different managers, so check the
+  // first value with a matching UUID before scanning.
+  std::ptrdiff_t idx = this->find(entity.entity());
+  if (idx < 0 || this->m_values[idx] == entity)
+  {
+    return idx;
+  }
+
+  idx = 0;
   smtk::model::EntityRefArray::const_iterator it;
   for (it = this->begin(); it != this->end(); ++it, ++idx)
   {
@@ -391,3 +434,91 @@ std::ptrdiff_t ModelEntityItem::find(const smtk::model::EntityRef& entity) const
   }
   return -1;
 }
+
+void ModelEntityItem::updateIndex() const
+{
+  if (this->m_indexValid)
+  {
+    return;
+  }
+  // Several threads may hold read access to an attribute at once.
+  std::lock_guard<std::mutex> guard(this->m_indexMutex);
+  if (this->m_indexValid)
+  {
+    return;
+  }
+  this->m_index.clear();
+  std::size_t ii = 0;
+  for (auto it = this->m_values.begin(); it != this->m_values.end(); ++it, ++ii)
+  {
+    auto entry = this->m_index.insert(std::make_pair(it->entity(), IndexEntry{ ii, 0 })).first;
+    ++entry->second.m_count;
+    if (!it->entity())
+    {
+      entry->second.m_position = ii;
+    }
+  }
+  this->m_indexValid = true;
+}
+
+void ModelEntityItem::indexValue(std::size_t i)
+{
+  if (!this->m_indexValid)
+  {
+    return;
+  }
+  const smtk::common::UUID& uid(this->m_values[i].entity());
+  auto entry = this->m_index.insert(std::make_pair(uid, IndexEntry{ i, 0 })).first;
+  ++entry->second.m_count;
+  if (uid ? i < entry->second.m_position : i > entry->second.m_position)
+  {
+    entry->second.m_position = i;
+  }
+}
+
+void ModelEntityItem::unindexValue(std::size_t i)
+{
+  if (!this->m_indexValid)
+  {
+    return;
+  }
+  const smtk::common::UUID& uid(this->m_values[i].entity());
+  auto entry = this->m_index.find(uid);
+  if (entry == this->m_index.end())
+  {
+    return;
+  }
+  if (--entry->second.m_count == 0)
+  {
+    this->m_index.erase(entry);
+    return;
+  }
+  if (entry->second.m_position != i)
+  {
+    return;
+  }
+  // The value occurs elsewhere; find the next entity (or previous unset) slot.
+  // This only happens for repeated values, which appendValue() never creates.
+  if (uid)
+  {
+    for (std::size_t jj = i + 1; jj < this->m_values.size(); ++jj)
+    {
+      if (this->m_values[jj].entity() == uid)
+      {
+        entry->second.m_position = jj;
+        return;
+      }
+    }
+  }
+  else
+  {
+    for (std::size_t jj = i; jj > 0; --jj)
+    {
+      if (!this->m_values[jj - 1].entity())
+      {
+        entry->second.m_position = jj - 1;
+        return;
+      }
+    }
+  }
+}
@@ -30,6 +30,10 @@
 #include "smtk/attribute/Item.h"
 #include "smtk/model/EntityRef.h"
 
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
 namespace smtk
 {
 namespace common
@@ -98,7 +102,27 @@ protected:
 
   bool setDefinition(smtk::attribute::ConstItemDefinitionPtr def) override;
 
+  // Rebuild m_index if it has been invalidated since it was last built.
+  void updateIndex() const;
+  void invalidateIndex() { this->m_indexValid = false; }
+  // Add or remove the index entry for the value at position i (if the index is valid).
+  void indexValue(std::size_t i);
+  void unindexValue(std::size_t i);
+
+  struct IndexEntry
+  {
+    std::size_t m_position; // first occurrence (last occurrence for the null UUID)
+    std::size_t m_count;    // number of occurrences
+  };
+
   smtk::model::EntityRefArray m_values;
+  // Map the UUID of each entity in m_values to where and how often it occurs
+  // (and the null UUID to the position of the last unset value) so that
+  // lookups do not scan every value. It is built lazily and then updated as
+  // individual values change.
+  mutable std::unordered_map<smtk::common::UUID, IndexEntry> m_index;
+  mutable std::atomic<bool> m_indexValid;
+  mutable std::mutex m_indexMutex;
 };
 
 template <typename I>
@@ -48,15 +48,18 @@ PySharedPtrClass< smtk::attribute::MeshSelectionItem, smtk::attribute::Item > py
     .def("modifyMode", &smtk::attribute::MeshSelectionItem::modifyMode)
     .def_static("modifyMode2String", &smtk::attribute::MeshSelectionItem::modifyMode2String, py::arg("m"))
     .def("numberOfValues", &smtk::attribute::MeshSelectionItem::numberOfValues)
-    .def("removeValues", &smtk::attribute::MeshSelectionItem::removeValues, py::arg("arg0"), py::arg("arg1"))
+    .def("removeValues", (void (smtk::attribute::MeshSelectionItem::*)(const ::smtk::common::UUID&, const ::std::set<int>&)) &smtk::attribute::MeshSelectionItem::removeValues, py::arg("arg0"), py::arg("arg1"))
     .def("reset", &smtk::attribute::MeshSelectionItem::reset)
     .def("setCtrlKeyDown", &smtk::attribute::MeshSelectionItem::setCtrlKeyDown, py::arg("val"))
     .def("setModifyMode", &smtk::attribute::MeshSelectionItem::setModifyMode, py::arg("mode"))
-    .def("setValues", &smtk::attribute::MeshSelectionItem::setValues, py::arg("arg0"), py::arg("arg1"))
+    .def("setValues", (void (smtk::attribute::MeshSelectionItem::*)(const ::smtk::common::UUID&, const ::std::set<int>&)) &smtk::attribute::MeshSelectionItem::setValues, py::arg("arg0"), py::arg("arg1"))
     .def_static("string2ModifyMode", &smtk::attribute::MeshSelectionItem::string2ModifyMode, py::arg("s"))
     .def("type", &smtk::attribute::MeshSelectionItem::type)
-    .def("unionValues", &smtk::attribute::MeshSelectionItem::unionValues, py::arg("arg0"), py::arg("arg1"))
-    .def("values", &smtk::attribute::MeshSelectionItem::values, py::arg("arg0"))
+    .def("unionValues", (void (smtk::attribute::MeshSelectionItem::*)(const ::smtk::common::UUID&, const ::std::set<int>&)) &smtk::attribute::MeshSelectionItem::unionValues, py::arg("arg0"), py::arg("arg1"))
+    .def("values", [](smtk::attribute::MeshSelectionItem& item, const smtk::common::UUID& uuid) {
+        const smtk::attribute::MeshSelectionItem::ValueSet& values = item.values(uuid);
+        return std::set<int>(values.begin(), values.end());
+      }, py::arg("arg0"))
     .def_static("CastTo", [](const std::shared_ptr<smtk::attribute::Item> i) {
         return std::dynamic_pointer_cast<smtk::attribute::MeshSelectionItem>(i);
       })    ;
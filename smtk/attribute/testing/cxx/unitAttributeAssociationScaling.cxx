@@ -0,0 +1,142 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Collection.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/ModelEntityItem.h"
+#include "smtk/attribute/ModelEntityItemDefinition.h"
+
+#include "smtk/model/Face.h"
+#include "smtk/model/Manager.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace smtk::attribute;
+using namespace smtk::common;
+using namespace smtk;
+
+namespace
+{
+
+double secondsSince(const std::chrono::steady_clock::time_point& start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+}
+
+// Associating an attribute with many entities (e.g., a boundary condition
+// applied to every face of a discrete model) should take time linear in the
+// number of entities.
+int unitAttributeAssociationScaling(int, char* [])
+{
+  const std::size_t numberOfFaces = 100000;
+
+  attribute::CollectionPtr collection = attribute::Collection::create();
+  model::Manager::Ptr modelMgr = model::Manager::create();
+  collection->setRefModelManager(modelMgr);
+
+  DefinitionPtr def = collection->createDefinition("boundaryCondition");
+  auto rule = def->createLocalAssociationRule();
+  rule->setMembershipMask(smtk::model::FACE);
+  rule->setIsExtensible(true);
+  AttributePtr att = collection->createAttribute("wall", "boundaryCondition");
+
+  std::vector<model::Face> faces;
+  faces.reserve(numberOfFaces);
+  for (std::size_t ii = 0; ii < numberOfFaces; ++ii)
+  {
+    faces.push_back(modelMgr->addFace());
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (auto& face : faces)
+  {
+    smtkTest(att->associateEntity(face), "Could not associate face " << face.entity() << ".");
+  }
+  // Associating an entity again must not add a duplicate.
+  smtkTest(att->associateEntity(faces[numberOfFaces / 2]), "Could not re-associate a face.");
+  std::cout << "Associated " << numberOfFaces << " faces in " << secondsSince(start) << " s\n";
+  smtkTest(att->associations()->numberOfValues() == numberOfFaces, "Wrong number of associations.");
+
+  start = std::chrono::steady_clock::now();
+  for (auto& face : faces)
+  {
+    smtkTest(att->isEntityAssociated(face), "Face not associated.");
+    smtkTest(face.attributes().count(att->id()) == 1, "Entity does not know its attribute.");
+  }
+  std::cout << "Queried " << numberOfFaces << " associations in " << secondsSince(start)
+            << " s\n";
+  smtkTest(att->associations()->find(faces[1234].entity()) == 1234, "Wrong association order.");
+
+  // Disassociating values from the end does not move the others.
+  start = std::chrono::steady_clock::now();
+  for (std::size_t ii = numberOfFaces; ii > numberOfFaces / 2; --ii)
+  {
+    att->disassociateEntity(faces[ii - 1]);
+  }
+  std::cout << "Disassociated " << (numberOfFaces - numberOfFaces / 2) << " faces in "
+            << secondsSince(start) << " s\n";
+  smtkTest(att->associations()->numberOfValues() == numberOfFaces / 2,
+    "Wrong number of associations after disassociation.");
+  smtkTest(!att->isEntityAssociated(faces.back()) && faces.back().attributes().empty(),
+    "Face still associated.");
+
+  // Removing a value from the middle shifts those after it.
+  att->disassociateEntity(faces[10]);
+  smtkTest(!att->isEntityAssociated(faces[10]), "Face still associated.");
+  smtkTest(att->associations()->find(faces[11].entity()) == 10, "Index not updated.");
+  smtkTest(att->associateEntity(faces[10]), "Could not re-associate a face.");
+  smtkTest(att->associations()->find(faces[10].entity()) ==
+      static_cast<std::ptrdiff_t>(numberOfFaces / 2 - 1),
+    "Re-associated face should be appended.");
+
+  att->removeAllAssociations();
+  smtkTest(att->associations()->numberOfValues() == 0 && faces[0].attributes().empty(),
+    "Could not remove all associations.");
+
+  // Filling an item slot by slot (as setValues() does) updates the index in
+  // place instead of rebuilding it after every value.
+  ModelEntityItemPtr item = att->associations();
+  start = std::chrono::steady_clock::now();
+  smtkTest(item->setNumberOfValues(numberOfFaces), "Could not resize the item.");
+  for (std::size_t ii = 0; ii < numberOfFaces; ++ii)
+  {
+    smtkTest(item->setValue(ii, faces[ii]), "Could not set value " << ii << ".");
+    smtkTest(item->find(faces[ii].entity()) == static_cast<std::ptrdiff_t>(ii),
+      "Wrong position for value " << ii << ".");
+  }
+  std::cout << "Set " << numberOfFaces << " values in " << secondsSince(start) << " s\n";
+
+  // Repeated values are found at their first position.
+  item->setValue(0, faces[5]);
+  smtkTest(item->find(faces[5].entity()) == 0 && item->find(faces[0].entity()) == -1,
+    "Index not updated when a value was replaced.");
+  item->setValue(0, faces[0]);
+  smtkTest(item->find(faces[5].entity()) == 5 && item->find(faces[0].entity()) == 0,
+    "Index not updated when a repeated value was replaced.");
+
+  // Unset slots are filled by appendValue().
+  smtkTest(item->removeValue(7), "Could not remove a value.");
+  smtkTest(item->find(faces[8].entity()) == 7, "Index not updated after removal.");
+  smtkTest(item->setNumberOfValues(numberOfFaces), "Could not grow the item.");
+  item->setValue(3, smtk::model::EntityRef());
+  smtkTest(item->appendValue(faces[7]) &&
+      item->find(faces[7].entity()) == static_cast<std::ptrdiff_t>(numberOfFaces - 1),
+    "Expected the last unset slot to be filled first.");
+  smtkTest(item->appendValue(faces[3]) && item->find(faces[3].entity()) == 3,
+    "Expected the remaining unset slot to be filled.");
+  smtkTest(item->isSet(3) && item->numberOfValues() == numberOfFaces, "Item should be full.");
+  item->reset();
+
+  return 0;
+}
@@ -189,8 +189,7 @@ void EdgeOperator::getSelectedVertsAndEdges(
 
       std::set<int> seledgepts;
 
-      for (std::set<int>::const_iterator sit = mapIt->second.begin(); sit != mapIt->second.end();
-           ++sit)
+      for (auto sit = mapIt->second.begin(); sit != mapIt->second.end(); ++sit)
       {
         vtkIdType pId = this->convertToGlobalPointId(*sit, selEdge);
         if (pId < 0)
@@ -71,7 +71,8 @@ bool GrowOperator::ableToOperate()
 }
 
 bool GrowOperator::writeSelectionResult(
-  const std::map<smtk::common::UUID, std::set<int> >& cachedSelection, OperatorResult& result)
+  const std::map<smtk::common::UUID, smtk::attribute::MeshSelectionItem::ValueSet>& cachedSelection,
+  OperatorResult& result)
 {
   smtk::attribute::MeshSelectionItem::Ptr outSelectionItem = result->findMeshSelection("selection");
   if (!outSelectionItem)
@@ -172,7 +173,7 @@ void GrowOperator::convertToGrowSelection(
       vtkDiscreteModelGeometricEntity::GetReverseClassificationArrayName()));
     if (masterCellIds)
     {
-      std::set<int>::const_iterator it;
+      smtk::attribute::MeshSelectionItem::ValueSet::const_iterator it;
       for (it = mapIt->second.begin(); it != mapIt->second.end(); ++it)
         outSelectionList->InsertNextValue(masterCellIds->GetValue(*it));
     }
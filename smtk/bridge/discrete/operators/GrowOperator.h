@@ -11,6 +11,7 @@
 #ifndef __smtk_session_discrete_GrowOperator_h
 #define __smtk_session_discrete_GrowOperator_h
 
+#include "smtk/attribute/MeshSelectionItem.h"
 #include "smtk/bridge/discrete/Operator.h"
 #include "vtkNew.h"
 #include "vtkSeedGrowSelectionFilter.h"
@@ -46,7 +47,9 @@ protected:
   void findVisibleModelFaces(
     const smtk::model::CellEntity& cellent, std::set<vtkIdType>& ModelFaceIds, Session* opsession);
 
-  bool writeSelectionResult(const std::map<smtk::common::UUID, std::set<int> >& cachedSelection,
+  bool writeSelectionResult(
+    const std::map<smtk::common::UUID, smtk::attribute::MeshSelectionItem::ValueSet>&
+      cachedSelection,
     smtk::model::OperatorResult& result);
   void writeSplitResult(vtkSelectionSplitOperator* splitOp, vtkDiscreteModelWrapper* modelWrapper,
     Session* opsession, smtk::model::OperatorResult& result);
@@ -62,7 +65,7 @@ protected:
   vtkNew<vtkSelectionSplitOperator> m_splitOp;
   vtkNew<vtkSeedGrowSelectionFilter> m_growOp;
   vtkNew<vtkSelection> m_growSelection;
-  std::map<smtk::common::UUID, std::set<int> > m_outSelection;
+  std::map<smtk::common::UUID, smtk::attribute::MeshSelectionItem::ValueSet> m_outSelection;
 };
 
 } // namespace discrete
@@ -16,6 +16,7 @@
 #include "smtk/attribute/IntItem.h"
 #include "smtk/attribute/ModelEntityItem.h"
 #include "smtk/attribute/StringItem.h"
+#include "smtk/attribute/VoidItem.h"
 
 #include "smtk/io/Logger.h"
 
@@ -209,27 +210,89 @@ void MarkChildren(vtkMultiBlockDataSet* data, T* key, V value)
   }
 }
 
+/**\brief Create the block hierarchy vtkExodusIIReader would produce, but with empty leaves.
+  *
+  * Each element block, side set, and node set is an empty placeholder registered
+  * with the session so that its geometry is read when it is first tessellated.
+  * Other object types are left as NULL blocks, just as the reader leaves them
+  * when they are disabled.
+  */
+static vtkSmartPointer<vtkMultiBlockDataSet> CreateLazyExodusBlocks(
+  vtkExodusIIReader* rdr, SessionPtr sess)
+{
+  // These match the order and names of vtkExodusIIReader's top-level blocks.
+  struct
+  {
+    vtkExodusIIReader::ObjectType type;
+    const char* name;
+    bool enabled;
+  } conn_types[] = { { vtkExodusIIReader::ELEM_BLOCK, "Element Blocks", true },
+    { vtkExodusIIReader::FACE_BLOCK, "Face Blocks", false },
+    { vtkExodusIIReader::EDGE_BLOCK, "Edge Blocks", false },
+    { vtkExodusIIReader::ELEM_SET, "Element Sets", false },
+    { vtkExodusIIReader::SIDE_SET, "Side Sets", true },
+    { vtkExodusIIReader::FACE_SET, "Face Sets", false },
+    { vtkExodusIIReader::EDGE_SET, "Edge Sets", false },
+    { vtkExodusIIReader::NODE_SET, "Node Sets", true } };
+  const int num_conn_types = sizeof(conn_types) / sizeof(conn_types[0]);
+
+  vtkSmartPointer<vtkMultiBlockDataSet> modelOut = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  modelOut->SetNumberOfBlocks(num_conn_types);
+  for (int j = 0; j < num_conn_types; ++j)
+  {
+    vtkNew<vtkMultiBlockDataSet> group;
+    int nb = rdr->GetNumberOfObjects(conn_types[j].type);
+    group->SetNumberOfBlocks(nb);
+    for (int i = 0; i < nb && conn_types[j].enabled; ++i)
+    {
+      vtkNew<vtkUnstructuredGrid> placeholder;
+      group->SetBlock(i, placeholder.GetPointer());
+      group->GetMetaData(i)->Set(
+        vtkCompositeDataSet::NAME(), rdr->GetObjectName(conn_types[j].type, i));
+      sess->addLazyBlock(placeholder.GetPointer(), rdr, conn_types[j].type, i);
+    }
+    modelOut->SetBlock(j, group.GetPointer());
+    modelOut->GetMetaData(j)->Set(vtkCompositeDataSet::NAME(), conn_types[j].name);
+  }
+  return modelOut;
+}
+
 smtk::model::OperatorResult ReadOperator::readExodus()
 {
   smtk::attribute::FileItem::Ptr filenameItem = this->specification()->findFile("filename");
+  smtk::attribute::VoidItem::Ptr lazyItem = this->specification()->findVoid("lazy loading");
+  smtk::attribute::VoidItem::Ptr prefetchItem =
+    this->specification()->findVoid("prefetch blocks");
+  bool lazy = lazyItem && lazyItem->isEnabled();
 
   std::string filename = filenameItem->value();
+  SessionPtr brdg = this->exodusSession();
 
-  vtkNew<vtkExodusIIReader> rdr;
+  vtkSmartPointer<vtkExodusIIReader> rdr = vtkSmartPointer<vtkExodusIIReader>::New();
   rdr->SetFileName(filenameItem->value(0).c_str());
   rdr->UpdateInformation();
-  // Turn on all side and node sets.
-  vtkExodusIIReader::ObjectType set_types[] = { vtkExodusIIReader::SIDE_SET,
-    vtkExodusIIReader::NODE_SET, vtkExodusIIReader::ELEM_BLOCK };
-  const int num_set_types = sizeof(set_types) / sizeof(set_types[0]);
-  for (int j = 0; j < num_set_types; ++j)
-    for (int i = 0; i < rdr->GetNumberOfObjects(set_types[j]); ++i)
-      rdr->SetObjectStatus(set_types[j], i, 1);
 
-  // Read in the data (so we can obtain tessellation info)
-  rdr->Update();
-  vtkSmartPointer<vtkMultiBlockDataSet> modelOut = vtkSmartPointer<vtkMultiBlockDataSet>::New();
-  modelOut->ShallowCopy(vtkMultiBlockDataSet::SafeDownCast(rdr->GetOutputDataObject(0)));
+  vtkSmartPointer<vtkMultiBlockDataSet> modelOut;
+  if (lazy)
+  {
+    // Only the metadata is read now; the session reads each block when it is first tessellated.
+    modelOut = CreateLazyExodusBlocks(rdr, brdg);
+  }
+  else
+  {
+    // Turn on all side and node sets.
+    vtkExodusIIReader::ObjectType set_types[] = { vtkExodusIIReader::SIDE_SET,
+      vtkExodusIIReader::NODE_SET, vtkExodusIIReader::ELEM_BLOCK };
+    const int num_set_types = sizeof(set_types) / sizeof(set_types[0]);
+    for (int j = 0; j < num_set_types; ++j)
+      for (int i = 0; i < rdr->GetNumberOfObjects(set_types[j]); ++i)
+        rdr->SetObjectStatus(set_types[j], i, 1);
+
+    // Read in the data (so we can obtain tessellation info)
+    rdr->Update();
+    modelOut = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+    modelOut->ShallowCopy(vtkMultiBlockDataSet::SafeDownCast(rdr->GetOutputDataObject(0)));
+  }
   int dim = rdr->GetDimensionality();
 
   // If we have preserved UUIDs, assign them now before anything else does:
@@ -265,12 +328,16 @@ smtk::model::OperatorResult ReadOperator::readExodus()
 
   // Now that the datasets we wish to present are marked,
   // have the Session create entries in the model manager for us:
-  SessionPtr brdg = this->exodusSession();
-  smtk::model::Model smtkModelOut = brdg->addModel(modelOut);
+  smtk::model::Model smtkModelOut = brdg->addModel(modelOut, lazy);
 
   smtkModelOut.setStringProperty("url", filename);
   smtkModelOut.setStringProperty("type", "exodus");
 
+  if (lazy && prefetchItem && prefetchItem->isEnabled())
+  {
+    brdg->prefetchBlocks();
+  }
+
   // Now set model for session and transcribe everything.
   smtk::model::OperatorResult result =
     this->createResult(smtk::operation::Operator::OPERATION_SUCCEEDED);
@@ -14,6 +14,8 @@
 
 #include "smtk/common/UUIDGenerator.h"
 
+#include "smtk/io/Logger.h"
+
 #include "smtk/mesh/core/Collection.h"
 #include "smtk/mesh/core/Manager.h"
 
@@ -27,6 +29,8 @@
 #include "smtk/extension/vtk/io/mesh/ImportVTKData.h"
 
 #include "vtkCellArray.h"
+#include "vtkDataObjectTreeIterator.h"
+#include "vtkExodusIIReader.h"
 #include "vtkGeometryFilter.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
@@ -38,6 +42,7 @@
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkUnsignedIntArray.h"
+#include "vtkUnstructuredGrid.h"
 
 using namespace smtk::model;
 using namespace smtk::common;
@@ -196,6 +201,7 @@ EntityHandle EntityHandle::parent() const
 
 // ++ 2 ++
 Session::Session()
+  : m_stopPrefetch(false)
 {
   this->initializeOperatorCollection(Session::s_operators);
 }
@@ -203,6 +209,7 @@ Session::Session()
 
 Session::~Session()
 {
+  this->cancelPrefetch();
 }
 
 // ++ 3 ++
@@ -229,8 +236,13 @@ smtk::model::EntityRef Session::toEntityRef(const EntityHandle& ent)
 // -- 4 --
 
 // ++ 6 ++
-/// Add the dataset and its blocks to the session.
-smtk::model::Model Session::addModel(vtkSmartPointer<vtkMultiBlockDataSet>& model)
+/**\brief Add the dataset and its blocks to the session.
+  *
+  * When \a lazy is true, only block metadata is transcribed; tessellations
+  * are created as blocks are first transcribed with SESSION_TESSELLATION.
+  * Lazy placeholders must be registered with addLazyBlock() beforehand.
+  */
+smtk::model::Model Session::addModel(vtkSmartPointer<vtkMultiBlockDataSet>& model, bool lazy)
 {
   EntityHandle handle(
     static_cast<int>(this->m_models.size()), model.GetPointer(), shared_from_this());
@@ -238,12 +250,173 @@ smtk::model::Model Session::addModel(vtkSmartPointer<vtkMultiBlockDataSet>& mode
   smtk::model::Model result = this->toEntityRef(handle);
   this->m_revIdMap[result] = handle;
   this->manager()->meshes()->makeCollection(result.entity())->name(result.name() + "_tessellation");
-  this->transcribe(result, smtk::model::SESSION_EVERYTHING, false);
+  this->transcribe(result,
+    lazy ? smtk::model::SESSION_EVERYTHING & ~smtk::model::SESSION_TESSELLATION
+         : smtk::model::SESSION_EVERYTHING,
+    false);
   result.setSession(smtk::model::SessionRef(this->manager(), this->sessionId()));
   return result;
 }
 // -- 6 --
 
+/**\brief Register an empty \a placeholder dataset whose geometry will be read on demand.
+  *
+  * The \a reader must have up-to-date metadata (i.e., UpdateInformation() has
+  * been called) for the file holding the block. The \a objectType is a
+  * vtkExodusIIReader::ObjectType and \a objectIndex is the block's index
+  * among objects of that type.
+  */
+void Session::addLazyBlock(
+  vtkDataObject* placeholder, vtkExodusIIReader* reader, int objectType, int objectIndex)
+{
+  if (!placeholder || !reader)
+    return;
+
+  std::lock_guard<std::mutex> guard(this->m_lazyMutex);
+  LazyBlock& block(this->m_lazyBlocks[placeholder]);
+  block.m_reader = reader;
+  block.m_objectType = objectType;
+  block.m_objectIndex = objectIndex;
+  block.m_data = NULL;
+}
+
+/// Return true when the geometry of \a entity is present (i.e., it is not a lazy placeholder).
+bool Session::isBlockLoaded(const smtk::model::EntityRef& entity)
+{
+  EntityHandle handle = this->toEntity(entity);
+  vtkDataObject* obj = handle.object<vtkDataObject>();
+  if (!obj)
+    return false;
+
+  std::lock_guard<std::mutex> guard(this->m_lazyMutex);
+  return this->m_lazyBlocks.find(obj) == this->m_lazyBlocks.end();
+}
+
+/// Return the number of lazy placeholders whose geometry has not been installed yet.
+size_t Session::numberOfUnloadedBlocks()
+{
+  std::lock_guard<std::mutex> guard(this->m_lazyMutex);
+  return this->m_lazyBlocks.size();
+}
+
+/**\brief Start reading the geometry of untouched lazy blocks on a background thread.
+  *
+  * The background thread only reads data into private datasets; the
+  * geometry is installed into the session's placeholders (and tessellated)
+  * on the calling thread when each block is first transcribed, so no
+  * dataset visible to the model manager is modified concurrently.
+  */
+void Session::prefetchBlocks()
+{
+  this->cancelPrefetch();
+  this->m_stopPrefetch = false;
+  this->m_prefetchThread = std::thread(&Session::prefetchWorker, this);
+}
+
+/// Stop any background prefetch started with prefetchBlocks() and wait for it to exit.
+void Session::cancelPrefetch()
+{
+  this->m_stopPrefetch = true;
+  if (this->m_prefetchThread.joinable())
+  {
+    this->m_prefetchThread.join();
+  }
+}
+
+void Session::prefetchWorker()
+{
+  while (!this->m_stopPrefetch)
+  {
+    // Hold the lock while reading since readers are shared among blocks of a file.
+    std::lock_guard<std::mutex> guard(this->m_lazyMutex);
+    LazyBlockMap_t::iterator it;
+    for (it = this->m_lazyBlocks.begin(); it != this->m_lazyBlocks.end(); ++it)
+    {
+      if (!it->second.m_data)
+        break;
+    }
+    if (it == this->m_lazyBlocks.end())
+      return;
+
+    it->second.m_data = Session::readLazyBlock(it->second);
+    if (!it->second.m_data)
+    { // Do not retry blocks that cannot be read; loadBlock() will report them.
+      it->second.m_data = vtkSmartPointer<vtkUnstructuredGrid>::New();
+    }
+  }
+}
+
+/// Read the geometry of a single lazy \a block, leaving all other blocks disabled.
+vtkSmartPointer<vtkDataObject> Session::readLazyBlock(const LazyBlock& block)
+{
+  vtkSmartPointer<vtkDataObject> result;
+  vtkExodusIIReader* rdr = block.m_reader.GetPointer();
+  if (!rdr)
+    return result;
+
+  vtkExodusIIReader::ObjectType set_types[] = { vtkExodusIIReader::SIDE_SET,
+    vtkExodusIIReader::NODE_SET, vtkExodusIIReader::ELEM_BLOCK };
+  const int num_set_types = sizeof(set_types) / sizeof(set_types[0]);
+  for (int j = 0; j < num_set_types; ++j)
+    for (int i = 0; i < rdr->GetNumberOfObjects(set_types[j]); ++i)
+      rdr->SetObjectStatus(set_types[j], i, 0);
+  rdr->SetObjectStatus(block.m_objectType, block.m_objectIndex, 1);
+  rdr->Update();
+
+  // Only one block is enabled, so the first non-empty leaf is the one we want.
+  vtkMultiBlockDataSet* out = vtkMultiBlockDataSet::SafeDownCast(rdr->GetOutputDataObject(0));
+  if (!out)
+    return result;
+
+  vtkSmartPointer<vtkDataObjectTreeIterator> iter;
+  iter.TakeReference(out->NewTreeIterator());
+  iter->VisitOnlyLeavesOn();
+  iter->SkipEmptyNodesOn();
+  iter->GoToFirstItem();
+  if (!iter->IsDoneWithTraversal())
+  {
+    // The reader is shared among the blocks of a file and its next Update()
+    // may reuse the leaf's arrays, so the block must own its own copy.
+    vtkDataObject* leaf = iter->GetCurrentDataObject();
+    result.TakeReference(leaf->NewInstance());
+    result->DeepCopy(leaf);
+  }
+  return result;
+}
+
+/**\brief Install the geometry of a lazily-read block into its placeholder.
+  *
+  * Returns true when the handle's data is ready to be tessellated
+  * (including when it was never lazy to begin with).
+  */
+bool Session::loadBlock(const EntityHandle& handle)
+{
+  vtkDataObject* obj = handle.object<vtkDataObject>();
+  if (!obj)
+    return false;
+
+  std::lock_guard<std::mutex> guard(this->m_lazyMutex);
+  LazyBlockMap_t::iterator it = this->m_lazyBlocks.find(obj);
+  if (it == this->m_lazyBlocks.end())
+    return true;
+
+  vtkSmartPointer<vtkDataObject> data = it->second.m_data;
+  if (!data)
+  {
+    data = Session::readLazyBlock(it->second);
+  }
+  this->m_lazyBlocks.erase(it);
+  if (!data)
+  {
+    smtkWarningMacro(this->log(), "Could not read geometry for \"" << handle.name() << "\".");
+    return false;
+  }
+
+  // Copying into the placeholder preserves the SMTK keys in its information object.
+  obj->ShallowCopy(data);
+  return true;
+}
+
 std::string Session::defaultFileExtension(const smtk::model::Model& model) const
 {
   std::string result = ".simple";
@@ -381,9 +554,14 @@ SessionInfoBits Session::transcribeInternal(
   {
     // If the entity is valid, is there any reason to refresh it?
     // Perhaps we want additional information transcribed?
-    if (this->danglingEntities().find(mutableEntityRef) == this->danglingEntities().end())
+    DanglingEntities::const_iterator dit = this->danglingEntities().find(mutableEntityRef);
+    if (dit == this->danglingEntities().end())
       return smtk::model::
         SESSION_EVERYTHING; // Not listed as dangling => everything transcribed already.
+
+    // Only transcribe what is missing (e.g., the tessellation of a lazily-read block).
+    actual = dit->second;
+    requestedInfo &= ~actual;
   }
   // -- 10 --
 
@@ -433,7 +611,7 @@ SessionInfoBits Session::transcribeInternal(
   }
   if (requestedInfo & smtk::model::SESSION_TESSELLATION)
   {
-    if (this->addTessellation(entity, handle))
+    if (this->loadBlock(handle) && this->addTessellation(entity, handle))
       actual |= smtk::model::SESSION_TESSELLATION;
   }
   if (requestedInfo & smtk::model::SESSION_PROPERTIES)
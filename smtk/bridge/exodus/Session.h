@@ -24,9 +24,13 @@
 #include "vtkNew.h"
 #include "vtkSmartPointer.h"
 
+#include <atomic>
 #include <map>
+#include <mutex>
+#include <thread>
 #include <vector>
 
+class vtkExodusIIReader;
 class vtkInformationDoubleKey;
 class vtkInformationIntegerKey;
 class vtkInformationStringKey;
@@ -121,6 +125,13 @@ typedef std::vector<EntityHandle> EntityHandleArray;
   * This session uses the VTK Exodus reader to obtain
   * information from Exodus files, with each element block,
   * side set, and node set represented as a vtkUnstructuredGrid.
+  *
+  * When a model is read lazily, each leaf dataset starts out as an
+  * empty placeholder carrying only the block metadata (name, pedigree,
+  * dimension, and UUID). The geometry of a block is read from the file
+  * the first time its tessellation is transcribed. Blocks that have not
+  * been touched yet may be read ahead of time on a background thread
+  * (see prefetchBlocks()).
   */
 class SMTKEXODUSSESSION_EXPORT Session : public smtk::model::Session
 {
@@ -155,11 +166,28 @@ public:
   static vtkInformationObjectBaseVectorKey* SMTK_CHILDREN();
   static vtkInformationDoubleKey* SMTK_LABEL_VALUE();
 
-  smtk::model::Model addModel(vtkSmartPointer<vtkMultiBlockDataSet>& model);
+  smtk::model::Model addModel(vtkSmartPointer<vtkMultiBlockDataSet>& model, bool lazy = false);
+
+  void addLazyBlock(
+    vtkDataObject* placeholder, vtkExodusIIReader* reader, int objectType, int objectIndex);
+  bool isBlockLoaded(const smtk::model::EntityRef& entity);
+  size_t numberOfUnloadedBlocks();
+  void prefetchBlocks();
+  void cancelPrefetch();
 
   std::string defaultFileExtension(const smtk::model::Model& model) const override;
 
 protected:
+  /// Where to find the geometry of a block that has not been read yet.
+  struct LazyBlock
+  {
+    vtkSmartPointer<vtkExodusIIReader> m_reader; //!< A reader whose metadata is up to date.
+    int m_objectType;                            //!< A vtkExodusIIReader::ObjectType value.
+    int m_objectIndex;                           //!< The index of the block among its type.
+    vtkSmartPointer<vtkDataObject> m_data;       //!< Geometry read ahead of time (or NULL).
+  };
+  typedef std::map<vtkDataObject*, LazyBlock> LazyBlockMap_t;
+
   friend class Operator;
   friend class ReadOperator;
   friend class SessionIOJSON;
@@ -177,7 +205,15 @@ protected:
   // std::map<EntityHandle,smtk::model::EntityRef> m_fwdIdMap; // not needed; store UUID in vtkInformation.
   // -- 1 --
 
+  LazyBlockMap_t m_lazyBlocks; // Placeholders whose geometry has not been installed yet.
+  std::mutex m_lazyMutex;      // Guards m_lazyBlocks and the readers it references.
+  std::thread m_prefetchThread;
+  std::atomic<bool> m_stopPrefetch;
+
   bool addTessellation(const smtk::model::EntityRef&, const EntityHandle&);
+  bool loadBlock(const EntityHandle& handle);
+  static vtkSmartPointer<vtkDataObject> readLazyBlock(const LazyBlock& block);
+  void prefetchWorker();
 
   size_t numberOfModels() const;
   vtkDataObject* modelOfHandle(const EntityHandle& h) const;
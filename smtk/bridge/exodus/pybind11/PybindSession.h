@@ -83,8 +83,9 @@ PySharedPtrClass< smtk::bridge::exodus::Session, smtk::model::Session > pybind11
     .def_static("SMTK_PEDIGREE", &smtk::bridge::exodus::Session::SMTK_PEDIGREE)
     .def_static("SMTK_UUID_KEY", &smtk::bridge::exodus::Session::SMTK_UUID_KEY)
     .def_static("SMTK_VISIBILITY", &smtk::bridge::exodus::Session::SMTK_VISIBILITY)
-    .def("addModel", &smtk::bridge::exodus::Session::addModel, py::arg("model"))
+    .def("addModel", &smtk::bridge::exodus::Session::addModel, py::arg("model"), py::arg("lazy") = false)
     .def("allSupportedInformation", &smtk::bridge::exodus::Session::allSupportedInformation)
+    .def("cancelPrefetch", &smtk::bridge::exodus::Session::cancelPrefetch)
     .def("className", &smtk::bridge::exodus::Session::className)
     .def("classname", &smtk::bridge::exodus::Session::classname)
     .def_static("create", (std::shared_ptr<smtk::bridge::exodus::Session> (*)()) &smtk::bridge::exodus::Session::create)
@@ -92,7 +93,10 @@ PySharedPtrClass< smtk::bridge::exodus::Session, smtk::model::Session > pybind11
     // .def("findOperatorConstructor", &smtk::bridge::exodus::Session::findOperatorConstructor, py::arg("opName"))
     .def("findOperatorXML", &smtk::bridge::exodus::Session::findOperatorXML, py::arg("opName"))
     .def("inheritsOperators", &smtk::bridge::exodus::Session::inheritsOperators)
+    .def("isBlockLoaded", &smtk::bridge::exodus::Session::isBlockLoaded, py::arg("entity"))
     .def("name", &smtk::bridge::exodus::Session::name)
+    .def("numberOfUnloadedBlocks", &smtk::bridge::exodus::Session::numberOfUnloadedBlocks)
+    .def("prefetchBlocks", &smtk::bridge::exodus::Session::prefetchBlocks)
     .def("registerOperator", &smtk::bridge::exodus::Session::registerOperator, py::arg("opName"), py::arg("opDescrXML"), py::arg("opCtor"))
     .def_static("registerStaticOperator", &smtk::bridge::exodus::Session::registerStaticOperator, py::arg("opName"), py::arg("opDescrXML"), py::arg("opCtor"))
     .def("shared_from_this", (std::shared_ptr<const smtk::bridge::exodus::Session> (smtk::bridge::exodus::Session::*)() const) &smtk::bridge::exodus::Session::shared_from_this)
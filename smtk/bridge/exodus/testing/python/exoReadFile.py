@@ -139,6 +139,36 @@ class TestExodusSession(smtk.testing.TestCase):
                 self.haveVTKExtension(),
                 'Could not import vtk. Python path is {pp}'.format(pp=sys.path))
 
+    def testLazyRead(self):
+        sref = GetActiveSession()
+        rdr = sref.op('read')
+        rdr.findAsFile('filename').setValue(0, self.filename)
+        rdr.findVoid('lazy loading', int(
+            smtk.attribute.ALL_CHILDREN)).setIsEnabled(True)
+        res = rdr.operate()
+        self.assertEqual(res.findInt('outcome').value(0),
+                         smtk.model.OPERATION_SUCCEEDED, 'Lazy read failed.')
+        model = smtk.model.Model(res.findModelEntity('created').value(0))
+
+        # Block metadata is present even though no geometry has been read.
+        allCells = model.cells()
+        self.assertEqual(len(allCells), 11,
+                         'Expected 11 cells, found %d' % len(allCells))
+        sess = sref.session()
+        self.assertEqual(sess.numberOfUnloadedBlocks(), 11,
+                         'Expected all blocks to be unloaded.')
+        self.assertTrue(all([x.hasTessellation() is None for x in allCells]),
+                        'Lazy cells should not be tessellated until requested.')
+
+        # Requesting a tessellation reads exactly that block.
+        cell = allCells[0]
+        sess.transcribe(cell, smtk.model.SESSION_TESSELLATION)
+        self.assertTrue(sess.isBlockLoaded(cell), 'Block was not loaded.')
+        self.assertIsNotNone(cell.hasTessellation(),
+                             'Block was not tessellated on demand.')
+        self.assertEqual(sess.numberOfUnloadedBlocks(), 10,
+                         'Expected only one block to be loaded.')
+
 
 if __name__ == '__main__':
     smtk.testing.process_arguments()
@@ -57,7 +57,8 @@ smtk::model::OperatorResult EulerCharacteristicRatio::operateInternal()
   smtk::mesh::MeshSet mesh = collection->meshes();
 
   // Compute the Euler characteristics for the model's boundary and volume.
-  int eulerBoundary = smtk::mesh::utility::eulerCharacteristic(mesh.extractShell());
+  // Neither computation adds shell or adjacency cells to the collection.
+  int eulerBoundary = smtk::mesh::utility::boundaryEulerCharacteristic(mesh);
   int eulerVolume = smtk::mesh::utility::eulerCharacteristic(mesh);
 
   // Compute the ratio of these two values.
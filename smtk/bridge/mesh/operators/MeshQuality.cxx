@@ -0,0 +1,118 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/bridge/mesh/operators/MeshQuality.h"
+
+#include "smtk/bridge/mesh/Session.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/DoubleItem.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/MeshItem.h"
+#include "smtk/attribute/ModelEntityItem.h"
+#include "smtk/attribute/StringItem.h"
+
+#include "smtk/common/CompilerInformation.h"
+
+#include "smtk/mesh/core/Collection.h"
+#include "smtk/mesh/core/Manager.h"
+#include "smtk/mesh/utility/CellQuality.h"
+
+#include "smtk/model/Model.h"
+
+#include <algorithm>
+
+using namespace smtk::model;
+using namespace smtk::common;
+
+namespace smtk
+{
+namespace bridge
+{
+namespace mesh
+{
+
+smtk::model::OperatorResult MeshQuality::operateInternal()
+{
+  // Access the associated model.
+  smtk::model::Model model =
+    this->specification()->associatedModelEntities<smtk::model::Models>()[0];
+  if (!model.isValid())
+  {
+    smtkErrorMacro(this->log(), "Invalid model.");
+    return this->createResult(smtk::operation::Operator::OPERATION_FAILED);
+  }
+
+  // Access the underlying mesh collection for the model.
+  smtk::mesh::CollectionPtr collection =
+    this->session()->meshManager()->findCollection(model.entity())->second;
+  if (!collection->isValid())
+  {
+    smtkErrorMacro(this->log(), "No collection associated with this model.");
+    return this->createResult(smtk::operation::Operator::OPERATION_FAILED);
+  }
+
+  // Map the requested metric name onto a metric.
+  std::string metricName = this->findString("metric")->value();
+  int metric = 0;
+  for (; metric < smtk::mesh::utility::CellQualityMetric_MAX; ++metric)
+  {
+    if (smtk::mesh::utility::cellQualityMetricName(
+          static_cast<smtk::mesh::utility::CellQualityMetric>(metric)) == metricName)
+    {
+      break;
+    }
+  }
+  if (metric == smtk::mesh::utility::CellQualityMetric_MAX)
+  {
+    smtkErrorMacro(this->log(), "Unknown quality metric \"" << metricName << "\".");
+    return this->createResult(smtk::operation::Operator::OPERATION_FAILED);
+  }
+  int numberOfBins = this->findInt("number of bins")->value();
+
+  // Compute the metric for every cell, storing it as a cell field.
+  smtk::mesh::MeshSet mesh = collection->meshes();
+  std::vector<smtk::mesh::utility::CellQualityMetric> metrics(
+    1, static_cast<smtk::mesh::utility::CellQualityMetric>(metric));
+  std::vector<smtk::mesh::utility::CellQualityHistogram> histograms;
+  smtk::mesh::utility::computeCellQuality(
+    mesh, metrics, &histograms, static_cast<std::size_t>(std::max(numberOfBins, 1)));
+  const smtk::mesh::utility::CellQualityHistogram& hist(histograms[0]);
+
+  smtk::model::OperatorResult result =
+    this->createResult(smtk::operation::Operator::OPERATION_SUCCEEDED);
+  result->findDouble("minimum")->setValue(hist.minimum);
+  result->findDouble("maximum")->setValue(hist.maximum);
+  result->findDouble("mean")->setValue(hist.mean);
+  result->findInt("number of cells")->setValue(static_cast<int>(hist.numberOfCells));
+  smtk::attribute::IntItemPtr binItem = result->findInt("histogram");
+  binItem->setNumberOfValues(hist.bins.size());
+  for (std::size_t i = 0; i < hist.bins.size(); ++i)
+  {
+    binItem->setValue(i, static_cast<int>(hist.bins[i]));
+  }
+  smtk::attribute::MeshItem::Ptr modifiedMeshes = result->findMesh("mesh_modified");
+  modifiedMeshes->appendValue(mesh);
+
+  std::stringstream s;
+  s << "Computed " << metricName << " of " << hist.numberOfCells << " cells: minimum "
+    << hist.minimum << ", mean " << hist.mean << ", maximum " << hist.maximum << ".";
+  smtkInfoMacro(this->log(), s.str());
+
+  return result;
+}
+
+} // namespace mesh
+} // namespace bridge
+} // namespace smtk
+
+#include "smtk/bridge/mesh/MeshQuality_xml.h"
+
+smtkImplementsModelOperator(SMTKMESHSESSION_EXPORT, smtk::bridge::mesh::MeshQuality, mesh_quality,
+  "mesh quality", MeshQuality_xml, smtk::bridge::mesh::Session);
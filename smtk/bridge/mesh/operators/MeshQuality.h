@@ -0,0 +1,43 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef __smtk_bridge_mesh_MeshQuality_h
+#define __smtk_bridge_mesh_MeshQuality_h
+
+#include "smtk/bridge/mesh/Operator.h"
+
+namespace smtk
+{
+namespace bridge
+{
+namespace mesh
+{
+
+/**\brief Compute a per-cell quality metric for a model's mesh tessellation.
+
+   The metric is stored as a cell field (named after the metric) on the
+   model's meshes and summarized by a histogram in the operator result.
+  */
+class SMTKMESHSESSION_EXPORT MeshQuality : public Operator
+{
+public:
+  smtkTypeMacro(MeshQuality);
+  smtkCreateMacro(MeshQuality);
+  smtkSharedFromThisMacro(Operator);
+  smtkDeclareModelOperator();
+
+protected:
+  smtk::model::OperatorResult operateInternal() override;
+};
+
+} // namespace mesh
+} // namespace bridge
+} // namespace smtk
+
+#endif // __smtk_bridge_mesh_MeshQuality_h
@@ -1019,6 +1019,218 @@ model::Edge pmodel::createModelEdgeFromVertices(
   return created;
 }
 
+/**\brief Create model edges from a batch of point sequences.
+  *
+  * The \a coords vector holds \a numCoordsPerPt coordinates for each point
+  * of every sequence, one sequence after another; \a pointsPerSequence
+  * holds the number of points in each sequence.
+  * Every sequence whose first and last points differ gets model vertices at
+  * its endpoints. The segments of all the sequences are then intersected
+  * with one another in a single pass; intersection points (and points
+  * where a sequence passes through a model vertex) become model vertices
+  * that split the sequence into several edges.
+  *
+  * On output, \a created holds the edges made from each sequence and
+  * \a newVerts holds the model vertices bounding the new edges.
+  * False is returned if any sequence could not be turned into edges;
+  * the remaining sequences are still processed.
+  */
+bool pmodel::createModelEdgesFromPointSequences(smtk::model::ManagerPtr mgr,
+  const std::vector<double>& coords, int numCoordsPerPt,
+  const std::vector<std::size_t>& pointsPerSequence, std::vector<smtk::model::Edges>& created,
+  smtk::model::VertexSet& newVerts)
+{
+  bool ok = true;
+  std::size_t numSequences = pointsPerSequence.size();
+  created.clear();
+  created.resize(numSequences);
+
+  // Project every point and collect the segments of all the sequences,
+  // remembering which segments belong to which sequence.
+  std::vector<Segment> segments;
+  segments.reserve(coords.size() / numCoordsPerPt);
+  std::vector<std::size_t> firstSegment(numSequences + 1, 0);
+  std::vector<bool> isPeriodic(numSequences, true);
+  std::vector<Point> endpoints;
+  std::vector<double>::const_iterator cit = coords.begin();
+  for (std::size_t seq = 0; seq < numSequences; ++seq)
+  {
+    firstSegment[seq] = segments.size();
+    Point curr;
+    Point prev;
+    Point orig;
+    for (std::size_t pp = 0; pp < pointsPerSequence[seq]; ++pp, cit += numCoordsPerPt)
+    {
+      curr = this->projectPoint(cit, cit + numCoordsPerPt);
+      if (pp == 0)
+      {
+        orig = curr;
+      }
+      else if (curr != prev)
+      {
+        segments.push_back(Segment(prev, curr));
+      }
+      prev = curr;
+    }
+    if (pointsPerSequence[seq] > 0 && orig != curr)
+    { // non-periodic edges force endpoints to be model vertices
+      isPeriodic[seq] = false;
+      endpoints.push_back(orig);
+      endpoints.push_back(curr);
+    }
+  }
+  firstSegment[numSequences] = segments.size();
+
+  // Snap all the endpoints to model vertices before splitting so that
+  // sequences passing through another's endpoint are split there.
+  for (auto endpoint : endpoints)
+  {
+    this->findOrAddModelVertex(mgr, endpoint);
+  }
+
+  // Intersect all of the segments at once. Results are grouped by input
+  // segment in input order, so each sequence owns a contiguous run of them.
+  SegmentSplitsT result;
+  poly::intersect_segments(result, segments.begin(), segments.end());
+
+  SegmentSplitsT::iterator seqBegin = result.begin();
+  for (std::size_t seq = 0; seq < numSequences; ++seq)
+  {
+    SegmentSplitsT::iterator seqEnd = seqBegin;
+    while (seqEnd != result.end() && seqEnd->first < firstSegment[seq + 1])
+    {
+      ++seqEnd;
+    }
+    if (seqBegin == seqEnd)
+    {
+      smtkErrorMacro(this->m_session->log(), "Self-intersection of edge segments was empty set.");
+      ok = false;
+      continue;
+    }
+
+    // I. Pre-process the intersected segments
+    //
+    // We perform two tasks to prepare the intersection results for
+    // edge creation:
+    //
+    // A. Reordering segments of periodic edges with model vertices
+    // When an edge is periodic (i.e., its first and last points are
+    // identical), it may get split into multiple periodic loops (if
+    // it self-intersects) or it might contain one or more pre-existing
+    // model vertices that split the edge and must serve as endpoints.
+    // In either of these circumstances, if the initial point is not a
+    // model vertex, we would rather not force it to become one; so,
+    // we move the first points that are not model vertices to the end
+    // of the intersection results.
+    //
+    // B. Reorienting inverted segments head-to-tail.
+    // Where an intersection occurs, if any one segment's record is
+    // pointing the wrong direction, all the records for the segment
+    // will be in reverse order; we must both swap the endpoints of those
+    // records and reverse their order so they follow the input sequence.
+    bool edgeIsPeriodic = isPeriodic[seq];
+    SegmentSplitsT::iterator segStart;
+    SegmentSplitsT::iterator segEnd;
+    SegmentSplitsT::iterator firstModelVertex;
+    bool haveFirstModelVertex = false;
+    // Loop over all intersection-output segments by their input segment:
+    for (SegmentSplitsT::iterator sit = seqBegin; sit != seqEnd;)
+    {
+      const Segment& source(segments[sit->first]);
+      std::size_t numSegsPerSrc = 0; // Number of result segs per input segment
+      // Determine whether segments are reversed from the input segment:
+      HighPrecisionPoint deltaSrc =
+        HighPrecisionPoint(static_cast<HighPrecisionPoint::coordinate_type>(
+                             source.high().x() - source.low().x()),
+          static_cast<HighPrecisionPoint::coordinate_type>(source.high().y() - source.low().y()));
+      HighPrecisionPoint deltaDst =
+        HighPrecisionPoint(static_cast<HighPrecisionPoint::coordinate_type>(
+                             sit->second.high().x() - sit->second.low().x()),
+          static_cast<HighPrecisionPoint::coordinate_type>(
+                             sit->second.high().y() - sit->second.low().y()));
+      segStart = sit;
+      if (deltaDst.x() * deltaSrc.x() < 0 || deltaDst.y() * deltaSrc.y() < 0)
+      {
+        for (segEnd = sit; segEnd != seqEnd && segEnd->first == segStart->first; ++segEnd)
+        {
+          Segment flipped(segEnd->second.high(), segEnd->second.low());
+          segEnd->second = flipped;
+          ++numSegsPerSrc;
+        }
+        std::reverse(segStart, segEnd);
+      }
+      else
+      {
+        for (segEnd = segStart; segEnd != seqEnd && segEnd->first == segStart->first; ++segEnd)
+        {
+          ++numSegsPerSrc;
+        }
+      }
+      // If the first point in the first output segment for any input segment is
+      // a model vertex, make a note of it for periodic edges:
+      sit = segStart;
+      if (edgeIsPeriodic && this->pointId(sit->second.low()) && !haveFirstModelVertex)
+      {
+        haveFirstModelVertex = true;
+        firstModelVertex = sit;
+      }
+      // If numSegsPerSrc > 1, we have interior model vertices where intersections occur.
+      // Promote each of those points to model vertices.
+      for (std::size_t i = 1; i < numSegsPerSrc; ++i)
+      {
+        this->findOrAddModelVertex(mgr, sit->second.high());
+        ++sit;
+        if (edgeIsPeriodic && !haveFirstModelVertex)
+        {
+          haveFirstModelVertex = true;
+          firstModelVertex = sit;
+        }
+      }
+      sit = segEnd;
+    }
+    // Move any non-model-vertex points on periodic edges that contain at least
+    // one model vertex to the end of the edge list.
+    if (edgeIsPeriodic && haveFirstModelVertex)
+    {
+      std::rotate(seqBegin, firstModelVertex, seqEnd);
+    }
+
+    // II. Generate edge(s) as required.
+    //
+    // All intersection points have been marked as model vertices
+    // and all segments are now in proper head-to-tail order.
+    // If the edge is periodic and has any model vertices, the
+    // first segment is now guaranteed to start with a model
+    // vertex (and thus the last segment will end with one).
+    segStart = seqBegin;
+    for (SegmentSplitsT::iterator sit = seqBegin; sit != seqEnd;)
+    {
+      bool generateEdge = (this->pointId(sit->second.high()) ? true : false);
+      ++sit;
+      // Does the current segment end with a model vertex?
+      if (generateEdge)
+      { // Generate an edge. segStart->second.low() is guaranteed to be a model vertex.
+        smtk::model::Edge edge = this->createModelEdgeFromSegments(
+          mgr, segStart, sit, true, std::pair<Id, Id>(), false, newVerts);
+        if (edge.isValid())
+        {
+          created[seq].push_back(edge);
+        }
+        segStart = sit;
+      }
+    }
+    // Handle the case when there are no model vertices:
+    if (segStart != seqEnd)
+    {
+      smtk::model::Edge edge = this->createModelEdgeFromSegments(
+        mgr, segStart, seqEnd, true, std::pair<Id, Id>(), false, newVerts);
+      created[seq].push_back(edge);
+    }
+    seqBegin = seqEnd;
+  }
+  return ok;
+}
+
 // TODO: Remove edgeToSplit so that creation can succeed (otherwise
 //       it will fail when trying to insert a coincident edge at the
 //       existing edge endpoints.
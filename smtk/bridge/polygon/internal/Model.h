@@ -76,6 +76,11 @@ public:
   template <typename T>
   std::set<Id> createModelEdgesFromPoints(T begin, T end);
 
+  bool createModelEdgesFromPointSequences(smtk::model::ManagerPtr mgr,
+    const std::vector<double>& coords, int numCoordsPerPt,
+    const std::vector<std::size_t>& pointsPerSequence, std::vector<smtk::model::Edges>& created,
+    smtk::model::VertexSet& newVerts);
+
   bool splitModelEdgeAtPoint(smtk::model::ManagerPtr mgr, const Id& edgeId,
     const std::vector<double>& point, smtk::model::EntityRefArray& created, int debugLevel = 0);
   bool splitModelEdgeAtIndex(smtk::model::ManagerPtr mgr, const Id& edgeId, int splitPointIndex,
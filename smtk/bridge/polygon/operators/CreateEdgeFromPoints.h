@@ -40,6 +40,17 @@ public:
   smtk::model::OperatorResult process(
     std::vector<double>& pnts, int numCoordsPerPoint, smtk::model::Model& parentModel);
 
+  /**\brief Create edges from many sequences of point coordinates at once.
+  *
+  * The coordinates of each sequence follow those of the previous one in
+  * \a pnts; \a numberOfPointsPerEdge holds the number of points in each.
+  * Vertex snapping and intersection are performed once for the whole batch
+  * and a single result holding every created edge is returned, so this is
+  * much faster than calling the single-edge variant for each sequence.
+  */
+  smtk::model::OperatorResult process(const std::vector<double>& pnts, int numCoordsPerPoint,
+    const std::vector<std::size_t>& numberOfPointsPerEdge, smtk::model::Model& parentModel);
+
 protected:
   smtk::model::OperatorResult operateInternal() override;
 };
@@ -42,6 +42,7 @@
 
 #include "smtk/bridge/polygon/CreateFaces_xml.h"
 
+#include <algorithm>
 #include <cmath>
 #include <deque>
 #include <map>
@@ -75,6 +76,253 @@ typedef std::vector<EdgeFragment> FragmentArray; // List of all output fragments
 
 typedef std::vector<std::pair<smtk::model::Edge, bool> > OrientedEdges;
 
+/**\brief Edges gathered by CreateFaces::populateEdgeMapNear().
+  *
+  * This holds the points and bounds of every edge in the model so that
+  * edges may be added to the operator's edge map (which also grows the
+  * bounds of the map) and tested against rays and rectangles cheaply.
+  */
+class NearbyEdges
+{
+public:
+  NearbyEdges(ModelEdgeMap& edgeMap)
+    : m_edgeMap(edgeMap)
+    , m_haveBounds(false)
+  {
+  }
+
+  /// Record the points and bounds of an edge that may be added to the map.
+  void addCandidate(const smtk::model::Edge& edge, const internal::EdgePtr& erec)
+  {
+    if (!erec || erec->pointsSize() < 1)
+    {
+      return;
+    }
+    internal::PointSeq::const_iterator pit = erec->pointsBegin();
+    internal::Rect bds(pit->x(), pit->y(), pit->x(), pit->y());
+    for (++pit; pit != erec->pointsEnd(); ++pit)
+    {
+      poly::encompass(bds, *pit);
+    }
+    this->m_candidates[edge] = std::make_pair(erec, bds);
+  }
+
+  /// Add \a edge to the map, returning false if it is already present or has no points.
+  bool insert(const smtk::model::Edge& edge)
+  {
+    CandidateMap::const_iterator cit = this->m_candidates.find(edge);
+    if (cit == this->m_candidates.end() || this->m_edgeMap.find(edge) != this->m_edgeMap.end())
+    {
+      return false;
+    }
+    this->m_edgeMap[edge] = 0;
+    this->encompass(this->m_bounds, this->m_haveBounds, cit->second.second);
+    return true;
+  }
+
+  /**\brief Add \a seeds and the edges connected to them that may bound a new face.
+    *
+    * An edge that bounds a face on each side cannot be part of a new loop,
+    * so the search does not continue through it.
+    * The bounds of the seeds and the edges added are stored in \a bounds.
+    * Returns false when none of them has any points.
+    */
+  bool insertConnected(const smtk::model::Edges& seeds, internal::Rect& bounds)
+  {
+    bool haveBounds = false;
+    std::deque<smtk::model::Edge> queue(seeds.begin(), seeds.end());
+    std::set<smtk::model::Edge> visited(seeds.begin(), seeds.end());
+    while (!queue.empty())
+    {
+      smtk::model::Edge edge = queue.front();
+      queue.pop_front();
+      CandidateMap::const_iterator cit = this->m_candidates.find(edge);
+      if (cit == this->m_candidates.end())
+      {
+        continue;
+      }
+      this->insert(edge);
+      this->encompass(bounds, haveBounds, cit->second.second);
+      smtk::model::Vertices verts = edge.vertices();
+      for (smtk::model::Vertices::iterator vit = verts.begin(); vit != verts.end(); ++vit)
+      {
+        smtk::model::Edges adjacent = vit->edges();
+        for (smtk::model::Edges::iterator ait = adjacent.begin(); ait != adjacent.end(); ++ait)
+        {
+          if (this->m_edgeMap.find(*ait) == this->m_edgeMap.end() && ait->faces().size() < 2 &&
+            visited.insert(*ait).second)
+          {
+            queue.push_back(*ait);
+          }
+        }
+      }
+    }
+    return haveBounds;
+  }
+
+  /// Add every edge lying inside the bounds of the map.
+  void insertContained()
+  {
+    if (!this->m_haveBounds)
+    {
+      return;
+    }
+    internal::Rect bounds = this->m_bounds;
+    for (CandidateMap::const_iterator cit = this->m_candidates.begin();
+         cit != this->m_candidates.end(); ++cit)
+    {
+      if (poly::contains(bounds, cit->second.second))
+      {
+        this->insert(cit->first);
+      }
+    }
+  }
+
+  /// Return the point of \a edges with the largest x coordinate.
+  internal::Point rightmostPoint(const smtk::model::Edges& edges) const
+  {
+    internal::Point result;
+    bool haveResult = false;
+    for (smtk::model::Edges::const_iterator it = edges.begin(); it != edges.end(); ++it)
+    {
+      CandidateMap::const_iterator cit = this->m_candidates.find(*it);
+      if (cit == this->m_candidates.end())
+      {
+        continue;
+      }
+      const internal::EdgePtr& erec(cit->second.first);
+      for (internal::PointSeq::const_iterator pit = erec->pointsBegin(); pit != erec->pointsEnd();
+           ++pit)
+      {
+        if (!haveResult || pit->x() > result.x())
+        {
+          result = *pit;
+          haveResult = true;
+        }
+      }
+    }
+    return result;
+  }
+
+  /**\brief Find the edge not yet in the map that a ray cast from \a origin along +x hits first.
+    *
+    * Returns false if the ray hits no such edge.
+    */
+  bool nearestCrossing(const internal::Point& origin, smtk::model::Edge& hit) const
+  {
+    bool found = false;
+    double nearest = 0.0;
+    std::vector<double> xs;
+    for (CandidateMap::const_iterator cit = this->m_candidates.begin();
+         cit != this->m_candidates.end(); ++cit)
+    {
+      if (this->m_edgeMap.find(cit->first) != this->m_edgeMap.end())
+      {
+        continue;
+      }
+      xs.clear();
+      crossings(cit->second, origin, xs);
+      for (std::vector<double>::const_iterator xit = xs.begin(); xit != xs.end(); ++xit)
+      {
+        if (!found || *xit < nearest)
+        {
+          nearest = *xit;
+          hit = cit->first;
+          found = true;
+        }
+      }
+    }
+    return found;
+  }
+
+  /// Add the existing faces bounded by any edge a ray cast from \a origin along +x hits.
+  void crossedFaces(const internal::Point& origin, std::set<smtk::model::Face>& faces) const
+  {
+    std::vector<double> xs;
+    for (CandidateMap::const_iterator cit = this->m_candidates.begin();
+         cit != this->m_candidates.end(); ++cit)
+    {
+      xs.clear();
+      crossings(cit->second, origin, xs);
+      if (!xs.empty())
+      {
+        smtk::model::Faces bounded = cit->first.faces();
+        faces.insert(bounded.begin(), bounded.end());
+      }
+    }
+  }
+
+  /// Return true when \a pt lies inside \a face, i.e., when the face's boundary
+  /// crosses the ray cast from \a pt along +x an odd number of times.
+  bool contains(const smtk::model::Face& face, const internal::Point& pt) const
+  {
+    std::size_t count = 0;
+    std::vector<double> xs;
+    smtk::model::Edges edges = face.edges();
+    std::set<smtk::model::Edge> unique(edges.begin(), edges.end());
+    for (std::set<smtk::model::Edge>::const_iterator eit = unique.begin(); eit != unique.end();
+         ++eit)
+    {
+      CandidateMap::const_iterator cit = this->m_candidates.find(*eit);
+      if (cit != this->m_candidates.end())
+      {
+        xs.clear();
+        crossings(cit->second, pt, xs);
+        count += xs.size();
+      }
+    }
+    return count % 2 == 1;
+  }
+
+protected:
+  typedef std::map<smtk::model::Edge, std::pair<internal::EdgePtr, internal::Rect> > CandidateMap;
+
+  /// Append the x coordinates where an edge crosses the ray cast from \a origin along +x.
+  static void crossings(const std::pair<internal::EdgePtr, internal::Rect>& candidate,
+    const internal::Point& origin, std::vector<double>& xs)
+  {
+    const internal::Rect& bds(candidate.second);
+    if (poly::xh(bds) <= origin.x() || poly::yl(bds) > origin.y() || poly::yh(bds) < origin.y())
+    {
+      return;
+    }
+    internal::PointSeq::const_iterator pit = candidate.first->pointsBegin();
+    internal::Point last = *pit;
+    for (++pit; pit != candidate.first->pointsEnd(); last = *pit, ++pit)
+    {
+      // Count each segment crossing the line y = origin.y() once (half-open in y).
+      if ((last.y() <= origin.y()) == (pit->y() <= origin.y()))
+      {
+        continue;
+      }
+      double t = static_cast<double>(origin.y() - last.y()) / (pit->y() - last.y());
+      double x = last.x() + t * (pit->x() - last.x());
+      if (x > origin.x())
+      {
+        xs.push_back(x);
+      }
+    }
+  }
+
+  static void encompass(internal::Rect& bounds, bool& haveBounds, const internal::Rect& other)
+  {
+    if (haveBounds)
+    {
+      poly::encompass(bounds, other);
+    }
+    else
+    {
+      bounds = other;
+      haveBounds = true;
+    }
+  }
+
+  ModelEdgeMap& m_edgeMap;
+  CandidateMap m_candidates;
+  internal::Rect m_bounds;
+  bool m_haveBounds;
+};
+
 static void DumpEventQueue(const char* msg, SweepEventSet& eventQueue)
 {
   std::cout << ">>>>>   " << msg << "\n";
@@ -120,20 +368,147 @@ bool CreateFaces::populateEdgeMap()
     return false;
   }
   this->m_model = model;
+  this->m_replacedFaces.clear();
 
   // Collect all the edges in this model, not just the free cells:
   smtk::model::Edges allEdges =
     model.manager()->entitiesMatchingFlagsAs<smtk::model::Edges>(smtk::model::EDGE, true);
+  smtk::model::Edges modelEdges;
   for (smtk::model::Edges::const_iterator it = allEdges.begin(); it != allEdges.end(); ++it)
   {
     if (it->owningModel() == model)
     {
-      this->m_edgeMap[*it] = 0;
+      modelEdges.push_back(*it);
+    }
+  }
+
+  // When asked to, only sweep the neighborhood of edges that have changed.
+  smtk::attribute::ModelEntityItem::Ptr changedItem = this->findModelEntity("changed edges");
+  if (changedItem && changedItem->isEnabled() && changedItem->numberOfValues() > 0)
+  {
+    smtk::model::Edges changed;
+    for (std::size_t i = 0; i < changedItem->numberOfValues(); ++i)
+    {
+      smtk::model::Edge edge(changedItem->value(i));
+      if (edge.isValid() && edge.owningModel() == model)
+      {
+        changed.push_back(edge);
+      }
     }
+    this->populateEdgeMapNear(changed, modelEdges);
+    return true;
+  }
+
+  for (smtk::model::Edges::const_iterator it = modelEdges.begin(); it != modelEdges.end(); ++it)
+  {
+    this->m_edgeMap[*it] = 0;
   }
   return true;
 }
 
+/**\brief Populate the edge map with only the edges near some \a changed edges.
+  *
+  * Any face that is new because of the changed edges has a changed edge
+  * on its boundary (or in one of its inner loops), so the edges swept are
+  * + the changed edges and the edges connected to them through model
+  *   vertices, stopping at edges that already bound a face on each side
+  *   (since those cannot be part of a new loop);
+  * + the loop that most closely encloses those, found by casting a ray
+  *   from their rightmost point, so that a new face bounded by it holds
+  *   the changed edges as an inner loop;
+  * + any edges (from \a candidates) inside the bounds of the above, which
+  *   may be inner loops of new faces; and
+  * + the outer and inner loops of existing faces that touch a changed edge
+  *   or hold one in their interior.
+  *
+  * Those existing faces are recorded in this->m_replacedFaces; they are
+  * deleted before the sweep, which creates the faces replacing them.
+  * Loops elsewhere in the model are neither visited nor modified.
+  */
+void CreateFaces::populateEdgeMapNear(
+  const smtk::model::Edges& changed, const smtk::model::Edges& candidates)
+{
+  NearbyEdges nearby(this->m_edgeMap);
+  for (smtk::model::Edges::const_iterator it = candidates.begin(); it != candidates.end(); ++it)
+  {
+    nearby.addCandidate(*it, this->findStorage<internal::edge>(it->entity()));
+  }
+
+  // The changed edges and the edges that could close loops with them.
+  internal::Rect changedBounds;
+  if (!nearby.insertConnected(changed, changedBounds))
+  {
+    return;
+  }
+
+  // Walk right from the changed edges until the edges hit enclose them.
+  internal::Point origin = nearby.rightmostPoint(changed);
+  smtk::model::Edge hit;
+  while (nearby.nearestCrossing(origin, hit) && hit.faces().size() < 2)
+  {
+    internal::Rect hitBounds;
+    nearby.insertConnected(smtk::model::Edges(1, hit), hitBounds);
+    if (poly::contains(hitBounds, changedBounds))
+    {
+      break;
+    }
+    origin.x(poly::xh(hitBounds));
+  }
+
+  // Edges inside the bounds may be inner loops of new faces.
+  nearby.insertContained();
+
+  // Existing faces that touch a changed edge or hold one in their interior
+  // are replaced, so their outer and inner loops are swept as well.
+  std::set<smtk::model::Face> touching;
+  for (smtk::model::Edges::const_iterator it = changed.begin(); it != changed.end(); ++it)
+  {
+    smtk::model::Faces faces = it->faces();
+    touching.insert(faces.begin(), faces.end());
+    smtk::model::Vertices verts = it->vertices();
+    for (smtk::model::Vertices::iterator vit = verts.begin(); vit != verts.end(); ++vit)
+    {
+      smtk::model::Edges adjacent = vit->edges();
+      for (smtk::model::Edges::iterator ait = adjacent.begin(); ait != adjacent.end(); ++ait)
+      {
+        faces = ait->faces();
+        touching.insert(faces.begin(), faces.end());
+      }
+    }
+    internal::EdgePtr erec = this->findStorage<internal::edge>(it->entity());
+    if (erec && erec->pointsSize() > 0)
+    {
+      std::set<smtk::model::Face> crossed;
+      nearby.crossedFaces(*erec->pointsBegin(), crossed);
+      for (std::set<smtk::model::Face>::const_iterator fit = crossed.begin(); fit != crossed.end();
+           ++fit)
+      {
+        if (nearby.contains(*fit, *erec->pointsBegin()))
+        {
+          touching.insert(*fit);
+        }
+      }
+    }
+  }
+  for (std::set<smtk::model::Face>::const_iterator fit = touching.begin(); fit != touching.end();
+       ++fit)
+  {
+    smtk::model::Edges faceEdges = fit->edges();
+    for (smtk::model::Edges::iterator eit = faceEdges.begin(); eit != faceEdges.end(); ++eit)
+    {
+      nearby.insert(*eit);
+    }
+    this->m_replacedFaces.insert(*fit);
+  }
+
+  if (this->m_debugLevel > 0)
+  {
+    smtkDebugMacro(this->log(), "Sweeping " << this->m_edgeMap.size() << " of "
+                                            << candidates.size() << " edges near "
+                                            << changed.size() << " changed edges.");
+  }
+}
+
 smtk::model::OperatorResult CreateFaces::operateInternal()
 {
   this->m_debugLevel = 1000;
@@ -178,7 +553,17 @@ smtk::model::OperatorResult CreateFaces::operateInternal()
   //     Merge parent and child UFEs (if applicable)
   //     Add an (edge, coedge sign) tuple to a "face" identified by the given UFE
   // FIXME: Test for self-intersections?
-  // FIXME: Deal w/ pre-existing faces?
+  //
+  // Loops that already bound a face are skipped by evaluateLoop(). Faces that
+  // changed edges touch or lie inside are deleted here, so that the sweep
+  // can create the faces replacing them from their (now free) edges.
+  smtk::model::EntityRefArray replacedModified;
+  smtk::model::EntityRefArray replacedExpunged;
+  if (!this->m_replacedFaces.empty())
+  {
+    this->polygonSession()->consistentInternalDelete(
+      this->m_replacedFaces, replacedModified, replacedExpunged, this->m_debugLevel > 0);
+  }
 
   // Create an event queue and populate it with events
   // for each segment of each edge in this->m_edgeMap.
@@ -290,11 +675,15 @@ smtk::model::OperatorResult CreateFaces::operateInternal()
   this->m_model = model;
   neighborhood.getLoops(this);
 
-  // Make sure the application knows the model has new faces.
-  if (this->m_result->findModelEntity("created")->numberOfValues() > 0)
+  // Make sure the application knows the model has new (or replaced) faces.
+  if ((this->m_result->findModelEntity("created")->numberOfValues() > 0 ||
+        !replacedExpunged.empty()) &&
+    std::find(replacedModified.begin(), replacedModified.end(), model) == replacedModified.end())
   {
-    this->addEntityToResult(this->m_result, model, MODIFIED);
+    replacedModified.push_back(model);
   }
+  this->addEntitiesToResult(this->m_result, replacedExpunged, EXPUNGED);
+  this->addEntitiesToResult(this->m_result, replacedModified, MODIFIED);
 
   // Finally, tessellate each face using Boost::polygon
   // (although TODO: it would be better to triangulate while sweeping).
@@ -76,6 +76,7 @@ protected:
   friend class Neighborhood;
 
   virtual bool populateEdgeMap();
+  void populateEdgeMapNear(const smtk::model::Edges& changed, const smtk::model::Edges& candidates);
   smtk::model::OperatorResult operateInternal() override;
 
   void evaluateLoop(RegionId faceNumber, OrientedEdges& loop, std::set<RegionId>& borders);
@@ -89,6 +90,7 @@ protected:
   smtk::model::Model m_model;
   smtk::model::OperatorOutcome m_status;
   ModelEdgeMap m_edgeMap;
+  smtk::model::EntityRefs m_replacedFaces; // existing faces to delete and sweep again
   internal::Point m_bdsLo;
   internal::Point m_bdsHi;
 };
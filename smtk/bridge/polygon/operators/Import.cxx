@@ -25,10 +25,12 @@
 #include "smtk/attribute/ModelEntityItem.h"
 #include "smtk/attribute/StringItem.h"
 
+#include "smtk/model/Edge.h"
 #include "smtk/model/Manager.h"
 #include "smtk/model/Model.h"
 #include "smtk/model/Operator.h"
 #include "smtk/model/SessionRef.h"
+#include "smtk/model/Vertex.h"
 
 #include "smtk/extension/vtk/reader/vtkCMBGeometryReader.h"
 #ifdef SMTK_ENABLE_REMUS_SUPPORT
@@ -64,32 +66,6 @@ namespace bridge
 namespace polygon
 {
 
-int polyLines2modelEdges(vtkPolyData* mesh, smtk::model::Operator::Ptr edgeOp,
-  smtk::model::EntityRefArray& createdEds, smtk::attribute::DoubleItem::Ptr pointsItem,
-  vtkIdType* pts, vtkIdType npts, smtk::io::Logger& logger)
-{
-  double p[3];
-  // create edge for current line cell
-  pointsItem->setNumberOfValues(npts * 3);
-  for (vtkIdType j = 0; j < npts; ++j)
-  {
-    mesh->GetPoint(pts[j], p);
-    for (int i = 0; i < 3; ++i)
-    {
-      pointsItem->setValue(3 * j + i, p[i]);
-    }
-  }
-  OperatorResult edgeResult = edgeOp->operate();
-  if (edgeResult->findInt("outcome")->value() != Import::OPERATION_SUCCEEDED)
-  {
-    smtkDebugMacro(logger, "\"create edge\" op failed to creat edge with given line cells.");
-    return 0;
-  }
-  smtk::attribute::ModelEntityItem::Ptr newEdges = edgeResult->findModelEntity("created");
-  createdEds.insert(createdEds.end(), newEdges->begin(), newEdges->end());
-  return static_cast<int>(newEdges->numberOfValues());
-}
-
 int Import::taggedPolyData2PolygonModelEntities(
   vtkIdTypeArray* tagInfo, vtkPolyData* pdata, smtk::model::Model& model)
 {
@@ -144,6 +120,8 @@ int Import::taggedPolyData2PolygonModelEntities(
   n = lines->GetNumberOfCells();
   pcoords.clear();
   pcoords.reserve((n + 1) * 3);
+  // Gather the points of every model edge so they can all be created at once.
+  std::vector<std::size_t> pointsPerEdge;
 
   for (cellId = linesOffset, lines->SetTraversalLocation(0); lines->GetNextCell(npts, pts);
        cellId++)
@@ -154,15 +132,8 @@ int Import::taggedPolyData2PolygonModelEntities(
       smtkErrorMacro(this->log(), "Encountered Line Cell with " << npts << " points!");
     }
     // Is this a new edge? - in that case we need to use both points
-    if (pcoords.empty() || (currentEdgeTag != tagInfo->GetValue(cellId)))
+    if (pointsPerEdge.empty() || (currentEdgeTag != tagInfo->GetValue(cellId)))
     {
-      // Were we walking a model edge already?
-      if (pcoords.size())
-      {
-        createEdgeOp->process(pcoords, 3, model);
-        numEnts++;
-      }
-      pcoords.clear();
       for (int j = 0; j < 2; j++)
       {
         points->GetPoint(pts[j], pnt);
@@ -170,6 +141,7 @@ int Import::taggedPolyData2PolygonModelEntities(
         pcoords.push_back(pnt[1]);
         pcoords.push_back(pnt[2]);
       }
+      pointsPerEdge.push_back(2);
       currentEdgeTag = tagInfo->GetValue(cellId);
       lastPointId = pts[1];
       continue;
@@ -183,12 +155,13 @@ int Import::taggedPolyData2PolygonModelEntities(
     pcoords.push_back(pnt[0]);
     pcoords.push_back(pnt[1]);
     pcoords.push_back(pnt[2]);
+    ++pointsPerEdge.back();
     lastPointId = pts[1];
   }
-  if (pcoords.size())
+  if (!pointsPerEdge.empty())
   {
-    createEdgeOp->process(pcoords, 3, model);
-    numEnts++;
+    createEdgeOp->process(pcoords, 3, pointsPerEdge, model);
+    numEnts += static_cast<int>(pointsPerEdge.size());
   }
 
   return numEnts;
@@ -220,40 +193,39 @@ int Import::basicPolyData2PolygonModelEntities(vtkPolyData* polyLines, smtk::mod
     return numEnts;
   }
   n = lines->GetNumberOfCells();
+  // Gather the points of every polyline so their edges can all be created at once.
+  std::vector<std::size_t> pointsPerEdge;
+  pointsPerEdge.reserve(n);
+  pcoords.reserve(3 * points->GetNumberOfPoints());
 
   for (cellId = 0, lines->SetTraversalLocation(0); lines->GetNextCell(npts, pts); cellId++)
   {
-    pcoords.clear();
-    pcoords.resize(npts * 3);
-    for (j = 0, i = 0; i < npts; i++)
+    j = static_cast<vtkIdType>(pcoords.size());
+    pcoords.resize(pcoords.size() + npts * 3);
+    for (i = 0; i < npts; i++)
     {
       points->GetPoint(pts[i], pnt);
       pcoords[j++] = pnt[0];
       pcoords[j++] = pnt[1];
       pcoords[j++] = pnt[2];
     }
-    createEdgeOp->process(pcoords, 3, model);
+    pointsPerEdge.push_back(static_cast<std::size_t>(npts));
     numEnts++;
   }
+  if (!pointsPerEdge.empty())
+  {
+    createEdgeOp->process(pcoords, 3, pointsPerEdge, model);
+  }
   return numEnts;
 }
 
 int polyLines2modelEdgesAndFaces(vtkPolyData* mesh, smtk::model::Model& model,
-  smtk::bridge::polygon::SessionPtr sess, smtk::io::Logger& logger)
+  smtk::bridge::polygon::SessionPtr sess, internal::pmodel::Ptr storage, smtk::io::Logger& logger)
 {
   int numEdges = 0;
   vtkCellArray* lines = mesh->GetLines();
   if (lines)
   {
-    smtk::model::Operator::Ptr edgeOp = sess->op("create edge");
-    smtk::attribute::AttributePtr spec = edgeOp->specification();
-    spec->associateEntity(model);
-    smtk::attribute::IntItem::Ptr constructMethod = spec->findInt("construction method");
-    constructMethod->setDiscreteIndex(0); // "points coornidates"
-    smtk::attribute::IntItem::Ptr numCoords = spec->findInt("coordinates");
-    numCoords->setValue(3); // number of elements in coordinates
-    smtk::attribute::DoubleItem::Ptr pointsItem = spec->findDouble("points");
-
     smtk::model::Operator::Ptr faceOp = sess->op("force create face");
     smtk::attribute::AttributePtr faceSpec = faceOp->specification();
     faceSpec->findInt("construction method")->setDiscreteIndex(1); // "edges"
@@ -264,68 +236,102 @@ int polyLines2modelEdgesAndFaces(vtkPolyData* mesh, smtk::model::Model& model,
     vtkIdType numPedIDs = pedigreeIds ? pedigreeIds->GetNumberOfTuples() : 0;
     vtkIdType* pedigree =
       numPedIDs == lines->GetNumberOfCells() && pedigreeIds ? pedigreeIds->GetPointer(0) : NULL;
-    /*
-    std::cout << "number of line cells: " << lines->GetNumberOfCells() << std::endl;
-    if(pedigreeIds)
-      {
-      std::cout << "number of pedigreeIds: " << numPedIDs << std::endl;
-      }
-*/
-    vtkIdType pidx = 0;
+
     vtkIdType *pts, npts;
-    for (lines->SetTraversalLocation(0); lines->GetNextCell(npts, pts); ++pidx)
+    double pnt[3];
+    vtkIdType pidx = 0;
+    for (lines->SetTraversalLocation(0); lines->GetNextCell(npts, pts);)
     {
-      std::vector<int>
-        counts; // how many edges make up the outer loop, how many inner loops are there and how many edges for each?
+      // Consecutive line cells with the same pedigree id are the outer loop
+      // and the inner loops of one face. The loops of each face are split
+      // against each other in one pass, but not against other faces' loops,
+      // so that neighboring faces each keep their own boundary.
+      vtkIdType pedId = pedigree ? pedigree[pidx] : -1;
+      std::vector<double> pcoords;
+      std::vector<std::size_t> pointsPerLoop;
+      for (;;)
+      {
+        for (vtkIdType j = 0; j < npts; ++j)
+        {
+          mesh->GetPoint(pts[j], pnt);
+          pcoords.insert(pcoords.end(), pnt, pnt + 3);
+        }
+        pointsPerLoop.push_back(static_cast<std::size_t>(npts));
+        ++pidx;
+        if (!pedigree || pidx >= numPedIDs || pedigree[pidx] != pedId ||
+          !lines->GetNextCell(npts, pts))
+        {
+          break;
+        }
+      }
+
+      std::vector<smtk::model::Edges> edgesPerLoop;
+      smtk::model::VertexSet newVerts;
+      if (!storage->createModelEdgesFromPointSequences(
+            sess->manager(), pcoords, 3, pointsPerLoop, edgesPerLoop, newVerts))
+      {
+        smtkDebugMacro(logger, "Failed to create edges for some line cells.");
+      }
+
+      // A loop may be split into several edges where it touches itself, another
+      // loop of the face or a model vertex. The edges of each loop run head to
+      // tail along the line cell; inner loops are traversed in reverse.
       smtk::model::EntityRefArray createdEds;
-      // create edge for current line cell
-      int numNewEdges =
-        polyLines2modelEdges(mesh, edgeOp, createdEds, pointsItem, pts, npts, logger);
-
-      counts.push_back(numNewEdges);
-      counts.push_back(0);
-      // peek at next pedigree id if possible, to see if the pedId is the same, if yes,
-      // the next cell is the inner loop
-      vtkIdType pedId = -1;
-      if (pedigree && numNewEdges > 0)
+      std::vector<int> orients;
+      std::vector<int> counts; // edges in the outer loop, number of inner loops, edges in each
+      for (std::size_t loop = 0; loop < edgesPerLoop.size(); ++loop)
       {
-        pedId = pedigree[pidx];
-        //std::cout << "pedid: " << pedId << std::endl;
-        while (pidx < numPedIDs - 1 && pedId == pedigree[pidx + 1])
+        const smtk::model::Edges& loopEdges(edgesPerLoop[loop]);
+        if (loop == 0)
         {
-          // The next line cell is an inner loop
-          if (lines->GetNextCell(npts, pts))
+          if (loopEdges.empty())
           {
-            ++counts[1]; // increment the number of inner loops
-            numNewEdges +=
-              polyLines2modelEdges(mesh, edgeOp, createdEds, pointsItem, pts, npts, logger);
-            counts.push_back(numNewEdges);
+            break; // no outer loop, so no face
           }
-          //std::cout << "inner pedid: " << pedId << std::endl;
-          ++pidx;
+          createdEds.insert(createdEds.end(), loopEdges.begin(), loopEdges.end());
+          orients.resize(createdEds.size(), +1);
+          counts.push_back(static_cast<int>(loopEdges.size()));
+          counts.push_back(0);
         }
-      }
-      if (numNewEdges > 0)
-      {
-        numEdges += numNewEdges;
-        faceSpec->associations()->setValues(createdEds.begin(), createdEds.end());
-        //std::cout << "number of created new edges: " << createdEds.size() << std::endl;
-        smtk::attribute::IntItem::Ptr orientArr = faceSpec->findInt("orientations");
-        std::vector<int> orients(numNewEdges, -1);
-        orients[0] = +1; // first one is outer loop
-        orientArr->setValues(orients.begin(), orients.end());
-        smtk::attribute::IntItem::Ptr countsArr = faceSpec->findInt("counts");
-        countsArr->setValues(counts.begin(), counts.end());
-
-        OperatorResult faceResult = faceOp->operate();
-        if (faceResult->findInt("outcome")->value() != Import::OPERATION_SUCCEEDED)
+        else if (!loopEdges.empty())
         {
-          smtkDebugMacro(logger, "\"force create face\" op failed to creat face with given edges.");
+          createdEds.insert(createdEds.end(), loopEdges.rbegin(), loopEdges.rend());
+          orients.resize(createdEds.size(), -1);
+          ++counts[1];
+          counts.push_back(static_cast<int>(loopEdges.size()));
         }
-        // Add a pedigree ID (if we have it, or -1 otherwise) to each face:
-        faceResult->findModelEntity("created")->value(0).setIntegerProperty("pedigree", pedId);
+      }
+      if (createdEds.empty())
+      {
+        continue;
+      }
+
+      numEdges += static_cast<int>(createdEds.size());
+      faceSpec->associations()->setValues(createdEds.begin(), createdEds.end());
+      faceSpec->findInt("orientations")->setValues(orients.begin(), orients.end());
+      faceSpec->findInt("counts")->setValues(counts.begin(), counts.end());
+
+      OperatorResult faceResult = faceOp->operate();
+      if (faceResult->findInt("outcome")->value() != Import::OPERATION_SUCCEEDED)
+      {
+        smtkDebugMacro(logger, "\"force create face\" op failed to creat face with given edges.");
+        continue;
+      }
+      // Add a pedigree ID (if we have it, or -1 otherwise) to each face:
+      faceResult->findModelEntity("created")->value(0).setIntegerProperty("pedigree", pedId);
+    }
+
+    // Vertices that split loops bound edges, so they are not free cells of the model.
+    smtk::model::Vertices dead;
+    smtk::model::Vertices freeVerts = model.cellsAs<smtk::model::Vertices>();
+    for (auto& vert : freeVerts)
+    {
+      if (!vert.edges().empty())
+      {
+        dead.push_back(vert);
       }
     }
+    model.removeCells(dead);
   }
   return numEdges;
 }
@@ -487,7 +493,8 @@ OperatorResult Import::operateInternal()
   }
   else
   {
-    numEntities = polyLines2modelEdgesAndFaces(polyOutput, model, sess, log());
+    numEntities = polyLines2modelEdgesAndFaces(
+      polyOutput, model, sess, this->findStorage<internal::pmodel>(model.entity()), log());
   }
   smtkDebugMacro(log(), "Number of entities: " << numEntities << "\n");
 
@@ -12,6 +12,7 @@
 #include "smtk/attribute/DoubleItem.h"
 #include "smtk/attribute/GroupItem.h"
 #include "smtk/attribute/IntItem.h"
+#include "smtk/bridge/polygon/operators/CreateEdgeFromPoints.h"
 #include "smtk/common/testing/cxx/helpers.h"
 #include "smtk/model/CellEntity.h"
 #include "smtk/model/Edge.h"
@@ -25,6 +26,71 @@
 namespace
 {
 static const double tolerance = 1.e-5;
+
+smtk::model::Edges edgesOfModel(const smtk::model::Model& model)
+{
+  smtk::model::Edges edges;
+  for (auto& cell : model.cells())
+  {
+    if (smtk::model::isEdge(cell.entityFlags()))
+    {
+      edges.push_back(static_cast<smtk::model::Edge>(cell));
+    }
+  }
+  return edges;
+}
+
+smtk::model::VertexSet verticesOfEdges(const smtk::model::Edges& edges)
+{
+  smtk::model::VertexSet verts;
+  for (auto& edge : edges)
+  {
+    smtk::model::Vertices vertsOnEdge = edge.vertices();
+    verts.insert(vertsOnEdge.begin(), vertsOnEdge.end());
+  }
+  return verts;
+}
+
+// Creating edges from several point sequences at once (as the import
+// operator does) splits the sequences wherever they cross one another.
+void testPointSequences(smtk::model::SessionRef& session)
+{
+  smtk::bridge::polygon::CreateEdgeFromPoints::Ptr op =
+    smtk::dynamic_pointer_cast<smtk::bridge::polygon::CreateEdgeFromPoints>(
+      session.op("create edge from points"));
+  test(op != nullptr, "No create edge from points operator");
+  const std::vector<std::size_t> twoPointsEach{ 2, 2 };
+
+  std::cout << "Creating edges from two sequences that do not cross" << std::endl;
+  smtk::model::Model separate =
+    session.op("create model")->operate()->findModelEntity("created")->value();
+  const std::vector<double> parallel{ 0., 0., 2., 0., 0., 1., 2., 1. };
+  smtk::model::OperatorResult res = op->process(parallel, 2, twoPointsEach, separate);
+  test(res->findInt("outcome")->value() == smtk::operation::Operator::OPERATION_SUCCEEDED,
+    "Could not create edges from sequences that do not cross");
+  smtk::model::Edges edges = edgesOfModel(separate);
+  test(edges.size() == 2, "Sequences that do not cross should each produce one edge");
+  test(verticesOfEdges(edges).size() == 4, "Expected a model vertex at each sequence endpoint");
+
+  std::cout << "Creating edges from two sequences that cross at (1, 1)" << std::endl;
+  smtk::model::Model crossed =
+    session.op("create model")->operate()->findModelEntity("created")->value();
+  const std::vector<double> crossing{ 0., 0., 2., 2., 0., 2., 2., 0. };
+  res = op->process(crossing, 2, twoPointsEach, crossed);
+  test(res->findInt("outcome")->value() == smtk::operation::Operator::OPERATION_SUCCEEDED,
+    "Could not create edges from crossing sequences");
+  edges = edgesOfModel(crossed);
+  test(edges.size() == 4, "Crossing sequences should be split into two edges each");
+  smtk::model::VertexSet verts = verticesOfEdges(edges);
+  test(verts.size() == 5, "Expected a model vertex at the crossing");
+  bool haveCrossing = false;
+  for (auto& vert : verts)
+  {
+    const double* xyz = vert.coordinates();
+    haveCrossing |= std::abs(xyz[0] - 1.0) < tolerance && std::abs(xyz[1] - 1.0) < tolerance;
+  }
+  test(haveCrossing, "No model vertex at the crossing point");
+}
 }
 
 int UnitTestPolygonCreateEdgeFromPoints(int argc, char* argv[])
@@ -93,6 +159,8 @@ int UnitTestPolygonCreateEdgeFromPoints(int argc, char* argv[])
   test(std::abs(verts[1].coordinates()[0] - 0.5) < tolerance, "Incorrect coordinates of vertex");
   test(std::abs(verts[1].coordinates()[1] - 0.5) < tolerance, "Incorrect coordinates of vertex");
 
+  testPointSequences(session);
+
   return 0;
 }
 
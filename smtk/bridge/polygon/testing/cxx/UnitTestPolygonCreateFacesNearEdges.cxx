@@ -0,0 +1,239 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/DoubleItem.h"
+#include "smtk/attribute/GroupItem.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/ModelEntityItem.h"
+#include "smtk/common/testing/cxx/helpers.h"
+#include "smtk/model/Edge.h"
+#include "smtk/model/Face.h"
+#include "smtk/model/FaceUse.h"
+#include "smtk/model/Loop.h"
+#include "smtk/model/Manager.h"
+#include "smtk/model/Model.h"
+#include "smtk/model/Operator.h"
+#include "smtk/model/Session.h"
+
+#include <algorithm>
+
+namespace
+{
+
+// Create the edge(s) along a sequence of \a numPoints 2-D points.
+smtk::model::Edges createEdges(smtk::model::SessionRef& session, const smtk::model::Model& model,
+  const double* points, int numPoints)
+{
+  smtk::model::OperatorPtr op = session.op("create edge from points");
+  test(op != nullptr, "No create edge from points operator");
+  test(op->specification()->associateEntity(model), "Could not associate model");
+  test(op->specification()->findInt("pointGeometry")->setValue(2), "Could not set pointGeometry");
+  smtk::attribute::GroupItem::Ptr pointsInfo = op->specification()->findGroup("2DPoints");
+  test(pointsInfo->setNumberOfGroups(numPoints), "Could not set number of points");
+  for (int i = 0; i < numPoints; ++i)
+  {
+    smtk::attribute::DoubleItemPtr point =
+      smtk::dynamic_pointer_cast<smtk::attribute::DoubleItem>(pointsInfo->find(i, "points"));
+    test(point != nullptr, "Could not find point");
+    test(point->setValue(0, points[2 * i]) && point->setValue(1, points[2 * i + 1]),
+      "Setting points failed");
+  }
+  smtk::model::OperatorResult res = op->operate();
+  test(res->findInt("outcome")->value() == smtk::operation::Operator::OPERATION_SUCCEEDED,
+    "Create edge from points operator failed");
+
+  smtk::model::Edges edges;
+  smtk::attribute::ModelEntityItem::Ptr created = res->findModelEntity("created");
+  for (std::size_t i = 0; i < created->numberOfValues(); ++i)
+  {
+    if (created->value(i).isEdge())
+    {
+      edges.push_back(created->value(i));
+    }
+  }
+  test(!edges.empty(), "No edge created");
+  return edges;
+}
+
+// Create a closed, counter-clockwise square edge with corners (lo, lo) and (hi, hi).
+smtk::model::Edge createSquare(
+  smtk::model::SessionRef& session, const smtk::model::Model& model, double lo, double hi)
+{
+  const double points[] = { lo, lo, hi, lo, hi, hi, lo, hi, lo, lo };
+  smtk::model::Edges edges = createEdges(session, model, points, 5);
+  test(edges.size() == 1, "Expected a single edge");
+  return edges[0];
+}
+
+// Run "create faces" on only the neighborhood of the \a changed edges.
+// The number of faces the run deletes is stored in \a numExpunged when given.
+smtk::model::Faces createFacesNear(smtk::model::SessionRef& session,
+  const smtk::model::Model& model, smtk::model::Edges changed, std::size_t* numExpunged = nullptr)
+{
+  smtk::model::OperatorPtr op = session.op("create faces");
+  test(op != nullptr, "No create faces operator");
+  test(op->specification()->associateEntity(model), "Could not associate model");
+  smtk::attribute::ModelEntityItemPtr changedItem = op->findModelEntity("changed edges");
+  test(changedItem != nullptr, "No changed edges item");
+  changedItem->setIsEnabled(true);
+  test(changedItem->setValues(changed.begin(), changed.end()), "Could not set changed edges");
+  smtk::model::OperatorResult res = op->operate();
+  test(res->findInt("outcome")->value() == smtk::operation::Operator::OPERATION_SUCCEEDED,
+    "Create faces operator failed");
+
+  smtk::model::Faces faces;
+  smtk::attribute::ModelEntityItemPtr created = res->findModelEntity("created");
+  for (std::size_t i = 0; i < created->numberOfValues(); ++i)
+  {
+    if (created->value(i).isFace())
+    {
+      faces.push_back(created->value(i));
+    }
+  }
+  if (numExpunged)
+  {
+    *numExpunged = 0;
+    smtk::attribute::ModelEntityItemPtr expunged = res->findModelEntity("expunged");
+    for (std::size_t i = 0; i < expunged->numberOfValues(); ++i)
+    {
+      *numExpunged += expunged->value(i).isFace() ? 1 : 0;
+    }
+  }
+  return faces;
+}
+
+// Return the number of faces in \a model.
+std::size_t numberOfFaces(const smtk::model::Model& model)
+{
+  std::size_t count = 0;
+  smtk::model::CellEntities cells = model.cells();
+  for (smtk::model::CellEntities::const_iterator it = cells.begin(); it != cells.end(); ++it)
+  {
+    count += it->isFace() ? 1 : 0;
+  }
+  return count;
+}
+
+// Return the number of inner loops (holes) in \a face.
+std::size_t numberOfHoles(const smtk::model::Face& face)
+{
+  std::size_t holes = 0;
+  smtk::model::FaceUse uses[] = { face.positiveUse(), face.negativeUse() };
+  for (int i = 0; i < 2; ++i)
+  {
+    smtk::model::Loops outer = uses[i].loops();
+    for (smtk::model::Loops::iterator it = outer.begin(); it != outer.end(); ++it)
+    {
+      holes += it->containedLoops().size();
+    }
+  }
+  return holes;
+}
+
+// Return the face in \a faces bounded by \a edge.
+smtk::model::Face faceBoundedBy(const smtk::model::Faces& faces, const smtk::model::Edge& edge)
+{
+  smtk::model::Faces bounded = edge.faces();
+  for (smtk::model::Faces::const_iterator it = faces.begin(); it != faces.end(); ++it)
+  {
+    if (std::find(bounded.begin(), bounded.end(), *it) != bounded.end())
+    {
+      return *it;
+    }
+  }
+  return smtk::model::Face();
+}
+}
+
+int UnitTestPolygonCreateFacesNearEdges(int argc, char* argv[])
+{
+  (void)argc;
+  (void)argv;
+
+  smtk::model::ManagerPtr manager = smtk::model::Manager::create();
+  smtk::model::SessionRef session = manager->createSession("polygon");
+  smtk::model::Model model =
+    session.op("create model")->operate()->findModelEntity("created")->value();
+  test(model.isValid(), "Could not create a model");
+
+  // A face whose changed outer loop holds an unchanged hole gets an inner loop.
+  // The hole's own interior becomes a face as well.
+  smtk::model::Edge outer = createSquare(session, model, 0., 10.);
+  smtk::model::Edge hole = createSquare(session, model, 4., 6.);
+  smtk::model::Faces faces = createFacesNear(session, model, smtk::model::Edges(1, outer));
+  test(faces.size() == 2, "Expected a face and the face filling its hole");
+  smtk::model::Face outerFace = faceBoundedBy(faces, outer);
+  test(outerFace.isValid(), "No face bounded by the changed edge");
+  test(numberOfHoles(outerFace) == 1, "Expected the unchanged edge to be a hole");
+  test(faceBoundedBy(faces, hole).isValid(), "No face filling the hole");
+
+  // Edges elsewhere in the model are not swept, so existing faces are untouched.
+  smtk::model::Edge apart = createSquare(session, model, 20., 22.);
+  faces = createFacesNear(session, model, smtk::model::Edges(1, apart));
+  test(faces.size() == 1, "Expected only the face bounded by the changed edge");
+  test(faceBoundedBy(faces, apart).isValid(), "No face bounded by the changed edge");
+
+  // A changed edge that is a hole in an unchanged loop is found by casting a ray.
+  smtk::model::Edge enclosing = createSquare(session, model, 30., 50.);
+  smtk::model::Edge inner = createSquare(session, model, 35., 40.);
+  faces = createFacesNear(session, model, smtk::model::Edges(1, inner));
+  test(faces.size() == 2, "Expected the changed face and the face enclosing it");
+  smtk::model::Face enclosingFace = faceBoundedBy(faces, enclosing);
+  test(enclosingFace.isValid(), "No face bounded by the enclosing edge");
+  test(numberOfHoles(enclosingFace) == 1, "Expected the changed edge to be a hole");
+  test(faceBoundedBy(faces, inner).isValid(), "No face bounded by the changed edge");
+
+  // A loop added inside an existing face replaces that face with one holding it as a hole.
+  smtk::model::Edge existing = createSquare(session, model, 60., 80.);
+  faces = createFacesNear(session, model, smtk::model::Edges(1, existing));
+  test(faces.size() == 1, "Expected a face bounded by the new edge");
+  std::size_t numFaces = numberOfFaces(model);
+  std::size_t numExpunged = 0;
+  smtk::model::Edge island = createSquare(session, model, 65., 70.);
+  faces = createFacesNear(session, model, smtk::model::Edges(1, island), &numExpunged);
+  test(faces.size() == 2, "Expected the replaced face and the face inside the new edge");
+  test(numExpunged == 1, "Expected the enclosing face to be replaced");
+  test(numberOfFaces(model) == numFaces + 1, "Replaced faces should not remain in the model");
+  smtk::model::Face replacement = faceBoundedBy(faces, existing);
+  test(replacement.isValid(), "No face bounded by the existing edge");
+  test(numberOfHoles(replacement) == 1, "Expected the new edge to be a hole");
+  test(existing.faces().size() == 1, "The existing edge should bound a single face");
+  test(island.faces().size() == 2, "The new edge should bound a face on each side");
+
+  // An edge splitting an existing face replaces it with a face on each side of the edge.
+  const double corners[] = { 100., 100., 110., 100., 110., 110., 100., 110., 100., 100. };
+  smtk::model::Edges square;
+  for (int i = 0; i < 4; ++i)
+  {
+    smtk::model::Edges side = createEdges(session, model, corners + 2 * i, 2);
+    square.insert(square.end(), side.begin(), side.end());
+  }
+  test(square.size() == 4, "Expected an edge for each side");
+  faces = createFacesNear(session, model, square);
+  test(faces.size() == 1, "Expected a face bounded by the sides");
+  numFaces = numberOfFaces(model);
+  const double diagonal[] = { 100., 100., 110., 110. };
+  smtk::model::Edges split = createEdges(session, model, diagonal, 2);
+  faces = createFacesNear(session, model, split, &numExpunged);
+  test(faces.size() == 2, "Expected a face on each side of the splitting edge");
+  test(numExpunged == 1, "Expected the split face to be replaced");
+  test(numberOfFaces(model) == numFaces + 1, "Replaced faces should not remain in the model");
+  test(split[0].faces().size() == 2, "The splitting edge should bound a face on each side");
+  for (smtk::model::Edges::const_iterator it = square.begin(); it != square.end(); ++it)
+  {
+    test(it->faces().size() == 1, "Each side should bound a single face");
+  }
+
+  return 0;
+}
+
+// This macro ensures the polygon session library is loaded into the executable
+smtkComponentInitMacro(smtk_polygon_session)
@@ -0,0 +1,114 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/attribute/FileItem.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/ModelEntityItem.h"
+#include "smtk/common/UUID.h"
+#include "smtk/common/testing/cxx/helpers.h"
+#include "smtk/model/Edge.h"
+#include "smtk/model/EdgeUse.h"
+#include "smtk/model/Face.h"
+#include "smtk/model/FaceUse.h"
+#include "smtk/model/Loop.h"
+#include "smtk/model/Manager.h"
+#include "smtk/model/Model.h"
+#include "smtk/model/Operator.h"
+#include "smtk/model/Session.h"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+namespace
+{
+
+std::string write_root = SMTK_SCRATCH_DIR;
+
+// Write polylines for two squares whose pedigree ids make each one a face.
+// The small square's left side lies along the large square's right side.
+std::string writeAdjacentSquares()
+{
+  std::string path = write_root + "/" + smtk::common::UUID::random().toString() + ".vtk";
+  std::ofstream file(path.c_str());
+  file << "# vtk DataFile Version 3.0\n"
+       << "two squares sharing a side\n"
+       << "ASCII\n"
+       << "DATASET POLYDATA\n"
+       << "POINTS 7 double\n"
+       << "0 0 0\n2 0 0\n2 2 0\n0 2 0\n3 0 0\n3 1 0\n2 1 0\n"
+       << "LINES 2 12\n"
+       << "5 0 1 2 3 0\n"
+       << "5 1 4 5 6 1\n"
+       << "CELL_DATA 2\n"
+       << "PEDIGREE_IDS faces vtkIdType\n"
+       << "0\n1\n";
+  return path;
+}
+
+// Return the number of edges bounding the outer loop of \a face.
+std::size_t numberOfOuterLoopEdges(const smtk::model::Face& face)
+{
+  smtk::model::Loops outer = face.positiveUse().loops();
+  return outer.empty() ? 0 : outer.front().edgeUses().size();
+}
+}
+
+int UnitTestPolygonImportAdjacentFaces(int argc, char* argv[])
+{
+  (void)argc;
+  (void)argv;
+
+  std::string path = writeAdjacentSquares();
+
+  smtk::model::ManagerPtr manager = smtk::model::Manager::create();
+  smtk::model::SessionRef session = manager->createSession("polygon");
+  smtk::model::OperatorPtr op = session.op("import");
+  test(op != nullptr, "No import operator");
+  op->specification()->findFile("filename")->setValue(path);
+  smtk::model::OperatorResult res = op->operate();
+  std::remove(path.c_str());
+  test(res->findInt("outcome")->value() == smtk::operation::Operator::OPERATION_SUCCEEDED,
+    "Import operator failed");
+  smtk::model::Model model = res->findModelEntity("created")->value();
+  test(model.isValid(), "No model imported");
+
+  // Each square becomes a face bounded by its own loop, even though the
+  // large square's side is touched by the small square's corner.
+  smtk::model::Faces faces;
+  for (auto& cell : model.cells())
+  {
+    if (cell.isFace())
+    {
+      faces.push_back(cell.as<smtk::model::Face>());
+    }
+  }
+  test(faces.size() == 2, "Expected a face for each square");
+  bool havePedigree[2] = { false, false };
+  for (auto& face : faces)
+  {
+    test(face.hasIntegerProperty("pedigree"), "Face has no pedigree id");
+    long pedigree = face.integerProperty("pedigree")[0];
+    test(pedigree == 0 || pedigree == 1, "Unexpected pedigree id");
+    havePedigree[pedigree] = true;
+    test(numberOfOuterLoopEdges(face) == 1, "Expected each square's loop to be a single edge");
+
+    std::vector<double> bounds = face.boundingBox();
+    test(bounds.size() >= 4, "Face has no bounds");
+    double area = (bounds[1] - bounds[0]) * (bounds[3] - bounds[2]);
+    test(std::abs(area - (pedigree == 0 ? 4. : 1.)) < 1e-2, "Face has the wrong extent");
+  }
+  test(havePedigree[0] && havePedigree[1], "Expected a face for each pedigree id");
+
+  return 0;
+}
+
+// This macro ensures the polygon session library is loaded into the executable
+smtkComponentInitMacro(smtk_polygon_session)
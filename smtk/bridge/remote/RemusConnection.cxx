@@ -566,7 +566,7 @@ void RemusConnection::setModelManager(smtk::model::ManagerPtr mgr)
 
 cJSON* RemusConnection::jsonRPCRequest(cJSON* req, const remus::proto::JobRequirements& jreq)
 {
-  char* reqStr = cJSON_Print(req);
+  char* reqStr = cJSON_PrintUnformatted(req);
   cJSON_Delete(req);
   cJSON* response = this->jsonRPCRequest(reqStr, jreq);
   free(reqStr);
@@ -599,7 +599,7 @@ cJSON* RemusConnection::jsonRPCRequest(
 
 void RemusConnection::jsonRPCNotification(cJSON* note, const remus::proto::JobRequirements& jreq)
 {
-  char* noteStr = cJSON_Print(note);
+  char* noteStr = cJSON_PrintUnformatted(note);
   cJSON_Delete(note);
   this->jsonRPCNotification(noteStr, jreq);
   free(noteStr);
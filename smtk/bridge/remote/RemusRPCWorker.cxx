@@ -283,7 +283,22 @@ void RemusRPCWorker::processJob(
         {
           smtk::model::OperatorResult ores = localOp->operate();
           cJSON* oresult = cJSON_CreateObject();
-          smtk::io::SaveJSON::forOperatorResult(ores, oresult);
+          // Clients that already hold the model may ask for only what changed.
+          // Tessellations are only skipped when this client was already sent them.
+          cJSON* fmt = cJSON_GetObjectItem(param, "result-format");
+          if (fmt && fmt->type == cJSON_String && fmt->valuestring &&
+            std::string(fmt->valuestring) == "delta")
+          {
+            cJSON* client = cJSON_GetObjectItem(param, "client-id");
+            bool haveClient = client && client->type == cJSON_String && client->valuestring &&
+              client->valuestring[0];
+            smtk::io::SaveJSON::forOperatorResultDelta(ores, oresult,
+              haveClient ? &this->m_sentTessellations[client->valuestring] : NULL);
+          }
+          else
+          {
+            smtk::io::SaveJSON::forOperatorResult(ores, oresult);
+          }
           cJSON_AddItemToObject(result, "result", oresult);
         }
       }
@@ -326,7 +341,7 @@ void RemusRPCWorker::processJob(
   status.updateProgress(progress);
   w->updateStatus(status);
 
-  char* response = cJSON_Print(result);
+  char* response = cJSON_PrintUnformatted(result);
   cJSON_Delete(result);
   remus::proto::JobResult jobResult =
     remus::proto::make_JobResult(jd.id(), response, remus::common::ContentFormat::JSON);
@@ -16,8 +16,12 @@
 #include "remus/worker/Job.h"
 #include "remus/worker/Worker.h"
 
+#include "smtk/common/UUID.h"
 #include "smtk/model/StringData.h"
 
+#include <map>
+#include <string>
+
 struct cJSON;
 
 namespace smtk
@@ -65,6 +69,9 @@ protected:
 
   smtk::model::ManagerPtr m_modelMgr;
   smtk::model::StringData m_options;
+  // Tessellation generations already sent in delta operator results, per client.
+  // Several clients may share a worker, and each holds its own copy of the model.
+  std::map<std::string, std::map<smtk::common::UUID, int> > m_sentTessellations;
 
 private:
   RemusRPCWorker(const RemusRPCWorker&); // Not implemented.
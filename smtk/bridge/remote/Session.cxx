@@ -42,6 +42,7 @@ namespace remote
 std::map<std::string, RemusStaticSessionInfo>* Session::s_remotes = NULL;
 
 Session::Session()
+  : m_clientId(smtk::common::UUID::random())
 {
   this->initializeOperatorCollection(Session::s_operators);
 }
@@ -121,6 +122,9 @@ smtk::model::OperatorResult Session::operateDelegate(smtk::model::RemoteOperator
   smtk::io::SaveJSON::forOperator(op->specification(), par);
   // Add the session's session ID so it can be properly instantiated on the server.
   cJSON_AddItemToObject(par, "sessionId", cJSON_CreateString(this->sessionId().toString().c_str()));
+  // Ask for only the changed records and binary-packed tessellations.
+  cJSON_AddItemToObject(par, "result-format", cJSON_CreateString("delta"));
+  cJSON_AddItemToObject(par, "client-id", cJSON_CreateString(this->m_clientId.toString().c_str()));
 
   cJSON* resp = this->m_remusConn->jsonRPCRequest(req, this->m_remusWorkerReqs);
   //cJSON* resp = NULL; // this->m_proxy->jsonRPCRequest(req, this->m_remusWorkerReqs); // This deletes req and par.
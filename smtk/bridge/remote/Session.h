@@ -95,6 +95,8 @@ protected:
   smtk::shared_ptr<remus::client::Client> m_remusClient;
   std::string m_remusWorkerName;
   remus::proto::JobRequirements m_remusWorkerReqs;
+  // Identifies this client to the worker, which tracks the tessellations each client holds.
+  smtk::common::UUID m_clientId;
 
   static std::map<std::string, RemusStaticSessionInfo>* s_remotes;
 
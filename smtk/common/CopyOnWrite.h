@@ -0,0 +1,96 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef __smtk_common_CopyOnWrite_h
+#define __smtk_common_CopyOnWrite_h
+
+#include "smtk/SharedPtr.h"
+
+namespace smtk
+{
+namespace common
+{
+
+/// The default way CopyOnWrite duplicates shared data: the copy constructor.
+template <typename T>
+struct CopyConstruct
+{
+  T* operator()(const T& data) const { return new T(data); }
+};
+
+/**\brief A pointer to data that is shared until it is modified.
+  *
+  * Copying a CopyOnWrite object shares the data it points to. Const
+  * access never copies, but non-const access first replaces shared data
+  * with a private copy made by \a Copier (which should perform a deep copy
+  * of any mutable objects the data points to).
+  *
+  * Only the holder that writes pays for the copy, so instances that are
+  * only read (e.g., snapshots) may be used from other threads while the
+  * original is modified. Readers must use const access for this to hold,
+  * since non-const access may replace the data.
+  *
+  * A default-constructed CopyOnWrite holds a default-constructed \a T,
+  * so it may be used as the value type of a std::map.
+  */
+template <typename T, typename Copier = CopyConstruct<T> >
+class CopyOnWrite
+{
+public:
+  CopyOnWrite()
+    : m_data(new T)
+  {
+  }
+  CopyOnWrite(T* data)
+    : m_data(data)
+  {
+  }
+  CopyOnWrite(const smtk::shared_ptr<T>& data)
+    : m_data(data)
+  {
+  }
+
+  const T& operator*() const { return *this->m_data; }
+  const T* operator->() const { return this->m_data.get(); }
+  T& operator*()
+  {
+    this->detach();
+    return *this->m_data;
+  }
+  T* operator->()
+  {
+    this->detach();
+    return this->m_data.get();
+  }
+
+  // Return the data without copying it, even from a non-const holder.
+  const T& data() const { return *this->m_data; }
+
+  explicit operator bool() const { return !!this->m_data; }
+
+  // Return true when other holders share the data.
+  bool isShared() const { return this->m_data && this->m_data.use_count() > 1; }
+
+  // Make a private copy of the data if it is shared.
+  void detach()
+  {
+    if (this->isShared())
+    {
+      this->m_data.reset(Copier()(*this->m_data));
+    }
+  }
+
+private:
+  smtk::shared_ptr<T> m_data;
+};
+}
+}
+
+#endif // __smtk_common_CopyOnWrite_h
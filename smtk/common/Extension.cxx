@@ -16,10 +16,15 @@ namespace smtk
 namespace common
 {
 
-static std::map<std::string, std::pair<std::function<Extension::Ptr(void)>, bool> > s_extensionMap;
+typedef std::map<std::string, std::pair<std::function<Extension::Ptr(void)>, bool> > ExtensionMap;
 
-// std::map<std::string, std::pair<std::function<Extension::Ptr(void)>, bool>>
-// Extension::s_extensionMap;
+// Constructed on first use so that extensions compiled into this library
+// can register themselves during static initialization.
+static ExtensionMap& extensionMap()
+{
+  static ExtensionMap s_extensionMap;
+  return s_extensionMap;
+}
 
 Extension::Extension()
 {
@@ -32,29 +37,31 @@ Extension::~Extension()
 bool Extension::registerExtension(
   const std::string& name, std::function<Extension::Ptr(void)> ctor, bool oneShot)
 {
+  ExtensionMap& extensions(extensionMap());
   if (name.empty() || !ctor)
   {
     return false;
   }
-  auto it = s_extensionMap.find(name);
-  if (it != s_extensionMap.end())
+  auto it = extensions.find(name);
+  if (it != extensions.end())
   {
     it->second.first = ctor;
     it->second.second = oneShot;
   }
   else
   {
-    s_extensionMap.insert(std::make_pair(name, std::make_pair(ctor, oneShot)));
+    extensions.insert(std::make_pair(name, std::make_pair(ctor, oneShot)));
   }
   return true;
 }
 
 bool Extension::unregisterExtension(const std::string& name)
 {
-  auto it = s_extensionMap.find(name);
-  if (it != s_extensionMap.end())
+  ExtensionMap& extensions(extensionMap());
+  auto it = extensions.find(name);
+  if (it != extensions.end())
   {
-    s_extensionMap.erase(it);
+    extensions.erase(it);
     return true;
   }
   return false;
@@ -63,9 +70,10 @@ bool Extension::unregisterExtension(const std::string& name)
 void Extension::visitAll(
   std::function<std::pair<bool, bool>(const std::string&, Extension::Ptr)> visitor)
 {
-  auto it = s_extensionMap.begin();
-  auto tmp = s_extensionMap.end();
-  for (; it != s_extensionMap.end(); it = tmp)
+  ExtensionMap& extensions(extensionMap());
+  auto it = extensions.begin();
+  auto tmp = extensions.end();
+  for (; it != extensions.end(); it = tmp)
   {
     std::pair<bool, bool> didUseAndTerminate = visitor(it->first, it->second.first());
     tmp = it;
@@ -74,7 +82,7 @@ void Extension::visitAll(
     {
       if (it->second.second)
       {
-        s_extensionMap.erase(it);
+        extensions.erase(it);
       }
     }
     if (didUseAndTerminate.second)
@@ -86,16 +94,17 @@ void Extension::visitAll(
 
 Extension::Ptr Extension::find(const std::string& name, bool removeOneShot)
 {
+  ExtensionMap& extensions(extensionMap());
   Extension::Ptr result;
-  auto it = s_extensionMap.find(name);
-  if (it == s_extensionMap.end())
+  auto it = extensions.find(name);
+  if (it == extensions.end())
   {
     return result;
   }
   result = it->second.first();
   if (removeOneShot && it->second.second)
   {
-    s_extensionMap.erase(it);
+    extensions.erase(it);
   }
   return result;
 }
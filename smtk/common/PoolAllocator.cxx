@@ -0,0 +1,126 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/PoolAllocator.h"
+
+namespace smtk
+{
+namespace common
+{
+
+namespace
+{
+
+// Blocks must be able to hold a free-list link and stay suitably aligned.
+std::size_t roundUpBlockSize(std::size_t blockSize)
+{
+  const std::size_t alignment = alignof(std::max_align_t);
+  if (blockSize < sizeof(void*))
+  {
+    blockSize = sizeof(void*);
+  }
+  return (blockSize + alignment - 1) / alignment * alignment;
+}
+}
+
+MemoryPool::MemoryPool(std::size_t blockSize, std::size_t blocksPerSlab)
+  : m_blockSize(roundUpBlockSize(blockSize))
+  , m_blocksPerSlab(blocksPerSlab > 0 ? blocksPerSlab : 1)
+  , m_free(nullptr)
+  , m_inUse(0)
+{
+}
+
+MemoryPool::~MemoryPool()
+{
+  for (auto slab : this->m_slabs)
+  {
+    ::operator delete(slab);
+  }
+}
+
+void* MemoryPool::allocate()
+{
+  std::lock_guard<std::mutex> guard(this->m_mutex);
+  if (!this->m_free)
+  {
+    // Thread a new slab onto the free list, keeping blocks in address order.
+    char* slab = static_cast<char*>(::operator new(this->m_blockSize * this->m_blocksPerSlab));
+    this->m_slabs.push_back(slab);
+    for (std::size_t ii = this->m_blocksPerSlab; ii > 0; --ii)
+    {
+      FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + (ii - 1) * this->m_blockSize);
+      block->m_next = this->m_free;
+      this->m_free = block;
+    }
+  }
+  FreeBlock* block = this->m_free;
+  this->m_free = block->m_next;
+  ++this->m_inUse;
+  return block;
+}
+
+void MemoryPool::deallocate(void* block)
+{
+  if (!block)
+  {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(this->m_mutex);
+  FreeBlock* freed = static_cast<FreeBlock*>(block);
+  freed->m_next = this->m_free;
+  this->m_free = freed;
+  --this->m_inUse;
+}
+
+std::size_t MemoryPool::numberOfSlabs() const
+{
+  std::lock_guard<std::mutex> guard(this->m_mutex);
+  return this->m_slabs.size();
+}
+
+std::size_t MemoryPool::numberOfBlocksInUse() const
+{
+  std::lock_guard<std::mutex> guard(this->m_mutex);
+  return this->m_inUse;
+}
+
+MemoryPools::~MemoryPools()
+{
+  for (auto& entry : this->m_pools)
+  {
+    delete entry.second;
+  }
+}
+
+MemoryPool& MemoryPools::forSize(std::size_t blockSize)
+{
+  blockSize = roundUpBlockSize(blockSize);
+  std::lock_guard<std::mutex> guard(this->m_mutex);
+  MemoryPool*& pool(this->m_pools[blockSize]);
+  if (!pool)
+  {
+    pool = new MemoryPool(blockSize);
+  }
+  return *pool;
+}
+
+std::size_t MemoryPools::numberOfSlabs() const
+{
+  std::lock_guard<std::mutex> guard(this->m_mutex);
+  std::size_t result = 0;
+  for (auto& entry : this->m_pools)
+  {
+    result += entry.second->numberOfSlabs();
+  }
+  return result;
+}
+}
+}
@@ -0,0 +1,168 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef __smtk_common_PoolAllocator_h
+#define __smtk_common_PoolAllocator_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/SharedPtr.h"
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace smtk
+{
+namespace common
+{
+
+/**\brief Hand out fixed-size blocks of memory carved from large slabs.
+  *
+  * Many small objects of the same size (e.g., model entity records or the
+  * nodes of maps holding them) are packed contiguously instead of being
+  * scattered across the heap, and a block that is freed is reused by the
+  * next allocation. Slabs are returned to the system when the pool is
+  * destroyed. Allocation and deallocation are thread-safe, since objects
+  * may be released by a different thread than the one that created them.
+  */
+class SMTKCORE_EXPORT MemoryPool
+{
+public:
+  MemoryPool(std::size_t blockSize, std::size_t blocksPerSlab = 1024);
+  MemoryPool(const MemoryPool&) = delete;
+  MemoryPool& operator=(const MemoryPool&) = delete;
+  ~MemoryPool();
+
+  void* allocate();
+  void deallocate(void* block);
+
+  std::size_t blockSize() const { return this->m_blockSize; }
+  std::size_t numberOfSlabs() const;
+  std::size_t numberOfBlocksInUse() const;
+
+private:
+  struct FreeBlock
+  {
+    FreeBlock* m_next;
+  };
+
+  std::size_t m_blockSize;
+  std::size_t m_blocksPerSlab;
+  std::vector<char*> m_slabs;
+  FreeBlock* m_free;
+  std::size_t m_inUse;
+  mutable std::mutex m_mutex;
+};
+
+/**\brief A set of memory pools, one per block size, owned by a single client.
+  *
+  * A client (e.g., a model manager) creates one of these and hands it to
+  * the PoolAllocator instances of its containers and records. Every
+  * allocator holds a reference to the set, so the pools (and their slabs)
+  * are freed once the client and every object allocated from them are gone.
+  */
+class SMTKCORE_EXPORT MemoryPools
+{
+public:
+  MemoryPools() {}
+  MemoryPools(const MemoryPools&) = delete;
+  MemoryPools& operator=(const MemoryPools&) = delete;
+  ~MemoryPools();
+
+  /// Return the pool for blocks of (at least) \a blockSize bytes.
+  MemoryPool& forSize(std::size_t blockSize);
+
+  std::size_t numberOfSlabs() const;
+
+private:
+  std::map<std::size_t, MemoryPool*> m_pools;
+  mutable std::mutex m_mutex;
+};
+
+/**\brief An STL allocator that takes single objects from a set of MemoryPools.
+  *
+  * This is intended for node-based containers (std::map, std::set, std::list)
+  * and std::allocate_shared, which allocate one object at a time. Requests for
+  * arrays, and all requests made by a default-constructed allocator (which
+  * has no pools), are passed on to the global operator new.
+  *
+  * Containers that are assigned or swapped take the allocator of their source,
+  * so records copied between owners keep the pools they were allocated from.
+  */
+template <typename T>
+class PoolAllocator
+{
+public:
+  typedef T value_type;
+  typedef std::true_type propagate_on_container_copy_assignment;
+  typedef std::true_type propagate_on_container_move_assignment;
+  typedef std::true_type propagate_on_container_swap;
+
+  static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported.");
+
+  PoolAllocator()
+    : m_pool(nullptr)
+  {
+  }
+  PoolAllocator(const smtk::shared_ptr<MemoryPools>& pools)
+    : m_pools(pools)
+    , m_pool(pools ? &pools->forSize(sizeof(T)) : nullptr)
+  {
+  }
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U>& other)
+    : PoolAllocator(other.pools())
+  {
+  }
+
+  T* allocate(std::size_t n)
+  {
+    return static_cast<T*>(
+      n == 1 && this->m_pool ? this->m_pool->allocate() : ::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T* object, std::size_t n)
+  {
+    if (n == 1 && this->m_pool)
+    {
+      this->m_pool->deallocate(object);
+    }
+    else
+    {
+      ::operator delete(object);
+    }
+  }
+
+  /// The set of pools that objects are allocated from (null for the global heap).
+  const smtk::shared_ptr<MemoryPools>& pools() const { return this->m_pools; }
+
+private:
+  smtk::shared_ptr<MemoryPools> m_pools;
+  MemoryPool* m_pool;
+};
+
+template <typename T, typename U>
+bool operator==(const PoolAllocator<T>& a, const PoolAllocator<U>& b)
+{
+  return a.pools() == b.pools();
+}
+
+template <typename T, typename U>
+bool operator!=(const PoolAllocator<T>& a, const PoolAllocator<U>& b)
+{
+  return a.pools() != b.pools();
+}
+}
+}
+
+#endif // __smtk_common_PoolAllocator_h
@@ -0,0 +1,339 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef __smtk_common_RangeSet_h
+#define __smtk_common_RangeSet_h
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace smtk
+{
+namespace common
+{
+
+/**\brief A set of integers stored as sorted runs of consecutive values.
+  *
+  * Selections of mesh cells and points tend to contain long runs of
+  * consecutive IDs, so storing each run as a closed interval [first, last]
+  * takes far less memory than a node per value. Unions, differences and
+  * intersections of two sets take time linear in their number of runs;
+  * inserting values in increasing order takes constant time.
+  *
+  * The set may be iterated like a std::set<T> of its values.
+  */
+template <typename T>
+class RangeSet
+{
+public:
+  typedef T value_type;
+  /// A closed interval of values [first, second].
+  typedef std::pair<T, T> Range;
+  typedef std::vector<Range> Ranges;
+
+  /// Iterate over the individual values (not the runs) of a RangeSet in order.
+  class const_iterator
+  {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const T* pointer;
+    typedef const T& reference;
+
+    const_iterator()
+      : m_ranges(nullptr)
+      , m_range(0)
+      , m_value()
+    {
+    }
+    const_iterator(const Ranges* ranges, std::size_t range)
+      : m_ranges(ranges)
+      , m_range(range)
+      , m_value(range < ranges->size() ? (*ranges)[range].first : T())
+    {
+    }
+
+    reference operator*() const { return this->m_value; }
+    pointer operator->() const { return &this->m_value; }
+
+    const_iterator& operator++()
+    {
+      if (this->m_value == (*this->m_ranges)[this->m_range].second)
+      {
+        ++this->m_range;
+        this->m_value =
+          this->m_range < this->m_ranges->size() ? (*this->m_ranges)[this->m_range].first : T();
+      }
+      else
+      {
+        ++this->m_value;
+      }
+      return *this;
+    }
+    const_iterator operator++(int)
+    {
+      const_iterator result(*this);
+      ++(*this);
+      return result;
+    }
+
+    bool operator==(const const_iterator& other) const
+    {
+      return this->m_range == other.m_range && this->m_value == other.m_value;
+    }
+    bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+  private:
+    const Ranges* m_ranges;
+    std::size_t m_range;
+    T m_value;
+  };
+  typedef const_iterator iterator;
+
+  RangeSet() {}
+
+  /// Construct a set holding the values in [begin, end), which need not be sorted.
+  template <typename Iterator>
+  RangeSet(Iterator begin, Iterator end)
+  {
+    for (; begin != end; ++begin)
+    {
+      this->insert(*begin);
+    }
+  }
+
+  bool empty() const { return this->m_ranges.empty(); }
+  void clear() { this->m_ranges.clear(); }
+
+  /// Return the number of values (not runs) in the set.
+  std::size_t size() const
+  {
+    std::size_t result = 0;
+    for (auto& range : this->m_ranges)
+    {
+      result += static_cast<std::size_t>(range.second - range.first) + 1;
+    }
+    return result;
+  }
+
+  /// Return the sorted, disjoint and non-adjacent runs of values in the set.
+  const Ranges& ranges() const { return this->m_ranges; }
+  std::size_t numberOfRanges() const { return this->m_ranges.size(); }
+
+  bool contains(T value) const
+  {
+    auto it = this->firstEndingAtOrAfter(value);
+    return it != this->m_ranges.end() && it->first <= value;
+  }
+  /// Return 1 if \a value is in the set and 0 otherwise (as std::set does).
+  std::size_t count(T value) const { return this->contains(value) ? 1 : 0; }
+
+  void insert(T value) { this->insert(value, value); }
+
+  /// Insert every value in the closed interval [first, last].
+  void insert(T first, T last)
+  {
+    if (last < first)
+    {
+      return;
+    }
+    // Fast path for values appended in order.
+    if (this->m_ranges.empty() || RangeSet::precedesWithGap(this->m_ranges.back(), first))
+    {
+      this->m_ranges.push_back(Range(first, last));
+      return;
+    }
+    // Find the runs that overlap or abut [first, last] and merge them.
+    auto begin = std::lower_bound(this->m_ranges.begin(), this->m_ranges.end(), first,
+      [](const Range& range, T value) { return RangeSet::precedesWithGap(range, value); });
+    auto end = begin;
+    while (end != this->m_ranges.end() && !RangeSet::followsWithGap(*end, last))
+    {
+      ++end;
+    }
+    if (begin == end)
+    {
+      this->m_ranges.insert(begin, Range(first, last));
+      return;
+    }
+    begin->first = std::min(begin->first, first);
+    begin->second = std::max((end - 1)->second, last);
+    this->m_ranges.erase(begin + 1, end);
+  }
+
+  void erase(T value) { this->erase(value, value); }
+
+  /// Remove every value in the closed interval [first, last].
+  void erase(T first, T last)
+  {
+    if (last < first)
+    {
+      return;
+    }
+    auto begin = this->firstEndingAtOrAfter(first);
+    auto end = begin;
+    while (end != this->m_ranges.end() && end->first <= last)
+    {
+      ++end;
+    }
+    if (begin == end)
+    {
+      return;
+    }
+    // Keep the parts of the first and last overlapping runs outside [first, last].
+    Ranges remainder;
+    if (begin->first < first)
+    {
+      remainder.push_back(Range(begin->first, first - 1));
+    }
+    if ((end - 1)->second > last)
+    {
+      remainder.push_back(Range(last + 1, (end - 1)->second));
+    }
+    auto position = this->m_ranges.erase(begin, end);
+    this->m_ranges.insert(position, remainder.begin(), remainder.end());
+  }
+
+  /// Add every value of \a other to this set.
+  RangeSet& unite(const RangeSet& other)
+  {
+    if (other.empty())
+    {
+      return *this;
+    }
+    Ranges result;
+    result.reserve(this->m_ranges.size() + other.m_ranges.size());
+    auto aa = this->m_ranges.begin();
+    auto bb = other.m_ranges.begin();
+    while (aa != this->m_ranges.end() || bb != other.m_ranges.end())
+    {
+      const Range& next = (bb == other.m_ranges.end() ||
+                            (aa != this->m_ranges.end() && aa->first < bb->first))
+        ? *aa++
+        : *bb++;
+      if (result.empty() || RangeSet::precedesWithGap(result.back(), next.first))
+      {
+        result.push_back(next);
+      }
+      else if (next.second > result.back().second)
+      {
+        result.back().second = next.second;
+      }
+    }
+    this->m_ranges.swap(result);
+    return *this;
+  }
+
+  /// Remove every value of \a other from this set.
+  RangeSet& subtract(const RangeSet& other)
+  {
+    if (other.empty() || this->empty())
+    {
+      return *this;
+    }
+    Ranges result;
+    result.reserve(this->m_ranges.size() + other.m_ranges.size());
+    auto bb = other.m_ranges.begin();
+    for (auto range : this->m_ranges)
+    {
+      // Skip runs of other that end before this run.
+      while (bb != other.m_ranges.end() && bb->second < range.first)
+      {
+        ++bb;
+      }
+      auto cut = bb;
+      while (cut != other.m_ranges.end() && cut->first <= range.second)
+      {
+        if (cut->first > range.first)
+        {
+          result.push_back(Range(range.first, cut->first - 1));
+        }
+        if (cut->second >= range.second)
+        {
+          break;
+        }
+        range.first = cut->second + 1;
+        ++cut;
+      }
+      if (cut == other.m_ranges.end() || cut->first > range.second)
+      {
+        result.push_back(range);
+      }
+    }
+    this->m_ranges.swap(result);
+    return *this;
+  }
+
+  /// Remove every value that is not also in \a other from this set.
+  RangeSet& intersect(const RangeSet& other)
+  {
+    Ranges result;
+    auto aa = this->m_ranges.begin();
+    auto bb = other.m_ranges.begin();
+    while (aa != this->m_ranges.end() && bb != other.m_ranges.end())
+    {
+      T first = std::max(aa->first, bb->first);
+      T last = std::min(aa->second, bb->second);
+      if (first <= last)
+      {
+        result.push_back(Range(first, last));
+      }
+      if (aa->second < bb->second)
+      {
+        ++aa;
+      }
+      else
+      {
+        ++bb;
+      }
+    }
+    this->m_ranges.swap(result);
+    return *this;
+  }
+
+  const_iterator begin() const { return const_iterator(&this->m_ranges, 0); }
+  const_iterator end() const { return const_iterator(&this->m_ranges, this->m_ranges.size()); }
+
+  bool operator==(const RangeSet& other) const { return this->m_ranges == other.m_ranges; }
+  bool operator!=(const RangeSet& other) const { return this->m_ranges != other.m_ranges; }
+
+private:
+  // Is there at least one value missing between the end of \a range and \a value?
+  static bool precedesWithGap(const Range& range, T value)
+  {
+    return range.second < value && range.second + 1 < value;
+  }
+  // Is there at least one value missing between \a value and the start of \a range?
+  static bool followsWithGap(const Range& range, T value)
+  {
+    return range.first > value && range.first - 1 > value;
+  }
+
+  typename Ranges::const_iterator firstEndingAtOrAfter(T value) const
+  {
+    return std::lower_bound(this->m_ranges.begin(), this->m_ranges.end(), value,
+      [](const Range& range, T val) { return range.second < val; });
+  }
+  typename Ranges::iterator firstEndingAtOrAfter(T value)
+  {
+    return std::lower_bound(this->m_ranges.begin(), this->m_ranges.end(), value,
+      [](const Range& range, T val) { return range.second < val; });
+  }
+
+  Ranges m_ranges;
+};
+}
+}
+
+#endif // __smtk_common_RangeSet_h
@@ -0,0 +1,74 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/ThreadPool.h"
+
+#include <algorithm>
+
+namespace smtk
+{
+namespace common
+{
+
+ThreadPool::ThreadPool(std::size_t numberOfThreads)
+  : m_stopping(false)
+{
+  if (numberOfThreads == 0)
+  {
+    numberOfThreads = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+  for (std::size_t i = 0; i < numberOfThreads; ++i)
+  {
+    this->m_threads.push_back(std::thread(&ThreadPool::run, this));
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::unique_lock<std::mutex> lock(this->m_mutex);
+    this->m_stopping = true;
+  }
+  this->m_condition.notify_all();
+  for (auto& thread : this->m_threads)
+  {
+    thread.join();
+  }
+}
+
+void ThreadPool::queue(std::function<void()>&& task)
+{
+  {
+    std::unique_lock<std::mutex> lock(this->m_mutex);
+    this->m_tasks.push(std::move(task));
+  }
+  this->m_condition.notify_one();
+}
+
+void ThreadPool::run()
+{
+  for (;;)
+  {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(this->m_mutex);
+      this->m_condition.wait(
+        lock, [this]() { return this->m_stopping || !this->m_tasks.empty(); });
+      if (this->m_tasks.empty())
+      {
+        return;
+      }
+      task = std::move(this->m_tasks.front());
+      this->m_tasks.pop();
+    }
+    task();
+  }
+}
+}
+}
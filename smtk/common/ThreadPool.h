@@ -0,0 +1,78 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef __smtk_common_ThreadPool_h
+#define __smtk_common_ThreadPool_h
+
+#include "smtk/CoreExports.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace smtk
+{
+namespace common
+{
+
+/**\brief A fixed-size pool of worker threads that run tasks in FIFO order.
+  *
+  * Tasks are submitted with operator() and their return values (or
+  * exceptions) are delivered through a std::future. Destroying the pool
+  * waits for all queued tasks to complete.
+  */
+class SMTKCORE_EXPORT ThreadPool
+{
+public:
+  // Construct a pool of \a numberOfThreads workers (or one per hardware
+  // thread if zero).
+  ThreadPool(std::size_t numberOfThreads = 0);
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ~ThreadPool();
+
+  // Queue \a function for execution and return a future for its result.
+  template <typename Function>
+  std::future<typename std::result_of<Function()>::type> operator()(Function&& function);
+
+  std::size_t numberOfThreads() const { return this->m_threads.size(); }
+
+private:
+  void queue(std::function<void()>&& task);
+  void run();
+
+  std::vector<std::thread> m_threads;
+  std::queue<std::function<void()> > m_tasks;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  bool m_stopping;
+};
+
+template <typename Function>
+std::future<typename std::result_of<Function()>::type> ThreadPool::operator()(Function&& function)
+{
+  typedef typename std::result_of<Function()>::type ReturnType;
+  // std::function requires a copyable callable, so the packaged task is shared.
+  auto task =
+    std::make_shared<std::packaged_task<ReturnType()> >(std::forward<Function>(function));
+  std::future<ReturnType> future = task->get_future();
+  this->queue([task]() { (*task)(); });
+  return future;
+}
+}
+}
+
+#endif // __smtk_common_ThreadPool_h
@@ -16,6 +16,7 @@ SMTK_THIRDPARTY_PRE_INCLUDE
 SMTK_THIRDPARTY_POST_INCLUDE
 
 #include <ctime>    // for time()
+#include <mutex>
 #include <stdlib.h> // for getenv()/_dupenv_s()
 
 namespace
@@ -62,6 +63,8 @@ public:
   boost::mt19937 m_mtseed;
   boost::uuids::basic_random_generator<boost::mt19937>* m_randomGenerator;
   boost::uuids::nil_generator m_nullGenerator;
+  // The shared instance() may be used by operators running on several threads.
+  std::mutex m_mutex;
 };
 
 UUIDGenerator::UUIDGenerator()
@@ -76,6 +79,7 @@ UUIDGenerator::~UUIDGenerator()
 
 UUID UUIDGenerator::random()
 {
+  std::lock_guard<std::mutex> guard(this->P->m_mutex);
   return UUID((*this->P->m_randomGenerator)());
 }
 
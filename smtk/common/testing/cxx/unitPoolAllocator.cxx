@@ -0,0 +1,151 @@
+//=============================================================================
+// Copyright (c) Kitware, Inc.
+// All rights reserved.
+// See LICENSE.txt for details.
+//
+// This software is distributed WITHOUT ANY WARRANTY; without even
+// the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+// PURPOSE.  See the above copyright notice for more information.
+//=============================================================================
+#include "smtk/common/PoolAllocator.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <map>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace smtk::common;
+
+namespace
+{
+
+struct Record
+{
+  Record(int value)
+    : m_value(value)
+  {
+  }
+  double m_padding[5];
+  int m_value;
+};
+
+void testMemoryPool()
+{
+  MemoryPool pool(sizeof(Record), 4);
+  test(pool.blockSize() >= sizeof(Record), "Blocks too small.");
+  test(pool.numberOfSlabs() == 0, "Expected no slabs before allocation.");
+
+  std::vector<void*> blocks;
+  for (int ii = 0; ii < 10; ++ii)
+  {
+    blocks.push_back(pool.allocate());
+  }
+  test(pool.numberOfSlabs() == 3, "Expected 3 slabs of 4 blocks.");
+  test(pool.numberOfBlocksInUse() == 10, "Expected 10 blocks in use.");
+  test(std::set<void*>(blocks.begin(), blocks.end()).size() == 10, "Blocks overlap.");
+  test(static_cast<char*>(blocks[1]) - static_cast<char*>(blocks[0]) ==
+      static_cast<std::ptrdiff_t>(pool.blockSize()),
+    "Blocks of a slab should be contiguous.");
+
+  // Freed blocks are reused before new slabs are allocated.
+  pool.deallocate(blocks[3]);
+  pool.deallocate(blocks[7]);
+  test(pool.numberOfBlocksInUse() == 8, "Expected 8 blocks in use.");
+  void* reused = pool.allocate();
+  test(reused == blocks[7] || reused == blocks[3], "Expected a freed block to be reused.");
+  pool.allocate();
+  pool.allocate();
+  pool.allocate();
+  test(pool.numberOfSlabs() == 3, "Expected freed blocks to be reused.");
+
+  MemoryPools pools;
+  test(&pools.forSize(sizeof(Record)) == &pools.forSize(sizeof(Record)),
+    "Expected one pool per size.");
+  test(&pools.forSize(sizeof(Record)) != &pools.forSize(4 * sizeof(Record)),
+    "Expected separate pools for different sizes.");
+}
+
+void testContainers()
+{
+  typedef std::map<int, Record, std::less<int>, PoolAllocator<std::pair<const int, Record> > >
+    RecordMap;
+  auto pools = std::make_shared<MemoryPools>();
+  std::weak_ptr<MemoryPools> watcher(pools);
+  {
+    RecordMap records{ RecordMap::allocator_type(pools) };
+    for (int ii = 0; ii < 5000; ++ii)
+    {
+      records.insert(std::make_pair(ii, Record(2 * ii)));
+    }
+    for (int ii = 0; ii < 5000; ii += 2)
+    {
+      records.erase(ii);
+    }
+    test(records.size() == 2500 && records.find(4999)->second.m_value == 9998,
+      "Bad map contents.");
+    test(pools->numberOfSlabs() > 0, "Map nodes were not pooled.");
+
+    // Copies share the pools of their source.
+    RecordMap copy(records);
+    test(copy.get_allocator() == records.get_allocator(), "Copy does not share pools.");
+    RecordMap assigned;
+    assigned = copy;
+    test(assigned.get_allocator().pools() == pools, "Assignment did not adopt pools.");
+  }
+
+  auto shared = std::allocate_shared<Record>(PoolAllocator<Record>(pools), 42);
+  test(shared->m_value == 42, "Bad shared value.");
+
+  // The pools (and their slabs) are freed with the last object allocated from them.
+  pools.reset();
+  test(!watcher.expired(), "Pools freed while an object still uses them.");
+  shared.reset();
+  test(watcher.expired(), "Pools not freed with their last object.");
+
+  // Without pools, objects come from the heap.
+  auto unpooled = std::allocate_shared<Record>(PoolAllocator<Record>(), 7);
+  test(unpooled->m_value == 7, "Bad unpooled value.");
+
+  // Several threads may allocate from the same pools at once, and objects
+  // may be released on a different thread than the one that created them.
+  pools = std::make_shared<MemoryPools>();
+  std::vector<std::shared_ptr<Record> > handedOff;
+  for (int ii = 0; ii < 1000; ++ii)
+  {
+    handedOff.push_back(std::allocate_shared<Record>(PoolAllocator<Record>(pools), ii));
+  }
+  std::vector<std::thread> threads;
+  threads.push_back(std::thread([&handedOff]() { handedOff.clear(); }));
+  for (int tt = 0; tt < 4; ++tt)
+  {
+    threads.push_back(std::thread([pools]() {
+      for (int pass = 0; pass < 10; ++pass)
+      {
+        std::vector<std::shared_ptr<Record> > records;
+        for (int ii = 0; ii < 1000; ++ii)
+        {
+          records.push_back(std::allocate_shared<Record>(PoolAllocator<Record>(pools), ii));
+        }
+        for (int ii = 0; ii < 1000; ++ii)
+        {
+          test(records[ii]->m_value == ii, "Allocations from different threads overlap.");
+        }
+      }
+    }));
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+}
+}
+
+int main(int, char* [])
+{
+  testMemoryPool();
+  testContainers();
+  return 0;
+}
@@ -0,0 +1,143 @@
+//=============================================================================
+// Copyright (c) Kitware, Inc.
+// All rights reserved.
+// See LICENSE.txt for details.
+//
+// This software is distributed WITHOUT ANY WARRANTY; without even
+// the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+// PURPOSE.  See the above copyright notice for more information.
+//=============================================================================
+#include "smtk/common/RangeSet.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <set>
+
+using namespace smtk::common;
+
+namespace
+{
+
+typedef RangeSet<int> IntSet;
+
+bool matches(const IntSet& ranges, const std::set<int>& values)
+{
+  if (ranges.size() != values.size())
+  {
+    return false;
+  }
+  return std::equal(values.begin(), values.end(), ranges.begin());
+}
+
+void testInsertAndErase()
+{
+  IntSet values;
+  test(values.empty() && values.size() == 0 && values.begin() == values.end(), "Not empty.");
+
+  for (int ii = 0; ii < 1000; ++ii)
+  {
+    values.insert(ii);
+  }
+  test(values.size() == 1000 && values.numberOfRanges() == 1, "Expected a single run.");
+
+  values.insert(2000, 2999);
+  values.insert(1500);
+  test(values.numberOfRanges() == 3 && values.size() == 2001, "Expected three runs.");
+  test(values.contains(1500) && !values.contains(1499) && values.count(2999) == 1 &&
+      values.count(3000) == 0,
+    "Bad membership.");
+
+  // Filling the gaps merges the runs.
+  values.insert(1000, 1499);
+  values.insert(1501, 1999);
+  test(values.numberOfRanges() == 1 && values.size() == 3000, "Runs were not merged.");
+
+  values.erase(10, 19);
+  values.erase(500);
+  values.erase(-5, 2);
+  test(values.numberOfRanges() == 3 && values.size() == 3000 - 10 - 1 - 3, "Bad erase.");
+  test(!values.contains(10) && !values.contains(19) && values.contains(20) && values.contains(9) &&
+      !values.contains(0) && values.contains(3),
+    "Wrong values erased.");
+  values.erase(0, 5000);
+  test(values.empty(), "Expected everything erased.");
+
+  // Inserting out of order matches std::set.
+  std::set<int> expected;
+  std::srand(1);
+  for (int ii = 0; ii < 2000; ++ii)
+  {
+    int value = std::rand() % 500;
+    values.insert(value);
+    expected.insert(value);
+    if (ii % 3 == 0)
+    {
+      value = std::rand() % 500;
+      values.erase(value);
+      expected.erase(value);
+    }
+  }
+  test(matches(values, expected), "Random inserts and erases do not match std::set.");
+  test(matches(IntSet(expected.begin(), expected.end()), expected), "Bad construction.");
+}
+
+void testSetOperations()
+{
+  std::set<int> aa;
+  std::set<int> bb;
+  std::srand(2);
+  for (int ii = 0; ii < 3000; ++ii)
+  {
+    aa.insert(std::rand() % 2000);
+    bb.insert(std::rand() % 2000 + 500);
+  }
+  aa.insert(5000);
+  bb.insert(4999);
+
+  std::set<int> expected;
+  std::set_union(
+    aa.begin(), aa.end(), bb.begin(), bb.end(), std::inserter(expected, expected.end()));
+  IntSet result(aa.begin(), aa.end());
+  result.unite(IntSet(bb.begin(), bb.end()));
+  test(matches(result, expected), "Bad union.");
+
+  expected.clear();
+  std::set_difference(
+    aa.begin(), aa.end(), bb.begin(), bb.end(), std::inserter(expected, expected.end()));
+  result = IntSet(aa.begin(), aa.end());
+  result.subtract(IntSet(bb.begin(), bb.end()));
+  test(matches(result, expected), "Bad difference.");
+
+  expected.clear();
+  std::set_intersection(
+    aa.begin(), aa.end(), bb.begin(), bb.end(), std::inserter(expected, expected.end()));
+  result = IntSet(aa.begin(), aa.end());
+  result.intersect(IntSet(bb.begin(), bb.end()));
+  test(matches(result, expected), "Bad intersection.");
+
+  // Large runs stay compact.
+  IntSet cells;
+  cells.insert(0, 999999);
+  IntSet holes;
+  for (int ii = 0; ii < 1000000; ii += 1000)
+  {
+    holes.insert(ii, ii + 9);
+  }
+  cells.subtract(holes);
+  test(cells.size() == 990000 && cells.numberOfRanges() == 1000, "Bad difference of runs.");
+  cells.unite(holes);
+  test(cells.numberOfRanges() == 1 && cells.size() == 1000000, "Bad union of runs.");
+  cells.intersect(holes);
+  test(cells == holes, "Bad intersection of runs.");
+}
+}
+
+int main(int, char* [])
+{
+  testInsertAndErase();
+  testSetOperations();
+  return 0;
+}
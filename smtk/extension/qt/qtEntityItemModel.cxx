@@ -30,10 +30,13 @@
 #include <QtCore/QFile>
 #include <QtCore/QVariant>
 
+#include <algorithm>
 #include <deque>
+#include <functional>
 #include <iomanip>
 #include <map>
 #include <sstream>
+#include <unordered_map>
 
 // The following is used to ensure that the QRC file
 // containing the entity-type icons is registered.
@@ -82,6 +85,72 @@ public:
     * with QModelIndex entries.
     */
   std::map<unsigned int, WeakDescriptivePhrasePtr> ptrs;
+
+  /**\brief Store the number of subphrases exposed to Qt by phrase ID.
+    *
+    * A phrase absent from this map exposes at most \a pageSize rows.
+    * Views grow the limit a page at a time with fetchMore().
+    */
+  std::map<unsigned int, int> rowLimits;
+  int pageSize;
+
+  int rowLimit(const DescriptivePhrasePtr& phrase) const
+  {
+    std::map<unsigned int, int>::const_iterator it = this->rowLimits.find(phrase->phraseId());
+    return it == this->rowLimits.end() ? this->pageSize : it->second;
+  }
+
+  /// Return the number of subphrases of \a phrase that Qt may see (building only those).
+  int visibleRows(const DescriptivePhrasePtr& phrase) const
+  {
+    if (!phrase)
+      return 0;
+    if (this->pageSize <= 0)
+      return static_cast<int>(phrase->subphrases().size());
+    int limit = this->rowLimit(phrase);
+    return std::min(limit, static_cast<int>(phrase->leadingSubphrases(limit).size()));
+  }
+
+  /**\brief Return how many of \a count rows inserted at \a row must be announced to Qt.
+    *
+    * Rows inserted past the last visible row stay hidden until fetched.
+    * Rows inserted among visible rows grow the limit so that no visible
+    * row is silently pushed out of view. Upon return, \a limit holds the
+    * row limit to use once the rows have been inserted.
+    */
+  int rowsShownOnInsert(
+    const DescriptivePhrasePtr& phrase, int row, int count, int sizeBefore, int& limit) const
+  {
+    if (this->pageSize <= 0)
+      return count;
+    limit = this->rowLimit(phrase);
+    int shown = 0;
+    for (; shown < count && row + shown < limit; ++shown)
+    {
+      if (sizeBefore + shown >= limit)
+        ++limit;
+    }
+    return shown;
+  }
+
+  /**\brief Return how many of \a count rows removed at \a row must be announced to Qt.
+    *
+    * Upon return, \a limit holds the row limit to use once the rows are erased.
+    */
+  int rowsShownOnRemove(
+    const DescriptivePhrasePtr& phrase, int row, int count, int sizeBefore, int& limit) const
+  {
+    if (this->pageSize <= 0)
+      return count;
+    limit = this->rowLimit(phrase);
+    int visible = std::min(sizeBefore, limit);
+    int shown = std::max(0, std::min(row + count, visible) - row);
+    // Removing hidden rows never changes what is shown; removing visible
+    // rows while hidden rows remain must shrink the limit to match.
+    if (sizeBefore - (count - shown) > limit)
+      limit -= shown;
+    return shown;
+  }
 };
 
 // A visitor functor called by foreach_phrase() to let the view know when to redraw data.
@@ -100,18 +169,27 @@ static bool UpdateSubphrases(
 }
 
 // Callback function, invoked when a new arrangement is added to an entity.
-static int entityModified(ManagerEventType, const smtk::model::EntityRef& ent,
-  const smtk::model::EntityRef&, void* callData)
+static int entityModified(
+  ManagerEventType, const smtk::model::EntityRefArray& ents, void* callData)
 {
   QEntityItemModel* qmodel = static_cast<QEntityItemModel*>(callData);
   if (!qmodel)
     return 1;
 
   // Find EntityPhrase instances under the root node whose relatedEntity
-  // is \a ent and rerun the subphrase generator.
+  // is in \a ents and rerun the subphrase generator.
   // This should in turn invoke callbacks on the QEntityItemModel
   // to handle insertions/deletions.
-  return qmodel->foreach_phrase(UpdateSubphrases, ent) ? -1 : 0;
+  // Events are batched so that each entity is updated once per operation.
+  int status = 0;
+  for (auto ent : ents)
+  {
+    if (qmodel->foreach_phrase(UpdateSubphrases, ent))
+    {
+      status = -1;
+    }
+  }
+  return status;
 }
 
 QEntityItemModel::QEntityItemModel(QObject* owner)
@@ -119,6 +197,7 @@ QEntityItemModel::QEntityItemModel(QObject* owner)
 {
   this->m_deleteOnRemoval = true;
   this->P = new Internal;
+  this->P->pageSize = 256;
   initIconResource();
 }
 
@@ -141,18 +220,20 @@ QColor QEntityItemModel::defaultEntityColor(const std::string& entityType)
 }
 void QEntityItemModel::clear()
 {
-  if (this->m_root && !this->m_root->subphrases().empty())
+  int nrows = this->P->visibleRows(this->m_root);
+  if (nrows > 0)
   {
     // provide an invalid parent since you want to clear all
-    this->beginRemoveRows(QModelIndex(), 0, static_cast<int>(this->m_root->subphrases().size()));
+    this->beginRemoveRows(QModelIndex(), 0, nrows - 1);
     this->m_root = DescriptivePhrasePtr();
+    this->P->rowLimits.clear();
     this->endRemoveRows();
   }
 }
 
 QModelIndex QEntityItemModel::index(int row, int column, const QModelIndex& owner) const
 {
-  if (!this->m_root || this->m_root->subphrases().empty())
+  if (!this->m_root || !this->m_root->hasSubphrases())
     return QModelIndex();
 
   if (owner.isValid() && owner.column() != 0)
@@ -168,7 +249,7 @@ QModelIndex QEntityItemModel::index(int row, int column, const QModelIndex& owne
   DescriptivePhrasePtr ownerPhrase = this->getItem(owner);
   std::string entName = ownerPhrase->relatedEntity().name();
   //  std::cout << "Owner index for: " << entName << std::endl;
-  DescriptivePhrases& subphrases(ownerPhrase->subphrases());
+  DescriptivePhrases& subphrases(ownerPhrase->leadingSubphrases(row + 1));
   if (row >= 0 && row < static_cast<int>(subphrases.size()))
   {
     //std::cout << "index(_"  << ownerPhrase->title() << "_, " << row << ") = " << subphrases[row]->title() << "\n";
@@ -209,25 +290,81 @@ QModelIndex QEntityItemModel::parent(const QModelIndex& child) const
 /// Return true when \a owner has subphrases.
 bool QEntityItemModel::hasChildren(const QModelIndex& owner) const
 {
-  // According to various Qt mailing-list posts, we might
-  // speed things up by always returning true here.
   if (owner.isValid())
   {
     DescriptivePhrasePtr phrase = this->getItem(owner);
     if (phrase)
-    { // Return whether the parent has subphrases.
-      return phrase->subphrases().empty() ? false : true;
+    {
+      // Views ask this of every visible row on each repaint, so do not build
+      // the subtree just to decide whether to draw an expansion indicator.
+      // Phrases keep their generator's answer until they are marked dirty.
+      return phrase->hasSubphrases();
     }
   }
   // Return whether the toplevel m_phrases list is empty.
-  return (this->m_root ? (this->m_root->subphrases().empty() ? false : true) : false);
+  return this->m_root ? this->m_root->hasSubphrases() : false;
 }
 
-/// The number of rows in the table "underneath" \a owner.
+/// The number of rows in the table "underneath" \a owner that have been fetched.
 int QEntityItemModel::rowCount(const QModelIndex& owner) const
 {
   DescriptivePhrasePtr ownerPhrase = this->getItem(owner);
-  return static_cast<int>(ownerPhrase->subphrases().size());
+  return this->P->visibleRows(ownerPhrase);
+}
+
+/// Return true when \a owner has subphrases not yet exposed to Qt.
+bool QEntityItemModel::canFetchMore(const QModelIndex& owner) const
+{
+  DescriptivePhrasePtr ownerPhrase = this->getItem(owner);
+  if (!ownerPhrase || this->P->pageSize <= 0)
+    return false;
+
+  // Phrases built a page at a time may have more subphrases to generate.
+  if (ownerPhrase->areSubphrasesPaged())
+    return true;
+
+  return ownerPhrase->areSubphrasesBuilt() &&
+    static_cast<int>(ownerPhrase->subphrases().size()) > this->P->visibleRows(ownerPhrase);
+}
+
+/// Expose the next page of subphrases of \a owner to Qt.
+void QEntityItemModel::fetchMore(const QModelIndex& owner)
+{
+  DescriptivePhrasePtr ownerPhrase = this->getItem(owner);
+  if (!ownerPhrase || this->P->pageSize <= 0)
+    return;
+
+  // Generate just the next page of subphrases.
+  int shown = this->P->visibleRows(ownerPhrase);
+  int total =
+    static_cast<int>(ownerPhrase->leadingSubphrases(shown + this->P->pageSize).size());
+  int more = std::min(total - shown, this->P->pageSize);
+  if (more <= 0)
+    return;
+
+  this->beginInsertRows(owner, shown, shown + more - 1);
+  this->P->rowLimits[ownerPhrase->phraseId()] = shown + more;
+  this->endInsertRows();
+}
+
+/**\brief Set the number of subphrases exposed to Qt at a time.
+  *
+  * Changing the page size resets the model.
+  */
+void QEntityItemModel::setPageSize(int rows)
+{
+  if (rows == this->P->pageSize)
+    return;
+
+  this->beginResetModel();
+  this->P->pageSize = rows;
+  this->P->rowLimits.clear();
+  this->endResetModel();
+}
+
+int QEntityItemModel::pageSize() const
+{
+  return this->P->pageSize;
 }
 
 /// Return something to display in the table header.
@@ -506,14 +643,11 @@ bool QEntityItemModel::removeRows(int position, int rows, const QModelIndex& par
   if (rows <= 0 || position < 0)
     return false;
 
-  this->beginRemoveRows(parentIdx, position, position + rows - 1);
   DescriptivePhrasePtr phrase = this->getItem(parentIdx);
-  if (phrase)
-  {
-    phrase->subphrases().erase(
-      phrase->subphrases().begin() + position, phrase->subphrases().begin() + position + rows);
-  }
-  this->endRemoveRows();
+  if (!phrase || position + rows > static_cast<int>(phrase->subphrases().size()))
+    return false;
+
+  this->eraseSubphrases(phrase, parentIdx, true, position, rows);
   return true;
 }
 
@@ -800,6 +934,7 @@ DescriptivePhrasePtr QEntityItemModel::getItem(const QModelIndex& idx) const
     else
     { // The phrase has disappeared. Remove the weak pointer from the freelist.
       this->P->ptrs.erase(phraseIdx);
+      this->P->rowLimits.erase(phraseIdx);
     }
   }
   return this->m_root;
@@ -807,21 +942,102 @@ DescriptivePhrasePtr QEntityItemModel::getItem(const QModelIndex& idx) const
 
 void QEntityItemModel::rebuildSubphrases(const QModelIndex& qidx)
 {
-  int nrows = this->rowCount(qidx);
   DescriptivePhrasePtr phrase = this->getItem(qidx);
+  if (!phrase)
+    return;
 
-  this->removeRows(0, nrows, qidx);
-  if (phrase)
-    phrase->markDirty(true);
+  int nrows = this->rowCount(qidx);
+  if (nrows > 0)
+  {
+    this->beginRemoveRows(qidx, 0, nrows - 1);
+    // Discard only what was built; there is no need to generate the rest first.
+    phrase->leadingSubphrases(0).clear();
+    this->P->rowLimits.erase(phrase->phraseId());
+    this->endRemoveRows();
+  }
+  phrase->markDirty(true);
 
-  nrows = phrase ? static_cast<int>(phrase->subphrases().size()) : 0;
-  this->beginInsertRows(qidx, 0, nrows);
-  this->endInsertRows();
+  // Only the first page of regenerated subphrases is announced.
+  nrows = this->P->visibleRows(phrase);
+  if (nrows > 0)
+  {
+    this->beginInsertRows(qidx, 0, nrows - 1);
+    this->endInsertRows();
+  }
   emit dataChanged(qidx, qidx);
 }
 
+void QEntityItemModel::insertSubphrases(const DescriptivePhrasePtr& parntDp,
+  const QModelIndex& qidx, bool exposed, int row, const DescriptivePhrases& phrases)
+{
+  DescriptivePhrases& subs(parntDp->subphrases());
+  int count = static_cast<int>(phrases.size());
+  int sizeBefore = static_cast<int>(subs.size());
+  row = std::min(row, sizeBefore);
+  int limit = 0;
+  int shown =
+    exposed ? this->P->rowsShownOnInsert(parntDp, row, count, sizeBefore, limit) : 0;
+
+  if (shown > 0)
+    this->beginInsertRows(qidx, row, row + shown - 1);
+  subs.insert(subs.begin() + row, phrases.begin(), phrases.end());
+  if (exposed && this->P->pageSize > 0)
+    this->P->rowLimits[parntDp->phraseId()] = limit;
+  if (shown > 0)
+    this->endInsertRows();
+}
+
+void QEntityItemModel::eraseSubphrases(
+  const DescriptivePhrasePtr& parntDp, const QModelIndex& qidx, bool exposed, int row, int count)
+{
+  DescriptivePhrases& subs(parntDp->subphrases());
+  int sizeBefore = static_cast<int>(subs.size());
+  int limit = 0;
+  int shown =
+    exposed ? this->P->rowsShownOnRemove(parntDp, row, count, sizeBefore, limit) : 0;
+
+  if (shown > 0)
+    this->beginRemoveRows(qidx, row, row + shown - 1);
+  subs.erase(subs.begin() + row, subs.begin() + row + count);
+  if (exposed && this->P->pageSize > 0)
+    this->P->rowLimits[parntDp->phraseId()] = limit;
+  if (shown > 0)
+    this->endRemoveRows();
+}
+
 namespace QEntityItemModelInternal
 {
+// Find the index of \a phrase by walking up its parents to the root phrase.
+// Returns false when \a phrase is not attached to the root phrase; otherwise
+// \a result is set (and is invalid when some ancestor's row is not fetched).
+inline bool _internal_getPhraseIndexFromAncestry(smtk::extension::QEntityItemModel* qmodel,
+  const DescriptivePhrasePtr& phrase, QModelIndex& result)
+{
+  DescriptivePhrasePtr root = qmodel->getItem(QModelIndex());
+  std::vector<int> rows;
+  DescriptivePhrasePtr dp;
+  for (dp = phrase; dp && dp != root; dp = dp->parent())
+  {
+    DescriptivePhrasePtr prnt = dp->parent();
+    int row = prnt ? prnt->argFindChild(dp.get()) : -1;
+    if (row < 0)
+      return false;
+    rows.push_back(row);
+  }
+  if (dp != root)
+    return false;
+
+  result = QModelIndex();
+  std::vector<int>::reverse_iterator rit;
+  for (rit = rows.rbegin(); rit != rows.rend(); ++rit)
+  {
+    result = qmodel->index(*rit, 0, result);
+    if (!result.isValid())
+      break;
+  }
+  return true;
+}
+
 inline QModelIndex _internal_getPhraseIndex(smtk::extension::QEntityItemModel* qmodel,
   const DescriptivePhrasePtr& phrase, const QModelIndex& top, bool recursive = false)
 {
@@ -829,9 +1045,14 @@ inline QModelIndex _internal_getPhraseIndex(smtk::extension::QEntityItemModel* q
   if (dp == phrase)
     return top;
 
+  // Most phrases know their parents, which is much faster than searching the tree.
+  QModelIndex found;
+  if (recursive && _internal_getPhraseIndexFromAncestry(qmodel, phrase, found))
+    return found;
+
   // Only look at subphrases if they are already built; otherwise, this can cause
   // infinite recursion when qmodel->rowCount() or ->index() are called.
-  if (dp->areSubphrasesBuilt())
+  if (dp->areSubphrasesBuilt() || dp->areSubphrasesPaged())
   {
     for (int row = 0; row < qmodel->rowCount(top); ++row)
     {
@@ -850,10 +1071,92 @@ inline QModelIndex _internal_getPhraseIndex(smtk::extension::QEntityItemModel* q
   return QModelIndex();
 }
 
+/// Identify what a phrase presents so that old and new subphrases may be matched by hashing.
+struct PhraseKey
+{
+  DescriptivePhraseType type;
+  smtk::common::UUID id;     // The related entity or mesh collection.
+  std::string title;         // Only used by property-value phrases.
+  int propertyType;          // Only used by property-value phrases.
+  smtk::mesh::MeshSet mesh;  // Only used by mesh phrases without a collection.
+
+  PhraseKey(const DescriptivePhrasePtr& phrase)
+    : type(phrase->phraseType())
+    , propertyType(-1)
+  {
+    if (this->type == MESH_SUMMARY)
+    {
+      if (phrase->relatedMeshCollection())
+      {
+        this->id = phrase->relatedMeshCollection()->entity();
+      }
+      else
+      {
+        this->mesh = phrase->relatedMesh();
+      }
+    }
+    else if (phrase->isPropertyValueType())
+    {
+      // Property-value phrases refer to their parent's entity; use their name instead.
+      this->title = phrase->title();
+      this->propertyType = static_cast<int>(phrase->relatedPropertyType());
+    }
+    else
+    {
+      this->id = phrase->relatedEntity().entity();
+    }
+  }
+
+  bool operator==(const PhraseKey& other) const
+  {
+    return this->type == other.type && this->id == other.id && this->title == other.title &&
+      this->propertyType == other.propertyType && this->mesh == other.mesh;
+  }
+};
+
+struct PhraseKeyHash
+{
+  std::size_t operator()(const PhraseKey& key) const
+  {
+    std::size_t result = std::hash<smtk::common::UUID>()(key.id);
+    result ^= std::hash<std::string>()(key.title) + 0x9e3779b9 + (result << 6) + (result >> 2);
+    result ^= static_cast<std::size_t>(key.type) * 31 + static_cast<std::size_t>(key.propertyType);
+    result ^= key.mesh.size();
+    return result;
+  }
+};
+
+typedef std::unordered_map<PhraseKey, int, PhraseKeyHash> PhraseKeyCounts;
+
+// Count how many times each key occurs in \a phrases.
+inline void _internal_countPhraseKeys(const DescriptivePhrases& phrases, PhraseKeyCounts& counts)
+{
+  counts.reserve(phrases.size());
+  for (DescriptivePhrases::const_iterator it = phrases.begin(); it != phrases.end(); ++it)
+  {
+    ++counts[PhraseKey(*it)];
+  }
+}
+
+// Append entries of \a phrases (with their rows) whose keys are not matched by \a counts.
+inline void _internal_unmatchedPhrases(const DescriptivePhrases& phrases, PhraseKeyCounts& counts,
+  std::vector<std::pair<DescriptivePhrasePtr, int> >& unmatched)
+{
+  int row = 0;
+  for (DescriptivePhrases::const_iterator it = phrases.begin(); it != phrases.end(); ++it, ++row)
+  {
+    PhraseKeyCounts::iterator cit = counts.find(PhraseKey(*it));
+    if (cit != counts.end() && cit->second > 0)
+      --cit->second;
+    else
+      unmatched.push_back(std::make_pair(*it, row));
+  }
+}
+
 inline void _internal_findAllExistingPhrases(const DescriptivePhrasePtr& parntDp,
   const smtk::attribute::ModelEntityItemPtr& modEnts, DescriptivePhrases& modifiedPhrases)
 {
-  if (!parntDp || !parntDp->areSubphrasesBuilt())
+  if (!parntDp || !(parntDp->areSubphrasesBuilt() || parntDp->areSubphrasesPaged()))
     return;
 
   smtk::model::DescriptivePhrases& subs(parntDp->subphrases());
@@ -872,7 +1175,7 @@ inline void _internal_findAllExistingPhrases(const DescriptivePhrasePtr& parntDp
 inline void _internal_findAllExistingMeshPhrases(const DescriptivePhrasePtr& parntDp,
   const smtk::attribute::MeshItemPtr& modMeshes, DescriptivePhrases& modifiedPhrases)
 {
-  if (!parntDp || !parntDp->areSubphrasesBuilt())
+  if (!parntDp || !(parntDp->areSubphrasesBuilt() || parntDp->areSubphrasesPaged()))
     return;
 
   smtk::model::DescriptivePhrases& subs(parntDp->subphrases());
@@ -892,7 +1195,7 @@ inline void _internal_updateAllMeshCollectionPhrases(const DescriptivePhrasePtr&
   const smtk::common::UUIDs& collectionIds, DescriptivePhrases& childPhrasesNeedUpdate,
   DescriptivePhrases& collectionPhrases, smtk::mesh::ManagerPtr meshMgr)
 {
-  if (!parntDp || !parntDp->areSubphrasesBuilt())
+  if (!parntDp || !(parntDp->areSubphrasesBuilt() || parntDp->areSubphrasesPaged()))
     return;
 
   smtk::model::DescriptivePhrases& subs(parntDp->subphrases());
@@ -903,7 +1206,7 @@ inline void _internal_updateAllMeshCollectionPhrases(const DescriptivePhrasePtr&
     {
       if ((*it)->relatedMeshCollection() &&
         collectionIds.find((*it)->relatedMeshCollection()->entity()) != collectionIds.end() &&
-        (*it)->areSubphrasesBuilt())
+        ((*it)->areSubphrasesBuilt() || (*it)->areSubphrasesPaged()))
       {
         // for the MeshPhrase of a modified collection, the phrase itself has to be re-setup,
         // so that its child phrases will have the updated MeshSets in the collection
@@ -934,57 +1237,66 @@ void QEntityItemModel::addChildPhrases(const DescriptivePhrasePtr& parntDp,
   bool descend)
 {
   QModelIndex qidx;
+  // A phrase without an index is hidden (its row has not been fetched yet),
+  // so its subphrases may be modified without notifying views.
+  bool exposed = true;
   if (parntDp != this->m_root)
   {
     qidx = (QEntityItemModelInternal::_internal_getPhraseIndex(this, parntDp, topIndex, descend));
-    if (!qidx.isValid())
-    {
-      std::cerr << "Can't find valid QModelIndex for phrase: " << parntDp->title() << "\n";
-      return;
-    }
+    exposed = qidx.isValid();
   }
 
-  if (!parntDp->areSubphrasesBuilt())
+  if (!parntDp->areSubphrasesBuilt() && !parntDp->areSubphrasesPaged())
   {
-    this->rebuildSubphrases(qidx);
+    // Unbuilt subphrases will include the new entries when they are generated,
+    // but whether the phrase has any may have changed.
+    if (exposed)
+      this->rebuildSubphrases(qidx);
+    else
+      parntDp->markDirty(true);
     return;
   }
 
   EntityListPhrasePtr lphrase = smtk::dynamic_pointer_cast<EntityListPhrase>(parntDp);
-  DescriptivePhrases& subrefs(parntDp->subphrases());
   int row = 0;
-  // iterate all subphrases, if child is part of newDphrs, insert an QModelIndex
-  // smtk::model::DescriptivePhrases subs = parntDp->subphrases();
-  // DescriptivePhrases listPhrases;
   std::vector<std::pair<DescriptivePhrasePtr, int> >::const_iterator it;
-  for (it = newDphrs.begin(); it != newDphrs.end(); ++it)
+  // for entity list phrase we are rebuliding subphrases, so no need to track individual rows.
+  // for rootIndex, the sessionRef should already be in the relatedEntities with
+  // newSessionOperatorResult()
+  if (lphrase && lphrase != this->m_root)
   {
-    // this sub is new, insert the QModelIndex for it
-    row = it->second;
-    if (row < 0)
-      continue;
-    // for entity list phrase we are rebuliding subphrases, so no need to track individual rows.
-    // for rootIndex, the sessionRef should already be in the relatedEntities with newSessionOperatorResult()
-    if (lphrase && lphrase != this->m_root)
+    for (it = newDphrs.begin(); it != newDphrs.end(); ++it)
     {
-      lphrase->relatedEntities().push_back(it->first->relatedEntity());
-    }
-    else if (parntDp == this->m_root || qidx.isValid())
-    {
-      this->beginInsertRows(qidx, row, row);
-      if (row >= static_cast<int>(parntDp->subphrases().size()))
-        parntDp->subphrases().push_back(it->first);
-      else
-        parntDp->subphrases().insert(subrefs.begin() + row, it->first);
-      this->endInsertRows();
+      if (it->second >= 0)
+        lphrase->relatedEntities().push_back(it->first->relatedEntity());
     }
+    if (exposed)
+      this->rebuildSubphrases(qidx);
+    else
+      lphrase->markDirty(true);
+    return;
   }
 
-  if (lphrase && lphrase != this->m_root)
+  // Insert each run of consecutive new rows with a single notification.
+  it = newDphrs.begin();
+  while (it != newDphrs.end())
   {
-    this->rebuildSubphrases(qidx);
-    return;
+    if (it->second < 0)
+    {
+      ++it;
+      continue;
+    }
+    row = it->second;
+    DescriptivePhrases run(1, it->first);
+    for (++it; it != newDphrs.end() && it->second == row + static_cast<int>(run.size()); ++it)
+    {
+      run.push_back(it->first);
+    }
+    this->insertSubphrases(parntDp, qidx, exposed, row, run);
+    row += static_cast<int>(run.size()) - 1;
   }
+  if (!exposed)
+    return;
 
   /* TODO: We need to handle the case when adding new subphrases will create a Entity_List
 
@@ -1026,12 +1338,13 @@ void QEntityItemModel::addChildPhrases(const DescriptivePhrasePtr& parntDp,
 void QEntityItemModel::removeChildPhrases(const DescriptivePhrasePtr& parntDp,
   const std::vector<std::pair<DescriptivePhrasePtr, int> >& remDphrs, const QModelIndex& topIndex)
 {
-  QModelIndex qidx(
-    QEntityItemModelInternal::_internal_getPhraseIndex(this, parntDp, topIndex, true));
-  if (!qidx.isValid())
+  QModelIndex qidx;
+  bool exposed = true;
+  if (parntDp != this->m_root)
   {
-    std::cerr << "Can't find valid QModelIndex for phrase: " << parntDp->title() << "\n";
-    return;
+    qidx = QEntityItemModelInternal::_internal_getPhraseIndex(this, parntDp, topIndex, true);
+    // A phrase without an index is hidden, so no rows need to be announced.
+    exposed = qidx.isValid();
   }
 
   std::vector<std::pair<DescriptivePhrasePtr, int> >::const_reverse_iterator rit;
@@ -1040,37 +1353,35 @@ void QEntityItemModel::removeChildPhrases(const DescriptivePhrasePtr& parntDp,
   // in case this is a entity_list phrase,
   EntityListPhrasePtr lphrase = smtk::dynamic_pointer_cast<EntityListPhrase>(parntDp);
 
-  // if child is part of remDphrs, remove the QModelIndex
-  DescriptivePhrases& subs(parntDp->subphrases());
-  for (rit = remDphrs.rbegin(); rit != remDphrs.rend(); ++rit)
+  // Remove runs of consecutive rows (last to first) with a single notification each.
+  rit = remDphrs.rbegin();
+  while (rit != remDphrs.rend())
   {
     row = rit->second;
-    //      this->removeRows(row, row, qidx);
-    this->beginRemoveRows(qidx, row, row);
-    subs.erase(subs.begin() + row);
-
-    if (lphrase)
+    int count = 0;
+    for (; rit != remDphrs.rend() && rit->second == row - count; ++rit, ++count)
     {
-      EntityRefArray::iterator it = std::find(lphrase->relatedEntities().begin(),
-        lphrase->relatedEntities().end(), rit->first->relatedEntity());
-      if (it != lphrase->relatedEntities().end())
-        lphrase->relatedEntities().erase(it);
+      if (lphrase)
+      {
+        EntityRefArray::iterator it = std::find(lphrase->relatedEntities().begin(),
+          lphrase->relatedEntities().end(), rit->first->relatedEntity());
+        if (it != lphrase->relatedEntities().end())
+          lphrase->relatedEntities().erase(it);
+      }
     }
-
-    this->endRemoveRows();
+    this->eraseSubphrases(parntDp, qidx, exposed, row - count + 1, count);
   }
 
-  if (lphrase && lphrase->relatedEntities().size() == 0)
+  if (lphrase && lphrase->relatedEntities().size() == 0 && lphrase->parent())
   {
     QModelIndex parentIdx = qidx.parent();
 
     int parId = lphrase->indexInParent();
-    this->beginRemoveRows(parentIdx, parId, parId);
-    lphrase->parent()->subphrases().erase(lphrase->parent()->subphrases().begin() + parId);
-    this->endRemoveRows();
-    emit dataChanged(parentIdx, parentIdx);
+    this->eraseSubphrases(lphrase->parent(), parentIdx, exposed, parId, 1);
+    if (exposed)
+      emit dataChanged(parentIdx, parentIdx);
   }
-  else
+  else if (exposed)
   {
     emit dataChanged(qidx, qidx);
   }
@@ -1111,67 +1422,29 @@ void QEntityItemModel::updateChildPhrases(
   // from the \a ent (such as add to or remove from a group)
   // This will NOT update subphrases of parntDp, and should not.
 
-  smtk::model::DescriptivePhrases newSubs = this->m_root->findDelegate()->subphrases(phrase);
-  smtk::model::DescriptivePhrases& origSubs(phrase->subphrases());
-
-  // find what's going to be removed with proper indices
+  // Subphrases that were never built will be generated fresh when Qt asks for them.
   std::vector<std::pair<DescriptivePhrasePtr, int> > remDphrs;
-  int remIdx = 0;
-  bool found = false;
-  for (smtk::model::DescriptivePhrases::iterator it = origSubs.begin(); it != origSubs.end();
-       ++it, ++remIdx)
+  std::vector<std::pair<DescriptivePhrasePtr, int> > newDphrs;
+  if (phrase->areSubphrasesBuilt() || phrase->areSubphrasesPaged())
   {
-    found = false;
-    EntityRef related = (*it)->relatedEntity();
-    for (smtk::model::DescriptivePhrases::iterator nit = newSubs.begin(); nit != newSubs.end();
-         ++nit)
-    {
-      if ((*it)->phraseType() != (*nit)->phraseType())
-        continue;
-      if ( // mesh phrases
-        ((*it)->phraseType() == MESH_SUMMARY &&
-          (((*it)->relatedMeshCollection() &&
-             (*it)->relatedMeshCollection()->entity() ==
-               (*nit)->relatedMeshCollection()->entity()) ||
-            (!(*it)->relatedMesh().is_empty() && (*it)->relatedMesh() == (*nit)->relatedMesh()))) ||
-        // model phrases
-        ((*it)->phraseType() != MESH_SUMMARY && related == (*nit)->relatedEntity()))
-      {
-        found = true;
-        break;
-      }
-    }
-
-    if (!found)
-      remDphrs.push_back(std::make_pair(*it, remIdx));
+    smtk::model::DescriptivePhrases newSubs = this->m_root->findDelegate()->subphrases(phrase);
+    smtk::model::DescriptivePhrases& origSubs(phrase->subphrases());
+
+    // Match old and new subphrases by key (counting duplicates) in linear time.
+    // Whatever in the original list is unmatched has been removed, with proper indices.
+    QEntityItemModelInternal::PhraseKeyCounts newCounts;
+    QEntityItemModelInternal::_internal_countPhraseKeys(newSubs, newCounts);
+    QEntityItemModelInternal::_internal_unmatchedPhrases(origSubs, newCounts, remDphrs);
+
+    // find what's new with proper indices
+    QEntityItemModelInternal::PhraseKeyCounts origCounts;
+    QEntityItemModelInternal::_internal_countPhraseKeys(origSubs, origCounts);
+    QEntityItemModelInternal::_internal_unmatchedPhrases(newSubs, origCounts, newDphrs);
   }
-
-  // find what's new with proper indices
-  std::vector<std::pair<DescriptivePhrasePtr, int> > newDphrs;
-  int newIdx = 0;
-  for (smtk::model::DescriptivePhrases::iterator it = newSubs.begin(); it != newSubs.end();
-       ++it, ++newIdx)
+  else
   {
-    int origId = -1;
-    if ((*it)->phraseType() == MESH_SUMMARY)
-    {
-      if ((*it)->relatedMeshCollection())
-        origId = phrase->argFindChild((*it)->relatedMeshCollection());
-      else
-        origId = phrase->argFindChild((*it)->relatedMesh());
-    }
-    else if ((*it)->isPropertyValueType())
-    {
-      // for property_value subphrases, we can't use the related entity to find child index,
-      // because PropertyValuePhrase refers to its parent's entity.
-      origId = phrase->argFindChild((*it)->title(), (*it)->relatedPropertyType());
-    }
-    else
-    {
-      origId = phrase->argFindChild((*it)->relatedEntity());
-    }
-    if (origId < 0)
-      newDphrs.push_back(std::make_pair(*it, newIdx));
+    // Forget whether the phrase had subphrases; the entity may have gained or lost some.
+    phrase->markDirty(true);
   }
 
   // remove non-existing first, then add new ones
@@ -1184,13 +1457,9 @@ void QEntityItemModel::updateChildPhrases(
   {
     QModelIndex qidx(
       QEntityItemModelInternal::_internal_getPhraseIndex(this, phrase, topIndex, true));
-    if (!qidx.isValid())
-    {
-      std::cerr << "Can't find valid QModelIndex for phrase: " << phrase->title() << "\n";
-      return;
-    }
-
-    emit dataChanged(qidx, qidx);
+    // Phrases in pages that have not been fetched have nothing to redraw.
+    if (qidx.isValid())
+      emit dataChanged(qidx, qidx);
   }
 }
 
@@ -1290,6 +1559,23 @@ void QEntityItemModel::findDirectParentPhrasesForAdd(
     changedPhrases
   /*,std::map<DescriptivePhrasePtr, DescriptivePhrases>& newLists*/)
 {
+  // Phrases whose subphrases were never built have no rows to update;
+  // they will include new entities when Qt first asks for their rows.
+  if (parntDp != this->m_root &&
+    !(parntDp->areSubphrasesBuilt() || parntDp->areSubphrasesPaged()))
+    return;
+
+  // Index the existing subphrases by entity so matching them is not quadratic.
+  std::unordered_map<smtk::common::UUID, int> existingRows;
+  DescriptivePhrases& origSubs(parntDp->subphrases());
+  existingRows.reserve(origSubs.size());
+  int origIdx = 0;
+  for (DescriptivePhrases::iterator oit = origSubs.begin(); oit != origSubs.end();
+       ++oit, ++origIdx)
+  {
+    existingRows.insert(std::make_pair((*oit)->relatedEntity().entity(), origIdx));
+  }
+
   smtk::model::DescriptivePhrases newSubs = this->m_root->findDelegate()->subphrases(parntDp);
   int newIdx = 0;
   for (smtk::model::DescriptivePhrases::iterator it = newSubs.begin(); it != newSubs.end();
@@ -1357,12 +1643,13 @@ void QEntityItemModel::findDirectParentPhrasesForAdd(
     }
     else if ((*it)->phraseType() != MESH_SUMMARY) // skip meshes
     {
-      int origId = parntDp->argFindChild(related);
+      std::unordered_map<smtk::common::UUID, int>::const_iterator found =
+        existingRows.find(related.entity());
       // we only want to descend with the built subphrases that
       // are already inside its parents.
-      if (origId >= 0)
+      if (found != existingRows.end())
         this->findDirectParentPhrasesForAdd(
-          parntDp->subphrases()[origId], newEnts, changedPhrases /*, newLists*/);
+          origSubs[found->second], newEnts, changedPhrases /*, newLists*/);
     }
   }
 }
@@ -1409,7 +1696,8 @@ void QEntityItemModel::updateWithOperatorResult(
   std::map<DescriptivePhrasePtr,
     std::vector<std::pair<DescriptivePhrasePtr, int> > >::const_iterator pit;
   smtk::attribute::ModelEntityItem::Ptr remEnts = result->findModelEntity("expunged");
-  if (remEnts && remEnts->numberOfValues() > 0 && startPhr->areSubphrasesBuilt())
+  if (remEnts && remEnts->numberOfValues() > 0 &&
+    (startPhr->areSubphrasesBuilt() || startPhr->areSubphrasesPaged()))
   {
     this->findDirectParentPhrasesForRemove(startPhr, remEnts, changedPhrases);
     for (pit = changedPhrases.begin(); pit != changedPhrases.end(); ++pit)
@@ -1418,7 +1706,8 @@ void QEntityItemModel::updateWithOperatorResult(
 
   changedPhrases.clear();
   smtk::attribute::MeshItem::Ptr remMeshes = result->findMesh("mesh_expunged");
-  if (remMeshes && remMeshes->numberOfValues() > 0 && startPhr->areSubphrasesBuilt())
+  if (remMeshes && remMeshes->numberOfValues() > 0 &&
+    (startPhr->areSubphrasesBuilt() || startPhr->areSubphrasesPaged()))
   {
     this->findDirectParentPhrasesForRemove(startPhr, remMeshes, changedPhrases);
     for (pit = changedPhrases.begin(); pit != changedPhrases.end(); ++pit)
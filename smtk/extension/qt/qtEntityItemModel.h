@@ -39,6 +39,13 @@ namespace extension
   * The filter is used to alter the available subphrases of each
   * descriptive phrase for presentation. For instance, you may write a
   * filter that omits descriptions of attributes on model items.
+  *
+  * Rows are exposed to Qt in pages (see setPageSize()): a phrase with
+  * many subphrases initially reports only the first page of rows and
+  * views request more via canFetchMore() and fetchMore() as the user
+  * scrolls. Subphrases are only generated when Qt asks about the rows
+  * of a phrase, and operator results are reconciled against existing
+  * subphrases by hashing rather than pairwise comparison.
   */
 class SMTKQTEXT_EXPORT QEntityItemModel : public QAbstractItemModel
 {
@@ -73,6 +80,12 @@ public:
   bool hasChildren(const QModelIndex& parent) const override;
 
   int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+  bool canFetchMore(const QModelIndex& parent) const override;
+  void fetchMore(const QModelIndex& parent) override;
+
+  /// Set/get the number of rows exposed at a time for each phrase (0 or less shows every row).
+  void setPageSize(int rows);
+  int pageSize() const;
   int columnCount(const QModelIndex& inParent = QModelIndex()) const override
   {
     (void)inParent;
@@ -141,6 +154,13 @@ protected:
 
   void updateObserver();
 
+  // insert \a phrases as consecutive subphrases of \a pDphr at \a row, announcing visible rows
+  void insertSubphrases(const model::DescriptivePhrasePtr& pDphr, const QModelIndex& qidx,
+    bool exposed, int row, const model::DescriptivePhrases& phrases);
+  // erase \a count consecutive subphrases of \a pDphr at \a row, announcing visible rows
+  void eraseSubphrases(const model::DescriptivePhrasePtr& pDphr, const QModelIndex& qidx,
+    bool exposed, int row, int count);
+
   // create child indices for new subphrases \a cDphrs under parent phrase \a pDphr index
   virtual void addChildPhrases(const model::DescriptivePhrasePtr& pDphr,
     const std::vector<std::pair<model::DescriptivePhrasePtr, int> >& cDphrs,
@@ -183,7 +203,8 @@ bool QEntityItemModel::foreach_phrase(
     // Do not descend if top's corresponding phrase would have to invoke
     // the subphrase generator to obtain the list of children... some models
     // are cyclic graphs. In these cases, only descend if "onlyBuilt" is false.
-    if (phrase && (!onlyBuilt || phrase->areSubphrasesBuilt()))
+    if (phrase &&
+      (!onlyBuilt || phrase->areSubphrasesBuilt() || phrase->areSubphrasesPaged()))
     {
       for (int row = 0; row < this->rowCount(top); ++row)
       {
@@ -207,7 +228,8 @@ bool QEntityItemModel::foreach_phrase(
     // Do not descend if top's corresponding phrase would have to invoke
     // the subphrase generator to obtain the list of children... some models
     // are cyclic graphs. In these cases, only descend if "onlyBuilt" is false.
-    if (phrase && (!onlyBuilt || phrase->areSubphrasesBuilt()))
+    if (phrase &&
+      (!onlyBuilt || phrase->areSubphrasesBuilt() || phrase->areSubphrasesPaged()))
     {
       for (int row = 0; row < this->rowCount(top); ++row)
       {
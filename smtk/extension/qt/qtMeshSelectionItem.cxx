@@ -74,8 +74,8 @@ public:
     this->ButtonGroup->setExclusive(exlusive);
   }
 
-  void modifyOutSelection(
-    const smtk::common::UUID& entid, const std::set<int> vals, MeshModifyMode opType)
+  void modifyOutSelection(const smtk::common::UUID& entid,
+    const MeshSelectionItem::ValueSet& vals, MeshModifyMode opType)
   {
     if (opType == RESET)
     {
@@ -83,18 +83,15 @@ public:
     }
     else if (opType == MERGE)
     {
-      m_outSelection[entid].insert(vals.begin(), vals.end());
+      m_outSelection[entid].unite(vals);
     }
     else if (opType == SUBTRACT)
     {
-      std::set<int> diffSet;
-      std::set_difference(m_outSelection[entid].begin(), m_outSelection[entid].end(), vals.begin(),
-        vals.end(), std::inserter(diffSet, diffSet.end()));
-      m_outSelection[entid] = diffSet;
+      m_outSelection[entid].subtract(vals);
     }
   }
 
-  std::map<smtk::common::UUID, std::set<int> > m_outSelection;
+  std::map<smtk::common::UUID, MeshSelectionItem::ValueSet> m_outSelection;
 };
 
 qtMeshSelectionItem::qtMeshSelectionItem(smtk::attribute::ItemPtr dataObj, QWidget* p,
@@ -366,7 +363,7 @@ void qtMeshSelectionItem::updateInputSelection(
   this->clearSelection();
 
   int totalVals = 0;
-  smtk::attribute::MeshSelectionItem::const_sel_map_it mapIt;
+  std::map<smtk::common::UUID, std::set<int> >::const_iterator mapIt;
   for (mapIt = selectionValues.begin(); mapIt != selectionValues.end(); ++mapIt)
     totalVals += static_cast<int>(mapIt->second.size());
 
@@ -383,7 +380,8 @@ void qtMeshSelectionItem::updateInputSelection(
       case SUBTRACT:
         if (meshSelectionItem->isCtrlKeyDown() || totalVals > 1)
         {
-          this->Internals->modifyOutSelection(mapIt->first, mapIt->second, opType);
+          this->Internals->modifyOutSelection(mapIt->first,
+            MeshSelectionItem::ValueSet(mapIt->second.begin(), mapIt->second.end()), opType);
           meshSelectionItem->setValues(mapIt->first, this->Internals->m_outSelection[mapIt->first]);
         }
         else if (totalVals == 1)
@@ -541,6 +539,6 @@ void qtMeshSelectionItem::syncWithCachedSelection(
   {
     for (mapIt = this->Internals->m_outSelection.begin();
          mapIt != this->Internals->m_outSelection.end(); ++mapIt)
-      outSelectionValues[mapIt->first] = this->Internals->m_outSelection[mapIt->first];
+      outSelectionValues[mapIt->first] = std::set<int>(mapIt->second.begin(), mapIt->second.end());
   }
 }
@@ -29,6 +29,7 @@
 #include "vtkCellData.h"
 #include "vtkDataArray.h"
 #include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
 #include "vtkIdTypeArray.h"
 #include "vtkIntArray.h"
 #include "vtkNew.h"
@@ -36,6 +37,7 @@
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkSmartPointer.h"
+#include "vtkTypeInt64Array.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 #include "vtkUnstructuredGridWriter.h"
@@ -115,6 +117,42 @@ bool ExportVTKData::operator()(const std::string& filename, smtk::mesh::Collecti
 namespace
 {
 
+// Construct a VTK array holding a copy of a cell or point field's values as
+// values of type <ValueType>.
+template <typename ArrayType, typename ValueType, typename Field>
+vtkSmartPointer<vtkDataArray> fieldArray(const Field& field)
+{
+  typedef typename ArrayType::ValueType ArrayValueType;
+  static_assert(sizeof(ArrayValueType) == sizeof(ValueType), "mismatched field value size");
+  vtkIdType numberOfValues = static_cast<vtkIdType>(field.size() * field.dimension());
+  ArrayValueType* data = new ArrayValueType[numberOfValues];
+  field.get(reinterpret_cast<ValueType*>(data));
+
+  vtkSmartPointer<ArrayType> array = vtkSmartPointer<ArrayType>::New();
+  array->SetName(field.name().c_str());
+  array->SetArray(data, numberOfValues, false, ArrayType::VTK_DATA_ARRAY_DELETE);
+  array->SetNumberOfComponents(static_cast<int>(field.dimension()));
+  return array;
+}
+
+// Construct a VTK array of the type in which a cell or point field stores its
+// values.
+template <typename Field>
+vtkSmartPointer<vtkDataArray> fieldArray(const Field& field)
+{
+  switch (field.type())
+  {
+    case smtk::mesh::FieldType::Float:
+      return fieldArray<vtkFloatArray, float>(field);
+    case smtk::mesh::FieldType::Integer:
+      return fieldArray<vtkIntArray, int>(field);
+    case smtk::mesh::FieldType::Integer64:
+      return fieldArray<vtkTypeInt64Array, std::int64_t>(field);
+    default:
+      return fieldArray<vtkDoubleArray, double>(field);
+  }
+}
+
 // functions to shunt past data transfer if input and output types match
 void constructNewArrayIfNecessary(vtkIdType*&, vtkIdType*&, std::int64_t)
 {
@@ -286,30 +324,14 @@ void ExportVTKData::operator()(
       meshset.subset(static_cast<smtk::mesh::DimensionType>(dimension)).cellFields();
     for (auto& cellfield : cellfields)
     {
-      double* cellData = new double[cellfield.size() * cellfield.dimension()];
-      cellfield.get(cellData);
-
-      vtkNew<vtkDoubleArray> cellDataArray;
-      cellDataArray->SetName(cellfield.name().c_str());
-      cellDataArray->SetArray(cellData, cellfield.size() * cellfield.dimension(), false,
-        vtkDoubleArray::VTK_DATA_ARRAY_DELETE);
-      cellDataArray->SetNumberOfComponents(static_cast<int>(cellfield.dimension()));
-      pd->GetCellData()->AddArray(cellDataArray.GetPointer());
+      pd->GetCellData()->AddArray(fieldArray(cellfield));
     }
 
     std::set<smtk::mesh::PointField> pointfields =
       meshset.subset(static_cast<smtk::mesh::DimensionType>(dimension)).pointFields();
     for (auto& pointfield : pointfields)
     {
-      double* pointData = new double[pointfield.size() * pointfield.dimension()];
-      pointfield.get(pointData);
-
-      vtkNew<vtkDoubleArray> pointDataArray;
-      pointDataArray->SetName(pointfield.name().c_str());
-      pointDataArray->SetArray(pointData, pointfield.size() * pointfield.dimension(), false,
-        vtkDoubleArray::VTK_DATA_ARRAY_DELETE);
-      pointDataArray->SetNumberOfComponents(static_cast<int>(pointfield.dimension()));
-      pd->GetPointData()->AddArray(pointDataArray.GetPointer());
+      pd->GetPointData()->AddArray(fieldArray(pointfield));
     }
   }
 }
@@ -421,29 +443,13 @@ void ExportVTKData::operator()(
     std::set<smtk::mesh::CellField> cellfields = meshset.cellFields();
     for (auto& cellfield : cellfields)
     {
-      double* cellData = new double[cellfield.size() * cellfield.dimension()];
-      cellfield.get(cellData);
-
-      vtkNew<vtkDoubleArray> cellDataArray;
-      cellDataArray->SetName(cellfield.name().c_str());
-      cellDataArray->SetArray(cellData, cellfield.size() * cellfield.dimension(), false,
-        vtkDoubleArray::VTK_DATA_ARRAY_DELETE);
-      cellDataArray->SetNumberOfComponents(static_cast<int>(cellfield.dimension()));
-      ug->GetCellData()->AddArray(cellDataArray.GetPointer());
+      ug->GetCellData()->AddArray(fieldArray(cellfield));
     }
 
     std::set<smtk::mesh::PointField> pointfields = meshset.pointFields();
     for (auto& pointfield : pointfields)
     {
-      double* pointData = new double[pointfield.size() * pointfield.dimension()];
-      pointfield.get(pointData);
-
-      vtkNew<vtkDoubleArray> pointDataArray;
-      pointDataArray->SetName(pointfield.name().c_str());
-      pointDataArray->SetArray(pointData, pointfield.size() * pointfield.dimension(), false,
-        vtkDoubleArray::VTK_DATA_ARRAY_DELETE);
-      pointDataArray->SetNumberOfComponents(static_cast<int>(pointfield.dimension()));
-      ug->GetPointData()->AddArray(pointDataArray.GetPointer());
+      ug->GetPointData()->AddArray(fieldArray(pointfield));
     }
   }
 }
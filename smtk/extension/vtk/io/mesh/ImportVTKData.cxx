@@ -63,6 +63,33 @@ namespace mesh
 namespace
 {
 
+// Return the type in which the values of a VTK array are stored as a field, or
+// MaxFieldType if the array cannot be stored as a field.
+smtk::mesh::FieldType fieldTypeOf(vtkDataArray* array)
+{
+  if (array == nullptr || !array->HasStandardMemoryLayout())
+  {
+    return smtk::mesh::FieldType::MaxFieldType;
+  }
+
+  switch (array->GetDataType())
+  {
+    case VTK_DOUBLE:
+      return smtk::mesh::FieldType::Double;
+    case VTK_FLOAT:
+      return smtk::mesh::FieldType::Float;
+    case VTK_INT:
+      return smtk::mesh::FieldType::Integer;
+    case VTK_LONG:
+    case VTK_LONG_LONG:
+      return array->GetDataTypeSize() == sizeof(std::int64_t)
+        ? smtk::mesh::FieldType::Integer64
+        : smtk::mesh::FieldType::MaxFieldType;
+    default:
+      return smtk::mesh::FieldType::MaxFieldType;
+  }
+}
+
 smtk::mesh::CellType vtkToSMTKCell(int t)
 {
   smtk::mesh::CellType ctype = smtk::mesh::CellType_MAX;
@@ -318,26 +345,28 @@ bool ImportVTKData::operator()(vtkPolyData* polydata, smtk::mesh::CollectionPtr
     mesh = smtk::mesh::MeshSet(collection->shared_from_this(), iface->getRoot(), entities);
   }
 
-  // Now that we have a valid meshset, we add double-valued vtk cell & point data to it.
+  // Now that we have a valid meshset, we add numeric vtk cell & point data to it.
   if (!mesh.is_empty())
   {
     for (vtkIdType i = 0; i < polydata->GetCellData()->GetNumberOfArrays(); i++)
     {
-      vtkDoubleArray* array = vtkDoubleArray::SafeDownCast(polydata->GetCellData()->GetArray(i));
-      if (array != nullptr)
+      vtkDataArray* array = polydata->GetCellData()->GetArray(i);
+      smtk::mesh::FieldType type = fieldTypeOf(array);
+      if (type != smtk::mesh::FieldType::MaxFieldType)
       {
-        mesh.createCellField(array->GetName(), array->GetNumberOfComponents(),
-          static_cast<const double*>(array->GetVoidPointer(0)));
+        mesh.createCellField(
+          array->GetName(), array->GetNumberOfComponents(), type, array->GetVoidPointer(0));
       }
     }
 
     for (vtkIdType i = 0; i < polydata->GetPointData()->GetNumberOfArrays(); i++)
     {
-      vtkDoubleArray* array = vtkDoubleArray::SafeDownCast(polydata->GetPointData()->GetArray(i));
-      if (array != nullptr)
+      vtkDataArray* array = polydata->GetPointData()->GetArray(i);
+      smtk::mesh::FieldType type = fieldTypeOf(array);
+      if (type != smtk::mesh::FieldType::MaxFieldType)
       {
-        mesh.createPointField(array->GetName(), array->GetNumberOfComponents(),
-          static_cast<const double*>(array->GetVoidPointer(0)));
+        mesh.createPointField(
+          array->GetName(), array->GetNumberOfComponents(), type, array->GetVoidPointer(0));
       }
     }
   }
@@ -391,26 +420,28 @@ bool ImportVTKData::operator()(vtkUnstructuredGrid* ugrid, smtk::mesh::Collectio
     mesh = smtk::mesh::MeshSet(collection->shared_from_this(), iface->getRoot(), entities);
   }
 
-  // Now that we have a valid meshset, we add double-valued vtk cell & point data to it.
+  // Now that we have a valid meshset, we add numeric vtk cell & point data to it.
   if (!mesh.is_empty())
   {
     for (vtkIdType i = 0; i < ugrid->GetCellData()->GetNumberOfArrays(); i++)
     {
-      vtkDoubleArray* array = vtkDoubleArray::SafeDownCast(ugrid->GetCellData()->GetArray(i));
-      if (array != nullptr)
+      vtkDataArray* array = ugrid->GetCellData()->GetArray(i);
+      smtk::mesh::FieldType type = fieldTypeOf(array);
+      if (type != smtk::mesh::FieldType::MaxFieldType)
       {
-        mesh.createCellField(array->GetName(), array->GetNumberOfComponents(),
-          static_cast<const double*>(array->GetVoidPointer(0)));
+        mesh.createCellField(
+          array->GetName(), array->GetNumberOfComponents(), type, array->GetVoidPointer(0));
       }
     }
 
     for (vtkIdType i = 0; i < ugrid->GetPointData()->GetNumberOfArrays(); i++)
     {
-      vtkDoubleArray* array = vtkDoubleArray::SafeDownCast(ugrid->GetPointData()->GetArray(i));
-      if (array != nullptr)
+      vtkDataArray* array = ugrid->GetPointData()->GetArray(i);
+      smtk::mesh::FieldType type = fieldTypeOf(array);
+      if (type != smtk::mesh::FieldType::MaxFieldType)
       {
-        mesh.createPointField(array->GetName(), array->GetNumberOfComponents(),
-          static_cast<const double*>(array->GetVoidPointer(0)));
+        mesh.createPointField(
+          array->GetName(), array->GetNumberOfComponents(), type, array->GetVoidPointer(0));
       }
     }
   }
@@ -0,0 +1,275 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "cmbDelaunayTriangulator.h"
+
+#include "Discretization/ConstrainedDelaunayMesh.hh"
+#include "Discretization/ExcisePolygon.hh"
+#include "Mesh/Mesh.hh"
+#include "Shape/Point.hh"
+#include "Shape/Polygon.hh"
+#include "Shape/PolygonUtilities.hh"
+
+#include <cmath>
+#include <map>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+typedef std::pair<double, double> Coordinates;
+
+template <typename T>
+bool ReadArray(std::istringstream& buffer, std::vector<T>& dest, int numElements)
+{
+  if (numElements <= 0)
+  {
+    return true;
+  }
+
+  dest.resize(numElements);
+
+  //strip away the new line character at the start
+  if (buffer.peek() == '\n')
+  {
+    buffer.get();
+  }
+
+  const std::streamsize size = sizeof(T) * numElements;
+  buffer.read(reinterpret_cast<char*>(&dest[0]), size);
+  return buffer.gcount() == size;
+}
+
+template <typename T>
+void WriteArray(std::ostringstream& buffer, const std::vector<T>& src)
+{
+  if (src.empty())
+  {
+    return;
+  }
+  buffer.write(reinterpret_cast<const char*>(&src[0]), sizeof(T) * src.size());
+  buffer << std::endl;
+}
+
+//Chain the segments into closed loops of point indices.
+bool ChainLoops(
+  int numPoints, const std::vector<int>& segments, std::vector<std::vector<int> >& loops)
+{
+  const int numSegments = static_cast<int>(segments.size() / 2);
+  std::vector<std::vector<int> > segmentsOfPoint(numPoints);
+  for (int ss = 0; ss < numSegments; ++ss)
+  {
+    for (int ee = 0; ee < 2; ++ee)
+    {
+      int pt = segments[2 * ss + ee];
+      if (pt < 0 || pt >= numPoints)
+      {
+        return false;
+      }
+      segmentsOfPoint[pt].push_back(ss);
+    }
+  }
+
+  std::vector<bool> visited(numSegments, false);
+  for (int ss = 0; ss < numSegments; ++ss)
+  {
+    if (visited[ss])
+    {
+      continue;
+    }
+    visited[ss] = true;
+    std::vector<int> loop(1, segments[2 * ss]);
+    int current = segments[2 * ss + 1];
+    while (current != loop.front())
+    {
+      loop.push_back(current);
+      int next = -1;
+      for (auto seg : segmentsOfPoint[current])
+      {
+        if (!visited[seg])
+        {
+          next = seg;
+          break;
+        }
+      }
+      if (next < 0)
+      {
+        return false; // an open chain of segments
+      }
+      visited[next] = true;
+      current = segments[2 * next] == current ? segments[2 * next + 1] : segments[2 * next];
+    }
+    loops.push_back(loop);
+  }
+  return !loops.empty();
+}
+
+//Return twice the signed area enclosed by a loop.
+double LoopArea(const std::vector<double>& points, const std::vector<int>& loop)
+{
+  double area = 0.;
+  for (std::size_t ii = 0; ii < loop.size(); ++ii)
+  {
+    int aa = loop[ii];
+    int bb = loop[(ii + 1) % loop.size()];
+    area += points[2 * aa] * points[2 * bb + 1] - points[2 * bb] * points[2 * aa + 1];
+  }
+  return area;
+}
+
+//Make a counter-clockwise polygon from a loop of point indices.
+Delaunay::Shape::Polygon LoopPolygon(
+  const std::vector<double>& points, const std::vector<int>& loop)
+{
+  std::vector<Delaunay::Shape::Point> polyPoints;
+  polyPoints.reserve(loop.size());
+  for (auto pt : loop)
+  {
+    polyPoints.push_back(Delaunay::Shape::Point(points[2 * pt], points[2 * pt + 1]));
+  }
+  Delaunay::Shape::Polygon p(polyPoints);
+  if (Delaunay::Shape::Orientation(p) != 1)
+  {
+    p = Delaunay::Shape::Polygon(polyPoints.rbegin(), polyPoints.rend());
+  }
+  return p;
+}
+}
+
+bool cmbDelaunayTriangulator::triangulate(const std::string& input, std::string& result)
+{
+  std::istringstream in(input);
+  int minAngleOn, maxAreaOn, preserveBoundaries, preserveEdgesAndNodes;
+  int numPoints, numSegments, numHoles, numRegions, numNodes;
+  double maxArea, minAngle;
+  in >> minAngleOn >> maxAreaOn >> preserveBoundaries >> preserveEdgesAndNodes >> numPoints >>
+    numSegments >> numHoles >> numRegions >> numNodes >> maxArea >> minAngle;
+  if (!in || numPoints < 3 || numSegments < 3)
+  {
+    return false;
+  }
+
+  std::vector<double> points;
+  std::vector<int> segments;
+  std::vector<double> holes;
+  std::vector<double> regions;
+  std::vector<int> segmentMarker;
+  std::vector<double> pointAttribute;
+  if (!ReadArray(in, points, numPoints * 2) || !ReadArray(in, segments, numSegments * 2) ||
+    !ReadArray(in, holes, numHoles * 2) || !ReadArray(in, regions, numRegions * 4))
+  {
+    return false;
+  }
+  if (preserveEdgesAndNodes &&
+    (!ReadArray(in, segmentMarker, numSegments) || !ReadArray(in, pointAttribute, numPoints)))
+  {
+    return false;
+  }
+
+  //The loop enclosing the largest area bounds the face; the others are its holes.
+  std::vector<std::vector<int> > loops;
+  if (!ChainLoops(numPoints, segments, loops))
+  {
+    return false;
+  }
+  //Inner loops without a hole seed are meant to be meshed, which this
+  //mesher cannot do; decline the face so the caller can use another mesher.
+  if (loops.size() != static_cast<std::size_t>(numHoles) + 1)
+  {
+    return false;
+  }
+  std::size_t outer = 0;
+  for (std::size_t ll = 1; ll < loops.size(); ++ll)
+  {
+    if (std::fabs(LoopArea(points, loops[ll])) > std::fabs(LoopArea(points, loops[outer])))
+    {
+      outer = ll;
+    }
+  }
+
+  Delaunay::Discretization::ConstrainedDelaunayMesh discretize;
+  Delaunay::Mesh::Mesh mesh;
+  discretize(LoopPolygon(points, loops[outer]), mesh);
+  Delaunay::Discretization::ExcisePolygon excise;
+  for (std::size_t ll = 0; ll < loops.size(); ++ll)
+  {
+    if (ll != outer)
+    {
+      excise(LoopPolygon(points, loops[ll]), mesh);
+    }
+  }
+
+  //Number the mesh vertices and look up input points by their coordinates.
+  std::vector<double> outPoints;
+  std::map<Coordinates, int> outIndex;
+  for (auto& p : mesh.GetVertices())
+  {
+    outIndex[Coordinates(p.x, p.y)] = static_cast<int>(outPoints.size() / 2);
+    outPoints.push_back(p.x);
+    outPoints.push_back(p.y);
+  }
+  std::vector<int> inputToOutput(numPoints);
+  for (int pp = 0; pp < numPoints; ++pp)
+  {
+    std::map<Coordinates, int>::const_iterator it =
+      outIndex.find(Coordinates(points[2 * pp], points[2 * pp + 1]));
+    if (it == outIndex.end())
+    {
+      return false;
+    }
+    inputToOutput[pp] = it->second;
+  }
+
+  std::vector<int> outSegments(segments.size());
+  for (std::size_t ss = 0; ss < segments.size(); ++ss)
+  {
+    outSegments[ss] = inputToOutput[segments[ss]];
+  }
+
+  std::vector<int> outTriangles;
+  outTriangles.reserve(mesh.GetTriangles().size() * 3);
+  for (auto& t : mesh.GetTriangles())
+  {
+    outTriangles.push_back(outIndex[Coordinates(t.AB().A().x, t.AB().A().y)]);
+    outTriangles.push_back(outIndex[Coordinates(t.AB().B().x, t.AB().B().y)]);
+    outTriangles.push_back(outIndex[Coordinates(t.AC().B().x, t.AC().B().y)]);
+  }
+  if (outTriangles.empty())
+  {
+    return false;
+  }
+
+  std::ostringstream out;
+  out << (outPoints.size() / 2) << std::endl
+      << numSegments << std::endl
+      << (outTriangles.size() / 3) << std::endl;
+  WriteArray(out, outPoints);
+  WriteArray(out, outSegments);
+  WriteArray(out, outTriangles);
+  if (preserveEdgesAndNodes)
+  {
+    std::vector<double> outAttribute(outPoints.size() / 2, -1.);
+    for (int pp = 0; pp < numPoints; ++pp)
+    {
+      outAttribute[inputToOutput[pp]] = pointAttribute[pp];
+    }
+    WriteArray(out, outAttribute);
+    WriteArray(out, segmentMarker);
+  }
+  if (numRegions > 0)
+  {
+    //Faces are meshed one at a time, so every triangle is in the first region.
+    WriteArray(out, std::vector<double>(outTriangles.size() / 3, regions[2]));
+  }
+  result = out.str();
+  return true;
+}
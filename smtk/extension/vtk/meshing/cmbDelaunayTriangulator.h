@@ -0,0 +1,39 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+// .NAME cmbDelaunayTriangulator
+// .SECTION Description
+// An in-process triangulator for cmbFaceMesherInterface that meshes faces
+// with the Delaunay library bundled with SMTK.
+//
+// It accepts the packed face description that cmbFaceMesherInterface
+// submits to a triangle mesh worker and produces the packed result that
+// the worker sends back. The loop with the largest area is meshed with a
+// constrained Delaunay triangulation and every other loop is excised from
+// it as a hole. No Steiner points are inserted, so the minimum angle and
+// maximum area constraints are not applied.
+
+#ifndef __smtk_vtk_cmbDelaunayTriangulator_h
+#define __smtk_vtk_cmbDelaunayTriangulator_h
+
+#include "smtk/extension/vtk/meshing/Exports.h" // For export macro
+#include <string>                               //for std string
+
+class VTKSMTKMESHINGEXT_EXPORT cmbDelaunayTriangulator
+{
+public:
+  //Triangulate the packed face description in input, storing the packed
+  //mesh in result. Returns false if the segments do not form closed loops,
+  //if the number of inner loops differs from the number of hole seeds,
+  //or if the face cannot be meshed.
+  static bool triangulate(const std::string& input, std::string& result);
+};
+
+#endif
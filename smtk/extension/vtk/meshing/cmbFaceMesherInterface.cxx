@@ -14,6 +14,8 @@
 
 #include "cmbFaceMesherInterface.h"
 
+#include "smtk/extension/vtk/meshing/cmbDelaunayTriangulator.h"
+
 //needed to launch a cmb mesh server
 #include "smtk/extension/vtk/meshing/vtkCMBMeshServerLauncher.h"
 
@@ -26,6 +28,7 @@
 #include <vtkNew.h>
 #include <vtkPolyData.h>
 
+#include <mutex>
 #include <vector>
 
 struct TriangleOutput
@@ -285,6 +288,62 @@ bool cmbFaceMesherInterface::buildFaceMesh(
   return valid;
 }
 
+namespace
+{
+std::mutex& triangulatorMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+cmbFaceMesherInterface::Triangulator& inProcessTriangulator()
+{
+  static cmbFaceMesherInterface::Triangulator triangulator(&cmbDelaunayTriangulator::triangulate);
+  return triangulator;
+}
+}
+
+void cmbFaceMesherInterface::setInProcessTriangulator(const Triangulator& triangulator)
+{
+  std::lock_guard<std::mutex> guard(triangulatorMutex());
+  inProcessTriangulator() = triangulator;
+}
+
+bool cmbFaceMesherInterface::hasInProcessTriangulator()
+{
+  std::lock_guard<std::mutex> guard(triangulatorMutex());
+  return inProcessTriangulator() ? true : false;
+}
+
+bool cmbFaceMesherInterface::hasBundledInProcessTriangulator()
+{
+  typedef bool (*TriangulateFunction)(const std::string&, std::string&);
+  std::lock_guard<std::mutex> guard(triangulatorMutex());
+  TriangulateFunction* fn = inProcessTriangulator().target<TriangulateFunction>();
+  return fn && *fn == &cmbDelaunayTriangulator::triangulate;
+}
+
+bool cmbFaceMesherInterface::buildFaceMeshInProcess(const long& faceId, const double& zValue)
+{
+  Triangulator triangulate;
+  {
+    std::lock_guard<std::mutex> guard(triangulatorMutex());
+    triangulate = inProcessTriangulator();
+  }
+  if (!triangulate)
+  {
+    return false;
+  }
+
+  std::string input_data;
+  std::string result;
+  if (!this->PackData(input_data) || !triangulate(input_data, result))
+  {
+    return false;
+  }
+  return this->unPackData(result.data(), result.size(), faceId, zValue);
+}
+
 bool cmbFaceMesherInterface::PackData(std::string& rawData)
 {
 
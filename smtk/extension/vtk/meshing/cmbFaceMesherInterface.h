@@ -17,7 +17,8 @@
 
 #include "smtk/extension/vtk/meshing/Exports.h" // For export macro
 #include "vtkABI.h"
-#include <string> //for std string
+#include <functional> //for std function
+#include <string>     //for std string
 
 class vtkPolyData;
 
@@ -71,6 +72,26 @@ public:
   //will be set for each edge
   bool buildFaceMesh(const long& faceId, const double& zValue = 0);
 
+  //A triangulator that runs in the calling process. It is passed the same
+  //packed description of the face that is submitted to the mesh server and
+  //must produce the packed result the triangle mesh worker sends back.
+  typedef std::function<bool(const std::string& input, std::string& result)> Triangulator;
+
+  //Set the triangulator used by buildFaceMeshInProcess(). It defaults to
+  //cmbDelaunayTriangulator::triangulate; applications that link the triangle
+  //worker's library may register its entry point here instead. It may be
+  //invoked from several threads at once. Pass an empty function to unset.
+  static void setInProcessTriangulator(const Triangulator& triangulator);
+  static bool hasInProcessTriangulator();
+
+  //Returns true when the in-process triangulator is the bundled Delaunay
+  //mesher, which applies neither the minimum angle nor the maximum area.
+  static bool hasBundledInProcessTriangulator();
+
+  //Mesh the face with the in-process triangulator instead of submitting
+  //a job to a mesh server. Returns false when no triangulator is set.
+  bool buildFaceMeshInProcess(const long& faceId, const double& zValue = 0);
+
 protected:
   void InitDataStructures();
 
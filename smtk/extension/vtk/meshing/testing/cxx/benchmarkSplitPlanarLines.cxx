@@ -0,0 +1,81 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/extension/vtk/meshing/vtkSplitPlanarLines.h"
+
+#include "smtk/model/testing/cxx/helpers.h"
+
+#include "vtkCellArray.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+using namespace smtk::model::testing;
+
+// Usage: benchmarkSplitPlanarLines [polylines-per-direction [segments-per-polyline]]
+//
+// Builds a grid of wavy horizontal and vertical polylines in which every
+// horizontal polyline crosses every vertical polyline exactly once (away
+// from any input point), splits them, and verifies the resulting topology.
+int main(int argc, char* argv[])
+{
+  int numLines = argc > 1 ? atoi(argv[1]) : 500;
+  int numSegs = argc > 2 ? atoi(argv[2]) : 1000;
+
+  vtkNew<vtkPoints> pts;
+  vtkNew<vtkCellArray> lines;
+  double length = numLines;
+  for (int dir = 0; dir < 2; ++dir)
+  {
+    for (int ll = 0; ll < numLines; ++ll)
+    {
+      lines->InsertNextCell(numSegs + 1);
+      for (int ss = 0; ss <= numSegs; ++ss)
+      {
+        double along = length * ss / numSegs;
+        double across = ll + 0.5 + 0.25 * std::sin(along * (dir ? 1.7 : 1.3));
+        lines->InsertCellPoint(
+          dir ? pts->InsertNextPoint(across, along, 0.) : pts->InsertNextPoint(along, across, 0.));
+      }
+    }
+  }
+  vtkNew<vtkPolyData> pd;
+  pd->SetPoints(pts.GetPointer());
+  pd->SetLines(lines.GetPointer());
+
+  vtkNew<vtkSplitPlanarLines> slf;
+  slf->SetInputData(pd.GetPointer());
+
+  Timer timer;
+  timer.mark();
+  slf->Update();
+  double deltaT = timer.elapsed();
+
+  vtkPolyData* result = slf->GetOutput();
+  vtkIdType numInputSegs = 2 * static_cast<vtkIdType>(numLines) * numSegs;
+  vtkIdType numCrossings = static_cast<vtkIdType>(numLines) * numLines;
+  std::cout << "Split " << numInputSegs << " segments of " << (2 * numLines) << " polylines\n"
+            << "  RequestData " << deltaT << " s\n"
+            << "  " << result->GetNumberOfLines() << " output segments, "
+            << result->GetNumberOfPoints() << " output points\n";
+
+  // Each crossing adds one point and splits two segments.
+  if (result->GetNumberOfLines() != numInputSegs + 2 * numCrossings ||
+    result->GetNumberOfPoints() != pts->GetNumberOfPoints() + numCrossings)
+  {
+    std::cerr << "Expected " << (numInputSegs + 2 * numCrossings) << " segments and "
+              << (pts->GetNumberOfPoints() + numCrossings) << " points.\n";
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,122 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/extension/vtk/meshing/cmbFaceMesherInterface.h"
+#include "smtk/extension/vtk/meshing/vtkCMBPrepareForTriangleMesher.h"
+#include "smtk/extension/vtk/meshing/vtkCMBTriangleMesher.h"
+
+#include "smtk/model/testing/cxx/helpers.h"
+
+#include "vtkCellArray.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace smtk::model::testing;
+
+namespace
+{
+
+// Create an n-by-n grid of unit-square polygons ready for meshing.
+void createSquares(int n, vtkPolyData* pd)
+{
+  vtkNew<vtkPoints> pts;
+  vtkNew<vtkCellArray> lines;
+  pd->SetPoints(pts.GetPointer());
+  pd->SetLines(lines.GetPointer());
+  vtkNew<vtkCMBPrepareForTriangleMesher> prepr;
+  prepr->SetPolyData(pd);
+  prepr->InitializeNewMapInfo();
+  vtkIdType arcId = 0;
+  for (int jj = 0; jj < n; ++jj)
+  {
+    for (int ii = 0; ii < n; ++ii)
+    {
+      vtkIdType corner[4] = { pts->InsertNextPoint(ii, jj, 0.),
+        pts->InsertNextPoint(ii + 1, jj, 0.), pts->InsertNextPoint(ii + 1, jj + 1, 0.),
+        pts->InsertNextPoint(ii, jj + 1, 0.) };
+      vtkIdType loop = prepr->AddLoop(ii + n * jj, -1);
+      for (int ee = 0; ee < 4; ++ee, ++arcId)
+      {
+        vtkIdType conn[2] = { corner[ee], corner[(ee + 1) % 4] };
+        vtkIdType arcStart = lines->GetInsertLocation(-1);
+        lines->InsertNextCell(2, conn);
+        vtkIdType arcEnd = lines->GetInsertLocation(-1);
+        prepr->AddArc(arcStart, arcEnd - arcStart, arcId, loop, -1, conn[0], conn[1]);
+      }
+    }
+  }
+  prepr->FinalizeNewMapInfo();
+}
+
+// Mesh an n-by-n grid of squares and report latency; returns false if
+// the output does not have the expected number of points and triangles.
+bool meshSquares(int n, bool inProcess)
+{
+  vtkNew<vtkPolyData> pd;
+  createSquares(n, pd.GetPointer());
+
+  vtkNew<vtkCMBTriangleMesher> msh;
+  msh->SetInputDataObject(pd.GetPointer());
+  msh->SetMaxAreaMode(vtkCMBTriangleMesher::NoMaxArea);
+  msh->SetInProcess(inProcess);
+  Timer timer;
+  timer.mark();
+  msh->Update();
+  double deltaT = timer.elapsed();
+
+  vtkPolyData* result = msh->GetOutput();
+  std::cout << (inProcess ? "in-process" : "mesh server") << ": " << (n * n) << " faces\n"
+            << "  RequestData " << deltaT << " s (meshing " << msh->GetLastMeshingTime()
+            << " s)\n"
+            << "  " << result->GetNumberOfPolys() << " triangles, " << result->GetNumberOfPoints()
+            << " points\n";
+  // Coincident corners of neighboring squares must be merged.
+  return !inProcess || (result->GetNumberOfPolys() == 2 * n * n &&
+                         result->GetNumberOfPoints() == (n + 1) * (n + 1));
+}
+}
+
+// Usage: benchmarkTriangleMesher [faces-per-side [server]]
+//
+// Times meshing a single face and a grid of faces in-process (using the
+// default Delaunay triangulator) and, when "server" is passed, through a
+// mesh server.
+int main(int argc, char* argv[])
+{
+  int numPerSide = argc > 1 ? atoi(argv[1]) : 32;
+  bool useServer = argc > 2 && !strcmp(argv[2], "server");
+
+  if (!cmbFaceMesherInterface::hasInProcessTriangulator())
+  {
+    std::cerr << "No default in-process triangulator.\n";
+    return 1;
+  }
+  bool ok = true;
+  for (int n : { 1, numPerSide })
+  {
+    ok &= meshSquares(n, true);
+    if (useServer)
+    {
+      meshSquares(n, false);
+    }
+  }
+  if (!ok)
+  {
+    std::cerr << "Unexpected in-process triangulation.\n";
+    return 1;
+  }
+  return 0;
+}
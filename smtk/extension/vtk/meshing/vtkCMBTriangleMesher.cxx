@@ -31,8 +31,13 @@
 #include <vtksys/SystemTools.hxx>
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <list>
-#include <set>
+#include <memory>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 #include "smtk/extension/vtk/meshing/cmbFaceMeshHelper.h"
 #include "smtk/extension/vtk/meshing/cmbFaceMesherInterface.h"
@@ -43,7 +48,7 @@
 vtkCxxSetObjectMacro(vtkCMBTriangleMesher, Launcher, vtkCMBMeshServerLauncher);
 
 //Unique Cell is used for appending multiple polydata's together that may
-//Share cells. Storing all the cells in a set of UniqueCells gaurentees
+//Share cells. Storing all the cells in a hash set of UniqueCells gaurentees
 //Uniqueness of the output
 class UniqueCell
 {
@@ -52,7 +57,6 @@ public:
   {
     this->nptIds = npts;
     this->elementId = inElementId;
-    this->ptIds = new vtkIdType[this->nptIds];
     for (int i = 0; i < nptIds; i++)
     {
       this->ptIds[i] = pts[i];
@@ -60,43 +64,45 @@ public:
     std::sort(this->ptIds,
       this->ptIds + this->nptIds); //sort so the cell (2,1) and (1,2) are treated the same way
   }
-  UniqueCell(const UniqueCell& other)
+
+  bool operator==(const UniqueCell& c) const
   {
-    this->nptIds = other.nptIds;
-    this->elementId = other.elementId;
-    this->ptIds = new vtkIdType[this->nptIds];
-    for (int i = 0; i < nptIds; i++)
-    {
-      this->ptIds[i] = other.ptIds[i];
-    }
+    return this->nptIds == c.nptIds && std::equal(this->ptIds, this->ptIds + this->nptIds, c.ptIds);
   }
 
-  ~UniqueCell() { delete[] ptIds; }
+  vtkIdType ptIds[3]; // vertices, lines and triangles only
+  vtkIdType nptIds;
+  vtkIdType elementId;
+};
 
-  bool operator<(const UniqueCell& c) const
+struct UniqueCellHash
+{
+  std::size_t operator()(const UniqueCell& c) const
   {
-    //If they don't have the same number of points they can't be equal
-    if (this->nptIds != c.nptIds)
+    std::size_t result = std::hash<vtkIdType>()(c.nptIds);
+    for (int i = 0; i < c.nptIds; i++)
     {
-      return this->nptIds < c.nptIds;
+      result ^= std::hash<vtkIdType>()(c.ptIds[i]) + 0x9e3779b9 + (result << 6) + (result >> 2);
     }
-    for (int i = 0; i < nptIds; i++)
+    return result;
+  }
+};
+
+//Cells in the order they were first seen, with a hash set for finding duplicates.
+class UniqueCells
+{
+public:
+  void insert(const UniqueCell& c)
+  {
+    if (this->Seen.insert(c).second)
     {
-      if (this->ptIds[i] < c.ptIds[i])
-      {
-        return true;
-      }
-      if (this->ptIds[i] > c.ptIds[i])
-      {
-        return false;
-      }
+      this->Cells.push_back(c);
     }
-    return false;
   }
+  std::size_t size() const { return this->Cells.size(); }
 
-  vtkIdType* ptIds;
-  vtkIdType nptIds;
-  vtkIdType elementId;
+  std::unordered_set<UniqueCell, UniqueCellHash> Seen;
+  std::vector<UniqueCell> Cells;
 };
 
 //Takes a list of polydatas as input and assumes they have
@@ -121,9 +127,9 @@ void SmartMapAppend(std::list<vtkPolyData*> inputs, vtkPolyData* output, bool Pr
 
   //Create a unique set for points, verts, lines, and triangles
   cmbUniquePointSet uniquePoints;
-  std::set<UniqueCell> uniqueVertexes;
-  std::set<UniqueCell> uniqueLines;
-  std::set<UniqueCell> uniqueTriangles;
+  UniqueCells uniqueVertexes;
+  UniqueCells uniqueLines;
+  UniqueCells uniqueTriangles;
 
   //Iterate over the inputs and populate the unique sets
   std::list<vtkPolyData*>::const_iterator inputIter = inputs.begin();
@@ -199,8 +205,8 @@ void SmartMapAppend(std::list<vtkPolyData*> inputs, vtkPolyData* output, bool Pr
   outputPts->FastDelete();
 
   //Iterate over the unique cells and add them to the polydata
-  std::set<UniqueCell>::const_iterator iter;
-  for (iter = uniqueVertexes.begin(); iter != uniqueVertexes.end(); iter++)
+  std::vector<UniqueCell>::const_iterator iter;
+  for (iter = uniqueVertexes.Cells.begin(); iter != uniqueVertexes.Cells.end(); iter++)
   {
     vtkIdType ptsToInsert[1] = { iter->ptIds[0] };
     output->InsertNextCell(VTK_VERTEX, 1, ptsToInsert);
@@ -209,7 +215,7 @@ void SmartMapAppend(std::list<vtkPolyData*> inputs, vtkPolyData* output, bool Pr
       outputElementIds->SetTuple1(cellInsertAt++, (*iter).elementId);
     }
   }
-  for (iter = uniqueLines.begin(); iter != uniqueLines.end(); iter++)
+  for (iter = uniqueLines.Cells.begin(); iter != uniqueLines.Cells.end(); iter++)
   {
     vtkIdType ptsToInsert[2] = { iter->ptIds[0], iter->ptIds[1] };
     output->InsertNextCell(VTK_LINE, 2, ptsToInsert);
@@ -218,7 +224,7 @@ void SmartMapAppend(std::list<vtkPolyData*> inputs, vtkPolyData* output, bool Pr
       outputElementIds->SetTuple1(cellInsertAt++, (*iter).elementId);
     }
   }
-  for (iter = uniqueTriangles.begin(); iter != uniqueTriangles.end(); iter++)
+  for (iter = uniqueTriangles.Cells.begin(); iter != uniqueTriangles.Cells.end(); iter++)
   {
     vtkIdType ptsToInsert[3] = { iter->ptIds[0], iter->ptIds[1], iter->ptIds[2] };
     output->InsertNextCell(VTK_TRIANGLE, 3, ptsToInsert);
@@ -250,6 +256,8 @@ vtkCMBTriangleMesher::vtkCMBTriangleMesher()
   MaxAreaMode = RelativeToBoundsAndSegments;
   VerboseOutput = false;
   Launcher = NULL;
+  InProcess = false;
+  LastMeshingTime = 0.;
 }
 
 vtkCMBTriangleMesher::~vtkCMBTriangleMesher()
@@ -272,6 +280,8 @@ void vtkCMBTriangleMesher::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "      Use Unique Areas: " << UseUniqueAreas << endl;
   os << indent << "        Verbose Output: " << VerboseOutput << endl;
   os << indent << "  Mesh Server Launcher: " << Launcher << endl;
+  os << indent << "            In Process: " << InProcess << endl;
+  os << indent << "     Last Meshing Time: " << LastMeshingTime << endl;
   this->Superclass::PrintSelf(os, indent);
 }
 
@@ -310,13 +320,10 @@ int vtkCMBTriangleMesher::RequestData(vtkInformation* /*request*/,
   std::list<vtkPolyData*> toAppend;
   std::map<vtkIdType, ModelFaceRep*>::iterator faceIter = pid2Face.begin();
 
-  vtkCMBMeshServerLauncher* meshServer = this->GetLauncher();
-  if (!meshServer)
-  {
-    vtkNew<vtkCMBMeshServerLauncher> launcher;
-    meshServer = launcher.GetPointer();
-    this->SetLauncher(meshServer);
-  }
+  // Prepare the triangle input for every face before meshing any of them.
+  std::vector<std::unique_ptr<cmbFaceMesherInterface> > faceInputs;
+  std::vector<vtkPolyData*> faceMeshes;
+  std::vector<vtkIdType> faceIds;
   for (; faceIter != pid2Face.end(); faceIter++)
   {
     vtkPolyData* outputMesh = vtkPolyData::New();
@@ -359,20 +366,112 @@ int vtkCMBTriangleMesher::RequestData(vtkInformation* /*request*/,
         break;
     }
 
-    cmbFaceMesherInterface ti(face->numberOfVertices(), face->numberOfEdges(),
-      face->numberOfHoles(), 0, this->PreserveEdgesAndNodes);
-    ti.setUseMaxArea(this->MaxAreaMode != NoMaxArea);
-    ti.setMaxArea(this->ComputedMaxArea);
-    ti.setUseMinAngle(this->UseMinAngle);
-    ti.setMinAngle(this->MinAngle);
-    ti.setPreserveBoundaries(this->PreserveBoundaries);
-    ti.setVerboseOutput(this->VerboseOutput);
-    ti.setOutputMesh(outputMesh);
-    face->fillTriangleInterface(&ti);
-    bool faceBuilt = ti.buildFaceMesh(meshServer, faceId);
-    if (faceBuilt)
+    cmbFaceMesherInterface* ti = new cmbFaceMesherInterface(face->numberOfVertices(),
+      face->numberOfEdges(), face->numberOfHoles(), 0, this->PreserveEdgesAndNodes);
+    ti->setUseMaxArea(this->MaxAreaMode != NoMaxArea);
+    ti->setMaxArea(this->ComputedMaxArea);
+    ti->setUseMinAngle(this->UseMinAngle);
+    ti->setMinAngle(this->MinAngle);
+    ti->setPreserveBoundaries(this->PreserveBoundaries);
+    ti->setVerboseOutput(this->VerboseOutput);
+    ti->setOutputMesh(outputMesh);
+    face->fillTriangleInterface(ti);
+    faceInputs.push_back(std::unique_ptr<cmbFaceMesherInterface>(ti));
+    faceMeshes.push_back(outputMesh);
+    faceIds.push_back(faceId);
+  }
+
+  bool inProcess = this->InProcess;
+  if (inProcess && !cmbFaceMesherInterface::hasInProcessTriangulator())
+  {
+    vtkWarningMacro("No in-process triangulator is registered; using the mesh server.");
+    inProcess = false;
+  }
+  if (inProcess && cmbFaceMesherInterface::hasBundledInProcessTriangulator() &&
+    (this->UseMinAngle || this->MaxAreaMode != NoMaxArea))
+  {
+    vtkWarningMacro("The bundled in-process triangulator does not insert points; "
+      << "the minimum angle and maximum area are ignored.");
+  }
+
+  double startTime = vtkTimerLog::GetUniversalTime();
+  std::vector<char> faceBuilt(faceInputs.size(), 0);
+  std::vector<std::size_t> serverFaces;
+  if (inProcess)
+  {
+    // Faces are independent, so hand them out to worker threads.
+    std::atomic<std::size_t> nextFace(0);
+    auto meshFaces = [&]() {
+      for (std::size_t ff = nextFace++; ff < faceInputs.size(); ff = nextFace++)
+      {
+        faceBuilt[ff] = faceInputs[ff]->buildFaceMeshInProcess(faceIds[ff]);
+      }
+    };
+    std::size_t numThreads =
+      std::min(static_cast<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u)),
+        faceInputs.size());
+    std::vector<std::thread> workers;
+    for (std::size_t tt = 1; tt < numThreads; ++tt)
+    {
+      workers.push_back(std::thread(meshFaces));
+    }
+    meshFaces();
+    for (auto& worker : workers)
+    {
+      worker.join();
+    }
+
+    // Faces the triangulator rejected (e.g., open segment chains) are
+    // handed to the mesh server rather than dropped.
+    for (std::size_t ff = 0; ff < faceInputs.size(); ++ff)
+    {
+      if (!faceBuilt[ff])
+      {
+        faceMeshes[ff]->Initialize();
+        serverFaces.push_back(ff);
+      }
+    }
+    if (!serverFaces.empty())
+    {
+      vtkWarningMacro(<< serverFaces.size() << " of " << faceInputs.size()
+                      << " faces could not be triangulated in process; "
+                      << "submitting them to the mesh server.");
+    }
+  }
+  else
+  {
+    for (std::size_t ff = 0; ff < faceInputs.size(); ++ff)
+    {
+      serverFaces.push_back(ff);
+    }
+  }
+
+  if (!serverFaces.empty())
+  {
+    vtkCMBMeshServerLauncher* meshServer = this->GetLauncher();
+    if (!meshServer)
+    {
+      vtkNew<vtkCMBMeshServerLauncher> launcher;
+      meshServer = launcher.GetPointer();
+      this->SetLauncher(meshServer);
+    }
+    for (auto ff : serverFaces)
+    {
+      faceBuilt[ff] = faceInputs[ff]->buildFaceMesh(meshServer, faceIds[ff]);
+    }
+  }
+  this->LastMeshingTime = vtkTimerLog::GetUniversalTime() - startTime;
+
+  for (std::size_t ff = 0; ff < faceMeshes.size(); ++ff)
+  {
+    if (faceBuilt[ff])
+    {
+      toAppend.push_back(faceMeshes[ff]);
+    }
+    else
     {
-      toAppend.push_back(outputMesh);
+      vtkWarningMacro("Face " << faceIds[ff] << " could not be meshed; it is omitted.");
+      faceMeshes[ff]->Delete();
     }
   }
 
@@ -126,6 +126,26 @@ public:
   virtual void SetLauncher(vtkCMBMeshServerLauncher* launcher);
   vtkGetObjectMacro(Launcher, vtkCMBMeshServerLauncher);
 
+  // Description:
+  // When true, faces are triangulated on worker threads of this process by
+  // the triangulator registered with
+  // cmbFaceMesherInterface::setInProcessTriangulator() (by default, the
+  // bundled Delaunay mesher; see cmbDelaunayTriangulator) rather than by
+  // jobs submitted to a mesh server. If the triangulator has been unset,
+  // a warning is issued and the mesh server is used. Faces the triangulator
+  // cannot mesh are submitted to the mesh server instead. The bundled
+  // mesher ignores UseMinAngle and the maximum area; a warning is issued
+  // when either is requested.
+  // default: false
+  vtkSetMacro(InProcess, bool);
+  vtkGetMacro(InProcess, bool);
+  vtkBooleanMacro(InProcess, bool);
+
+  // Description:
+  // The wall-clock time (in seconds) spent triangulating faces during
+  // the last call to RequestData().
+  vtkGetMacro(LastMeshingTime, double);
+
 protected:
   vtkCMBTriangleMesher();
   ~vtkCMBTriangleMesher();
@@ -159,6 +179,9 @@ protected:
   // Allow the same launcher for multiple meshing operations:
   vtkCMBMeshServerLauncher* Launcher;
 
+  bool InProcess;
+  double LastMeshingTime;
+
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
 private:
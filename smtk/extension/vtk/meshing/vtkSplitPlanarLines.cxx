@@ -12,8 +12,6 @@
 
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
-#include "vtkDoubleArray.h"
-#include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkIncrementalOctreePointLocator.h"
 #include "vtkInformation.h"
@@ -23,214 +21,218 @@
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
-#include "vtkSortDataArray.h"
 #include "vtkVector.h"
 #include "vtkVectorOperators.h"
 
-#include "smtk/extension/vtk/meshing/vtkRayIntersectionLocator.h"
-#include <map>
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
+namespace
+{
+
+// One straight segment of an input polyline.
 struct SegmentRecord
 {
   vtkIdType CellId;
-  int SubId;
-  double Param[2];
-  vtkVector3d Point;
+  vtkIdType Conn[2]; // input point IDs of the segment endpoints
 };
 
-typedef std::vector<SegmentRecord> SegmentRecords;
-typedef std::map<vtkIdType, SegmentRecords> HitList;
-
-vtkStandardNewMacro(vtkSplitPlanarLines);
-
-vtkSplitPlanarLines::vtkSplitPlanarLines()
-{
-  this->Tolerance = 0.;
-}
-
-vtkSplitPlanarLines::~vtkSplitPlanarLines()
+// A point interior to a segment at which the segment must be split.
+struct SegmentHit
 {
-}
+  std::size_t Segment;
+  double Param;
+  vtkVector3d Point;
 
-void vtkSplitPlanarLines::PrintSelf(ostream& os, vtkIndent indent)
-{
-  this->Superclass::PrintSelf(os, indent);
-  os << indent << "Tolerance: " << this->Tolerance << "\n";
-}
+  bool operator<(const SegmentHit& other) const
+  {
+    return this->Segment < other.Segment ||
+      (this->Segment == other.Segment && this->Param < other.Param);
+  }
+};
 
-inline void EraseHit(std::vector<vtkVector3d>& points, std::vector<vtkVector3d>& pcoords,
-  std::vector<double>& tvals, std::vector<vtkIdType>& cellIds, std::vector<int>& subIds,
-  vtkIdType i, vtkIdType& nhits)
-{
-  tvals.erase(tvals.begin() + i);
-  points.erase(points.begin() + i);
-  pcoords.erase(pcoords.begin() + i);
-  cellIds.erase(cellIds.begin() + i);
-  subIds.erase(subIds.begin() + i);
-  --nhits;
-}
+typedef std::vector<SegmentRecord> SegmentRecords;
+typedef std::vector<SegmentHit> HitList;
 
-void IntersectSegments(vtkPolyData* input, vtkIdType cellId, vtkRayIntersectionLocator* clocator,
-  HitList& hits, vtkPolyData* output, vtkIncrementalOctreePointLocator* plocator,
-  vtkIdTypeArray* pedigreeIds)
+// A uniform grid of buckets covering the x-y bounds of all the segments.
+// Each segment is listed in every bucket its (tolerance-padded) bounds overlap,
+// so only segments sharing a bucket need to be tested against each other.
+class SegmentGrid
 {
-  vtkIdType npts;
-  vtkIdType* conn;
-  input->GetCellPoints(cellId, npts, conn);
-  if (npts < 2)
-  {
-    return;
-  }
-  vtkPoints* opts = output->GetPoints();
-  std::vector<vtkVector3d> points;
-  std::vector<vtkVector3d> pcoords;
-  std::vector<double> tvals;
-  std::vector<vtkIdType> cellIds;
-  std::vector<int> subIds;
-  vtkVector3d ptA;
-  vtkVector3d ptB;
-  vtkIdType nhits;
-  vtkCellData* icd = input->GetCellData();
-  vtkCellData* cd = output->GetCellData();
-  vtkPointData* pd = output->GetPointData();
-  opts->GetPoint(conn[0], ptA.GetData());
-  for (int j = 1; j < npts; ++j)
+public:
+  SegmentGrid(const SegmentRecords& segs, const std::vector<vtkVector3d>& pts, double tol)
+    : Segs(segs)
+    , Pts(pts)
+    , Tol(tol)
   {
-    opts->GetPoint(conn[j], ptB.GetData());
-    clocator->AllIntersectionsAlongSegment(ptA, ptB, points, tvals, pcoords, cellIds, subIds);
-    // Now we must remove hits from cells with an ID less than cellId
-    // (those are kept in hits and should be commutative).
-    // Hits at exactly t=0 or t=1 must be discarded to avoid
-    // degenerate output segments.
-    nhits = static_cast<vtkIdType>(cellIds.size());
-    HitList::iterator hitit;
-    for (vtkIdType i = 0; i < nhits;)
+    double sumExtent = 0.;
+    this->Lo[0] = this->Lo[1] = VTK_DOUBLE_MAX;
+    double hi[2] = { VTK_DOUBLE_MIN, VTK_DOUBLE_MIN };
+    for (SegmentRecords::const_iterator it = segs.begin(); it != segs.end(); ++it)
     {
-      bool notErased = true;
-      if (cellIds[i] < cellId || (cellIds[i] == cellId && subIds[i] < j - 1))
-      { // Remove the hit. If it really exists, it is already stored in "hits".
-        EraseHit(points, pcoords, tvals, cellIds, subIds, i, nhits);
-        notErased = false;
-      }
-      else
+      const vtkVector3d& a(pts[it->Conn[0]]);
+      const vtkVector3d& b(pts[it->Conn[1]]);
+      for (int i = 0; i < 2; ++i)
       {
-        // We are responsible for this hit...
-        // add it to other cell's entries in hits.
-        if (pcoords[i][0] > 0. && pcoords[i][0] < 1.)
-        {
-          hitit = hits.find(cellIds[i]);
-          if (hitit == hits.end())
-          {
-            SegmentRecords empty;
-            hitit = hits.insert(std::pair<vtkIdType, SegmentRecords>(cellIds[i], empty)).first;
-          }
-          SegmentRecord srec;
-          srec.CellId = cellIds[i];
-          srec.SubId = subIds[i];
-          srec.Param[0] = pcoords[i][0];
-          srec.Param[1] = tvals[i];
-          srec.Point = points[i];
-          hitit->second.push_back(srec);
-        }
-      }
-      // We might have recorded the hit for another cell above,
-      // but if it's at the beginning or end of *this* segment,
-      // we don't need it:
-      if ((tvals[i] == 0. || tvals[i] == 1.) && notErased)
-      {
-        EraseHit(points, pcoords, tvals, cellIds, subIds, i, nhits);
-        notErased = false;
-      }
-      if (notErased)
-      {
-        ++i;
+        this->Lo[i] = std::min(this->Lo[i], std::min(a[i], b[i]));
+        hi[i] = std::max(hi[i], std::max(a[i], b[i]));
       }
+      sumExtent += std::max(std::fabs(b[0] - a[0]), std::fabs(b[1] - a[1]));
+    }
+    // Size buckets to hold about one average segment each, but do not
+    // allocate (many) more buckets than there are segments.
+    double numSegs = static_cast<double>(segs.size());
+    double width = std::max(hi[0] - this->Lo[0], hi[1] - this->Lo[1]);
+    this->Size = std::max(sumExtent / numSegs, width / std::sqrt(numSegs));
+    this->Size = std::max(this->Size, std::max(2. * tol, 1e-12 * (width + 1.)));
+    for (int i = 0; i < 2; ++i)
+    {
+      this->Dims[i] = static_cast<std::size_t>((hi[i] - this->Lo[i]) / this->Size) + 1;
     }
-    // We must also add in relevant entries from the "hits" map,
-    // for which the other cell was responsible.
-    // Having one cell responsible for each possible pair of
-    // intersections eliminates problems where an intersection is
-    // detected when testing one segment and not when testing the
-    // other.
-    hitit = hits.find(cellId);
-    if (hitit != hits.end())
+
+    // Count the segments in each bucket, then fill the buckets.
+    this->BucketStart.resize(this->Dims[0] * this->Dims[1] + 1, 0);
+    for (std::size_t ss = 0; ss < segs.size(); ++ss)
     {
-      SegmentRecords::iterator sit;
-      for (sit = hitit->second.begin(); sit != hitit->second.end(); ++sit)
+      std::size_t range[4];
+      this->bucketRange(ss, range);
+      for (std::size_t jj = range[2]; jj <= range[3]; ++jj)
       {
-        if (sit->SubId == j - 1)
+        for (std::size_t ii = range[0]; ii <= range[1]; ++ii)
         {
-          points.push_back(sit->Point);
-          tvals.push_back(sit->Param[0]);
-          subIds.push_back(sit->SubId);
-          cellIds.push_back(sit->CellId);
-          pcoords.push_back(vtkVector3d(sit->Param[1], 0., 0.));
-          SegmentRecords::iterator tmp = sit - 1;
-          hitit->second.erase(sit);
-          sit = tmp;
+          ++this->BucketStart[ii + this->Dims[0] * jj + 1];
         }
       }
     }
-    // Finally, we must sort all the lists by tvals in order to
-    // report subsegments correctly.
-    vtkNew<vtkIdList> permutation;
-    nhits = static_cast<vtkIdType>(cellIds.size());
-    permutation->SetNumberOfIds(nhits);
-    for (vtkIdType i = 0; i < nhits; ++i)
+    for (std::size_t bb = 1; bb < this->BucketStart.size(); ++bb)
     {
-      permutation->SetId(i, i);
+      this->BucketStart[bb] += this->BucketStart[bb - 1];
     }
-    vtkNew<vtkDoubleArray> twrapper;
-    twrapper->SetArray(&tvals[0], nhits, 1);
-    vtkSortDataArray::Sort(twrapper.GetPointer(), permutation.GetPointer());
-    // Output the sorted segments.
-    vtkIdType seg[2];
-    seg[0] = plocator->FindClosestPoint(ptA.GetData());
-    for (vtkIdType i = 0; i < nhits; ++i)
+    this->BucketSegs.resize(this->BucketStart.back());
+    std::vector<std::size_t> fill(this->BucketStart.begin(), this->BucketStart.end() - 1);
+    for (std::size_t ss = 0; ss < segs.size(); ++ss)
     {
-      if (i > 0 && tvals[i] == tvals[i - 1])
-      {
-        continue; // Ignore duplicate t-values. Yes, this happens.
-      }
-      if (plocator->InsertUniquePoint((ptA + tvals[i] * (ptB - ptA)).GetData(), seg[1]))
-      { // Interpolate along edge to get new point data
-        pd->InterpolateEdge(pd, seg[1], conn[j - 1], conn[j], tvals[i]);
-      }
-      if (seg[0] != seg[1])
+      std::size_t range[4];
+      this->bucketRange(ss, range);
+      for (std::size_t jj = range[2]; jj <= range[3]; ++jj)
       {
-        vtkIdType segId = output->GetLines()->InsertNextCell(2, seg);
-        cd->CopyData(icd, cellId, segId);
-        if (pedigreeIds)
+        for (std::size_t ii = range[0]; ii <= range[1]; ++ii)
         {
-          pedigreeIds->InsertNextValue(cellId);
+          this->BucketSegs[fill[ii + this->Dims[0] * jj]++] = ss;
         }
-        seg[0] = seg[1];
       }
     }
-    if (nhits == 0 || tvals[nhits - 1] < 1.)
+  }
+
+  // Find every pair of crossing segments and record where each must be split.
+  // A crossing is reported only by the bucket containing it, so pairs of
+  // segments that share several buckets are not reported twice.
+  void Intersect(HitList& hits) const
+  {
+    std::size_t numBuckets = this->BucketStart.size() - 1;
+    for (std::size_t bb = 0; bb < numBuckets; ++bb)
     {
-      seg[1] = plocator->FindClosestPoint(ptB.GetData());
-      if (seg[0] != seg[1])
+      for (std::size_t ii = this->BucketStart[bb]; ii < this->BucketStart[bb + 1]; ++ii)
       {
-        vtkIdType segId = output->GetLines()->InsertNextCell(2, seg);
-        if (pedigreeIds)
+        for (std::size_t jj = ii + 1; jj < this->BucketStart[bb + 1]; ++jj)
         {
-          pedigreeIds->InsertNextValue(cellId);
+          this->IntersectPair(bb, this->BucketSegs[ii], this->BucketSegs[jj], hits);
         }
-        cd->CopyData(icd, cellId, segId);
       }
     }
+  }
+
+protected:
+  std::size_t bucketCoord(double x, int axis) const
+  {
+    double ii = std::floor((x - this->Lo[axis]) / this->Size);
+    return ii < 0. ? 0 : std::min(static_cast<std::size_t>(ii), this->Dims[axis] - 1);
+  }
 
-    // Clear lists for next segment
-    points.clear();
-    tvals.clear();
-    pcoords.clear();
-    cellIds.clear();
-    subIds.clear();
-    // Reuse ptA as the endpoint of the next segment in the polyline.
-    ptA = ptB;
+  std::size_t bucketOf(const vtkVector3d& pt) const
+  {
+    return this->bucketCoord(pt[0], 0) + this->Dims[0] * this->bucketCoord(pt[1], 1);
+  }
+
+  void bucketRange(std::size_t seg, std::size_t range[4]) const
+  {
+    const vtkVector3d& a(this->Pts[this->Segs[seg].Conn[0]]);
+    const vtkVector3d& b(this->Pts[this->Segs[seg].Conn[1]]);
+    for (int i = 0; i < 2; ++i)
+    {
+      range[2 * i] = this->bucketCoord(std::min(a[i], b[i]) - this->Tol, i);
+      range[2 * i + 1] = this->bucketCoord(std::max(a[i], b[i]) + this->Tol, i);
+    }
   }
+
+  void IntersectPair(std::size_t bucket, std::size_t s1, std::size_t s2, HitList& hits) const
+  {
+    const vtkVector3d& a1(this->Pts[this->Segs[s1].Conn[0]]);
+    const vtkVector3d& a2(this->Pts[this->Segs[s2].Conn[0]]);
+    vtkVector3d d1 = this->Pts[this->Segs[s1].Conn[1]] - a1;
+    vtkVector3d d2 = this->Pts[this->Segs[s2].Conn[1]] - a2;
+    vtkVector3d rr = a2 - a1;
+    double denom = d1[0] * d2[1] - d1[1] * d2[0];
+    double len1 = std::sqrt(d1[0] * d1[0] + d1[1] * d1[1]);
+    double len2 = std::sqrt(d2[0] * d2[0] + d2[1] * d2[1]);
+    if (std::fabs(denom) <= 1e-12 * len1 * len2)
+    { // Parallel (or degenerate) segments do not cross.
+      return;
+    }
+    double t1 = (rr[0] * d2[1] - rr[1] * d2[0]) / denom;
+    double t2 = (rr[0] * d1[1] - rr[1] * d1[0]) / denom;
+    double e1 = this->Tol / len1;
+    double e2 = this->Tol / len2;
+    if (t1 < -e1 || t1 > 1. + e1 || t2 < -e2 || t2 > 1. + e2)
+    {
+      return;
+    }
+    vtkVector3d pt = a1 + std::min(std::max(t1, 0.), 1.) * d1;
+    if (this->bucketOf(pt) != bucket)
+    {
+      return;
+    }
+    // Hits at (or within tolerance of) a segment endpoint must be discarded
+    // to avoid degenerate output segments.
+    if (t1 > e1 && t1 < 1. - e1)
+    {
+      SegmentHit hit = { s1, t1, pt };
+      hits.push_back(hit);
+    }
+    if (t2 > e2 && t2 < 1. - e2)
+    {
+      SegmentHit hit = { s2, t2, pt };
+      hits.push_back(hit);
+    }
+  }
+
+  const SegmentRecords& Segs;
+  const std::vector<vtkVector3d>& Pts;
+  double Tol;
+  double Lo[2];
+  double Size;
+  std::size_t Dims[2];
+  std::vector<std::size_t> BucketStart;
+  std::vector<std::size_t> BucketSegs;
+};
+}
+
+vtkStandardNewMacro(vtkSplitPlanarLines);
+
+vtkSplitPlanarLines::vtkSplitPlanarLines()
+{
+  this->Tolerance = 0.;
+}
+
+vtkSplitPlanarLines::~vtkSplitPlanarLines()
+{
+}
+
+void vtkSplitPlanarLines::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Tolerance: " << this->Tolerance << "\n";
 }
 
 int vtkSplitPlanarLines::RequestData(
@@ -242,17 +244,11 @@ int vtkSplitPlanarLines::RequestData(
   vtkPolyData* input = vtkPolyData::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
   vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
 
-  // Build locator on input so GetCellPoints() works.
+  // Build links on input so GetCellPoints() works.
   input->BuildCells();
 
-  vtkNew<vtkRayIntersectionLocator> clocator;
-  clocator->SetDataSet(input);
-  clocator->SetTolerance(this->Tolerance);
-  clocator->BuildLocator();
-
   vtkIdType numVerts = input->GetNumberOfVerts();
   vtkIdType numLines = input->GetNumberOfLines();
-  vtkCellArray* lines = input->GetLines();
   vtkNew<vtkPoints> opts;
   vtkNew<vtkCellArray> olines;
   // Copy input points and attributes since we'll be adding intersection points.
@@ -261,20 +257,86 @@ int vtkSplitPlanarLines::RequestData(
   output->SetLines(olines.GetPointer());
   output->GetPointData()->DeepCopy(input->GetPointData());
   output->GetCellData()->CopyAllocate(input->GetCellData());
-  // Initialize event queue with polyline endpoints
-  lines->InitTraversal();
-  HitList hits; // intersections we've already processed
+  vtkCellData* icd = input->GetCellData();
+  vtkCellData* cd = output->GetCellData();
+  vtkPointData* pd = output->GetPointData();
+
+  // Collect every segment of every polyline along with its point coordinates.
+  vtkIdType numPts = input->GetNumberOfPoints();
+  std::vector<vtkVector3d> coords(static_cast<std::size_t>(numPts));
+  for (vtkIdType ii = 0; ii < numPts; ++ii)
+  {
+    input->GetPoint(ii, coords[ii].GetData());
+  }
+  SegmentRecords segs;
   vtkIdType firstPolyCell = numVerts + numLines;
+  for (vtkIdType cellId = numVerts; cellId < firstPolyCell; ++cellId)
+  {
+    vtkIdType npts;
+    vtkIdType* conn;
+    input->GetCellPoints(cellId, npts, conn);
+    for (vtkIdType j = 1; j < npts; ++j)
+    {
+      SegmentRecord seg = { cellId, { conn[j - 1], conn[j] } };
+      segs.push_back(seg);
+    }
+  }
+
+  // Find all the crossings at once and sort them along each segment.
+  HitList hits;
+  if (!segs.empty())
+  {
+    SegmentGrid grid(segs, coords, this->Tolerance);
+    grid.Intersect(hits);
+    std::sort(hits.begin(), hits.end());
+  }
+
+  // Output each segment, split at its crossings.
   vtkNew<vtkIncrementalOctreePointLocator> plocator;
   vtkNew<vtkIdTypeArray> pedigreeIds;
   plocator->SetDataSet(output);
   plocator->SetTolerance(this->Tolerance);
   pedigreeIds->SetName("vtkPedigreeIds");
-  bool haveInputPedigree = input->GetCellData()->GetPedigreeIds() ? true : false;
-  for (vtkIdType cellId = numVerts; cellId < firstPolyCell; ++cellId)
+  bool haveInputPedigree = icd->GetPedigreeIds() ? true : false;
+  HitList::const_iterator hit = hits.begin();
+  for (std::size_t ss = 0; ss < segs.size(); ++ss)
   {
-    IntersectSegments(input, cellId, clocator.GetPointer(), hits, output, plocator.GetPointer(),
-      haveInputPedigree ? NULL : pedigreeIds.GetPointer());
+    const SegmentRecord& srec(segs[ss]);
+    vtkIdType seg[2];
+    seg[0] = plocator->FindClosestPoint(coords[srec.Conn[0]].GetData());
+    double lastParam = 0.;
+    for (; hit != hits.end() && hit->Segment == ss; ++hit)
+    {
+      if (hit->Param == lastParam)
+      {
+        continue; // Ignore duplicate parameter values (where several segments cross).
+      }
+      lastParam = hit->Param;
+      if (plocator->InsertUniquePoint(hit->Point.GetData(), seg[1]))
+      { // Interpolate along edge to get new point data
+        pd->InterpolateEdge(pd, seg[1], srec.Conn[0], srec.Conn[1], hit->Param);
+      }
+      if (seg[0] != seg[1])
+      {
+        vtkIdType segId = olines->InsertNextCell(2, seg);
+        cd->CopyData(icd, srec.CellId, segId);
+        if (!haveInputPedigree)
+        {
+          pedigreeIds->InsertNextValue(srec.CellId);
+        }
+        seg[0] = seg[1];
+      }
+    }
+    seg[1] = plocator->FindClosestPoint(coords[srec.Conn[1]].GetData());
+    if (seg[0] != seg[1])
+    {
+      vtkIdType segId = olines->InsertNextCell(2, seg);
+      cd->CopyData(icd, srec.CellId, segId);
+      if (!haveInputPedigree)
+      {
+        pedigreeIds->InsertNextValue(srec.CellId);
+      }
+    }
   }
   // Only add cell pedigree Ids if the input had none.
   // If the input had them, then copying cell data to each
@@ -13,9 +13,13 @@
 
 // .NAME vtkSplitPlanarLines - Split polyline data at all intersection points.
 // .SECTION Description
-// This filter uses the Bentley-Ottman line sweep algorithm as modified by
-// deBerg, Overmars, van Kreveld, and Schwarzkopf to find all line segment
-// intersections. New points are inserted at the end of the existing point
+// This filter finds all line segment intersections in a single pass by
+// binning segments into a uniform grid of buckets sized to the average
+// segment and only testing segments that share a bucket, so the cost grows
+// with the number of segments and crossings rather than their product.
+// Lines are assumed to lie in a plane of constant z; crossings are found
+// using x and y coordinates.
+// New points are inserted at the end of the existing point
 // coordinates (preserving the original point IDs).
 // There is no guarantee that edge order is preserved, but pedigree IDs are
 // generated to indicate the correspondence between input and output edges.
@@ -0,0 +1,104 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/extension/vtk/source/vtkModelMultiBlockSource.h"
+
+#include "smtk/model/Face.h"
+#include "smtk/model/Instance.h"
+#include "smtk/model/Manager.h"
+#include "smtk/model/Model.h"
+#include "smtk/model/Tessellation.h"
+#include "smtk/model/testing/cxx/helpers.h"
+
+#include "vtkCompositeDataIterator.h"
+#include "vtkDataObject.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+
+#include <cstdlib>
+#include <iostream>
+
+using namespace smtk::model;
+using namespace smtk::model::testing;
+
+// Report the memory (in kiB) held by all leaves of a multiblock.
+static unsigned long leafMemory(vtkMultiBlockDataSet* mbds)
+{
+  unsigned long total = 0;
+  vtkCompositeDataIterator* iter = mbds->NewIterator();
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    total += iter->GetCurrentDataObject()->GetActualMemorySize();
+  }
+  iter->Delete();
+  return total;
+}
+
+// Usage: benchmarkInstancePlacements [placements [prototype-triangles]]
+int main(int argc, char* argv[])
+{
+  int numPlacements = argc > 1 ? atoi(argv[1]) : 100000;
+  int numTriangles = argc > 2 ? atoi(argv[2]) : 10000;
+
+  ManagerPtr mgr = Manager::create();
+  Model model = mgr->addModel(3, 3, "instances");
+  Face proto = mgr->addFace();
+  proto.setName("prototype");
+  model.addCell(proto);
+
+  // A strip of numTriangles/2 quads split into triangles.
+  Tessellation protoTess;
+  int numQuads = numTriangles / 2;
+  for (int ii = 0; ii <= numQuads; ++ii)
+  {
+    protoTess.addCoords(0.01 * ii, 0., 0.);
+    protoTess.addCoords(0.01 * ii, 0.01, 0.);
+  }
+  for (int ii = 0; ii < numQuads; ++ii)
+  {
+    protoTess.addTriangle(2 * ii, 2 * ii + 2, 2 * ii + 3);
+    protoTess.addTriangle(2 * ii, 2 * ii + 3, 2 * ii + 1);
+  }
+  proto.setTessellation(&protoTess);
+
+  Instance inst = mgr->addInstance(proto);
+  inst.setRule("tabular");
+  FloatList placements(3 * static_cast<std::size_t>(numPlacements));
+  for (int ii = 0; ii < numPlacements; ++ii)
+  {
+    placements[3 * ii] = ii % 1000;
+    placements[3 * ii + 1] = ii / 1000;
+    placements[3 * ii + 2] = 0.;
+  }
+  inst.setFloatProperty("placements", placements);
+  inst.generateTessellation();
+
+  vtkNew<vtkModelMultiBlockSource> src;
+  src->SetModelManager(mgr);
+  src->SetModelEntityID(model.entity().toString().c_str());
+
+  Timer timer;
+  for (int compact = 0; compact < 2; ++compact)
+  {
+    src->SetCompactInstances(compact);
+    timer.mark();
+    src->Update();
+    double deltaT = timer.elapsed();
+    auto instances = vtkMultiBlockDataSet::SafeDownCast(
+      src->GetOutputDataObject(vtkModelMultiBlockSource::INSTANCE_PORT));
+    auto prototypes = vtkMultiBlockDataSet::SafeDownCast(
+      src->GetOutputDataObject(vtkModelMultiBlockSource::PROTOTYPE_PORT));
+    std::cout << (compact ? "compact" : "default") << " instancing: " << numPlacements
+              << " placements of a " << numTriangles << "-triangle prototype\n"
+              << "  RequestData " << deltaT << " s\n"
+              << "  placements " << leafMemory(instances) << " kiB\n"
+              << "  prototypes " << leafMemory(prototypes) << " kiB\n";
+  }
+  return 0;
+}
@@ -39,10 +39,12 @@
 #include "vtkCellData.h"
 #include "vtkDataObjectTreeIterator.h"
 #include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
 #include "vtkGDALRasterReader.h"
 #include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkImageMapToColors.h"
+#include "vtkIntArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationStringKey.h"
 #include "vtkInformationVector.h"
@@ -71,6 +73,7 @@ SMTK_THIRDPARTY_PRE_INCLUDE
 #include "boost/filesystem.hpp"
 SMTK_THIRDPARTY_POST_INCLUDE
 
+#include <algorithm>
 #include <errno.h>
 #include <inttypes.h>
 #include <stdlib.h>
@@ -95,6 +98,7 @@ vtkModelMultiBlockSource::vtkModelMultiBlockSource()
   this->ModelEntityID = NULL;
   this->AllowNormalGeneration = 0;
   this->ShowAnalysisTessellation = 0;
+  this->CompactInstances = 0;
   this->linkInstance();
 }
 
@@ -115,6 +119,7 @@ void vtkModelMultiBlockSource::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "ModelEntityID: " << this->ModelEntityID << "\n";
   os << indent << "AllowNormalGeneration: " << (this->AllowNormalGeneration ? "ON" : "OFF") << "\n";
   os << indent << "ShowAnalysisTessellation: " << this->ShowAnalysisTessellation << "\n";
+  os << indent << "CompactInstances: " << (this->CompactInstances ? "ON" : "OFF") << "\n";
 }
 
 /// Set the SMTK model to be displayed.
@@ -623,6 +628,30 @@ void vtkModelMultiBlockSource::PreparePrototypeOutput(vtkMultiBlockDataSet* mbds
     }
   }
   iter->Delete();
+
+  // Prototypes outside the model output (e.g., auxiliary geometry displayed as
+  // a separate representation) are generated here, once, rather than having
+  // their instances dropped.
+  for (auto& entry : instancePrototypes)
+  {
+    if (entry.second >= 0)
+    {
+      continue;
+    }
+    auto data =
+      this->GenerateRepresentationFromModel(entry.first, this->AllowNormalGeneration != 0);
+    if (!data)
+    {
+      continue;
+    }
+    protoBlocks->SetBlock(nextProtoIndex, data);
+    protoBlocks->GetMetaData(nextProtoIndex)
+      ->Set(vtkCompositeDataSet::NAME(), entry.first.name().c_str());
+    protoBlocks->GetMetaData(nextProtoIndex)
+      ->Set(vtkModelMultiBlockSource::ENTITYID(), entry.first.entity().toString().c_str());
+    entry.second = nextProtoIndex;
+    ++nextProtoIndex;
+  }
 }
 
 /// Called by GenerateRepresentationFromModel to create a polydata per instance
@@ -634,6 +663,14 @@ void vtkModelMultiBlockSource::PrepareInstanceOutput(vtkMultiBlockDataSet* insta
   int block = 0;
   for (auto instance : modelInstances)
   {
+    if (this->CompactInstances)
+    {
+      vtkNew<vtkPolyData> instancePoly;
+      instanceBlocks->SetBlock(block++, instancePoly.GetPointer());
+      this->AddCompactInstancePoints(instancePoly.GetPointer(), instance, instancePrototypes);
+      continue;
+    }
+
     const smtk::model::Tessellation* tess = instance.hasTessellation();
     vtkIdType numPoints = static_cast<vtkIdType>(tess->coords().size() / 3);
 
@@ -729,6 +766,58 @@ void vtkModelMultiBlockSource::AddInstancePoints(vtkPolyData* instancePoly,
   }
 }
 
+/**\brief Called by PrepareInstanceOutput to add compact placements for an instance.
+  *
+  * Arrays are sized once and filled directly instead of growing with
+  * InsertNext calls; see SetCompactInstances() for the arrays produced.
+  */
+void vtkModelMultiBlockSource::AddCompactInstancePoints(vtkPolyData* instancePoly,
+  const smtk::model::Instance& inst,
+  std::map<smtk::model::EntityRef, vtkIdType>& instancePrototypes)
+{
+  EntityRef proto;
+  const smtk::model::Tessellation* tess;
+  std::map<smtk::model::EntityRef, vtkIdType>::iterator it;
+  if (!inst.isValid() || !(tess = inst.hasTessellation()) || tess->coords().size() < 3 ||
+    !((proto = inst.prototype()).isValid()))
+  {
+    smtkWarningMacro(this->ModelMgr->log(), "Instance "
+        << inst.entity() << " was invalid, has no tessellation, or has no prototype.");
+    return;
+  }
+  if (((it = instancePrototypes.find(proto)) == instancePrototypes.end()) || it->second < 0)
+  {
+    smtkWarningMacro(this->ModelMgr->log(), "Prototype (" << proto.name() << ") for instance ("
+                                                          << inst.name() << ") has no VTK dataset");
+    return;
+  }
+
+  vtkIdType numPoints = static_cast<vtkIdType>(tess->coords().size() / 3);
+  vtkNew<vtkPoints> pts;
+  pts->SetDataTypeToFloat();
+  pts->SetNumberOfPoints(numPoints);
+  float* xyz = vtkFloatArray::SafeDownCast(pts->GetData())->GetPointer(0);
+  const double* src = &tess->coords()[0];
+  for (vtkIdType ii = 0; ii < 3 * numPoints; ++ii)
+  {
+    xyz[ii] = static_cast<float>(src[ii]);
+  }
+  instancePoly->SetPoints(pts.GetPointer());
+
+  vtkNew<vtkIntArray> instancePrototype; // block ID of prototype object
+  vtkNew<vtkUnsignedCharArray> instanceMask; // visibility control
+  instancePrototype->SetName(VTK_INSTANCE_SOURCE);
+  instanceMask->SetName(VTK_INSTANCE_VISIBILITY);
+  instancePrototype->SetNumberOfTuples(numPoints);
+  instanceMask->SetNumberOfTuples(numPoints);
+  std::fill_n(instancePrototype->GetPointer(0), numPoints, static_cast<int>(it->second));
+  std::fill_n(instanceMask->GetPointer(0), numPoints, static_cast<unsigned char>(1));
+
+  auto pd = instancePoly->GetPointData();
+  pd->AddArray(instancePrototype.GetPointer());
+  pd->AddArray(instanceMask.GetPointer());
+}
+
 /// Create a multiblock with the right structure, find entities with tessellations, and add them.
 void vtkModelMultiBlockSource::GenerateRepresentationFromModel(vtkMultiBlockDataSet* mbds,
   vtkMultiBlockDataSet* instanceBlocks, vtkMultiBlockDataSet* protoBlocks,
@@ -92,6 +92,17 @@ public:
   vtkSetMacro(AllowNormalGeneration, int);
   vtkBooleanMacro(AllowNormalGeneration, int);
 
+  // Description:
+  // When on, instance placements on INSTANCE_PORT are stored compactly:
+  // single-precision points, a 32-bit prototype index and the visibility
+  // mask. The orientation and scale arrays are omitted since every placement
+  // uses the identity orientation and unit scale; glyph mappers fall back to
+  // those defaults when the arrays are absent. Prototype geometry is emitted
+  // once on PROTOTYPE_PORT in either mode. Off by default.
+  vtkGetMacro(CompactInstances, int);
+  vtkSetMacro(CompactInstances, int);
+  vtkBooleanMacro(CompactInstances, int);
+
   // Description:
   // Functions get string names used to store cell/field data.
   static const char* GetEntityTagName() { return "Entity"; }
@@ -134,6 +145,8 @@ protected:
     std::map<smtk::model::EntityRef, vtkIdType>&);
   void AddInstancePoints(vtkPolyData* instancePoly, const smtk::model::Instance& inst,
     std::map<smtk::model::EntityRef, vtkIdType>& instancePrototypes);
+  void AddCompactInstancePoints(vtkPolyData* instancePoly, const smtk::model::Instance& inst,
+    std::map<smtk::model::EntityRef, vtkIdType>& instancePrototypes);
   void GenerateRepresentationFromModel(vtkMultiBlockDataSet* mbds,
     vtkMultiBlockDataSet* instancePoly, vtkMultiBlockDataSet* protoBlocks,
     smtk::model::ManagerPtr model);
@@ -154,6 +167,7 @@ protected:
   char* ModelEntityID; // Model Entity UUID
   int AllowNormalGeneration;
   int ShowAnalysisTessellation;
+  int CompactInstances;
   vtkNew<vtkPolyDataNormals> NormalGenerator;
   std::map<smtk::common::UUID, vtkIdType> UUID2BlockIdMap; // UUIDs to block index map
 
@@ -179,6 +179,7 @@ public:
 
   struct ThreadSpecificData
   {
+    rtvl_tokens<3>* Tokens;
     SegmentVotersType SegmentVoters;
     vnl_vector_fixed<double, 3> LastNormal;
     unsigned int SegmentIJ[2];
@@ -192,6 +193,17 @@ public:
 
   ThreadSpecificData ThreadData;
 
+  // The working set for extracting a single block; one per block when the
+  // sub-blocks of a level are extracted concurrently.
+  struct BlockExtractionData
+  {
+    rtvl_tokens<3> Tokens;
+    vtkSmartPointer<vtkPoints> OutPoints;
+    vtkSmartPointer<vtkDoubleArray> OutScales;
+    vtkSmartPointer<vtkUnsignedCharArray> RGBScalars;
+    vtkSmartPointer<vtkFloatArray> IntensityArray;
+  };
+
   double TerrainOrigin[2];
 
   void WritePoints(vcl_string fileName, int outputPtsFormat, vtkPolyData* outputPD);
@@ -209,6 +221,10 @@ public:
 
   bool UpdateProgress(int currentLevel, double* bounds);
   bool TerrainExtractSubLevel(TerrainLevelBlock* prevLevelBlock, int extractLevel);
+  bool CanExtractSubBlocksConcurrently(TerrainLevelBlock* prevLevelBlock, int extractLevel);
+  void ExtractSubBlocksConcurrently(
+    TerrainLevelBlock* prevLevelBlock, int extractLevel, rtvl_weight_smooth<3>& tvw);
+  void GetSubBlockTokenBounds(TerrainLevelBlock* levelBlock, double scale, double bounds[4]);
 
   void BuildLevelBlockTree(TerrainLevelBlock* levelBlockTree, int currentLevel, bool split);
   void SetupBlockExtents(TerrainLevelBlock* childBlock);
@@ -216,14 +232,17 @@ public:
   void ExtractNextLevel(TerrainLevelBlock* levelBlock, TerrainLevelBlock* prevLevelBlock,
     unsigned int startRow, unsigned int endRow);
   void Extract2D(TerrainLevelBlock* levelBlock, TerrainLevelBlock* prevLevelBlock,
-    vtkPoints* outPoints, vtkDoubleArray* outScales, rtvl_weight_smooth<3>& tvw);
+    rtvl_tokens<3>& tokens, vtkPoints* outPoints, vtkDoubleArray* outScales,
+    vtkUnsignedCharArray* rgbScalars, vtkFloatArray* intensityArray, rtvl_weight_smooth<3>& tvw,
+    int maximumNumberOfThreads = 0);
 
   bool ExtractSegmentInit(TerrainLevelBlock* levelBlock, ThreadSpecificData& threadData,
     rgtl_octree_objects<2>& objects2D);
   void ExtractSegmentSearch(TerrainLevelBlock* levelBlock, ThreadSpecificData& threadData,
     vtkPoints* outPoints, vtkDoubleArray* outScales, rtvl_weight_smooth<3>& tvw);
   vtkPolyData* ExtractSave(TerrainLevelBlock* levelBlock, int extractLevel, bool levelSplit,
-    vtkPoints* extractOutPoints, vtkDoubleArray* outScales);
+    vtkPoints* extractOutPoints, vtkDoubleArray* outScales, vtkUnsignedCharArray* rgbScalars,
+    vtkFloatArray* intensityArray);
 
   struct Location
   {
@@ -259,6 +278,20 @@ public:
   vtkFloatArray* InputIntensityArray;
   vtkFloatArray* IntensityArray;
   vtkPointLocator* PointLocator;
+
+  // Results of split (sub-block) extraction kept in memory rather than
+  // written to temporary files, keyed by the file name (without extension)
+  // they would otherwise have been written to.
+  typedef vcl_map<vcl_string, vtkSmartPointer<vtkPolyData> > BlockOutputsType;
+  BlockOutputsType BlockOutputs;
+  double BlockOutputsMemoryMB;
+  bool KeepBlockOutput(const vcl_string& fileName, vtkPolyData* polyData);
+  vtkSmartPointer<vtkPolyData> TakeBlockOutput(const vcl_string& fileName);
+  void ClearBlockOutputs()
+  {
+    this->BlockOutputs.clear();
+    this->BlockOutputsMemoryMB = 0;
+  }
 };
 
 vtkTerrainExtractionInternal::vtkTerrainExtractionInternal()
@@ -277,6 +310,7 @@ vtkTerrainExtractionInternal::vtkTerrainExtractionInternal()
   this->RGBScalars = 0;
   this->IntensityArray = 0;
   this->PointLocator = 0;
+  this->BlockOutputsMemoryMB = 0;
 }
 
 vtkTerrainExtractionInternal::~vtkTerrainExtractionInternal()
@@ -338,6 +372,8 @@ vtkTerrainExtractionFilter::vtkTerrainExtractionFilter()
   this->InitialScale = -1;
   this->DetermineIntensityAndColor = true;
   this->MaskSize = 1.0; //default pulled from rtvl_refine
+  this->ProcessBlocksInMemory = false;
+  this->MaximumMemoryMB = 400;
 }
 
 vtkTerrainExtractionFilter::~vtkTerrainExtractionFilter()
@@ -588,6 +624,7 @@ int vtkTerrainExtractionFilter::RequestData(vtkInformation* vtkNotUsed(request),
 
     this->Internal->DeleteTemporaryFiles();
     this->AppendOutputs();
+    this->Internal->ClearBlockOutputs();
 
     delete[] this->Internal->OutputSplitCount;
     delete[] this->Internal->OutputFileNameBase;
@@ -666,8 +703,14 @@ void vtkTerrainExtractionFilter::AppendOutputs()
             int index = (j + n) * this->Internal->OutputSplitCount[level] + (i + m);
             vcl_string fileName = this->Internal->OutputFileNameBase[level];
             sprintf(buf, "_%d", index);
-            fileName += buf + fileExtension;
-            if (vtksys::SystemTools::FileExists(fileName.c_str()))
+            fileName += buf;
+            vtkSmartPointer<vtkPolyData> blockOutput = this->Internal->TakeBlockOutput(fileName);
+            fileName += fileExtension;
+            if (blockOutput)
+            {
+              appendPolyData->AddInputData(blockOutput);
+            }
+            else if (vtksys::SystemTools::FileExists(fileName.c_str()))
             {
               this->Internal->TemporaryFiles.push_back(fileName);
               if (this->GetOutputPtsFormat() == VTK_OUTPUT_TYPE_XML_PD)
@@ -977,7 +1020,8 @@ bool vtkTerrainExtractionInternal::TerrainExtractSubLevel(
     // DO THE WORK
     //push this all into threaded routine
     this->LevelIndex = extractLevel;
-    this->Extract2D(levelBlock, prevLevelBlock, this->OutPoints, this->OutScales, tvw);
+    this->Extract2D(levelBlock, prevLevelBlock, this->Tokens, this->OutPoints, this->OutScales,
+      this->RGBScalars, this->IntensityArray, tvw);
     if (prevLevelBlock)
     {
       prevLevelBlock->Terrain.clear();
@@ -990,7 +1034,8 @@ bool vtkTerrainExtractionInternal::TerrainExtractSubLevel(
       this->InitialExtractSplitLevel = extractLevel - 1;
     }
 
-    this->ExtractSave(levelBlock, extractLevel, false, this->OutPoints, this->OutScales);
+    this->ExtractSave(levelBlock, extractLevel, false, this->OutPoints, this->OutScales,
+      this->RGBScalars, this->IntensityArray);
 
     // update the progress
     abort = this->UpdateProgress(extractLevel, levelBlock->Bounds);
@@ -1001,6 +1046,27 @@ bool vtkTerrainExtractionInternal::TerrainExtractSubLevel(
     }
     delete levelBlock;
   }
+  else if (this->CanExtractSubBlocksConcurrently(prevLevelBlock, extractLevel))
+  {
+    this->LevelIndex = extractLevel;
+    this->ExtractSubBlocksConcurrently(prevLevelBlock, extractLevel, tvw);
+
+    // the blocks of this level are done; descend into each of them in turn
+    for (int i = 0; i < prevLevelBlock->NumberOfSubBlocks; i++)
+    {
+      TerrainLevelBlock* levelBlock = prevLevelBlock->SubBlock[i];
+      if (!abort)
+      {
+        abort = this->UpdateProgress(extractLevel, levelBlock->Bounds);
+      }
+      if (!abort && levelBlock->NumberOfSubBlocks > 0)
+      {
+        abort = this->TerrainExtractSubLevel(levelBlock, extractLevel - 1);
+      }
+      delete levelBlock;
+      prevLevelBlock->SubBlock[i] = 0;
+    }
+  }
   else // process children of prevLevelBlock
   {
     for (int i = 0; i < prevLevelBlock->NumberOfSubBlocks && !abort; i++)
@@ -1008,12 +1074,7 @@ bool vtkTerrainExtractionInternal::TerrainExtractSubLevel(
       TerrainLevelBlock* levelBlock = prevLevelBlock->SubBlock[i];
       // get the tokens within
       double bounds[4];
-      bounds[0] = this->InputBounds[0] + levelBlock->Offset[0] * levelBlock->Spacing[0] - 3 * scale;
-      bounds[1] = this->InputBounds[0] +
-        (levelBlock->Offset[0] + levelBlock->Ni - 1) * levelBlock->Spacing[0] + 3 * scale;
-      bounds[2] = this->InputBounds[2] + levelBlock->Offset[1] * levelBlock->Spacing[1] - 3 * scale;
-      bounds[3] = this->InputBounds[2] +
-        (levelBlock->Offset[1] + levelBlock->Nj - 1) * levelBlock->Spacing[1] + 3 * scale;
+      this->GetSubBlockTokenBounds(levelBlock, scale, bounds);
       this->Refine->get_tokens(extractLevel, bounds, this->Tokens);
 
       // Allocate the terrain representation for this level.
@@ -1022,13 +1083,15 @@ bool vtkTerrainExtractionInternal::TerrainExtractSubLevel(
       // DO THE WORK
       this->LevelIndex = extractLevel;
 
-      this->Extract2D(levelBlock, prevLevelBlock, this->OutPoints, this->OutScales, tvw);
+      this->Extract2D(levelBlock, prevLevelBlock, this->Tokens, this->OutPoints, this->OutScales,
+        this->RGBScalars, this->IntensityArray, tvw);
       if (prevLevelBlock->NumberOfSubBlocks == 1)
       {
         prevLevelBlock->Terrain.clear();
       }
 
-      this->ExtractSave(levelBlock, extractLevel, true, this->OutPoints, this->OutScales);
+      this->ExtractSave(levelBlock, extractLevel, true, this->OutPoints, this->OutScales,
+        this->RGBScalars, this->IntensityArray);
 
       // update the progress
       abort = this->UpdateProgress(extractLevel, levelBlock->Bounds);
@@ -1046,6 +1109,126 @@ bool vtkTerrainExtractionInternal::TerrainExtractSubLevel(
   return abort;
 }
 
+void vtkTerrainExtractionInternal::GetSubBlockTokenBounds(
+  TerrainLevelBlock* levelBlock, double scale, double bounds[4])
+{
+  bounds[0] = this->InputBounds[0] + levelBlock->Offset[0] * levelBlock->Spacing[0] - 3 * scale;
+  bounds[1] = this->InputBounds[0] +
+    (levelBlock->Offset[0] + levelBlock->Ni - 1) * levelBlock->Spacing[0] + 3 * scale;
+  bounds[2] = this->InputBounds[2] + levelBlock->Offset[1] * levelBlock->Spacing[1] - 3 * scale;
+  bounds[3] = this->InputBounds[2] +
+    (levelBlock->Offset[1] + levelBlock->Nj - 1) * levelBlock->Spacing[1] + 3 * scale;
+}
+
+bool vtkTerrainExtractionInternal::CanExtractSubBlocksConcurrently(
+  TerrainLevelBlock* prevLevelBlock, int extractLevel)
+{
+  if (!this->Main->GetProcessBlocksInMemory() || prevLevelBlock->NumberOfSubBlocks < 2)
+  {
+    return false;
+  }
+
+  // All sibling blocks (and, as we descend, their own sub-blocks) are held
+  // at once, so require the whole family to fit in the memory budget.
+  TerrainLevelBlock* firstBlock = prevLevelBlock->SubBlock[0];
+  double size[2] = { firstBlock->Bounds[1] - firstBlock->Bounds[0],
+    firstBlock->Bounds[3] - firstBlock->Bounds[2] };
+  double memoryMB = prevLevelBlock->NumberOfSubBlocks *
+    static_cast<double>(
+      this->ComputeMemoryRequirement(extractLevel, this->MinExtractLevel, false, size));
+  return memoryMB + this->BlockOutputsMemoryMB <= this->Main->GetMaximumMemoryMB();
+}
+
+struct vtkBlockThreadUserData
+{
+  TerrainLevelBlock* PrevLevelBlock;
+  vtkTerrainExtractionInternal* Internal;
+  vtkTerrainExtractionInternal::BlockExtractionData* BlockData;
+  rtvl_weight_smooth<3>* TVW;
+  int ThreadsPerBlock;
+};
+
+VTK_THREAD_RETURN_TYPE vtkExtractBlockExecute(void* arg)
+{
+  int threadId = static_cast<vtkMultiThreader::ThreadInfo*>(arg)->ThreadID;
+  vtkBlockThreadUserData* td =
+    static_cast<vtkBlockThreadUserData*>(static_cast<vtkMultiThreader::ThreadInfo*>(arg)->UserData);
+
+  // one block per thread; each block may still be split by rows across
+  // the threads left over (see ThreadsPerBlock)
+  vtkTerrainExtractionInternal::BlockExtractionData& blockData = td->BlockData[threadId];
+  td->Internal->Extract2D(td->PrevLevelBlock->SubBlock[threadId], td->PrevLevelBlock,
+    blockData.Tokens, blockData.OutPoints, blockData.OutScales, blockData.RGBScalars,
+    blockData.IntensityArray, *td->TVW, td->ThreadsPerBlock);
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+void vtkTerrainExtractionInternal::ExtractSubBlocksConcurrently(
+  TerrainLevelBlock* prevLevelBlock, int extractLevel, rtvl_weight_smooth<3>& tvw)
+{
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+
+  int numberOfBlocks = prevLevelBlock->NumberOfSubBlocks;
+  double scale = this->LevelScales[extractLevel];
+  vcl_vector<BlockExtractionData> blockData(numberOfBlocks);
+
+  // Fetching the tokens may read the (cached) refine results from disk, so
+  // it is done serially before any of the blocks are extracted.
+  for (int i = 0; i < numberOfBlocks; i++)
+  {
+    TerrainLevelBlock* levelBlock = prevLevelBlock->SubBlock[i];
+    double bounds[4];
+    this->GetSubBlockTokenBounds(levelBlock, scale, bounds);
+    this->Refine->get_tokens(extractLevel, bounds, blockData[i].Tokens);
+
+    // Allocate the terrain representation for this level.
+    levelBlock->Terrain.resize(levelBlock->Ni * levelBlock->Nj);
+
+    blockData[i].OutPoints = vtkSmartPointer<vtkPoints>::New();
+    blockData[i].OutScales = vtkSmartPointer<vtkDoubleArray>::New();
+    blockData[i].OutScales->SetName("Scale");
+    if (this->RGBScalars)
+    {
+      blockData[i].RGBScalars = vtkSmartPointer<vtkUnsignedCharArray>::New();
+      blockData[i].RGBScalars->SetName("Color");
+      blockData[i].RGBScalars->SetNumberOfComponents(3);
+    }
+    if (this->IntensityArray)
+    {
+      blockData[i].IntensityArray = vtkSmartPointer<vtkFloatArray>::New();
+      blockData[i].IntensityArray->SetName("Intensity");
+    }
+  }
+
+  vtkNew<vtkMultiThreader> threader;
+  int numberOfThreads = threader->GetGlobalDefaultNumberOfThreads();
+  vtkBlockThreadUserData userData;
+  userData.PrevLevelBlock = prevLevelBlock;
+  userData.Internal = this;
+  userData.BlockData = &blockData[0];
+  userData.TVW = &tvw;
+  userData.ThreadsPerBlock =
+    numberOfThreads > numberOfBlocks ? numberOfThreads / numberOfBlocks : 1;
+
+  threader->SetNumberOfThreads(numberOfBlocks);
+  threader->SetSingleMethod(vtkExtractBlockExecute, &userData);
+  threader->SingleMethodExecute();
+
+  // the parent terrain is only needed to seed this (now complete) level
+  prevLevelBlock->Terrain.clear();
+
+  for (int i = 0; i < numberOfBlocks; i++)
+  {
+    this->ExtractSave(prevLevelBlock->SubBlock[i], extractLevel, true, blockData[i].OutPoints,
+      blockData[i].OutScales, blockData[i].RGBScalars, blockData[i].IntensityArray);
+  }
+
+  timer->StopTimer();
+  vtkDebugWithObjectMacro(this->Main, "Level " << extractLevel << ": extracted " << numberOfBlocks
+                                               << " blocks in " << timer->GetElapsedTime() << "s");
+}
+
 void vtkTerrainExtractionInternal::BuildLevelBlockTree(
   TerrainLevelBlock* parentBlock, int currentLevel, bool split)
 {
@@ -1186,8 +1369,11 @@ bool vtkTerrainExtractionFilter::TerrainExtract(
   this->Internal->OutputFileNameBase = new vcl_string[this->MaxExtractLevel + 1];
 
   // 1st thing we do is figure out the level (if any) that we start splitting at
-  unsigned int maxMemoryMB = 400;
-  this->Internal->InitialExtractSplitLevel = this->DetermineStartingSplitLevel(maxMemoryMB);
+  this->Internal->InitialExtractSplitLevel =
+    this->DetermineStartingSplitLevel(static_cast<unsigned int>(this->MaximumMemoryMB));
+
+  // done once up front, since blocks may be extracted from several threads
+  vtkMultiThreader::SetGlobalMaximumNumberOfThreads(0);
 
   // process 1st couple levels a single block at a time, but then start
   // processing sub-blocks, and it's sub-block, etc, down to leaf.  Can only release
@@ -1258,7 +1444,8 @@ unsigned int vtkTerrainExtractionInternal::ComputeMemoryRequirement(
 }
 
 vtkPolyData* vtkTerrainExtractionInternal::ExtractSave(TerrainLevelBlock* levelBlock,
-  int extractLevel, bool levelSplit, vtkPoints* extractOutPoints, vtkDoubleArray* outScales)
+  int extractLevel, bool levelSplit, vtkPoints* extractOutPoints, vtkDoubleArray* outScales,
+  vtkUnsignedCharArray* rgbScalars, vtkFloatArray* intensityArray)
 {
   vtkNew<vtkCellArray> verts;
   verts->Allocate(extractOutPoints->GetNumberOfPoints());
@@ -1271,18 +1458,18 @@ vtkPolyData* vtkTerrainExtractionInternal::ExtractSave(TerrainLevelBlock* levelB
   vtkPolyData* polyData = vtkPolyData::New();
   polyData->SetPoints(extractOutPoints);
   polyData->SetVerts(verts.GetPointer());
-  if (this->RGBScalars)
+  if (rgbScalars)
   {
-    polyData->GetPointData()->SetScalars(this->RGBScalars);
+    polyData->GetPointData()->SetScalars(rgbScalars);
     polyData->GetPointData()->AddArray(outScales);
   }
   else
   {
     polyData->GetPointData()->SetScalars(outScales);
   }
-  if (this->IntensityArray)
+  if (intensityArray)
   {
-    polyData->GetPointData()->AddArray(this->IntensityArray);
+    polyData->GetPointData()->AddArray(intensityArray);
   }
 
   vcl_string levelFileName = this->OutputPath;
@@ -1323,17 +1510,58 @@ vtkPolyData* vtkTerrainExtractionInternal::ExtractSave(TerrainLevelBlock* levelB
     levelFileName += buf;
   }
 
-  this->WritePoints(levelFileName, this->Main->GetOutputPtsFormat(), polyData);
+  if (!levelSplit || !this->KeepBlockOutput(levelFileName, polyData))
+  {
+    this->WritePoints(levelFileName, this->Main->GetOutputPtsFormat(), polyData);
+  }
   polyData->Delete();
   return 0;
   //  return polyData;
 }
 
+bool vtkTerrainExtractionInternal::KeepBlockOutput(
+  const vcl_string& fileName, vtkPolyData* polyData)
+{
+  if (!this->Main->GetProcessBlocksInMemory())
+  {
+    return false;
+  }
+
+  // spill to disk once the results held in memory would exceed the budget
+  double memoryMB = polyData->GetActualMemorySize() / 1024.0;
+  if (this->BlockOutputsMemoryMB + memoryMB > this->Main->GetMaximumMemoryMB())
+  {
+    return false;
+  }
+
+  // the points and arrays may be reused for the next block, so copy them
+  vtkSmartPointer<vtkPolyData> blockOutput = vtkSmartPointer<vtkPolyData>::New();
+  blockOutput->DeepCopy(polyData);
+  this->BlockOutputs[fileName] = blockOutput;
+  this->BlockOutputsMemoryMB += blockOutput->GetActualMemorySize() / 1024.0;
+  return true;
+}
+
+vtkSmartPointer<vtkPolyData> vtkTerrainExtractionInternal::TakeBlockOutput(
+  const vcl_string& fileName)
+{
+  vtkSmartPointer<vtkPolyData> blockOutput;
+  BlockOutputsType::iterator it = this->BlockOutputs.find(fileName);
+  if (it != this->BlockOutputs.end())
+  {
+    blockOutput = it->second;
+    this->BlockOutputsMemoryMB -= blockOutput->GetActualMemorySize() / 1024.0;
+    this->BlockOutputs.erase(it);
+  }
+  return blockOutput;
+}
+
 struct vtkThreadUserData
 {
   TerrainLevelBlock* LevelBlock;
   TerrainLevelBlock* PrevLevelBlock;
   vtkTerrainExtractionInternal* Internal;
+  rtvl_tokens<3>* Tokens;
   vtkPoints** OutPoints;
   vtkDoubleArray** OutScales;
   vtkUnsignedCharArray** RGBScalars;
@@ -1372,9 +1600,10 @@ VTK_THREAD_RETURN_TYPE vtkExtract2DExecute(void* arg)
   td->Internal->ExtractNextLevel(td->LevelBlock, td->PrevLevelBlock, startRow, lastRow);
 
   vtkTerrainExtractionInternal::ThreadSpecificData threadData;
+  threadData.Tokens = td->Tokens;
 
   // setup search structure to tokens, as needed by this thread
-  unsigned int n = td->Internal->Tokens.points.get_number_of_points();
+  unsigned int n = td->Tokens->points.get_number_of_points();
   unsigned int /*addPtIndex = 0, */ numberOfPointsForThisThread = 0;
   rgtl_object_array_points<2> points2D;
   // the Y (row) extents of tokens that can affect extraction for this thread
@@ -1389,7 +1618,7 @@ VTK_THREAD_RETURN_TYPE vtkExtract2DExecute(void* arg)
   for (unsigned int i = 0; i < n; i++)
   {
     double p[3];
-    td->Internal->Tokens.points.get_point(i, p);
+    td->Tokens->points.get_point(i, p);
     if (threadCount == 1 || (p[1] >= minY && p[1] <= maxY))
     {
       threadData.PointMapping[numberOfPointsForThisThread] = i;
@@ -1467,20 +1696,26 @@ VTK_THREAD_RETURN_TYPE vtkExtract2DExecute(void* arg)
 }
 
 void vtkTerrainExtractionInternal::Extract2D(TerrainLevelBlock* levelBlock,
-  TerrainLevelBlock* prevLevelBlock, vtkPoints* outPoints, vtkDoubleArray* outScales,
-  rtvl_weight_smooth<3>& tvw)
+  TerrainLevelBlock* prevLevelBlock, rtvl_tokens<3>& tokens, vtkPoints* outPoints,
+  vtkDoubleArray* outScales, vtkUnsignedCharArray* rgbScalars, vtkFloatArray* intensityArray,
+  rtvl_weight_smooth<3>& tvw, int maximumNumberOfThreads)
 {
   vtkNew<vtkMultiThreader> threader;
-  vtkMultiThreader::SetGlobalMaximumNumberOfThreads(0);
 
   vtkThreadUserData userData;
   userData.Internal = this;
   userData.LevelBlock = levelBlock;
   userData.PrevLevelBlock = prevLevelBlock;
+  userData.Tokens = &tokens;
   userData.TVW = &tvw;
 
   // if less than 4 rows per thread, use less threads
   unsigned int numberOfThreads = threader->GetGlobalDefaultNumberOfThreads();
+  if (maximumNumberOfThreads > 0 &&
+    numberOfThreads > static_cast<unsigned int>(maximumNumberOfThreads))
+  {
+    numberOfThreads = maximumNumberOfThreads;
+  }
   if (levelBlock->Nj < 4 * numberOfThreads)
   {
     numberOfThreads = int(vcl_ceil(levelBlock->Nj / 4.0));
@@ -1490,13 +1725,13 @@ void vtkTerrainExtractionInternal::Extract2D(TerrainLevelBlock* levelBlock,
   // reset existing arrays
   outPoints->Reset();
   outScales->Reset();
-  if (this->RGBScalars)
+  if (rgbScalars)
   {
-    this->RGBScalars->Reset();
+    rgbScalars->Reset();
   }
-  if (this->IntensityArray)
+  if (intensityArray)
   {
-    this->IntensityArray->Reset();
+    intensityArray->Reset();
   }
   userData.OutPoints = new vtkPoints*[threader->GetNumberOfThreads()];
   userData.OutScales = new vtkDoubleArray*[threader->GetNumberOfThreads()];
@@ -1506,8 +1741,8 @@ void vtkTerrainExtractionInternal::Extract2D(TerrainLevelBlock* levelBlock,
   {
     userData.OutPoints[0] = outPoints;
     userData.OutScales[0] = outScales;
-    userData.RGBScalars[0] = this->RGBScalars;
-    userData.IntensityArray[0] = this->IntensityArray;
+    userData.RGBScalars[0] = rgbScalars;
+    userData.IntensityArray[0] = intensityArray;
   }
   else
   {
@@ -1515,7 +1750,7 @@ void vtkTerrainExtractionInternal::Extract2D(TerrainLevelBlock* levelBlock,
     {
       userData.OutPoints[i] = vtkPoints::New();
       userData.OutScales[i] = vtkDoubleArray::New();
-      if (this->RGBScalars)
+      if (rgbScalars)
       {
         userData.RGBScalars[i] = vtkUnsignedCharArray::New();
         userData.RGBScalars[i]->SetNumberOfComponents(3);
@@ -1524,7 +1759,7 @@ void vtkTerrainExtractionInternal::Extract2D(TerrainLevelBlock* levelBlock,
       {
         userData.RGBScalars[i] = 0;
       }
-      if (this->IntensityArray)
+      if (intensityArray)
       {
         userData.IntensityArray[i] = vtkFloatArray::New();
       }
@@ -1543,13 +1778,13 @@ void vtkTerrainExtractionInternal::Extract2D(TerrainLevelBlock* levelBlock,
     // combine points and arrays, then delete
     outPoints->Allocate(levelBlock->Nj * levelBlock->Ni);
     outScales->Allocate(levelBlock->Nj * levelBlock->Ni);
-    if (this->RGBScalars)
+    if (rgbScalars)
     {
-      this->RGBScalars->Allocate(levelBlock->Nj * levelBlock->Ni * 3);
+      rgbScalars->Allocate(levelBlock->Nj * levelBlock->Ni * 3);
     }
-    if (this->IntensityArray)
+    if (intensityArray)
     {
-      this->IntensityArray->Allocate(levelBlock->Nj * levelBlock->Ni);
+      intensityArray->Allocate(levelBlock->Nj * levelBlock->Ni);
     }
 
     for (int i = 0; i < threader->GetNumberOfThreads(); i++)
@@ -1558,13 +1793,13 @@ void vtkTerrainExtractionInternal::Extract2D(TerrainLevelBlock* levelBlock,
       {
         outPoints->InsertNextPoint(userData.OutPoints[i]->GetPoint(j));
         outScales->InsertNextValue(userData.OutScales[i]->GetValue(j));
-        if (this->RGBScalars)
+        if (rgbScalars)
         {
-          this->RGBScalars->InsertNextTuple(userData.RGBScalars[i]->GetTuple(j));
+          rgbScalars->InsertNextTuple(userData.RGBScalars[i]->GetTuple(j));
         }
-        if (this->IntensityArray)
+        if (intensityArray)
         {
-          this->IntensityArray->InsertNextValue(userData.IntensityArray[i]->GetValue(j));
+          intensityArray->InsertNextValue(userData.IntensityArray[i]->GetValue(j));
         }
       }
       userData.OutPoints[i]->Delete();
@@ -1595,8 +1830,8 @@ bool vtkTerrainExtractionInternal::ExtractSegmentInit(
   TerrainPoint& tp = levelBlock->GetPoint(threadData.SegmentIJ);
   if (tp.known)
   {
-    threadData.SegmentRange[0] = tp.z - this->Tokens.scale / 2;
-    threadData.SegmentRange[1] = tp.z + this->Tokens.scale / 2;
+    threadData.SegmentRange[0] = tp.z - threadData.Tokens->scale / 2;
+    threadData.SegmentRange[1] = tp.z + threadData.Tokens->scale / 2;
   }
   else
   {
@@ -1606,18 +1841,19 @@ bool vtkTerrainExtractionInternal::ExtractSegmentInit(
 
   // Lookup voters that contribute to points on this line segment.
   vcl_vector<int> voter_ids;
-  int num_voters = objects2D.query_sphere(threadData.SegmentXY, 3 * this->Tokens.scale, voter_ids);
+  int num_voters =
+    objects2D.query_sphere(threadData.SegmentXY, 3 * threadData.Tokens->scale, voter_ids);
   for (int i = 0; i < num_voters; i++)
   {
     int id = threadData.PointMapping[voter_ids[i]];
     double p[3];
-    this->Tokens.points.get_point(id, p);
-    rtvl_tensor<3> const& tensor = this->Tokens.tokens[id];
+    threadData.Tokens->points.get_point(id, p);
+    rtvl_tensor<3> const& tensor = threadData.Tokens->tokens[id];
     double flatness = tensor.saliency(0) / tensor.lambda(0);
     double const flatness_threshold = 0;
     if (flatness >= flatness_threshold &&
-      p[2] + 3 * this->Tokens.scale > threadData.SegmentRange[0] &&
-      p[2] - 3 * this->Tokens.scale < threadData.SegmentRange[1])
+      p[2] + 3 * threadData.Tokens->scale > threadData.SegmentRange[0] &&
+      p[2] - 3 * threadData.Tokens->scale < threadData.SegmentRange[1])
     {
       vtkTerrainExtractionInternal::SegmentVotersType::value_type entry(p[2], id);
       threadData.SegmentVoters.insert(entry);
@@ -1630,8 +1866,8 @@ bool vtkTerrainExtractionInternal::ExtractSegmentInit(
   {
     // Compute the search range along the line within reach of the
     // voters.
-    double range[2] = { threadData.SegmentVoters.begin()->first - 3 * this->Tokens.scale,
-      threadData.SegmentVoters.rbegin()->first + 3 * this->Tokens.scale };
+    double range[2] = { threadData.SegmentVoters.begin()->first - 3 * threadData.Tokens->scale,
+      threadData.SegmentVoters.rbegin()->first + 3 * threadData.Tokens->scale };
 
     // Shrink the line segment if possible.
     if (range[0] > threadData.SegmentRange[0])
@@ -1657,7 +1893,7 @@ bool vtkTerrainExtractionInternal::ExtractSegmentVote(
   Location& loc, ThreadSpecificData& threadData, rtvl_weight_smooth<3>& tvw)
 {
   // Find the voters in reach.
-  double sigma = this->Tokens.scale;
+  double sigma = threadData.Tokens->scale;
   vtkTerrainExtractionInternal::SegmentVotersType::iterator first =
     threadData.SegmentVoters.lower_bound(loc.z - 3 * sigma);
   vtkTerrainExtractionInternal::SegmentVotersType::iterator last =
@@ -1685,8 +1921,8 @@ bool vtkTerrainExtractionInternal::ExtractSegmentVote(
   for (vtkTerrainExtractionInternal::SegmentVotersType::iterator vi = first; vi != last; ++vi)
   {
     int j = vi->second;
-    this->Tokens.points.get_point(j, voter_location.data_block());
-    rtvl_voter<3> voter(voter_location, this->Tokens.tokens[j]);
+    threadData.Tokens->points.get_point(j, voter_location.data_block());
+    rtvl_voter<3> voter(voter_location, threadData.Tokens->tokens[j]);
     rtvl_vote(voter, votee, tvw, false);
   }
 
@@ -1709,7 +1945,7 @@ void vtkTerrainExtractionInternal::ExtractSegmentSearch(TerrainLevelBlock* level
   ThreadSpecificData& threadData, vtkPoints* outPoints, vtkDoubleArray* outScales,
   rtvl_weight_smooth<3>& tvw)
 {
-  double step = this->Tokens.scale / 2;
+  double step = threadData.Tokens->scale / 2;
 
   // Shrink the step size if the range is small.
   double size = threadData.SegmentRange[1] - threadData.SegmentRange[0];
@@ -1844,13 +2080,13 @@ bool vtkTerrainExtractionInternal::ExtractSegmentLocalMax(TerrainLevelBlock* lev
   // maximum could not possibly be high enough.
   //
   // TODO: Actually get the constant.  This value is too conservative.
-  double const max_width = this->Tokens.scale / 8;
+  double const max_width = threadData.Tokens->scale / 8;
   double const min_saliency = 10;
 
   int count = 0;
   double saliency = 0;
   double constraint = 10000;
-  double const accuracy = this->Tokens.scale / 100;
+  double const accuracy = threadData.Tokens->scale / 100;
   while ((c.z - a.z > accuracy) && vcl_fabs(constraint) > 1e-8)
   {
     // When the saliency is not high enough, we want to shrink the
@@ -1944,7 +2180,7 @@ bool vtkTerrainExtractionInternal::ExtractSegmentLocalMax(TerrainLevelBlock* lev
     {
       this->InverseTransform->TransformPoint(p.data_block(), transformed);
       /*tp.id = */ outPoints->InsertNextPoint(transformed);
-      double scale = this->Tokens.scale;
+      double scale = threadData.Tokens->scale;
       outScales->InsertNextTypedTuple(&scale);
       if (this->PointLocator)
       {
@@ -1976,7 +2212,7 @@ bool vtkTerrainExtractionInternal::ExtractSegmentLocalMax(TerrainLevelBlock* lev
     }
     tp.known = true;
     tp.level = this->LevelIndex;
-    tp.scale = this->Tokens.scale;
+    tp.scale = threadData.Tokens->scale;
     tp.z = p(2);
     tp.normal = threadData.LastNormal;
     return true;
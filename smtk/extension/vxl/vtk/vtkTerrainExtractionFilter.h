@@ -225,6 +225,25 @@ public:
   vtkSetClampMacro(MaskSize, double, 0.0, 1.0);
   vtkGetMacro(MaskSize, double);
 
+  // Description:
+  // Set/Get whether the independent blocks of a split extraction level are
+  // processed concurrently, with their per-block results kept in memory
+  // (instead of being written to temporary files and read back when the
+  // level is appended).  Blocks are only processed concurrently while the
+  // estimated requirement fits within MaximumMemoryMB; beyond that, blocks
+  // are processed one at a time and results are spilled to disk.
+  vtkBooleanMacro(ProcessBlocksInMemory, bool);
+  vtkSetMacro(ProcessBlocksInMemory, bool);
+  vtkGetMacro(ProcessBlocksInMemory, bool);
+
+  // Description:
+  // Set/Get the memory budget (in MB) for the Extract phase.  It determines
+  // the level at which the extraction starts splitting into blocks, and
+  // (when ProcessBlocksInMemory is true) how many blocks and block results
+  // may be held in memory at once.
+  vtkSetClampMacro(MaximumMemoryMB, int, 1, VTK_INT_MAX);
+  vtkGetMacro(MaximumMemoryMB, int);
+
   //BTX
 protected:
   vtkTerrainExtractionFilter();
@@ -263,6 +282,9 @@ private:
 
   double MaskSize;
 
+  bool ProcessBlocksInMemory;
+  int MaximumMemoryMB;
+
   bool DetermineIntensityAndColor;
 
   double InputBounds[6];
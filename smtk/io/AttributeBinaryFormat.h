@@ -0,0 +1,91 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+// .NAME AttributeBinaryFormat.h - Layout shared by the binary attribute reader and writer
+// .SECTION Description
+// This header is private to smtk/io and is not installed.
+//
+// A binary attribute file is laid out as:
+//
+//   char     signature[8]   "SMTKATTB"
+//   uint32   version
+//   uint32   byte-order tag (0x01020304 in the writer's byte order)
+//   section  xml            definitions, categories, analyses, levels and views
+//   section  strings        uint64 count, uint32 lengths[count], uint64 bytes, chars
+//   section  structure      uint64 count, int32[count]
+//   section  doubles        uint64 count, double[count]
+//   section  uuids          uint64 count, uint8[16 * count]
+//   section  handles        uint64 count, uint64[count]
+//
+// Attribute instances are encoded into the typed arrays in the same order the
+// XML writer visits them: each base definition, its attributes, then its
+// derived definitions.  The structure array holds counts, flags, discrete
+// indices, integer values and string-pool indices; every other kind of value
+// is consumed sequentially from the array that matches its type.
+//
+// Mesh selections are stored as a count of entities followed, for each
+// entity, by its number of runs and the [first, last] pair of each run.
+// .SECTION See Also
+// AttributeBinaryReader AttributeBinaryWriter
+
+#ifndef __smtk_io_AttributeBinaryFormat_h
+#define __smtk_io_AttributeBinaryFormat_h
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace smtk
+{
+namespace io
+{
+namespace binary
+{
+
+static const char signature[8] = { 'S', 'M', 'T', 'K', 'A', 'T', 'T', 'B' };
+static const std::uint32_t formatVersion = 1;
+static const std::uint32_t byteOrderTag = 0x01020304;
+
+/// Per-item flags stored ahead of every item's payload.
+enum ItemFlags
+{
+  ITEM_ENABLED = 0x1,
+  ITEM_READ_LEVEL = 0x2, //!< an explicit advance read level follows
+  ITEM_WRITE_LEVEL = 0x4 //!< an explicit advance write level follows
+};
+
+/// Per-attribute flags stored after the attribute's name.
+enum AttributeFlags
+{
+  ATTRIBUTE_INTERIOR_NODES = 0x1,
+  ATTRIBUTE_BOUNDARY_NODES = 0x2,
+  ATTRIBUTE_COLOR = 0x4,       //!< 4 color components follow in the double array
+  ATTRIBUTE_ASSOCIATIONS = 0x8 //!< an association item payload follows
+};
+
+/// The state of each value in a non-discrete value item.
+enum ValueState
+{
+  VALUE_UNSET = 0,
+  VALUE_SET = 1,
+  VALUE_EXPRESSION = 2
+};
+
+/// Returns true when \a contents begins with the binary attribute signature.
+inline bool hasSignature(const char* contents, std::size_t length)
+{
+  return contents && length >= sizeof(signature) &&
+    std::memcmp(contents, signature, sizeof(signature)) == 0;
+}
+
+} // namespace binary
+} // namespace io
+} // namespace smtk
+
+#endif // __smtk_io_AttributeBinaryFormat_h
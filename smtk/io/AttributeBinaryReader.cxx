@@ -0,0 +1,802 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/io/AttributeBinaryReader.h"
+#include "smtk/io/AttributeBinaryFormat.h"
+#include "smtk/io/AttributeReader.h"
+#include "smtk/io/Logger.h"
+#include "smtk/io/XmlDocV1Parser.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Collection.h"
+#include "smtk/attribute/DateTimeItem.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/DirectoryItem.h"
+#include "smtk/attribute/DoubleItem.h"
+#include "smtk/attribute/FileItem.h"
+#include "smtk/attribute/GroupItem.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/Item.h"
+#include "smtk/attribute/MeshItem.h"
+#include "smtk/attribute/MeshSelectionItem.h"
+#include "smtk/attribute/ModelEntityItem.h"
+#include "smtk/attribute/RefItem.h"
+#include "smtk/attribute/StringItem.h"
+#include "smtk/attribute/ValueItem.h"
+
+#include "smtk/mesh/core/Collection.h"
+#include "smtk/mesh/core/Interface.h"
+#include "smtk/mesh/core/Manager.h"
+#include "smtk/mesh/core/MeshSet.h"
+
+#include "smtk/model/EntityRef.h"
+#include "smtk/model/Manager.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <vector>
+
+using namespace smtk::attribute;
+
+namespace
+{
+
+// Sequential reader over the sections of a binary attribute file.
+class SectionReader
+{
+public:
+  SectionReader(const char* data, std::size_t length)
+    : m_data(data)
+    , m_length(length)
+    , m_offset(0)
+  {
+  }
+
+  template <typename T>
+  bool read(T& value)
+  {
+    if (m_length - m_offset < sizeof(T))
+    {
+      return false;
+    }
+    std::memcpy(&value, m_data + m_offset, sizeof(T));
+    m_offset += sizeof(T);
+    return true;
+  }
+
+  template <typename T>
+  bool readArray(std::vector<T>& values)
+  {
+    std::uint64_t n;
+    if (!this->read(n) || n > (m_length - m_offset) / sizeof(T))
+    {
+      return false;
+    }
+    values.resize(static_cast<std::size_t>(n));
+    if (n)
+    {
+      std::memcpy(&values[0], m_data + m_offset, sizeof(T) * values.size());
+      m_offset += sizeof(T) * values.size();
+    }
+    return true;
+  }
+
+protected:
+  const char* m_data;
+  std::size_t m_length;
+  std::size_t m_offset;
+};
+
+// Rebuilds attribute instances from the typed arrays written by the encoder
+// in AttributeBinaryWriter.cxx; the two must visit items in the same order.
+class Decoder
+{
+public:
+  Decoder(CollectionPtr collection, smtk::io::Logger& logger)
+    : m_collection(collection)
+    , m_logger(logger)
+    , m_ok(true)
+    , m_nextInt(0)
+    , m_nextDouble(0)
+    , m_nextUUID(0)
+    , m_nextHandle(0)
+  {
+  }
+
+  bool readSections(SectionReader& reader, std::string& xml);
+  void processCollection();
+
+protected:
+  void processAttribute(const DefinitionPtr& def);
+  void processItem(const ItemPtr& item);
+  void processValueItem(const ValueItemPtr& item);
+  template <typename ItemType, typename ValueType>
+  void processDerivedValue(const ItemType& item);
+  void processRefItem(const RefItemPtr& item);
+  void processFileSystemItem(const FileSystemItemPtr& item);
+  void processFileItem(const FileItemPtr& item);
+  void processGroupItem(const GroupItemPtr& item);
+  void processModelEntityItem(const ModelEntityItemPtr& item);
+  void processMeshSelectionItem(const MeshSelectionItemPtr& item);
+  void processMeshEntityItem(const MeshItemPtr& item);
+  void processDateTimeItem(const DateTimeItemPtr& item);
+  void resolveReferences();
+
+  int nextInt();
+  std::size_t nextCount() { return static_cast<std::size_t>(std::max(this->nextInt(), 0)); }
+  double nextDouble();
+  const std::string& nextString() { return this->string(this->nextInt()); }
+  const std::string& string(int id);
+  smtk::common::UUID nextUUID();
+  std::uint64_t nextHandle();
+
+  void decode(int& value) { value = this->nextInt(); }
+  void decode(double& value) { value = this->nextDouble(); }
+  void decode(std::string& value) { value = this->nextString(); }
+
+  // Report a structural problem; decoding cannot continue past it since the
+  // remaining values would be attributed to the wrong items.
+  void fail(const std::string& message)
+  {
+    if (m_ok)
+    {
+      smtkErrorMacro(m_logger, message);
+    }
+    m_ok = false;
+  }
+
+  CollectionPtr m_collection;
+  smtk::io::Logger& m_logger;
+  bool m_ok;
+
+  std::vector<std::string> m_strings;
+  std::vector<int> m_ints;
+  std::vector<double> m_doubles;
+  std::vector<unsigned char> m_uuids;
+  std::vector<std::uint64_t> m_handles;
+  std::size_t m_nextInt;
+  std::size_t m_nextDouble;
+  std::size_t m_nextUUID;
+  std::size_t m_nextHandle;
+
+  std::vector<smtk::io::ItemExpressionInfo> m_itemExpressionInfo;
+  std::vector<smtk::io::AttRefInfo> m_attRefInfo;
+};
+
+bool Decoder::readSections(SectionReader& reader, std::string& xml)
+{
+  std::vector<char> chars;
+  std::vector<std::uint32_t> lengths;
+  if (!reader.readArray(chars))
+  {
+    return false;
+  }
+  xml.assign(chars.begin(), chars.end());
+
+  if (!reader.readArray(lengths) || !reader.readArray(chars))
+  {
+    return false;
+  }
+  m_strings.reserve(lengths.size());
+  std::size_t offset = 0;
+  std::vector<std::uint32_t>::const_iterator it;
+  for (it = lengths.begin(); it != lengths.end(); ++it)
+  {
+    if (chars.size() - offset < *it)
+    {
+      return false;
+    }
+    m_strings.push_back(std::string(chars.begin() + offset, chars.begin() + offset + *it));
+    offset += *it;
+  }
+
+  return reader.readArray(m_ints) && reader.readArray(m_doubles) && reader.readArray(m_uuids) &&
+    reader.readArray(m_handles);
+}
+
+int Decoder::nextInt()
+{
+  if (m_nextInt >= m_ints.size())
+  {
+    this->fail("Binary attribute data is truncated");
+    return 0;
+  }
+  return m_ints[m_nextInt++];
+}
+
+double Decoder::nextDouble()
+{
+  if (m_nextDouble >= m_doubles.size())
+  {
+    this->fail("Binary attribute data is truncated");
+    return 0.;
+  }
+  return m_doubles[m_nextDouble++];
+}
+
+const std::string& Decoder::string(int id)
+{
+  static const std::string empty;
+  if (id < 0 || static_cast<std::size_t>(id) >= m_strings.size())
+  {
+    this->fail("Binary attribute data refers to an invalid string");
+    return empty;
+  }
+  return m_strings[static_cast<std::size_t>(id)];
+}
+
+smtk::common::UUID Decoder::nextUUID()
+{
+  if (m_uuids.size() - m_nextUUID < smtk::common::UUID::SIZE)
+  {
+    this->fail("Binary attribute data is truncated");
+    return smtk::common::UUID::null();
+  }
+  const unsigned char* data = &m_uuids[m_nextUUID];
+  m_nextUUID += smtk::common::UUID::SIZE;
+  return smtk::common::UUID(data, data + smtk::common::UUID::SIZE);
+}
+
+std::uint64_t Decoder::nextHandle()
+{
+  if (m_nextHandle >= m_handles.size())
+  {
+    this->fail("Binary attribute data is truncated");
+    return 0;
+  }
+  return m_handles[m_nextHandle++];
+}
+
+void Decoder::processCollection()
+{
+  int d, numDefs = this->nextInt();
+  for (d = 0; d < numDefs && m_ok; ++d)
+  {
+    const std::string& type = this->nextString();
+    std::size_t i, n = this->nextCount();
+    if (!n)
+    {
+      continue;
+    }
+    DefinitionPtr def = m_collection->findDefinition(type);
+    if (!def)
+    {
+      this->fail("Attribute Type: " + type + " - can not find attribute definition");
+      break;
+    }
+    if (def->isAbstract())
+    {
+      this->fail("Attribute Type: " + type + " - is an abstract definition");
+      break;
+    }
+    for (i = 0; i < n && m_ok; ++i)
+    {
+      this->processAttribute(def);
+    }
+  }
+  this->resolveReferences();
+}
+
+void Decoder::processAttribute(const DefinitionPtr& def)
+{
+  std::string name = this->nextString();
+  smtk::common::UUID id = this->nextUUID();
+  int flags = this->nextInt();
+  if (!m_ok)
+  {
+    return;
+  }
+
+  AttributePtr att = id.isNull() ? m_collection->createAttribute(name, def)
+                                 : m_collection->createAttribute(name, def, id);
+  if (!att)
+  {
+    this->fail("Attribute: " + name + " of Type: " + def->type() +
+      "  - could not be created - is the name in use");
+    return;
+  }
+
+  if (def->isNodal())
+  {
+    att->setAppliesToInteriorNodes((flags & smtk::io::binary::ATTRIBUTE_INTERIOR_NODES) != 0);
+    att->setAppliesToBoundaryNodes((flags & smtk::io::binary::ATTRIBUTE_BOUNDARY_NODES) != 0);
+  }
+
+  if (flags & smtk::io::binary::ATTRIBUTE_COLOR)
+  {
+    double color[4];
+    for (int c = 0; c < 4; ++c)
+    {
+      color[c] = this->nextDouble();
+    }
+    att->setColor(color);
+  }
+
+  if (flags & smtk::io::binary::ATTRIBUTE_ASSOCIATIONS)
+  {
+    ModelEntityItemPtr assocsItem = att->associations();
+    if (!assocsItem)
+    {
+      this->fail("Attribute: " + name + " has associations but its definition does not");
+      return;
+    }
+    this->processItem(assocsItem);
+    // As in XmlDocV1Parser::processAttribute, let the model manager know about
+    // the associations without having it call back into this attribute.
+    smtk::model::Manager::Ptr mmgr = att->modelManager();
+    if (mmgr)
+    {
+      ModelEntityItem::const_iterator eit;
+      for (eit = assocsItem->begin(); eit != assocsItem->end(); ++eit)
+      {
+        mmgr->associateAttribute(NULL, att->id(), eit->entity());
+      }
+    }
+  }
+
+  std::size_t i, n = att->numberOfItems();
+  for (i = 0; i < n && m_ok; ++i)
+  {
+    this->processItem(att->item(static_cast<int>(i)));
+  }
+}
+
+void Decoder::processItem(const ItemPtr& item)
+{
+  int flags = this->nextInt();
+  if (item->isOptional())
+  {
+    item->setIsEnabled((flags & smtk::io::binary::ITEM_ENABLED) != 0);
+  }
+  if (flags & smtk::io::binary::ITEM_READ_LEVEL)
+  {
+    item->setAdvanceLevel(0, this->nextInt());
+  }
+  if (flags & smtk::io::binary::ITEM_WRITE_LEVEL)
+  {
+    item->setAdvanceLevel(1, this->nextInt());
+  }
+  if (!m_ok)
+  {
+    return;
+  }
+
+  switch (item->type())
+  {
+    case Item::ATTRIBUTE_REF:
+      this->processRefItem(smtk::dynamic_pointer_cast<RefItem>(item));
+      break;
+    case Item::DOUBLE:
+      this->processValueItem(smtk::dynamic_pointer_cast<ValueItem>(item));
+      this->processDerivedValue<DoubleItemPtr, double>(
+        smtk::dynamic_pointer_cast<DoubleItem>(item));
+      break;
+    case Item::DIRECTORY:
+      this->processFileSystemItem(smtk::dynamic_pointer_cast<DirectoryItem>(item));
+      break;
+    case Item::FILE:
+      this->processFileItem(smtk::dynamic_pointer_cast<FileItem>(item));
+      break;
+    case Item::GROUP:
+      this->processGroupItem(smtk::dynamic_pointer_cast<GroupItem>(item));
+      break;
+    case Item::INT:
+      this->processValueItem(smtk::dynamic_pointer_cast<ValueItem>(item));
+      this->processDerivedValue<IntItemPtr, int>(smtk::dynamic_pointer_cast<IntItem>(item));
+      break;
+    case Item::STRING:
+      this->processValueItem(smtk::dynamic_pointer_cast<ValueItem>(item));
+      this->processDerivedValue<StringItemPtr, std::string>(
+        smtk::dynamic_pointer_cast<StringItem>(item));
+      break;
+    case Item::MODEL_ENTITY:
+      this->processModelEntityItem(smtk::dynamic_pointer_cast<ModelEntityItem>(item));
+      break;
+    case Item::MESH_SELECTION:
+      this->processMeshSelectionItem(smtk::dynamic_pointer_cast<MeshSelectionItem>(item));
+      break;
+    case Item::MESH_ENTITY:
+      this->processMeshEntityItem(smtk::dynamic_pointer_cast<MeshItem>(item));
+      break;
+    case Item::DATE_TIME:
+      this->processDateTimeItem(smtk::dynamic_pointer_cast<DateTimeItem>(item));
+      break;
+    case Item::VOID:
+      // Nothing to do!
+      break;
+    default:
+      this->fail("Unsupported Item Type: " + Item::type2String(item->type()));
+  }
+}
+
+void Decoder::processValueItem(const ValueItemPtr& item)
+{
+  std::size_t i, n = this->nextCount();
+  if (n != item->numberOfValues() && !item->setNumberOfValues(n))
+  {
+    this->fail("Invalid number of values for Item: " + item->name());
+    return;
+  }
+  if (!item->isDiscrete())
+  {
+    return;
+  }
+
+  const std::map<std::string, ItemPtr>& childrenItems = item->childrenItems();
+  std::map<std::string, ItemPtr>::const_iterator iter;
+  for (iter = childrenItems.begin(); iter != childrenItems.end() && m_ok; ++iter)
+  {
+    this->processItem(iter->second);
+  }
+  for (i = 0; i < n && m_ok; i++)
+  {
+    int index = this->nextInt();
+    if (index < 0)
+    {
+      item->unset(i);
+    }
+    else if (!item->setDiscreteIndex(i, index))
+    {
+      smtkErrorMacro(m_logger, "Discrete Index " << index << " for  ith value : " << i
+                                                 << " is not valid for Item: " << item->name());
+    }
+  }
+}
+
+template <typename ItemType, typename ValueType>
+void Decoder::processDerivedValue(const ItemType& item)
+{
+  if (!m_ok || item->isDiscrete())
+  {
+    return;
+  }
+  std::size_t i, n = item->numberOfValues();
+  ValueType value;
+  for (i = 0; i < n && m_ok; i++)
+  {
+    int state = this->nextInt();
+    if (state == smtk::io::binary::VALUE_SET)
+    {
+      this->decode(value);
+      item->setValue(i, value);
+    }
+    else if (state == smtk::io::binary::VALUE_EXPRESSION)
+    {
+      smtk::io::ItemExpressionInfo info;
+      info.item = item;
+      info.pos = static_cast<int>(i);
+      info.expName = this->nextString();
+      m_itemExpressionInfo.push_back(info);
+    }
+    else
+    {
+      item->unset(i);
+    }
+  }
+}
+
+void Decoder::processRefItem(const RefItemPtr& item)
+{
+  std::size_t i, n = this->nextCount();
+  if (n != item->numberOfValues() && !item->setNumberOfValues(n))
+  {
+    this->fail("Invalid number of values for Item: " + item->name());
+    return;
+  }
+  for (i = 0; i < n && m_ok; i++)
+  {
+    int id = this->nextInt();
+    if (id > 0)
+    {
+      smtk::io::AttRefInfo info;
+      info.item = item;
+      info.pos = static_cast<int>(i);
+      info.attName = this->string(id - 1);
+      m_attRefInfo.push_back(info);
+    }
+    else
+    {
+      item->unset(i);
+    }
+  }
+}
+
+void Decoder::processFileSystemItem(const FileSystemItemPtr& item)
+{
+  std::size_t i, n = this->nextCount();
+  if (n != item->numberOfValues() && !item->setNumberOfValues(n))
+  {
+    this->fail("Invalid number of values for Item: " + item->name());
+    return;
+  }
+  for (i = 0; i < n && m_ok; i++)
+  {
+    int id = this->nextInt();
+    if (id > 0)
+    {
+      item->setValue(i, this->string(id - 1));
+    }
+    else
+    {
+      item->unset(i);
+    }
+  }
+}
+
+void Decoder::processFileItem(const FileItemPtr& item)
+{
+  this->processFileSystemItem(item);
+  std::size_t i, n = this->nextCount();
+  for (i = 0; i < n && m_ok; i++)
+  {
+    item->addRecentValue(this->nextString());
+  }
+}
+
+void Decoder::processGroupItem(const GroupItemPtr& item)
+{
+  std::size_t i, j, n = this->nextCount();
+  if (n != item->numberOfGroups() && !item->setNumberOfGroups(n))
+  {
+    this->fail("Invalid number of sub-groups for Group Item: " + item->name());
+    return;
+  }
+  std::size_t m = item->numberOfItemsPerGroup();
+  for (i = 0; i < n && m_ok; i++)
+  {
+    for (j = 0; j < m && m_ok; j++)
+    {
+      this->processItem(item->item(i, j));
+    }
+  }
+}
+
+void Decoder::processModelEntityItem(const ModelEntityItemPtr& item)
+{
+  std::size_t i, n = this->nextCount();
+  if (n != item->numberOfValues() && !item->setNumberOfValues(n))
+  {
+    this->fail("Invalid number of values for Item: " + item->name());
+    return;
+  }
+  smtk::model::ManagerPtr mmgr = m_collection->refModelManager();
+  for (i = 0; i < n && m_ok; i++)
+  {
+    if (this->nextInt())
+    {
+      item->setValue(i, smtk::model::EntityRef(mmgr, this->nextUUID()));
+    }
+    else
+    {
+      item->unset(i);
+    }
+  }
+}
+
+void Decoder::processMeshSelectionItem(const MeshSelectionItemPtr& item)
+{
+  item->setCtrlKeyDown(this->nextInt() != 0);
+  item->setModifyMode(static_cast<smtk::attribute::MeshModifyMode>(this->nextInt()));
+  // Every selected entity is stored with its UUID, so the entity count can
+  // never exceed the number of UUIDs that remain.
+  std::size_t i, n = this->nextCount();
+  if ((m_uuids.size() - m_nextUUID) / smtk::common::UUID::SIZE < n)
+  {
+    this->fail("Invalid number of selected entities for Item: " + item->name());
+    return;
+  }
+  for (i = 0; i < n && m_ok; i++)
+  {
+    smtk::common::UUID uid = this->nextUUID();
+    std::size_t count = this->nextCount();
+    if ((m_ints.size() - m_nextInt) / 2 < count)
+    {
+      this->fail("Binary attribute data is truncated");
+      return;
+    }
+    MeshSelectionItem::ValueSet values;
+    for (std::size_t j = 0; j < count; ++j, m_nextInt += 2)
+    {
+      values.insert(m_ints[m_nextInt], m_ints[m_nextInt + 1]);
+    }
+    item->setValues(uid, values);
+  }
+}
+
+void Decoder::processMeshEntityItem(const MeshItemPtr& item)
+{
+  std::size_t i, n = this->nextCount();
+  if (n != item->numberOfValues() && !item->setNumberOfValues(n))
+  {
+    this->fail("Invalid number of values for Item: " + item->name());
+    return;
+  }
+  smtk::model::ManagerPtr modelmgr = m_collection->refModelManager();
+  for (i = 0; i < n && m_ok; i++)
+  {
+    if (!this->nextInt())
+    {
+      item->unset(i);
+      continue;
+    }
+    smtk::common::UUID cid = this->nextUUID();
+    std::size_t p, numPairs = this->nextCount();
+    smtk::mesh::HandleRange range;
+    for (p = 0; p < numPairs && m_ok; ++p)
+    {
+      smtk::mesh::Handle first = static_cast<smtk::mesh::Handle>(this->nextHandle());
+      smtk::mesh::Handle second = static_cast<smtk::mesh::Handle>(this->nextHandle());
+      range.insert(first, second);
+    }
+
+    smtk::mesh::CollectionPtr c =
+      modelmgr ? modelmgr->meshes()->collection(cid) : smtk::mesh::CollectionPtr();
+    if (!c || !c->interface())
+    {
+      smtkErrorMacro(m_logger, "Expecting a valid collection for mesh item: " << item->name());
+      continue;
+    }
+    item->setValue(i, smtk::mesh::MeshSet(c, c->interface()->getRoot(), range));
+  }
+}
+
+void Decoder::processDateTimeItem(const DateTimeItemPtr& item)
+{
+  std::size_t i, n = this->nextCount();
+  if (n != item->numberOfValues() && !item->setNumberOfValues(n))
+  {
+    this->fail("Invalid number of values for Item: " + item->name());
+    return;
+  }
+  for (i = 0; i < n && m_ok; i++)
+  {
+    int id = this->nextInt();
+    if (id > 0)
+    {
+      ::smtk::common::DateTimeZonePair dtz;
+      dtz.deserialize(this->string(id - 1));
+      item->setValue(i, dtz);
+    }
+    else
+    {
+      item->unset(i);
+    }
+  }
+}
+
+void Decoder::resolveReferences()
+{
+  AttributePtr att;
+  std::vector<smtk::io::ItemExpressionInfo>::const_iterator eit;
+  for (eit = m_itemExpressionInfo.begin(); eit != m_itemExpressionInfo.end(); ++eit)
+  {
+    att = m_collection->findAttribute(eit->expName);
+    if (att)
+    {
+      eit->item->setExpression(eit->pos, att);
+    }
+    else
+    {
+      smtkErrorMacro(m_logger, "Expression Attribute: "
+          << eit->expName << " is missing and required by Item : " << eit->item->name());
+    }
+  }
+
+  std::vector<smtk::io::AttRefInfo>::const_iterator rit;
+  for (rit = m_attRefInfo.begin(); rit != m_attRefInfo.end(); ++rit)
+  {
+    att = m_collection->findAttribute(rit->attName);
+    if (att)
+    {
+      rit->item->setValue(rit->pos, att);
+    }
+    else
+    {
+      smtkErrorMacro(m_logger, "Referenced Attribute: "
+          << rit->attName << " is missing and required by Item: " << rit->item->name());
+    }
+  }
+}
+
+} // anonymous namespace
+
+namespace smtk
+{
+namespace io
+{
+
+bool AttributeBinaryReader::read(
+  smtk::attribute::CollectionPtr collection, const std::string& filename, Logger& logger)
+{
+  logger.reset();
+  std::ifstream infile(filename.c_str(), std::ifstream::in | std::ifstream::binary);
+  if (!infile)
+  {
+    smtkErrorMacro(logger, "Could not open file " << filename);
+    return true;
+  }
+  std::string contents(
+    (std::istreambuf_iterator<char>(infile)), std::istreambuf_iterator<char>());
+  return this->readContents(collection, contents.c_str(), contents.size(), logger);
+}
+
+bool AttributeBinaryReader::readContents(
+  smtk::attribute::CollectionPtr collection, const std::string& filecontents, Logger& logger)
+{
+  return this->readContents(collection, filecontents.c_str(), filecontents.size(), logger);
+}
+
+bool AttributeBinaryReader::readContents(smtk::attribute::CollectionPtr collection,
+  const char* contents, std::size_t length, Logger& logger)
+{
+  logger.reset();
+  if (!collection)
+  {
+    smtkErrorMacro(logger, "No attribute collection to read into");
+    return true;
+  }
+  if (!AttributeBinaryReader::canReadContents(contents, length))
+  {
+    smtkErrorMacro(logger, "Data is not a binary attribute collection");
+    return true;
+  }
+
+  SectionReader reader(contents, length);
+  char sig[sizeof(binary::signature)];
+  std::uint32_t version = 0;
+  std::uint32_t byteOrder = 0;
+  reader.read(sig);
+  reader.read(version);
+  if (!reader.read(byteOrder) || byteOrder != binary::byteOrderTag)
+  {
+    smtkErrorMacro(logger, "Binary attribute data was written with a different byte order");
+    return true;
+  }
+  if (version > binary::formatVersion)
+  {
+    smtkErrorMacro(logger, "Unsupported binary attribute version " << version);
+    return true;
+  }
+
+  std::string xml;
+  Decoder decoder(collection, logger);
+  if (!decoder.readSections(reader, xml))
+  {
+    smtkErrorMacro(logger, "Binary attribute data is truncated");
+    return true;
+  }
+
+  // Definitions, categories and views come first so that attributes can be
+  // created against them.
+  AttributeReader xmlReader;
+  if (xmlReader.readContents(collection, xml, logger))
+  {
+    return true;
+  }
+  decoder.processCollection();
+  return logger.hasErrors();
+}
+
+bool AttributeBinaryReader::canRead(const std::string& filename)
+{
+  char sig[sizeof(binary::signature)];
+  std::ifstream infile(filename.c_str(), std::ifstream::in | std::ifstream::binary);
+  return infile && infile.read(sig, sizeof(sig)) &&
+    AttributeBinaryReader::canReadContents(sig, sizeof(sig));
+}
+
+bool AttributeBinaryReader::canReadContents(const char* contents, std::size_t length)
+{
+  return binary::hasSignature(contents, length);
+}
+}
+}
@@ -0,0 +1,52 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+// .NAME AttributeBinaryReader.h - Read an attribute collection written by AttributeBinaryWriter
+// .SECTION Description
+// The embedded definitions are parsed with AttributeReader; attribute
+// instances are then decoded straight from the typed value arrays.
+// Attribute and expression references are resolved once every attribute
+// has been created, just as the XML parsers do.
+// .SECTION See Also
+// AttributeBinaryWriter AttributeReader
+
+#ifndef __smtk_io_AttributeBinaryReader_h
+#define __smtk_io_AttributeBinaryReader_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+#include "smtk/SystemConfig.h"
+#include <string>
+
+namespace smtk
+{
+namespace io
+{
+class Logger;
+class SMTKCORE_EXPORT AttributeBinaryReader
+{
+public:
+  // Returns true if there was a problem with reading the file
+  bool read(smtk::attribute::CollectionPtr collection, const std::string& filename,
+    smtk::io::Logger& logger);
+
+  bool readContents(smtk::attribute::CollectionPtr collection, const std::string& filecontents,
+    smtk::io::Logger& logger);
+
+  bool readContents(smtk::attribute::CollectionPtr collection, const char* contents,
+    std::size_t length, smtk::io::Logger& logger);
+
+  // Returns true if the file starts with the binary attribute signature
+  static bool canRead(const std::string& filename);
+  static bool canReadContents(const char* contents, std::size_t length);
+};
+}
+}
+
+#endif /* __smtk_io_AttributeBinaryReader_h */
@@ -0,0 +1,544 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/io/AttributeBinaryWriter.h"
+#include "smtk/io/AttributeBinaryFormat.h"
+#include "smtk/io/AttributeWriter.h"
+#include "smtk/io/Logger.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Collection.h"
+#include "smtk/attribute/DateTimeItem.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/DirectoryItem.h"
+#include "smtk/attribute/DoubleItem.h"
+#include "smtk/attribute/FileItem.h"
+#include "smtk/attribute/GroupItem.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/Item.h"
+#include "smtk/attribute/MeshItem.h"
+#include "smtk/attribute/MeshSelectionItem.h"
+#include "smtk/attribute/ModelEntityItem.h"
+#include "smtk/attribute/RefItem.h"
+#include "smtk/attribute/StringItem.h"
+#include "smtk/attribute/ValueItem.h"
+
+#include "smtk/mesh/core/Collection.h"
+
+#include "smtk/model/EntityRef.h"
+
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+using namespace smtk::attribute;
+
+namespace
+{
+
+// Accumulates an attribute collection's instances into typed arrays.
+class Encoder
+{
+public:
+  Encoder(smtk::io::Logger& logger)
+    : m_logger(logger)
+    , m_numberOfDefinitions(0)
+  {
+  }
+
+  void processCollection(const CollectionPtr& collection);
+  void processDefinition(const CollectionPtr& collection, const DefinitionPtr& def);
+  void processAttribute(const AttributePtr& att);
+  void processItem(const ItemPtr& item);
+
+  void write(std::ostream& out, const std::string& xml) const;
+
+protected:
+  void processValueItem(const ValueItemPtr& item);
+  template <typename ItemType>
+  void processDerivedValue(const ItemType& item);
+  void processRefItem(const RefItemPtr& item);
+  void processFileSystemItem(const FileSystemItemPtr& item);
+  void processFileItem(const FileItemPtr& item);
+  void processGroupItem(const GroupItemPtr& item);
+  void processModelEntityItem(const ModelEntityItemPtr& item);
+  void processMeshSelectionItem(const MeshSelectionItemPtr& item);
+  void processMeshEntityItem(const MeshItemPtr& item);
+  void processDateTimeItem(const DateTimeItemPtr& item);
+
+  void encode(int value) { m_ints.push_back(value); }
+  void encode(double value) { m_doubles.push_back(value); }
+  void encode(const std::string& value) { m_ints.push_back(this->stringId(value)); }
+  void encode(const smtk::common::UUID& uid)
+  {
+    m_uuids.insert(m_uuids.end(), uid.begin(), uid.end());
+  }
+  void encodeCount(std::size_t n) { m_ints.push_back(static_cast<int>(n)); }
+
+  int stringId(const std::string& value);
+
+  smtk::io::Logger& m_logger;
+  int m_numberOfDefinitions;
+  std::vector<std::string> m_strings;
+  std::unordered_map<std::string, int> m_stringIds;
+  std::vector<int> m_ints;
+  std::vector<double> m_doubles;
+  std::vector<unsigned char> m_uuids;
+  std::vector<std::uint64_t> m_handles;
+};
+
+template <typename T>
+void writeArray(std::ostream& out, const std::vector<T>& values)
+{
+  std::uint64_t n = static_cast<std::uint64_t>(values.size());
+  out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+  if (n)
+  {
+    out.write(reinterpret_cast<const char*>(&values[0]), sizeof(T) * values.size());
+  }
+}
+
+int Encoder::stringId(const std::string& value)
+{
+  std::unordered_map<std::string, int>::const_iterator it = m_stringIds.find(value);
+  if (it != m_stringIds.end())
+  {
+    return it->second;
+  }
+  int id = static_cast<int>(m_strings.size());
+  m_strings.push_back(value);
+  m_stringIds[value] = id;
+  return id;
+}
+
+void Encoder::processCollection(const CollectionPtr& collection)
+{
+  // The number of definitions is only known once the hierarchy is visited.
+  std::size_t countPos = m_ints.size();
+  m_ints.push_back(0);
+  std::vector<DefinitionPtr> baseDefs;
+  collection->findBaseDefinitions(baseDefs);
+  std::vector<DefinitionPtr>::const_iterator it;
+  for (it = baseDefs.begin(); it != baseDefs.end(); ++it)
+  {
+    this->processDefinition(collection, *it);
+  }
+  m_ints[countPos] = m_numberOfDefinitions;
+}
+
+void Encoder::processDefinition(const CollectionPtr& collection, const DefinitionPtr& def)
+{
+  // Visit definitions in the same order as XmlV2StringWriter::processDefinition
+  // so that both formats list attributes identically.
+  std::vector<AttributePtr> atts;
+  collection->findDefinitionAttributes(def->type(), atts);
+  ++m_numberOfDefinitions;
+  this->encode(def->type());
+  this->encodeCount(atts.size());
+  std::vector<AttributePtr>::const_iterator ait;
+  for (ait = atts.begin(); ait != atts.end(); ++ait)
+  {
+    this->processAttribute(*ait);
+  }
+
+  std::vector<DefinitionPtr> defs;
+  collection->derivedDefinitions(def, defs);
+  std::vector<DefinitionPtr>::const_iterator dit;
+  for (dit = defs.begin(); dit != defs.end(); ++dit)
+  {
+    this->processDefinition(collection, *dit);
+  }
+}
+
+void Encoder::processAttribute(const AttributePtr& att)
+{
+  this->encode(att->name());
+  this->encode(att->id());
+
+  int flags = 0;
+  if (att->definition() && att->definition()->isNodal())
+  {
+    flags |= att->appliesToInteriorNodes() ? smtk::io::binary::ATTRIBUTE_INTERIOR_NODES : 0;
+    flags |= att->appliesToBoundaryNodes() ? smtk::io::binary::ATTRIBUTE_BOUNDARY_NODES : 0;
+  }
+  if (att->isColorSet())
+  {
+    flags |= smtk::io::binary::ATTRIBUTE_COLOR;
+  }
+  ModelEntityItemPtr assoc = att->associations();
+  if (assoc && assoc->numberOfValues() > 0)
+  {
+    flags |= smtk::io::binary::ATTRIBUTE_ASSOCIATIONS;
+  }
+  this->encode(flags);
+
+  if (flags & smtk::io::binary::ATTRIBUTE_COLOR)
+  {
+    const double* color = att->color();
+    m_doubles.insert(m_doubles.end(), color, color + 4);
+  }
+  if (flags & smtk::io::binary::ATTRIBUTE_ASSOCIATIONS)
+  {
+    this->processItem(assoc);
+  }
+
+  std::size_t i, n = att->numberOfItems();
+  for (i = 0; i < n; i++)
+  {
+    this->processItem(att->item(static_cast<int>(i)));
+  }
+}
+
+void Encoder::processItem(const ItemPtr& item)
+{
+  int flags = 0;
+  if (item->isOptional() && item->isEnabled())
+  {
+    flags |= smtk::io::binary::ITEM_ENABLED;
+  }
+  if (!item->usingDefinitionAdvanceLevel(0))
+  {
+    flags |= smtk::io::binary::ITEM_READ_LEVEL;
+  }
+  if (!item->usingDefinitionAdvanceLevel(1))
+  {
+    flags |= smtk::io::binary::ITEM_WRITE_LEVEL;
+  }
+  this->encode(flags);
+  if (flags & smtk::io::binary::ITEM_READ_LEVEL)
+  {
+    this->encode(item->advanceLevel(0));
+  }
+  if (flags & smtk::io::binary::ITEM_WRITE_LEVEL)
+  {
+    this->encode(item->advanceLevel(1));
+  }
+
+  switch (item->type())
+  {
+    case Item::ATTRIBUTE_REF:
+      this->processRefItem(smtk::dynamic_pointer_cast<RefItem>(item));
+      break;
+    case Item::DOUBLE:
+      this->processValueItem(smtk::dynamic_pointer_cast<ValueItem>(item));
+      this->processDerivedValue(smtk::dynamic_pointer_cast<DoubleItem>(item));
+      break;
+    case Item::DIRECTORY:
+      this->processFileSystemItem(smtk::dynamic_pointer_cast<DirectoryItem>(item));
+      break;
+    case Item::FILE:
+      this->processFileItem(smtk::dynamic_pointer_cast<FileItem>(item));
+      break;
+    case Item::GROUP:
+      this->processGroupItem(smtk::dynamic_pointer_cast<GroupItem>(item));
+      break;
+    case Item::INT:
+      this->processValueItem(smtk::dynamic_pointer_cast<ValueItem>(item));
+      this->processDerivedValue(smtk::dynamic_pointer_cast<IntItem>(item));
+      break;
+    case Item::STRING:
+      this->processValueItem(smtk::dynamic_pointer_cast<ValueItem>(item));
+      this->processDerivedValue(smtk::dynamic_pointer_cast<StringItem>(item));
+      break;
+    case Item::MODEL_ENTITY:
+      this->processModelEntityItem(smtk::dynamic_pointer_cast<ModelEntityItem>(item));
+      break;
+    case Item::MESH_SELECTION:
+      this->processMeshSelectionItem(smtk::dynamic_pointer_cast<MeshSelectionItem>(item));
+      break;
+    case Item::MESH_ENTITY:
+      this->processMeshEntityItem(smtk::dynamic_pointer_cast<MeshItem>(item));
+      break;
+    case Item::DATE_TIME:
+      this->processDateTimeItem(smtk::dynamic_pointer_cast<DateTimeItem>(item));
+      break;
+    case Item::VOID:
+      // Nothing to do!
+      break;
+    default:
+      smtkErrorMacro(m_logger, "Unsupported Type: " << Item::type2String(item->type())
+                                                    << " for Item: " << item->name());
+  }
+}
+
+void Encoder::processValueItem(const ValueItemPtr& item)
+{
+  std::size_t i, n = item->numberOfValues();
+  this->encodeCount(n);
+  if (!item->isDiscrete())
+  {
+    return; // values are written by processDerivedValue
+  }
+
+  // Children items are keyed by name so the map order is stable.
+  const std::map<std::string, ItemPtr>& childrenItems = item->childrenItems();
+  std::map<std::string, ItemPtr>::const_iterator iter;
+  for (iter = childrenItems.begin(); iter != childrenItems.end(); ++iter)
+  {
+    this->processItem(iter->second);
+  }
+  for (i = 0; i < n; i++)
+  {
+    this->encode(item->isSet(i) ? item->discreteIndex(i) : -1);
+  }
+}
+
+template <typename ItemType>
+void Encoder::processDerivedValue(const ItemType& item)
+{
+  if (item->isDiscrete())
+  {
+    return;
+  }
+  std::size_t i, n = item->numberOfValues();
+  for (i = 0; i < n; i++)
+  {
+    if (!item->isSet(i))
+    {
+      this->encode(static_cast<int>(smtk::io::binary::VALUE_UNSET));
+    }
+    else if (item->isExpression(i))
+    {
+      this->encode(static_cast<int>(smtk::io::binary::VALUE_EXPRESSION));
+      this->encode(item->expression(i)->name());
+    }
+    else
+    {
+      this->encode(static_cast<int>(smtk::io::binary::VALUE_SET));
+      this->encode(item->value(i));
+    }
+  }
+}
+
+void Encoder::processRefItem(const RefItemPtr& item)
+{
+  std::size_t i, n = item->numberOfValues();
+  this->encodeCount(n);
+  for (i = 0; i < n; i++)
+  {
+    // String ids are offset by one so that zero marks an unset value.
+    this->encode(item->isSet(i) ? this->stringId(item->value(i)->name()) + 1 : 0);
+  }
+}
+
+void Encoder::processFileSystemItem(const FileSystemItemPtr& item)
+{
+  std::size_t i, n = item->numberOfValues();
+  this->encodeCount(n);
+  for (i = 0; i < n; i++)
+  {
+    this->encode(item->isSet(i) ? this->stringId(item->value(i)) + 1 : 0);
+  }
+}
+
+void Encoder::processFileItem(const FileItemPtr& item)
+{
+  this->processFileSystemItem(item);
+  const std::vector<std::string>& recent = item->recentValues();
+  this->encodeCount(recent.size());
+  std::vector<std::string>::const_iterator it;
+  for (it = recent.begin(); it != recent.end(); ++it)
+  {
+    this->encode(*it);
+  }
+}
+
+void Encoder::processGroupItem(const GroupItemPtr& item)
+{
+  std::size_t i, j, n = item->numberOfGroups();
+  std::size_t m = item->numberOfItemsPerGroup();
+  this->encodeCount(n);
+  for (i = 0; i < n; i++)
+  {
+    for (j = 0; j < m; j++)
+    {
+      this->processItem(item->item(i, j));
+    }
+  }
+}
+
+void Encoder::processModelEntityItem(const ModelEntityItemPtr& item)
+{
+  std::size_t i, n = item->numberOfValues();
+  this->encodeCount(n);
+  for (i = 0; i < n; i++)
+  {
+    bool isSet = item->isSet(i);
+    this->encode(isSet ? 1 : 0);
+    if (isSet)
+    {
+      this->encode(item->value(i).entity());
+    }
+  }
+}
+
+void Encoder::processMeshSelectionItem(const MeshSelectionItemPtr& item)
+{
+  this->encode(item->isCtrlKeyDown() ? 1 : 0);
+  this->encode(static_cast<int>(item->modifyMode()));
+  // The count is that of selected entities, not of selected values.
+  this->encodeCount(static_cast<std::size_t>(std::distance(item->begin(), item->end())));
+  MeshSelectionItem::const_sel_map_it it;
+  for (it = item->begin(); it != item->end(); ++it)
+  {
+    this->encode(it->first);
+    this->encodeCount(it->second.numberOfRanges());
+    for (auto& range : it->second.ranges())
+    {
+      m_ints.push_back(range.first);
+      m_ints.push_back(range.second);
+    }
+  }
+}
+
+void Encoder::processMeshEntityItem(const MeshItemPtr& item)
+{
+  std::size_t i = 0, n = item->numberOfValues();
+  this->encodeCount(n);
+  MeshItem::const_mesh_it it;
+  for (it = item->begin(); it != item->end(); ++it, ++i)
+  {
+    bool isSet = item->isSet(i);
+    this->encode(isSet ? 1 : 0);
+    if (!isSet)
+    {
+      continue;
+    }
+    // Ranges are stored as (first, second) pairs of handles.
+    this->encode(it->collection()->entity());
+    const smtk::mesh::HandleRange& range = it->range();
+    this->encodeCount(range.psize());
+    smtk::mesh::HandleRange::const_pair_iterator pit;
+    for (pit = range.const_pair_begin(); pit != range.const_pair_end(); ++pit)
+    {
+      m_handles.push_back(static_cast<std::uint64_t>(pit->first));
+      m_handles.push_back(static_cast<std::uint64_t>(pit->second));
+    }
+  }
+}
+
+void Encoder::processDateTimeItem(const DateTimeItemPtr& item)
+{
+  std::size_t i, n = item->numberOfValues();
+  this->encodeCount(n);
+  for (i = 0; i < n; i++)
+  {
+    this->encode(item->isSet(i) ? this->stringId(item->value(i).serialize()) + 1 : 0);
+  }
+}
+
+void Encoder::write(std::ostream& out, const std::string& xml) const
+{
+  out.write(smtk::io::binary::signature, sizeof(smtk::io::binary::signature));
+  out.write(reinterpret_cast<const char*>(&smtk::io::binary::formatVersion),
+    sizeof(smtk::io::binary::formatVersion));
+  out.write(reinterpret_cast<const char*>(&smtk::io::binary::byteOrderTag),
+    sizeof(smtk::io::binary::byteOrderTag));
+
+  std::vector<char> xmlChars(xml.begin(), xml.end());
+  writeArray(out, xmlChars);
+
+  // The string pool is written as a table of lengths followed by the
+  // concatenated characters so it can be read with two block reads.
+  std::vector<std::uint32_t> lengths;
+  std::vector<char> chars;
+  lengths.reserve(m_strings.size());
+  std::vector<std::string>::const_iterator sit;
+  for (sit = m_strings.begin(); sit != m_strings.end(); ++sit)
+  {
+    lengths.push_back(static_cast<std::uint32_t>(sit->size()));
+    chars.insert(chars.end(), sit->begin(), sit->end());
+  }
+  writeArray(out, lengths);
+  writeArray(out, chars);
+
+  writeArray(out, m_ints);
+  writeArray(out, m_doubles);
+  writeArray(out, m_uuids);
+  writeArray(out, m_handles);
+}
+
+} // anonymous namespace
+
+namespace smtk
+{
+namespace io
+{
+
+AttributeBinaryWriter::AttributeBinaryWriter()
+  : m_includeViews(true)
+{
+}
+
+unsigned int AttributeBinaryWriter::fileVersion()
+{
+  return smtk::io::binary::formatVersion;
+}
+
+bool AttributeBinaryWriter::write(
+  const smtk::attribute::CollectionPtr collection, const std::string& filename, Logger& logger)
+{
+  std::string result;
+  if (this->writeContents(collection, result, logger))
+  {
+    return true;
+  }
+
+  std::ofstream outfile;
+  outfile.open(filename.c_str(), std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+  if (!outfile)
+  {
+    smtkErrorMacro(logger, "Error opening file for writing: " << filename);
+  }
+  else
+  {
+    outfile << result;
+  }
+  outfile.close();
+  return logger.hasErrors();
+}
+
+bool AttributeBinaryWriter::writeContents(
+  const smtk::attribute::CollectionPtr collection, std::string& filecontents, Logger& logger)
+{
+  logger.reset();
+  if (!collection)
+  {
+    smtkErrorMacro(logger, "No attribute collection to write");
+    return true;
+  }
+
+  // Definitions and views are comparatively small and have a rich, evolving
+  // schema, so they reuse the latest XML format.
+  std::string xml;
+  AttributeWriter xmlWriter;
+  xmlWriter.setMaxFileVersion();
+  xmlWriter.includeInstances(false);
+  xmlWriter.includeViews(this->m_includeViews);
+  if (xmlWriter.writeContents(collection, xml, logger, true))
+  {
+    return true;
+  }
+
+  Encoder encoder(logger);
+  encoder.processCollection(collection);
+  if (logger.hasErrors())
+  {
+    return true;
+  }
+
+  std::ostringstream out(std::ios_base::out | std::ios_base::binary);
+  encoder.write(out, xml);
+  filecontents = out.str();
+  return false;
+}
+}
+}
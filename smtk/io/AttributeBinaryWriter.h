@@ -0,0 +1,57 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+// .NAME AttributeBinaryWriter.h - Write an attribute collection in a compact binary format
+// .SECTION Description
+// Definitions, categories, analyses and views are stored as an embedded XML
+// chunk produced by AttributeWriter; attribute instances - usually the bulk of
+// a simulation file - are stored as a string pool plus flat arrays of values
+// per type so they can be loaded without building a DOM.
+// Files written this way can be read by AttributeBinaryReader or
+// AttributeReader, which detects the binary signature.
+// .SECTION See Also
+// AttributeBinaryReader AttributeWriter
+
+#ifndef __smtk_io_AttributeBinaryWriter_h
+#define __smtk_io_AttributeBinaryWriter_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+#include "smtk/SystemConfig.h"
+#include <string>
+
+namespace smtk
+{
+namespace io
+{
+class Logger;
+class SMTKCORE_EXPORT AttributeBinaryWriter
+{
+public:
+  AttributeBinaryWriter();
+
+  // The version of the binary layout this writer produces
+  static unsigned int fileVersion();
+
+  // Returns true if there was a problem with writing the file
+  bool write(const smtk::attribute::CollectionPtr collection, const std::string& filename,
+    smtk::io::Logger& logger);
+  bool writeContents(const smtk::attribute::CollectionPtr collection, std::string& filecontents,
+    smtk::io::Logger& logger);
+
+  // If val is false then views will not be saved
+  void includeViews(bool val) { this->m_includeViews = val; }
+
+private:
+  bool m_includeViews;
+};
+}
+}
+
+#endif /* __smtk_io_AttributeBinaryWriter_h */
@@ -9,6 +9,7 @@
 //=========================================================================
 
 #include "smtk/io/AttributeReader.h"
+#include "smtk/io/AttributeBinaryReader.h"
 #include "smtk/io/Logger.h"
 #include "smtk/io/XmlDocV1Parser.h"
 #include "smtk/io/XmlDocV2Parser.h"
@@ -233,6 +234,13 @@ void Internal_readAttributes(smtk::attribute::CollectionPtr collection,
 bool AttributeReader::read(smtk::attribute::CollectionPtr collection, const std::string& filename,
   bool includePath, Logger& logger)
 {
+  // Collections saved by AttributeBinaryWriter carry a signature instead of XML
+  if (AttributeBinaryReader::canRead(filename))
+  {
+    AttributeBinaryReader binaryReader;
+    return binaryReader.read(collection, filename, logger);
+  }
+
   logger.reset();
   // First load in the xml document
   pugi::xml_document doc;
@@ -0,0 +1,390 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/io/BinaryTessellations.h"
+
+#include "smtk/model/EntityRef.h"
+#include "smtk/model/Manager.h"
+#include "smtk/model/Tessellation.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace smtk
+{
+namespace io
+{
+
+namespace
+{
+
+const char signature[8] = { 'S', 'M', 'T', 'K', 'T', 'E', 'S', 'S' };
+const std::uint32_t formatVersion = 1;
+const std::uint32_t byteOrderTag = 0x01020304;
+
+const char base64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+template <typename T>
+void append(std::string& blob, const T& value)
+{
+  blob.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void appendVarint(std::string& blob, std::int64_t value)
+{
+  // Zig-zag encode so small negative deltas stay small.
+  std::uint64_t zz =
+    (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+  while (zz >= 0x80)
+  {
+    blob.push_back(static_cast<char>((zz & 0x7f) | 0x80));
+    zz >>= 7;
+  }
+  blob.push_back(static_cast<char>(zz));
+}
+
+/// A bounds-checked cursor over an encoded blob.
+class Cursor
+{
+public:
+  Cursor(const std::string& blob)
+    : m_data(blob.data())
+    , m_size(blob.size())
+    , m_pos(0)
+    , m_ok(true)
+  {
+  }
+
+  bool ok() const { return this->m_ok; }
+  bool atEnd() const { return this->m_pos == this->m_size; }
+
+  bool bytes(void* dest, std::size_t len)
+  {
+    if (!this->m_ok || len > this->m_size - this->m_pos)
+    {
+      this->m_ok = false;
+      return false;
+    }
+    std::memcpy(dest, this->m_data + this->m_pos, len);
+    this->m_pos += len;
+    return true;
+  }
+
+  template <typename T>
+  T read()
+  {
+    T value = T();
+    this->bytes(&value, sizeof(T));
+    return value;
+  }
+
+  std::int64_t varint()
+  {
+    std::uint64_t zz = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+      std::uint8_t byte = this->read<std::uint8_t>();
+      if (!this->m_ok)
+      {
+        return 0;
+      }
+      zz |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+      if (!(byte & 0x80))
+      {
+        return static_cast<std::int64_t>(zz >> 1) ^ -static_cast<std::int64_t>(zz & 1);
+      }
+    }
+    this->m_ok = false;
+    return 0;
+  }
+
+  /// Fail unless at least \a count items of \a itemSize bytes remain.
+  bool expect(std::size_t count, std::size_t itemSize)
+  {
+    if (!this->m_ok || count > (this->m_size - this->m_pos) / itemSize)
+    {
+      this->m_ok = false;
+    }
+    return this->m_ok;
+  }
+
+protected:
+  const char* m_data;
+  std::size_t m_size;
+  std::size_t m_pos;
+  bool m_ok;
+};
+
+struct Decoded
+{
+  smtk::common::UUID uid;
+  int generation;
+  smtk::model::Tessellation tess;
+};
+
+/// Return true when every cell of \a tess is complete and refers only to its own points.
+bool validConnectivity(const smtk::model::Tessellation& tess)
+{
+  typedef smtk::model::Tessellation Tess;
+  const std::vector<double>& coords(tess.coords());
+  const std::vector<int>& conn(tess.conn());
+  if (coords.size() % 3)
+  {
+    return false;
+  }
+  std::int64_t numPoints = static_cast<std::int64_t>(coords.size() / 3);
+  std::size_t offset = 0;
+  while (offset < conn.size())
+  {
+    int cellType = conn[offset];
+    if (cellType < 0 || (cellType & ~(smtk::model::TESS_CELLTYPE_MASK |
+                                       smtk::model::TESS_PROPERTY_MASK)))
+    {
+      return false;
+    }
+    std::int64_t numVerts;
+    std::size_t header = 1;
+    switch (Tess::cellShapeFromType(cellType))
+    {
+      case smtk::model::TESS_VERTEX:
+        numVerts = 1;
+        break;
+      case smtk::model::TESS_TRIANGLE:
+        numVerts = 3;
+        break;
+      case smtk::model::TESS_QUAD:
+        numVerts = 4;
+        break;
+      case smtk::model::TESS_POLYVERTEX:
+      case smtk::model::TESS_POLYLINE:
+      case smtk::model::TESS_POLYGON:
+      case smtk::model::TESS_TRIANGLE_STRIP:
+        if (offset + 1 >= conn.size() || conn[offset + 1] < 0)
+        {
+          return false;
+        }
+        numVerts = conn[offset + 1];
+        header = 2;
+        break;
+      default:
+        return false;
+    }
+    std::int64_t length = static_cast<std::int64_t>(header) +
+      numVerts * (1 + Tess::numVertexPropsFromType(cellType)) +
+      Tess::numCellPropsFromType(cellType);
+    if (length > static_cast<std::int64_t>(conn.size() - offset))
+    {
+      return false;
+    }
+    for (std::int64_t vv = 0; vv < numVerts; ++vv)
+    {
+      int pointId = conn[offset + header + static_cast<std::size_t>(vv)];
+      if (pointId < 0 || pointId >= numPoints)
+      {
+        return false;
+      }
+    }
+    offset += static_cast<std::size_t>(length);
+  }
+  return true;
+}
+
+/// Decode every tessellation in \a blob, returning false if it is malformed.
+bool parse(const std::string& blob, std::vector<Decoded>& decoded)
+{
+  Cursor cursor(blob);
+  char sig[sizeof(signature)];
+  if (!cursor.bytes(sig, sizeof(sig)) || std::memcmp(sig, signature, sizeof(sig)) != 0 ||
+    cursor.read<std::uint32_t>() != formatVersion || cursor.read<std::uint32_t>() != byteOrderTag)
+  {
+    return false;
+  }
+
+  std::uint32_t count = cursor.read<std::uint32_t>();
+  for (std::uint32_t ii = 0; ii < count && cursor.ok(); ++ii)
+  {
+    decoded.push_back(Decoded());
+    Decoded& entry(decoded.back());
+    smtk::common::UUID::value_type raw[16];
+    cursor.bytes(raw, sizeof(raw));
+    entry.uid = smtk::common::UUID(raw, raw + sizeof(raw));
+    entry.generation = cursor.read<std::int32_t>();
+
+    std::uint32_t numCoords = cursor.read<std::uint32_t>();
+    if (!cursor.expect(numCoords, sizeof(double)))
+    {
+      break;
+    }
+    entry.tess.coords().resize(numCoords);
+    if (numCoords)
+    {
+      cursor.bytes(&entry.tess.coords()[0], numCoords * sizeof(double));
+    }
+
+    std::uint32_t numConn = cursor.read<std::uint32_t>();
+    if (!cursor.expect(numConn, 1))
+    {
+      break;
+    }
+    entry.tess.conn().resize(numConn);
+    std::int64_t prev = 0;
+    for (std::uint32_t cc = 0; cc < numConn && cursor.ok(); ++cc)
+    {
+      prev += cursor.varint();
+      entry.tess.conn()[cc] = static_cast<int>(prev);
+    }
+    if (cursor.ok() && !validConnectivity(entry.tess))
+    {
+      return false;
+    }
+  }
+  return cursor.ok() && cursor.atEnd();
+}
+}
+
+int BinaryTessellations::encode(
+  const smtk::common::UUIDs& uids, smtk::model::ManagerPtr mgr, std::string& blob)
+{
+  if (!mgr)
+  {
+    return 0;
+  }
+  blob.append(signature, sizeof(signature));
+  append(blob, formatVersion);
+  append(blob, byteOrderTag);
+  std::size_t countPos = blob.size();
+  append(blob, static_cast<std::uint32_t>(0));
+
+  std::uint32_t count = 0;
+  const smtk::model::UUIDsToTessellations& tessellations(mgr->tessellations());
+  for (auto uid : uids)
+  {
+    auto it = tessellations.find(uid);
+    if (it == tessellations.end())
+    {
+      continue;
+    }
+    const smtk::model::Tessellation& tess(it->second);
+    blob.append(reinterpret_cast<const char*>(uid.begin()), smtk::common::UUID::size());
+    int generation = smtk::model::EntityRef(mgr, uid).tessellationGeneration();
+    append(blob, static_cast<std::int32_t>(generation));
+    append(blob, static_cast<std::uint32_t>(tess.coords().size()));
+    if (!tess.coords().empty())
+    {
+      blob.append(reinterpret_cast<const char*>(&tess.coords()[0]),
+        tess.coords().size() * sizeof(double));
+    }
+    append(blob, static_cast<std::uint32_t>(tess.conn().size()));
+    std::int64_t prev = 0;
+    for (auto entry : tess.conn())
+    {
+      appendVarint(blob, static_cast<std::int64_t>(entry) - prev);
+      prev = entry;
+    }
+    ++count;
+  }
+  std::memcpy(&blob[countPos], &count, sizeof(count));
+  return static_cast<int>(count);
+}
+
+int BinaryTessellations::validate(const std::string& blob)
+{
+  std::vector<Decoded> decoded;
+  return parse(blob, decoded) ? static_cast<int>(decoded.size()) : -1;
+}
+
+int BinaryTessellations::decode(const std::string& blob, smtk::model::ManagerPtr mgr)
+{
+  // Decode everything before touching the manager so a malformed blob has no effect.
+  std::vector<Decoded> decoded;
+  if (!mgr || !parse(blob, decoded))
+  {
+    return -1;
+  }
+
+  // Go through the manager so that cached bounds are discarded and observers
+  // are told, then restore the generation the sender assigned.
+  for (auto& entry : decoded)
+  {
+    mgr->setTessellation(entry.uid, entry.tess);
+    mgr->setIntegerProperty(entry.uid, SMTK_TESS_GEN_PROP, entry.generation);
+  }
+  return static_cast<int>(decoded.size());
+}
+
+std::string BinaryTessellations::toBase64(const std::string& bytes)
+{
+  std::string text;
+  text.reserve(4 * ((bytes.size() + 2) / 3));
+  std::size_t ii = 0;
+  for (; ii + 2 < bytes.size(); ii += 3)
+  {
+    std::uint32_t triple = (static_cast<std::uint8_t>(bytes[ii]) << 16) |
+      (static_cast<std::uint8_t>(bytes[ii + 1]) << 8) | static_cast<std::uint8_t>(bytes[ii + 2]);
+    text.push_back(base64Chars[(triple >> 18) & 0x3f]);
+    text.push_back(base64Chars[(triple >> 12) & 0x3f]);
+    text.push_back(base64Chars[(triple >> 6) & 0x3f]);
+    text.push_back(base64Chars[triple & 0x3f]);
+  }
+  std::size_t rest = bytes.size() - ii;
+  if (rest)
+  {
+    std::uint32_t triple = static_cast<std::uint8_t>(bytes[ii]) << 16;
+    if (rest > 1)
+    {
+      triple |= static_cast<std::uint8_t>(bytes[ii + 1]) << 8;
+    }
+    text.push_back(base64Chars[(triple >> 18) & 0x3f]);
+    text.push_back(base64Chars[(triple >> 12) & 0x3f]);
+    text.push_back(rest > 1 ? base64Chars[(triple >> 6) & 0x3f] : '=');
+    text.push_back('=');
+  }
+  return text;
+}
+
+bool BinaryTessellations::fromBase64(const std::string& text, std::string& bytes)
+{
+  int lookup[256];
+  for (int ii = 0; ii < 256; ++ii)
+  {
+    lookup[ii] = -1;
+  }
+  for (int ii = 0; ii < 64; ++ii)
+  {
+    lookup[static_cast<unsigned char>(base64Chars[ii])] = ii;
+  }
+
+  bytes.clear();
+  bytes.reserve(3 * text.size() / 4);
+  std::uint32_t accum = 0;
+  int bits = 0;
+  for (auto ch : text)
+  {
+    if (ch == '=')
+    {
+      break;
+    }
+    int val = lookup[static_cast<unsigned char>(ch)];
+    if (val < 0)
+    {
+      return false;
+    }
+    accum = (accum << 6) | static_cast<std::uint32_t>(val);
+    bits += 6;
+    if (bits >= 8)
+    {
+      bits -= 8;
+      bytes.push_back(static_cast<char>((accum >> bits) & 0xff));
+    }
+  }
+  return true;
+}
+}
+}
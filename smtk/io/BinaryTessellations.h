@@ -0,0 +1,70 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+// .NAME BinaryTessellations.h - Pack entity tessellations into a compact binary blob
+// .SECTION Description
+// Used to ship display tessellations alongside JSON operator results
+// without printing every coordinate as text. The layout is:
+//
+//   char     signature[8]   "SMTKTESS"
+//   uint32   version
+//   uint32   byte-order tag (0x01020304 in the writer's byte order)
+//   uint32   number of tessellations
+//   per tessellation:
+//     uint8    uuid[16]
+//     int32    tessellation generation
+//     uint32   number of coordinates, then double[number of coordinates]
+//     uint32   number of connectivity entries, then each entry as a
+//              zig-zag varint of its difference from the previous entry
+//
+// Connectivity of neighbouring primitives is highly correlated, so the
+// varint deltas usually take one or two bytes per entry.
+// Blobs are embedded in JSON with toBase64()/fromBase64().
+// .SECTION See Also
+// SaveJSON::forOperatorResultDelta LoadJSON::ofOperatorResultRecords
+
+#ifndef __smtk_io_BinaryTessellations_h
+#define __smtk_io_BinaryTessellations_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+#include "smtk/common/UUID.h"
+
+#include <string>
+
+namespace smtk
+{
+namespace io
+{
+
+class SMTKCORE_EXPORT BinaryTessellations
+{
+public:
+  // Append the display tessellations of \a uids held by \a mgr to \a blob.
+  // Entities without a tessellation are skipped. Returns the number encoded.
+  static int encode(
+    const smtk::common::UUIDs& uids, smtk::model::ManagerPtr mgr, std::string& blob);
+
+  // Check that \a blob is well formed and that every cell refers only to
+  // points of its own tessellation. Returns the number of tessellations or -1.
+  static int validate(const std::string& blob);
+
+  // Replace the display tessellations in \a mgr with those in \a blob,
+  // preserving the encoded generation numbers. Returns the number decoded
+  // or -1 if the blob is malformed (in which case nothing is changed).
+  static int decode(const std::string& blob, smtk::model::ManagerPtr mgr);
+
+  static std::string toBase64(const std::string& bytes);
+  // Returns false if \a text contains characters outside the base64 alphabet.
+  static bool fromBase64(const std::string& text, std::string& bytes);
+};
+}
+}
+
+#endif /* __smtk_io_BinaryTessellations_h */
@@ -31,6 +31,7 @@
 #include "smtk/mesh/moab/Interface.h"
 
 #include "smtk/io/AttributeReader.h"
+#include "smtk/io/BinaryTessellations.h"
 #include "smtk/io/ImportMesh.h"
 #include "smtk/io/Logger.h"
 
@@ -552,6 +553,7 @@ int LoadJSON::ofManagerTessellation(const UUID& uid, cJSON* dict, ManagerPtr man
   // We should fetch the metadata->formatVersion and verify it,
   // but I don't think it makes any difference to the fields
   // we rely on... yet.
+  manager->invalidateBoundingBoxes();
   UUIDsToTessellations::iterator tessIt = manager->tessellations().find(uid);
   if (tessIt == manager->tessellations().end())
   {
@@ -987,31 +989,90 @@ int LoadJSON::ofOperatorResult(
   // Deserialize the relevant transcribed entities into the
   // remote operator's model manager:
   smtk::model::ManagerPtr mgr = op->manager();
+  if (mgr)
+  {
+    status &= LoadJSON::ofOperatorResultRecords(node, mgr);
+  }
+  return status;
+}
+
+/**\brief Apply the entity, tessellation and mesh records of an operator result to \a mgr.
+  *
+  * Results produced by SaveJSON::forOperatorResult() hold every entity of each
+  * affected model; each transcribed entity is erased and then re-read.
+  *
+  * Results produced by SaveJSON::forOperatorResultDelta() (which have a true
+  * "delta" member) hold only the created and modified entities. Their records
+  * are updated in place so that neighboring entities which were not sent keep
+  * their references to them, and tessellations which were not sent are kept.
+  * Sent tessellations are decoded from the "tessellations" member; if it is
+  * malformed, nothing is applied and 0 is returned.
+  */
+int LoadJSON::ofOperatorResultRecords(cJSON* node, smtk::model::ManagerPtr mgr)
+{
+  if (!node || !mgr)
+  {
+    return 0;
+  }
+
+  int status = 1;
+  cJSON* delta = cJSON_GetObjectItem(node, "delta");
+  bool isDelta = delta && delta->type == cJSON_True;
   cJSON* records = cJSON_GetObjectItem(node, "records");
+  cJSON* tessellations = cJSON_GetObjectItem(node, "tessellations");
   cJSON* mesh_records = cJSON_GetObjectItem(node, "mesh_records");
-  if (mgr)
+
+  // Reject a malformed tessellation blob before any record is changed.
+  std::string blob;
+  if (tessellations &&
+    (tessellations->type != cJSON_String || !tessellations->valuestring ||
+        !BinaryTessellations::fromBase64(tessellations->valuestring, blob) ||
+        BinaryTessellations::validate(blob) < 0))
   {
-    if (records)
+    std::cerr << "Malformed tessellations in operator result.\n";
+    return 0;
+  }
+
+  if (records)
+  {
+    //      std::cout << "records: \n" << cJSON_Print(records) << "\n";
+    for (cJSON* c = records->child; c; c = c->next)
     {
-      //      std::cout << "records: \n" << cJSON_Print(records) << "\n";
-      for (cJSON* c = records->child; c; c = c->next)
+      smtk::common::UUID uid(c->string);
+      // we can't erase a session
+      smtk::model::SessionRef sref(mgr, uid);
+      if (sref.isValid())
+      {
+        continue;
+      }
+      if (!isDelta)
       {
-        smtk::common::UUID uid(c->string);
-        // we can't erase a session
-        smtk::model::SessionRef sref(mgr, uid);
-        if (sref.isValid())
+        mgr->erase(uid);
+        continue;
+      }
+      EntityPtr ent = mgr->findEntity(uid, false);
+      if (ent)
+      {
+        ent->relations().clear();
+        for (int i = 0; i < smtk::model::KINDS_OF_ARRANGEMENTS; ++i)
         {
-          continue;
+          mgr->arrangementsOfKindForEntity(uid, static_cast<ArrangementKind>(i)).clear();
         }
-        mgr->erase(uid);
       }
-      status = LoadJSON::ofManager(records, mgr);
+      mgr->erase(uid, smtk::model::SESSION_PROPERTIES);
     }
+    status = LoadJSON::ofManager(records, mgr);
+  }
 
-    if (mesh_records)
-    {
-      status &= LoadJSON::ofMeshesOfModel(mesh_records, mgr);
-    }
+  if (tessellations && BinaryTessellations::decode(blob, mgr) < 0)
+  {
+    std::cerr << "Malformed tessellations in operator result.\n";
+    status = 0;
+  }
+
+  if (mesh_records)
+  {
+    status &= LoadJSON::ofMeshesOfModel(mesh_records, mgr);
   }
   return status;
 }
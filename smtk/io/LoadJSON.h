@@ -66,6 +66,7 @@ public:
   static int ofOperator(cJSON* node, smtk::model::OperatorPtr& op, smtk::model::ManagerPtr context);
   static int ofOperatorResult(
     cJSON* node, smtk::model::OperatorResult& resOut, smtk::model::RemoteOperatorPtr op);
+  static int ofOperatorResultRecords(cJSON* node, smtk::model::ManagerPtr context);
   static int ofDanglingEntities(cJSON* node, smtk::model::ManagerPtr context);
 
   static int ofLog(const char* jsonStr, smtk::io::Logger& log);
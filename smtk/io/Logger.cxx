@@ -23,6 +23,42 @@ Logger& Logger::instance()
   return Logger::m_instance;
 }
 
+/**\brief Copy the records and settings of \a other.
+  *
+  * The stream and callback of \a other are not shared with the copy.
+  */
+Logger::Logger(const Logger& other)
+  : m_hasErrors(false)
+  , m_minimumSeverity(DEBUG)
+  , m_stream(nullptr)
+  , m_ownStream(false)
+  , m_flushBatchSize(1)
+  , m_numberOfFlushedRecords(0)
+{
+  *this = other;
+}
+
+Logger& Logger::operator=(const Logger& other)
+{
+  if (&other == this)
+  {
+    return *this;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock1(this->m_recordMutex, std::defer_lock);
+    std::unique_lock<std::mutex> lock2(other.m_recordMutex, std::defer_lock);
+    std::lock(lock1, lock2);
+    this->m_records = other.m_records;
+  }
+  this->m_hasErrors = other.m_hasErrors.load();
+  this->m_minimumSeverity = other.m_minimumSeverity.load();
+  this->m_flushBatchSize = other.m_flushBatchSize;
+  std::lock_guard<std::mutex> streamLock(this->m_streamMutex);
+  this->m_numberOfFlushedRecords = this->numberOfRecords();
+  return *this;
+}
+
 Logger::~Logger()
 {
   this->setFlushToStream(NULL, false, false);
@@ -32,16 +68,42 @@ Logger::~Logger()
   }
 }
 
+std::size_t Logger::numberOfRecords() const
+{
+  std::lock_guard<std::mutex> lock(this->m_recordMutex);
+  return this->m_records.size();
+}
+
+const Logger::Record& Logger::record(std::size_t i) const
+{
+  std::lock_guard<std::mutex> lock(this->m_recordMutex);
+  return this->m_records[i];
+}
+
+/**\brief Add a record to the log.
+  *
+  * This may be called from several threads at once.
+  * Records less severe than minimumSeverity() are discarded.
+  */
 void Logger::addRecord(
   Severity s, const std::string& m, const std::string& fname, unsigned int line)
 {
+  if (!this->isLogging(s))
+  {
+    return;
+  }
   if ((s == Logger::ERROR) || (s == Logger::FATAL))
   {
     this->m_hasErrors = true;
   }
-  this->m_records.push_back(Record(s, m, fname, line));
-  std::size_t nr = this->numberOfRecords();
-  this->flushRecordsToStream(nr - 1, nr);
+  Record rec(s, m, fname, line);
+  {
+    std::lock_guard<std::mutex> lock(this->m_recordMutex);
+    this->m_records.push_back(Record());
+    std::swap(this->m_records.back(), rec);
+  }
+  // Errors are written immediately so they are not lost should the process die.
+  this->flushPendingRecords(s >= Logger::ERROR);
 }
 
 void Logger::append(const Logger& l)
@@ -52,19 +114,26 @@ void Logger::append(const Logger& l)
     return;
   }
 
-  this->m_records.insert(this->m_records.end(), l.m_records.begin(), l.m_records.end());
+  {
+    std::unique_lock<std::mutex> lock1(this->m_recordMutex, std::defer_lock);
+    std::unique_lock<std::mutex> lock2(l.m_recordMutex, std::defer_lock);
+    std::lock(lock1, lock2);
+    this->m_records.insert(this->m_records.end(), l.m_records.begin(), l.m_records.end());
+  }
   if (l.m_hasErrors)
   {
     this->m_hasErrors = true;
   }
-  std::size_t nr = this->numberOfRecords();
-  this->flushRecordsToStream(nr - l.numberOfRecords(), nr);
+  this->flushPendingRecords(false);
 }
 
 void Logger::reset()
 {
+  std::lock_guard<std::mutex> streamLock(this->m_streamMutex);
+  std::lock_guard<std::mutex> lock(this->m_recordMutex);
   this->m_hasErrors = false;
   this->m_records.clear();
+  this->m_numberOfFlushedRecords = 0;
 }
 
 std::string Logger::severityAsString(Severity s)
@@ -92,6 +161,7 @@ std::string Logger::severityAsString(Severity s)
   */
 std::string Logger::toString(std::size_t i, bool includeSourceLoc) const
 {
+  std::lock_guard<std::mutex> lock(this->m_recordMutex);
   std::stringstream ss;
   ss << severityAsString(this->m_records[i].severity) << ": ";
   if (includeSourceLoc && this->m_records[i].fileName != "")
@@ -108,6 +178,7 @@ std::string Logger::toString(std::size_t i, bool includeSourceLoc) const
   */
 std::string Logger::toString(std::size_t i, std::size_t j, bool includeSourceLoc) const
 {
+  std::lock_guard<std::mutex> lock(this->m_recordMutex);
   std::stringstream ss;
   for (; i < j; i++)
   {
@@ -124,6 +195,7 @@ std::string Logger::toString(std::size_t i, std::size_t j, bool includeSourceLoc
 
 std::string Logger::toHTML(std::size_t i, std::size_t j, bool includeSourceLoc) const
 {
+  std::lock_guard<std::mutex> lock(this->m_recordMutex);
   std::stringstream ss;
   ss << "<table>";
   for (; i < j; i++)
@@ -150,12 +222,12 @@ std::string Logger::toHTML(std::size_t i, std::size_t j, bool includeSourceLoc)
 
 std::string Logger::convertToString(bool includeSourceLoc) const
 {
-  return this->toString(0, this->m_records.size(), includeSourceLoc);
+  return this->toString(0, this->numberOfRecords(), includeSourceLoc);
 }
 
 std::string Logger::convertToHTML(bool includeSourceLog) const
 {
-  return this->toHTML(0, this->m_records.size(), includeSourceLog);
+  return this->toHTML(0, this->numberOfRecords(), includeSourceLog);
 }
 
 /**\brief Request all records be flushed to \a output as they are logged.
@@ -174,12 +246,16 @@ std::string Logger::convertToHTML(bool includeSourceLog) const
   */
 void Logger::setFlushToStream(std::ostream* output, bool ownFile, bool includePast)
 {
+  // write any records still pending to the old stream before replacing it
+  this->flushPendingRecords(true);
+  std::lock_guard<std::mutex> streamLock(this->m_streamMutex);
   if (this->m_ownStream)
     delete this->m_stream;
   this->m_stream = output;
   this->m_ownStream = output ? ownFile : false;
+  this->m_numberOfFlushedRecords = this->numberOfRecords();
   if (includePast)
-    this->flushRecordsToStream(0, this->numberOfRecords());
+    this->flushRecordsToStream(0, this->m_numberOfFlushedRecords);
 }
 
 /**\brief Request all records be flushed to a file with the given \a filename.
@@ -243,6 +319,26 @@ void Logger::setFlushToStderr(bool includePast)
   this->setFlushToStream(&std::cerr, false, includePast);
 }
 
+/**\brief Set the number of records to accumulate before writing them to the stream.
+  *
+  * The default of 1 writes each record as it is added.
+  * Larger batches amortize the cost of formatting and flushing the
+  * stream when many records are logged; call flush() to write any
+  * pending records immediately.
+  * Error and fatal records always cause pending records to be written.
+  */
+void Logger::setFlushBatchSize(std::size_t numberOfRecords)
+{
+  this->m_flushBatchSize = numberOfRecords > 0 ? numberOfRecords : 1;
+  this->flushPendingRecords(false);
+}
+
+/// Write any records not yet written to the stream (if one has been set).
+void Logger::flush()
+{
+  this->flushPendingRecords(true);
+}
+
 /// Set a function to be called upon the destruction of the logger.
 void Logger::setCallback(std::function<void()> fn)
 {
@@ -250,15 +346,35 @@ void Logger::setCallback(std::function<void()> fn)
 }
 
 /// This is a helper routine to write records to the stream (if one has been set).
+///
+/// Callers must hold m_streamMutex.
 void Logger::flushRecordsToStream(std::size_t beginRec, std::size_t endRec)
 {
-  if (this->m_stream && beginRec < endRec && beginRec < numberOfRecords() &&
-    endRec <= numberOfRecords())
+  std::size_t nr = this->numberOfRecords();
+  if (this->m_stream && beginRec < endRec && beginRec < nr && endRec <= nr)
   {
     (*this->m_stream) << this->toString(beginRec, endRec);
     this->m_stream->flush();
   }
 }
 
+/// Write records added since the last flush once a batch has accumulated (or if \a force is set).
+void Logger::flushPendingRecords(bool force)
+{
+  std::lock_guard<std::mutex> streamLock(this->m_streamMutex);
+  std::size_t nr = this->numberOfRecords();
+  if (!this->m_stream)
+  {
+    this->m_numberOfFlushedRecords = nr;
+    return;
+  }
+  if (nr > this->m_numberOfFlushedRecords &&
+    (force || nr - this->m_numberOfFlushedRecords >= this->m_flushBatchSize))
+  {
+    this->flushRecordsToStream(this->m_numberOfFlushedRecords, nr);
+    this->m_numberOfFlushedRecords = nr;
+  }
+}
+
 } // namespace io
 } // namespace smtk
@@ -13,47 +13,58 @@
 
 #include "smtk/CoreExports.h"
 #include "smtk/SystemConfig.h"
+#include <atomic>
+#include <deque>
 #include <functional>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <string>
-#include <vector>
 
-/**\brief Write the expression \a x to \a logger as an error message.
+/**\brief Write the expression \a x to \a logger with the given \a severity.
   *
-  * Note that \a x may use the "<<" operator.
+  * The expression is only formatted when \a logger accepts records
+  * of the given severity (see smtk::io::Logger::setMinimumSeverity),
+  * so disabled messages cost a single comparison.
+  * When \a includeSourceLoc is false, no filename and line number
+  * are recorded.
   */
-#define smtkErrorMacro(logger, x)                                                                  \
+#define smtkLogMacro(logger, severity, x, includeSourceLoc)                                        \
   do                                                                                               \
   {                                                                                                \
-    std::stringstream s1;                                                                          \
-    s1 << x;                                                                                       \
-    logger.addRecord(smtk::io::Logger::ERROR, s1.str(), __FILE__, __LINE__);                       \
+    smtk::io::Logger& l1 = (logger);                                                               \
+    if (l1.isLogging(severity))                                                                    \
+    {                                                                                              \
+      std::stringstream s1;                                                                        \
+      s1 << x;                                                                                     \
+      if (includeSourceLoc)                                                                        \
+      {                                                                                            \
+        l1.addRecord(severity, s1.str(), __FILE__, __LINE__);                                      \
+      }                                                                                            \
+      else                                                                                         \
+      {                                                                                            \
+        l1.addRecord(severity, s1.str());                                                          \
+      }                                                                                            \
+    }                                                                                              \
   } while (0)
 
+/**\brief Write the expression \a x to \a logger as an error message.
+  *
+  * Note that \a x may use the "<<" operator.
+  */
+#define smtkErrorMacro(logger, x) smtkLogMacro(logger, smtk::io::Logger::ERROR, x, true)
+
 /**\brief Write the expression \a x to \a logger as a warning message.
   *
   * Note that \a x may use the "<<" operator.
   */
-#define smtkWarningMacro(logger, x)                                                                \
-  do                                                                                               \
-  {                                                                                                \
-    std::stringstream s1;                                                                          \
-    s1 << x;                                                                                       \
-    logger.addRecord(smtk::io::Logger::WARNING, s1.str(), __FILE__, __LINE__);                     \
-  } while (0)
+#define smtkWarningMacro(logger, x) smtkLogMacro(logger, smtk::io::Logger::WARNING, x, true)
 
 /**\brief Write the expression \a x to \a logger as a debug message.
   *
   * Note that \a x may use the "<<" operator.
   */
-#define smtkDebugMacro(logger, x)                                                                  \
-  do                                                                                               \
-  {                                                                                                \
-    std::stringstream s1;                                                                          \
-    s1 << x;                                                                                       \
-    logger.addRecord(smtk::io::Logger::DEBUG, s1.str(), __FILE__, __LINE__);                       \
-  } while (0)
+#define smtkDebugMacro(logger, x) smtkLogMacro(logger, smtk::io::Logger::DEBUG, x, true)
 
 /**\brief Write the expression \a x to \a logger as an informational message.
   *
@@ -62,13 +73,7 @@
   * Unlike other logging macros, this does not include  a
   * filename and line number in the record.
   */
-#define smtkInfoMacro(logger, x)                                                                   \
-  do                                                                                               \
-  {                                                                                                \
-    std::stringstream s1;                                                                          \
-    s1 << x;                                                                                       \
-    logger.addRecord(smtk::io::Logger::INFO, s1.str());                                            \
-  } while (0)
+#define smtkInfoMacro(logger, x) smtkLogMacro(logger, smtk::io::Logger::INFO, x, false)
 
 namespace smtk
 {
@@ -79,6 +84,13 @@ namespace io
  *
  * Logger has a singleton interface to a global logger, but is also
  * constructible as a non-singleton object.
+ *
+ * Records may be added from multiple threads at once; each record is
+ * appended under a short-lived lock and records are never moved once
+ * added, so references returned by record() remain valid until reset().
+ * Records below the minimum severity are discarded before they are
+ * formatted by the logging macros. When a stream is set, records may
+ * be written to it in batches (see setFlushBatchSize).
  */
 class SMTKCORE_EXPORT Logger
 {
@@ -116,19 +128,31 @@ public:
 
   Logger()
     : m_hasErrors(false)
+    , m_minimumSeverity(DEBUG)
     , m_stream(nullptr)
     , m_ownStream(false)
+    , m_flushBatchSize(1)
+    , m_numberOfFlushedRecords(0)
   {
   }
+  Logger(const Logger& other);
+  Logger& operator=(const Logger& other);
   virtual ~Logger();
-  std::size_t numberOfRecords() const { return this->m_records.size(); }
+  std::size_t numberOfRecords() const;
 
   bool hasErrors() const { return this->m_hasErrors; }
 
   void addRecord(
     Severity s, const std::string& m, const std::string& fname = "", unsigned int line = 0);
 
-  const Record& record(std::size_t i) const { return this->m_records[i]; }
+  const Record& record(std::size_t i) const;
+
+  /// Return true when records of severity \a s are kept rather than discarded.
+  bool isLogging(Severity s) const { return s >= this->m_minimumSeverity.load(); }
+
+  /// Set/get the least severe records to keep; the default keeps all records.
+  void setMinimumSeverity(Severity s) { this->m_minimumSeverity = s; }
+  Severity minimumSeverity() const { return this->m_minimumSeverity; }
 
   std::string toString(std::size_t i, bool includeSourceLoc = false) const;
   std::string toString(std::size_t i, std::size_t j, bool includeSourceLoc = false) const;
@@ -149,16 +173,28 @@ public:
   void setFlushToStdout(bool includePast);
   void setFlushToStderr(bool includePast);
 
+  void setFlushBatchSize(std::size_t numberOfRecords);
+  std::size_t flushBatchSize() const { return this->m_flushBatchSize; }
+  void flush();
+
   void setCallback(std::function<void()> fn);
 
 protected:
   void flushRecordsToStream(std::size_t beginRec, std::size_t endRec);
+  void flushPendingRecords(bool force);
 
-  std::vector<Record> m_records;
-  bool m_hasErrors;
+  std::deque<Record> m_records;
+  std::atomic<bool> m_hasErrors;
+  std::atomic<Severity> m_minimumSeverity;
   std::ostream* m_stream;
   bool m_ownStream;
+  std::size_t m_flushBatchSize;
+  std::size_t m_numberOfFlushedRecords;
   std::function<void()> m_callback;
+  // Guards m_records; held only while records are inserted or looked up.
+  mutable std::mutex m_recordMutex;
+  // Guards m_stream and m_numberOfFlushedRecords while records are written.
+  std::mutex m_streamMutex;
 
 private:
   static Logger m_instance;
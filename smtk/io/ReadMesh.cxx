@@ -67,16 +67,15 @@ bool ReadMesh::ExtensionIsSupported(const std::string& ext)
   return false;
 }
 
-smtk::mesh::CollectionPtr ReadMesh::operator()(
-  const std::string& filePath, smtk::mesh::ManagerPtr manager, mesh::Subset subset) const
+namespace
+{
+// Search for a reader that can read the given file, returning nullptr if there is none
+const smtk::io::mesh::MeshIO* findReader(const std::string& filePath)
 {
   // Grab the file extension
   std::string ext = boost::filesystem::extension(filePath);
   std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
 
-  smtk::mesh::CollectionPtr collection = nullptr;
-
-  // Search for an appropriate reader
   for (auto&& reader : smtk::io::ReadMesh::SupportedIOTypes())
   {
     for (auto&& format : reader->FileFormats())
@@ -85,22 +84,26 @@ smtk::mesh::CollectionPtr ReadMesh::operator()(
         std::find(format.Extensions.begin(), format.Extensions.end(), ext) !=
           format.Extensions.end())
       {
-        // read the collection
-        collection = reader->read(filePath, manager, subset);
-        break;
+        return reader.get();
       }
     }
   }
+  return nullptr;
+}
+}
+
+smtk::mesh::CollectionPtr ReadMesh::operator()(
+  const std::string& filePath, smtk::mesh::ManagerPtr manager, mesh::Subset subset) const
+{
+  const mesh::MeshIO* reader = findReader(filePath);
+  smtk::mesh::CollectionPtr collection =
+    reader ? reader->read(filePath, manager, subset) : smtk::mesh::CollectionPtr();
 
   if (!collection)
   {
     collection = smtk::mesh::Collection::create();
-    collection->readLocation(filePath);
-  }
-  else
-  {
-    collection->readLocation(filePath);
   }
+  collection->readLocation(filePath);
 
   return collection;
 }
@@ -108,25 +111,32 @@ smtk::mesh::CollectionPtr ReadMesh::operator()(
 bool ReadMesh::operator()(
   const std::string& filePath, smtk::mesh::CollectionPtr collection, mesh::Subset subset) const
 {
-  // Grab the file extension
-  std::string ext = boost::filesystem::extension(filePath);
-  std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+  const mesh::MeshIO* reader = findReader(filePath);
+  return reader ? reader->read(filePath, collection, subset) : false;
+}
 
-  // Search for an appropriate reader
-  for (auto&& reader : smtk::io::ReadMesh::SupportedIOTypes())
+smtk::mesh::CollectionPtr ReadMesh::operator()(const std::string& filePath,
+  smtk::mesh::ManagerPtr manager, const smtk::common::UUIDArray& modelEntities) const
+{
+  const mesh::MeshIO* reader = findReader(filePath);
+  smtk::mesh::CollectionPtr collection = reader
+    ? reader->readAssociated(filePath, manager, modelEntities)
+    : smtk::mesh::CollectionPtr();
+
+  if (!collection)
   {
-    for (auto&& format : reader->FileFormats())
-    {
-      if (format.CanRead() &&
-        std::find(format.Extensions.begin(), format.Extensions.end(), ext) !=
-          format.Extensions.end())
-      {
-        // read the collection
-        return reader->read(filePath, collection, subset);
-      }
-    }
+    collection = smtk::mesh::Collection::create();
   }
-  return false;
+  collection->readLocation(filePath);
+
+  return collection;
+}
+
+bool ReadMesh::operator()(const std::string& filePath, smtk::mesh::CollectionPtr collection,
+  const smtk::common::UUIDArray& modelEntities) const
+{
+  const mesh::MeshIO* reader = findReader(filePath);
+  return reader ? reader->readAssociated(filePath, collection, modelEntities) : false;
 }
 
 smtk::mesh::CollectionPtr readMesh(
@@ -153,6 +163,13 @@ smtk::mesh::CollectionPtr readNeumann(const std::string& filePath, smtk::mesh::M
   return smtk::io::readMesh(filePath, manager, mesh::Subset::OnlyNeumann);
 }
 
+smtk::mesh::CollectionPtr readAssociated(const std::string& filePath,
+  smtk::mesh::ManagerPtr manager, const smtk::common::UUIDArray& modelEntities)
+{
+  ReadMesh read;
+  return read(filePath, manager, modelEntities);
+}
+
 bool readMesh(
   const std::string& filePath, smtk::mesh::CollectionPtr collection, mesh::Subset subset)
 {
@@ -175,5 +192,11 @@ bool readNeumann(const std::string& filePath, smtk::mesh::CollectionPtr collecti
 {
   return smtk::io::readMesh(filePath, collection, mesh::Subset::OnlyNeumann);
 }
+bool readAssociated(const std::string& filePath, smtk::mesh::CollectionPtr collection,
+  const smtk::common::UUIDArray& modelEntities)
+{
+  ReadMesh read;
+  return read(filePath, collection, modelEntities);
+}
 }
 }
@@ -46,6 +46,17 @@ public:
     mesh::Subset subset = mesh::Subset::EntireCollection) const;
   bool operator()(const std::string& filePath, smtk::mesh::CollectionPtr collection,
     mesh::Subset subset = mesh::Subset::EntireCollection) const;
+
+  //Load only the meshes associated with the given model entities (along with
+  //the cells and points they hold) as a new collection into the given manager.
+  smtk::mesh::CollectionPtr operator()(const std::string& filePath, smtk::mesh::ManagerPtr manager,
+    const smtk::common::UUIDArray& modelEntities) const;
+  //Load the meshes associated with the given model entities into an existing
+  //collection. Model entities the collection already holds meshes for are
+  //skipped, so that a collection can be filled in incrementally. Points the
+  //new cells share with the collection's cells are not duplicated.
+  bool operator()(const std::string& filePath, smtk::mesh::CollectionPtr collection,
+    const smtk::common::UUIDArray& modelEntities) const;
 };
 
 SMTKCORE_EXPORT smtk::mesh::CollectionPtr readMesh(const std::string& filePath,
@@ -59,6 +70,8 @@ SMTKCORE_EXPORT smtk::mesh::CollectionPtr readDirichlet(
   const std::string& filePath, smtk::mesh::ManagerPtr manager);
 SMTKCORE_EXPORT smtk::mesh::CollectionPtr readNeumann(
   const std::string& filePath, smtk::mesh::ManagerPtr manager);
+SMTKCORE_EXPORT smtk::mesh::CollectionPtr readAssociated(const std::string& filePath,
+  smtk::mesh::ManagerPtr manager, const smtk::common::UUIDArray& modelEntities);
 
 SMTKCORE_EXPORT bool readMesh(const std::string& filePath, smtk::mesh::CollectionPtr collection,
   mesh::Subset subset = mesh::Subset::EntireCollection);
@@ -69,6 +82,8 @@ SMTKCORE_EXPORT bool readDomain(const std::string& filePath, smtk::mesh::Collect
 SMTKCORE_EXPORT bool readDirichlet(
   const std::string& filePath, smtk::mesh::CollectionPtr collection);
 SMTKCORE_EXPORT bool readNeumann(const std::string& filePath, smtk::mesh::CollectionPtr collection);
+SMTKCORE_EXPORT bool readAssociated(const std::string& filePath,
+  smtk::mesh::CollectionPtr collection, const smtk::common::UUIDArray& modelEntities);
 }
 }
 
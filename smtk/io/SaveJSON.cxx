@@ -33,6 +33,7 @@
 #include "smtk/mesh/core/Manager.h"
 
 #include "smtk/io/AttributeWriter.h"
+#include "smtk/io/BinaryTessellations.h"
 #include "smtk/io/Logger.h"
 #include "smtk/io/WriteMesh.h"
 #include "smtk/io/mesh/MeshIO.h"
@@ -636,11 +637,11 @@ int SaveJSON::forManagerFloatProperties(
 {
   int status = 1;
   UUIDWithFloatProperties entIt = model->floatProperties().find(uid);
-  if (entIt == model->floatProperties().end() || entIt->second.empty())
+  if (entIt == model->floatProperties().end() || entIt->second.data().empty())
   { // No properties is not an error
     return status;
   }
-  return SaveJSON::forFloatData(dict, entIt->second);
+  return SaveJSON::forFloatData(dict, entIt->second.data());
 }
 
 int SaveJSON::forManagerStringProperties(
@@ -648,11 +649,11 @@ int SaveJSON::forManagerStringProperties(
 {
   int status = 1;
   UUIDWithStringProperties entIt = modelManager->stringProperties().find(uid);
-  if (entIt == modelManager->stringProperties().end() || entIt->second.empty())
+  if (entIt == modelManager->stringProperties().end() || entIt->second.data().empty())
   { // No properties is not an error
     return status;
   }
-  return SaveJSON::forStringData(dict, entIt->second);
+  return SaveJSON::forStringData(dict, entIt->second.data());
 }
 
 int SaveJSON::forManagerIntegerProperties(
@@ -660,11 +661,11 @@ int SaveJSON::forManagerIntegerProperties(
 {
   int status = 1;
   UUIDWithIntegerProperties entIt = model->integerProperties().find(uid);
-  if (entIt == model->integerProperties().end() || entIt->second.empty())
+  if (entIt == model->integerProperties().end() || entIt->second.data().empty())
   { // No properties is not an error
     return status;
   }
-  return SaveJSON::forIntegerData(dict, entIt->second);
+  return SaveJSON::forIntegerData(dict, entIt->second.data());
 }
 
 int SaveJSON::forManagerSession(const smtk::common::UUID& uid, cJSON* node, ManagerPtr modelMgr,
@@ -772,28 +773,11 @@ int SaveJSON::forOperator(smtk::attribute::AttributePtr op, cJSON* entRec)
   return 1;
 }
 
-int SaveJSON::forOperatorResult(OperatorResult res, cJSON* entRec)
+// Export JSON meshes created or modified by an operator as a new "mesh_records" node.
+static void addOperatorResultMeshRecords(
+  OperatorResult res, const EntityRefs& meshents, cJSON* entRec)
 {
-  cJSON_AddItemToObject(entRec, "name", cJSON_CreateString(res->type().c_str()));
-  cJSON_AddAttributeSpec(entRec, "result", "resultXML", res);
-  EntityRefs ents = res->modelEntitiesAs<EntityRefs>("created");
-  EntityRefs mdfs = res->modelEntitiesAs<EntityRefs>("modified");
-  EntityRefs meshents = res->modelEntitiesAs<EntityRefs>("mesh_created");
-
-  ents.insert(mdfs.begin(), mdfs.end());
-  ents.insert(meshents.begin(), meshents.end());
-  if (!ents.empty())
-  {
-    // If the operator reports new/modified entities, transcribe the affected models.
-    // TODO: In the future, this may be more conservative (i.e., fewer records
-    //       would be included to save time and memory) than ITERATE_MODELS.
-    cJSON* records = cJSON_CreateObject();
-    SaveJSON::forEntities(records, ents, smtk::model::ITERATE_MODELS, JSON_CLIENT_DATA);
-    cJSON_AddItemToObject(entRec, "records", records);
-  }
-
   smtk::attribute::MeshItemPtr modifiedMeshes = res->findMesh("mesh_modified");
-  // Also export JSON meshes as a new node "mesh_records"
   if (!meshents.empty() || modifiedMeshes)
   {
     // get all collections associated with the input entities
@@ -820,7 +804,112 @@ int SaveJSON::forOperatorResult(OperatorResult res, cJSON* entRec)
       cJSON_AddItemToObject(entRec, "mesh_records", mesh_records);
     }
   }
+}
+
+int SaveJSON::forOperatorResult(OperatorResult res, cJSON* entRec)
+{
+  cJSON_AddItemToObject(entRec, "name", cJSON_CreateString(res->type().c_str()));
+  cJSON_AddAttributeSpec(entRec, "result", "resultXML", res);
+  EntityRefs ents = res->modelEntitiesAs<EntityRefs>("created");
+  EntityRefs mdfs = res->modelEntitiesAs<EntityRefs>("modified");
+  EntityRefs meshents = res->modelEntitiesAs<EntityRefs>("mesh_created");
+
+  ents.insert(mdfs.begin(), mdfs.end());
+  ents.insert(meshents.begin(), meshents.end());
+  if (!ents.empty())
+  {
+    // If the operator reports new/modified entities, transcribe the affected models.
+    cJSON* records = cJSON_CreateObject();
+    SaveJSON::forEntities(records, ents, smtk::model::ITERATE_MODELS, JSON_CLIENT_DATA);
+    cJSON_AddItemToObject(entRec, "records", records);
+  }
+
+  addOperatorResultMeshRecords(res, meshents, entRec);
+  return 1;
+}
+
+/**\brief Serialize an operator result for a client that already holds the affected models.
+  *
+  * Unlike forOperatorResult(), only the records of entities the operator
+  * reports as created or modified are transcribed (not every entity in their
+  * models) and the result is marked with a true "delta" member.
+  * Newly created models are still transcribed whole.
+  * Display tessellations of the transcribed entities are packed by
+  * BinaryTessellations into a base64-encoded "tessellations" string rather
+  * than printed as JSON.
+  *
+  * If \a sentGenerations is non-null, it maps entities to the tessellation
+  * generation last sent to this client; tessellations that have not changed
+  * since are omitted and the map is updated with those that are sent.
+  *
+  * LoadJSON::ofOperatorResultRecords() applies the result on the client.
+  */
+int SaveJSON::forOperatorResultDelta(
+  OperatorResult res, cJSON* entRec, std::map<smtk::common::UUID, int>* sentGenerations)
+{
+  cJSON_AddItemToObject(entRec, "name", cJSON_CreateString(res->type().c_str()));
+  cJSON_AddAttributeSpec(entRec, "result", "resultXML", res);
+  cJSON_AddItemToObject(entRec, "delta", cJSON_CreateTrue());
+  EntityRefs ents = res->modelEntitiesAs<EntityRefs>("created");
+  EntityRefs mdfs = res->modelEntitiesAs<EntityRefs>("modified");
+  EntityRefs meshents = res->modelEntitiesAs<EntityRefs>("mesh_created");
+
+  // Models the client has never seen (e.g., those just read from a file)
+  // are sent whole; other entities are sent without their neighbors.
+  EntityRefs newModels;
+  for (EntityRefs::iterator it = ents.begin(); it != ents.end();)
+  {
+    if (it->isModel())
+    {
+      newModels.insert(*it);
+      ents.erase(it++);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+  ents.insert(mdfs.begin(), mdfs.end());
+  ents.insert(meshents.begin(), meshents.end());
+  if (!ents.empty() || !newModels.empty())
+  {
+    JSONFlags sections = static_cast<JSONFlags>(JSON_ENTITIES | JSON_PROPERTIES);
+    cJSON* records = cJSON_CreateObject();
+    SaveJSON::forEntities(records, ents, smtk::model::ITERATE_BARE, sections);
+    SaveJSON::forEntities(records, newModels, smtk::model::ITERATE_MODELS, sections);
+    cJSON_AddItemToObject(entRec, "records", records);
+
+    smtk::model::ManagerPtr mgr = res->modelManager();
+    smtk::common::UUIDs tessIds;
+    for (cJSON* rec = records->child; rec; rec = rec->next)
+    {
+      EntityRef ent(mgr, smtk::common::UUID(rec->string));
+      if (!ent.hasTessellation())
+      {
+        continue;
+      }
+      int gen = ent.tessellationGeneration();
+      if (sentGenerations)
+      {
+        std::map<smtk::common::UUID, int>::iterator sent = sentGenerations->find(ent.entity());
+        if (sent != sentGenerations->end() && sent->second == gen)
+        {
+          continue;
+        }
+        (*sentGenerations)[ent.entity()] = gen;
+      }
+      tessIds.insert(ent.entity());
+    }
+    if (!tessIds.empty())
+    {
+      std::string blob;
+      BinaryTessellations::encode(tessIds, mgr, blob);
+      cJSON_AddItemToObject(entRec, "tessellations",
+        cJSON_CreateString(BinaryTessellations::toBase64(blob).c_str()));
+    }
+  }
 
+  addOperatorResultMeshRecords(res, meshents, entRec);
   return 1;
 }
 
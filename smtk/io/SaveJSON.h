@@ -123,6 +123,8 @@ public:
   static int forOperator(smtk::model::OperatorSpecification op, cJSON*);
   static int forOperator(smtk::model::OperatorPtr op, cJSON*);
   static int forOperatorResult(smtk::model::OperatorResult res, cJSON*);
+  static int forOperatorResultDelta(smtk::model::OperatorResult res, cJSON*,
+    std::map<smtk::common::UUID, int>* sentGenerations = nullptr);
   static int forDanglingEntities(
     const smtk::common::UUID& sessionId, cJSON* node, smtk::model::ManagerPtr modelMgr);
 
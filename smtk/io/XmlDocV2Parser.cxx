@@ -432,7 +432,7 @@ void XmlDocV2Parser::processMeshSelectionItem(
       xatt = valsNode.attribute("EntityUUID");
       if (xatt)
       {
-        std::set<int> vals;
+        attribute::MeshSelectionItem::ValueSet vals;
         for (xml_node val = valsNode.child("Val"); val; val = val.next_sibling("Val"))
         {
           vals.insert(val.text().as_int());
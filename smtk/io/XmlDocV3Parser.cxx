@@ -13,6 +13,7 @@
 #include "pugixml/src/pugixml.cpp"
 #include "smtk/attribute/DateTimeItem.h"
 #include "smtk/attribute/DateTimeItemDefinition.h"
+#include "smtk/attribute/MeshSelectionItem.h"
 #include "smtk/common/DateTimeZonePair.h"
 
 using namespace pugi;
@@ -199,3 +200,31 @@ void XmlDocV3Parser::processDateTimeItem(pugi::xml_node& node, attribute::DateTi
     }     // if (valsNode)
   }       // else
 }
+
+void XmlDocV3Parser::processMeshSelectionItem(
+  pugi::xml_node& node, attribute::MeshSelectionItemPtr item)
+{
+  // Version 2 reads the options and the single values; version 3 files
+  // may also hold runs of consecutive values as Range elements.
+  XmlDocV2Parser::processMeshSelectionItem(node, item);
+
+  xml_node selValsNode = node.child("SelectionValues");
+  for (xml_node valsNode = selValsNode.child("Values"); valsNode;
+       valsNode = valsNode.next_sibling("Values"))
+  {
+    xml_attribute xatt = valsNode.attribute("EntityUUID");
+    if (!xatt)
+    {
+      continue;
+    }
+    attribute::MeshSelectionItem::ValueSet vals;
+    for (xml_node range = valsNode.child("Range"); range; range = range.next_sibling("Range"))
+    {
+      vals.insert(range.attribute("First").as_int(), range.attribute("Last").as_int());
+    }
+    if (!vals.empty())
+    {
+      item->unionValues(smtk::common::UUID(xatt.value()), vals);
+    }
+  }
+}
@@ -34,6 +34,8 @@ public:
 
 protected:
   void processDateTimeItem(pugi::xml_node& node, smtk::attribute::DateTimeItemPtr item) override;
+  void processMeshSelectionItem(
+    pugi::xml_node& node, smtk::attribute::MeshSelectionItemPtr item) override;
   void processDateTimeDef(
     pugi::xml_node& node, smtk::attribute::DateTimeItemDefinitionPtr idef) override;
 
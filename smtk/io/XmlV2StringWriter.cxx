@@ -1265,7 +1265,7 @@ void XmlV2StringWriter::processMeshSelectionItem(
   {
     values = selValues.append_child("Values");
     values.append_attribute("EntityUUID").set_value(it->first.toString().c_str());
-    std::set<int>::const_iterator vit;
+    smtk::attribute::MeshSelectionItem::ValueSet::const_iterator vit;
     for (vit = it->second.begin(); vit != it->second.end(); ++vit)
     {
       val = values.append_child("Val");
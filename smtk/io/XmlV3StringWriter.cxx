@@ -15,6 +15,7 @@
 
 #include "smtk/attribute/DateTimeItem.h"
 #include "smtk/attribute/DateTimeItemDefinition.h"
+#include "smtk/attribute/MeshSelectionItem.h"
 #include "smtk/io/Logger.h"
 
 using namespace pugi;
@@ -111,6 +112,10 @@ void XmlV3StringWriter::processItemType(xml_node& node, smtk::attribute::ItemPtr
       this->processDateTimeItem(node, smtk::dynamic_pointer_cast<DateTimeItem>(item));
       break;
 
+    case Item::MESH_SELECTION:
+      this->processMeshSelectionItem(node, smtk::dynamic_pointer_cast<MeshSelectionItem>(item));
+      break;
+
     default:
       XmlV2StringWriter::processItemType(node, item);
       break;
@@ -160,5 +165,45 @@ void XmlV3StringWriter::processDateTimeItem(pugi::xml_node& node, attribute::Dat
   }
 }
 
+void XmlV3StringWriter::processMeshSelectionItem(
+  pugi::xml_node& node, attribute::MeshSelectionItemPtr item)
+{
+  size_t n = item->numberOfValues();
+  node.append_attribute("NumberOfValues").set_value(static_cast<unsigned int>(n));
+  xml_node val;
+  val = node.append_child("CtrlKey");
+  val.text().set(item->isCtrlKeyDown() ? 1 : 0);
+
+  val = node.append_child("MeshModifyMode");
+  val.text().set(MeshSelectionItem::modifyMode2String(item->modifyMode()).c_str());
+  if (!n)
+  {
+    return;
+  }
+
+  xml_node values, selValues = node.append_child("SelectionValues");
+  smtk::attribute::MeshSelectionItem::const_sel_map_it it;
+  for (it = item->begin(); it != item->end(); ++it)
+  {
+    values = selValues.append_child("Values");
+    values.append_attribute("EntityUUID").set_value(it->first.toString().c_str());
+    // Runs of consecutive values are written as a single Range element.
+    for (auto& range : it->second.ranges())
+    {
+      if (range.first == range.second)
+      {
+        val = values.append_child("Val");
+        val.text().set(range.first);
+      }
+      else
+      {
+        val = values.append_child("Range");
+        val.append_attribute("First").set_value(range.first);
+        val.append_attribute("Last").set_value(range.second);
+      }
+    }
+  }
+}
+
 } // namespace io
 } // namespace smtk
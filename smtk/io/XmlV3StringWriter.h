@@ -47,6 +47,7 @@ protected:
   // New methods
   void processDateTimeDef(pugi::xml_node& node, smtk::attribute::DateTimeItemDefinitionPtr idef);
   void processDateTimeItem(pugi::xml_node& node, smtk::attribute::DateTimeItemPtr item);
+  void processMeshSelectionItem(pugi::xml_node& node, smtk::attribute::MeshSelectionItemPtr item);
 
 private:
 };
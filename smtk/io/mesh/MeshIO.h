@@ -14,6 +14,8 @@
 #include "smtk/CoreExports.h" // For SMTKCORE_EXPORT macro.
 #include "smtk/PublicPointerDefs.h"
 
+#include "smtk/common/UUID.h"
+
 #include "smtk/io/mesh/Format.h"
 
 #include <memory>
@@ -72,6 +74,17 @@ public:
   }
   virtual bool read(const std::string&, smtk::mesh::CollectionPtr, Subset) const { return false; }
 
+  virtual smtk::mesh::CollectionPtr readAssociated(
+    const std::string&, smtk::mesh::ManagerPtr&, const smtk::common::UUIDArray&) const
+  {
+    return smtk::mesh::CollectionPtr();
+  }
+  virtual bool readAssociated(
+    const std::string&, smtk::mesh::CollectionPtr, const smtk::common::UUIDArray&) const
+  {
+    return false;
+  }
+
   virtual bool write(const std::string&, smtk::mesh::CollectionPtr, Subset) const { return false; }
   virtual bool write(smtk::mesh::CollectionPtr, Subset) const { return false; }
 
@@ -120,6 +120,18 @@ bool MeshIOMoab::read(
   return result;
 }
 
+smtk::mesh::CollectionPtr MeshIOMoab::readAssociated(const std::string& filePath,
+  smtk::mesh::ManagerPtr& manager, const smtk::common::UUIDArray& entities) const
+{
+  return smtk::mesh::moab::read_associated(filePath, manager, entities);
+}
+
+bool MeshIOMoab::readAssociated(const std::string& filePath,
+  smtk::mesh::CollectionPtr collection, const smtk::common::UUIDArray& entities) const
+{
+  return smtk::mesh::moab::import_associated(filePath, collection, entities);
+}
+
 bool MeshIOMoab::write(
   const std::string& filePath, smtk::mesh::CollectionPtr collection, Subset subset) const
 {
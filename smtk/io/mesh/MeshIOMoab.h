@@ -65,6 +65,19 @@ public:
   bool read(
     const std::string& filePath, smtk::mesh::CollectionPtr collection, Subset s) const override;
 
+  //Load only the meshes in a moab data file that are associated with the
+  //given model entities as a new collection into the given manager.
+  //Returns an invalid collection that is NOT part of the manager if none
+  //of the meshes in the file are associated with the model entities
+  smtk::mesh::CollectionPtr readAssociated(const std::string& filePath,
+    smtk::mesh::ManagerPtr& manager, const smtk::common::UUIDArray& entities) const override;
+
+  //Merge the meshes in a moab data file that are associated with the given
+  //model entities into an existing valid collection. Model entities that
+  //already have meshes in the collection are not read again.
+  bool readAssociated(const std::string& filePath, smtk::mesh::CollectionPtr collection,
+    const smtk::common::UUIDArray& entities) const override;
+
   //Writes the collection to file. Overwrites any existing content in the file
   bool write(
     const std::string& filePath, smtk::mesh::CollectionPtr collection, Subset s) const override;
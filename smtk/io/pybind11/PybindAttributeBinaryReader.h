@@ -0,0 +1,36 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef pybind_smtk_io_AttributeBinaryReader_h
+#define pybind_smtk_io_AttributeBinaryReader_h
+
+#include <pybind11/pybind11.h>
+
+#include "smtk/io/AttributeBinaryReader.h"
+
+#include "smtk/attribute/Collection.h"
+#include "smtk/io/Logger.h"
+
+namespace py = pybind11;
+
+PySharedPtrClass< smtk::io::AttributeBinaryReader > pybind11_init_smtk_io_AttributeBinaryReader(py::module &m)
+{
+  PySharedPtrClass< smtk::io::AttributeBinaryReader > instance(m, "AttributeBinaryReader");
+  instance
+    .def(py::init<>())
+    .def("read", &smtk::io::AttributeBinaryReader::read, py::arg("system"), py::arg("filename"), py::arg("logger"))
+    // Binary contents are exchanged as python bytes rather than str.
+    .def("readContents", [](smtk::io::AttributeBinaryReader& reader, ::smtk::attribute::CollectionPtr system, py::bytes contents, smtk::io::Logger& logger){ std::string data = contents; return reader.readContents(system, data, logger); }, py::arg("system"), py::arg("contents"), py::arg("logger"))
+    .def_static("canRead", &smtk::io::AttributeBinaryReader::canRead, py::arg("filename"))
+    ;
+  return instance;
+}
+
+#endif
@@ -0,0 +1,37 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef pybind_smtk_io_AttributeBinaryWriter_h
+#define pybind_smtk_io_AttributeBinaryWriter_h
+
+#include <pybind11/pybind11.h>
+
+#include "smtk/io/AttributeBinaryWriter.h"
+
+#include "smtk/attribute/Collection.h"
+#include "smtk/io/Logger.h"
+
+namespace py = pybind11;
+
+PySharedPtrClass< smtk::io::AttributeBinaryWriter > pybind11_init_smtk_io_AttributeBinaryWriter(py::module &m)
+{
+  PySharedPtrClass< smtk::io::AttributeBinaryWriter > instance(m, "AttributeBinaryWriter");
+  instance
+    .def(py::init<>())
+    .def_static("fileVersion", &smtk::io::AttributeBinaryWriter::fileVersion)
+    .def("includeViews", &smtk::io::AttributeBinaryWriter::includeViews, py::arg("val"))
+    .def("write", &smtk::io::AttributeBinaryWriter::write, py::arg("system"), py::arg("filename"), py::arg("logger"))
+    // Binary contents are exchanged as python bytes rather than str.
+    .def("writeContents", [](smtk::io::AttributeBinaryWriter& writer, const smtk::attribute::CollectionPtr system, smtk::io::Logger& logger){ std::string filecontents; writer.writeContents(system, filecontents, logger); return py::bytes(filecontents); }, py::arg("system"), py::arg("logger"))
+    ;
+  return instance;
+}
+
+#endif
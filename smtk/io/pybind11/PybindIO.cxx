@@ -26,6 +26,8 @@ using PySharedPtrClass = py::class_<T, std::shared_ptr<T>, Args...>;
 #include "PybindMeshIOMoab.h"
 #include "PybindMeshIOXMS.h"
 
+#include "PybindAttributeBinaryReader.h"
+#include "PybindAttributeBinaryWriter.h"
 #include "PybindAttributeReader.h"
 #include "PybindAttributeWriter.h"
 #include "PybindSaveJSON.h"
@@ -61,6 +63,8 @@ PYBIND11_MODULE(_smtkPybindIO, io)
   PySharedPtrClass< smtk::io::mesh::MeshIOXMS > smtk_io_mesh_MeshIOXMS = pybind11_init_smtk_io_mesh_MeshIOXMS(mesh, smtk_io_mesh_MeshIO);
 
   PySharedPtrClass< smtk::io::AttRefInfo > smtk_io_AttRefInfo = pybind11_init_smtk_io_AttRefInfo(io);
+  PySharedPtrClass< smtk::io::AttributeBinaryReader > smtk_io_AttributeBinaryReader = pybind11_init_smtk_io_AttributeBinaryReader(io);
+  PySharedPtrClass< smtk::io::AttributeBinaryWriter > smtk_io_AttributeBinaryWriter = pybind11_init_smtk_io_AttributeBinaryWriter(io);
   PySharedPtrClass< smtk::io::AttributeReader > smtk_io_AttributeReader = pybind11_init_smtk_io_AttributeReader(io);
   PySharedPtrClass< smtk::io::AttributeWriter > smtk_io_AttributeWriter = pybind11_init_smtk_io_AttributeWriter(io);
   pybind11_init_smtk_io_JSONFlags(io);
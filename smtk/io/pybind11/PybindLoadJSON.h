@@ -63,6 +63,7 @@ PySharedPtrClass< smtk::io::LoadJSON > pybind11_init_smtk_io_LoadJSON(py::module
     .def_static("ofLocalSession", &smtk::io::LoadJSON::ofLocalSession, py::arg("arg0"), py::arg("context"), py::arg("loadNativeModels") = false, py::arg("referencePath") = std::string())
     .def_static("ofOperator", &smtk::io::LoadJSON::ofOperator, py::arg("node"), py::arg("op"), py::arg("context"))
     .def_static("ofOperatorResult", &smtk::io::LoadJSON::ofOperatorResult, py::arg("node"), py::arg("resOut"), py::arg("op"))
+    .def_static("ofOperatorResultRecords", &smtk::io::LoadJSON::ofOperatorResultRecords, py::arg("node"), py::arg("context"))
     .def_static("ofDanglingEntities", &smtk::io::LoadJSON::ofDanglingEntities, py::arg("node"), py::arg("context"))
     .def_static("ofLog", (int (*)(char const *, ::smtk::io::Logger &)) &smtk::io::LoadJSON::ofLog, py::arg("jsonStr"), py::arg("log"))
     .def_static("ofLog", (int (*)(::cJSON *, ::smtk::io::Logger &)) &smtk::io::LoadJSON::ofLog, py::arg("logrecordarray"), py::arg("log"))
@@ -40,6 +40,12 @@ PySharedPtrClass< smtk::io::Logger > pybind11_init_smtk_io_Logger(py::module &m)
     .def("setFlushToFile", &smtk::io::Logger::setFlushToFile, py::arg("filename"), py::arg("includePast"))
     .def("setFlushToStdout", &smtk::io::Logger::setFlushToStdout, py::arg("includePast"))
     .def("setFlushToStderr", &smtk::io::Logger::setFlushToStderr, py::arg("includePast"))
+    .def("isLogging", &smtk::io::Logger::isLogging, py::arg("s"))
+    .def("setMinimumSeverity", &smtk::io::Logger::setMinimumSeverity, py::arg("s"))
+    .def("minimumSeverity", &smtk::io::Logger::minimumSeverity)
+    .def("setFlushBatchSize", &smtk::io::Logger::setFlushBatchSize, py::arg("numberOfRecords"))
+    .def("flushBatchSize", &smtk::io::Logger::flushBatchSize)
+    .def("flush", &smtk::io::Logger::flush)
     ;
   PySharedPtrClass< smtk::io::Logger::Record >(instance, "Record")
     .def(py::init<::smtk::io::Logger::Severity, ::std::string const &, ::std::string const &, unsigned int>())
@@ -14,6 +14,111 @@
 
 #include "smtk/io/Logger.h"
 #include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+int formatCount = 0;
+
+// Count how many times a message is formatted.
+std::string counted(const std::string& msg)
+{
+  ++formatCount;
+  return msg;
+}
+
+int testSeverityGating()
+{
+  smtk::io::Logger logger;
+  logger.setMinimumSeverity(smtk::io::Logger::WARNING);
+  formatCount = 0;
+  smtkDebugMacro(logger, counted("suppressed debug"));
+  smtkInfoMacro(logger, counted("suppressed info"));
+  smtkWarningMacro(logger, counted("kept warning"));
+  smtkErrorMacro(logger, counted("kept error"));
+  logger.addRecord(smtk::io::Logger::DEBUG, "suppressed record");
+  if (logger.numberOfRecords() != 2 || formatCount != 2 || !logger.hasErrors())
+  {
+    std::cerr << "Severity gating failed: " << logger.numberOfRecords() << " records, "
+              << formatCount << " messages formatted\n";
+    return 1;
+  }
+  return 0;
+}
+
+int testBatchedFlush()
+{
+  smtk::io::Logger logger;
+  std::ostringstream stream;
+  logger.setFlushToStream(&stream, false, false);
+  logger.setFlushBatchSize(3);
+  logger.addRecord(smtk::io::Logger::INFO, "one");
+  logger.addRecord(smtk::io::Logger::INFO, "two");
+  if (!stream.str().empty())
+  {
+    std::cerr << "Records flushed before the batch was complete\n";
+    return 1;
+  }
+  logger.addRecord(smtk::io::Logger::INFO, "three");
+  logger.addRecord(smtk::io::Logger::INFO, "four");
+  if (stream.str() != "INFO: one\nINFO: two\nINFO: three\n")
+  {
+    std::cerr << "Unexpected batch output \"" << stream.str() << "\"\n";
+    return 1;
+  }
+  logger.flush();
+  if (stream.str() != "INFO: one\nINFO: two\nINFO: three\nINFO: four\n")
+  {
+    std::cerr << "Unexpected flushed output \"" << stream.str() << "\"\n";
+    return 1;
+  }
+  logger.setFlushToStream(nullptr, false, false);
+  return 0;
+}
+
+int testConcurrentRecords()
+{
+  smtk::io::Logger logger;
+  std::ostringstream stream;
+  logger.setFlushToStream(&stream, false, false);
+  logger.setFlushBatchSize(64);
+  const int numberOfThreads = 8;
+  const int recordsPerThread = 1000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < numberOfThreads; ++t)
+  {
+    threads.push_back(std::thread([&logger, t]() {
+      for (int i = 0; i < recordsPerThread; ++i)
+      {
+        smtkInfoMacro(logger, "thread " << t << " record " << i);
+      }
+    }));
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  logger.flush();
+  std::size_t expected = numberOfThreads * recordsPerThread;
+  std::size_t lines = 0;
+  std::string text = stream.str();
+  for (auto ch : text)
+  {
+    lines += (ch == '\n' ? 1 : 0);
+  }
+  logger.setFlushToStream(nullptr, false, false);
+  if (logger.numberOfRecords() != expected || lines != expected)
+  {
+    std::cerr << "Concurrent logging lost records: " << logger.numberOfRecords() << " records, "
+              << lines << " lines; expected " << expected << "\n";
+    return 1;
+  }
+  return 0;
+}
+}
 
 int main()
 {
@@ -38,5 +143,10 @@ int main()
               << "\n\tMessage = " << r.message << "\tFile = " << r.fileName
               << "\n\tLine = " << r.lineNumber << std::endl;
   }
+
+  if (testSeverityGating() || testBatchedFlush() || testConcurrentRecords())
+  {
+    return -1;
+  }
   return 0;
 }
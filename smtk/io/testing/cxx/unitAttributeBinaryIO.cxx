@@ -0,0 +1,429 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <vector>
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Collection.h"
+#include "smtk/attribute/DateTimeItem.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/DirectoryItem.h"
+#include "smtk/attribute/DoubleItem.h"
+#include "smtk/attribute/FileItem.h"
+#include "smtk/attribute/GroupItem.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/MeshSelectionItem.h"
+#include "smtk/attribute/RefItem.h"
+#include "smtk/attribute/StringItem.h"
+
+#include "smtk/common/UUID.h"
+
+#include "smtk/io/AttributeBinaryReader.h"
+#include "smtk/io/AttributeBinaryWriter.h"
+#include "smtk/io/AttributeReader.h"
+#include "smtk/io/AttributeWriter.h"
+#include "smtk/io/Logger.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+//force to use filesystem version 3
+#define BOOST_FILESYSTEM_VERSION 3
+#include <boost/filesystem.hpp>
+
+namespace
+{
+std::string write_root = SMTK_SCRATCH_DIR;
+
+void cleanup(const std::string& file_path)
+{
+  //first verify the file exists
+  ::boost::filesystem::path path(file_path);
+  if (::boost::filesystem::is_regular_file(path))
+  {
+    //remove the file_path if it exists.
+    ::boost::filesystem::remove(path);
+  }
+}
+
+const char* testInput =
+  "<?xml version=\"1.0\" encoding=\"utf-8\" ?>"
+  "<SMTK_AttributeSystem Version=\"3\">"
+  "  <Categories>"
+  "    <Cat>Flow</Cat>"
+  "  </Categories>"
+  "  <Definitions>"
+  "    <AttDef Type=\"expression\">"
+  "      <ItemDefinitions>"
+  "        <String Name=\"formula\"/>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"material\">"
+  "      <ItemDefinitions>"
+  "        <Double Name=\"density\">"
+  "          <ExpressionType>expression</ExpressionType>"
+  "          <DefaultValue>1.0</DefaultValue>"
+  "        </Double>"
+  "        <Double Name=\"vector\" NumberOfRequiredValues=\"3\"/>"
+  "        <Int Name=\"counts\" Extensible=\"true\" NumberOfRequiredValues=\"1\"/>"
+  "        <String Name=\"solver\">"
+  "          <ChildrenDefinitions>"
+  "            <Double Name=\"tolerance\">"
+  "              <DefaultValue>1e-6</DefaultValue>"
+  "            </Double>"
+  "          </ChildrenDefinitions>"
+  "          <DiscreteInfo DefaultIndex=\"0\">"
+  "            <Structure>"
+  "              <Value Enum=\"Iterative\">cg</Value>"
+  "              <Items><Item>tolerance</Item></Items>"
+  "            </Structure>"
+  "            <Value Enum=\"Direct\">lu</Value>"
+  "          </DiscreteInfo>"
+  "        </String>"
+  "        <AttributeRef Name=\"next\">"
+  "          <AttDef>material</AttDef>"
+  "        </AttributeRef>"
+  "        <File Name=\"input\" ShouldExist=\"false\"/>"
+  "        <Directory Name=\"output\" ShouldExist=\"false\" Optional=\"true\"/>"
+  "        <Group Name=\"layers\" Extensible=\"true\" NumberOfRequiredGroups=\"1\">"
+  "          <ItemDefinitions>"
+  "            <Double Name=\"thickness\"/>"
+  "            <Void Name=\"active\" Optional=\"true\" IsEnabledByDefault=\"false\"/>"
+  "          </ItemDefinitions>"
+  "        </Group>"
+  "        <DateTime Name=\"start\"/>"
+  "        <MeshSelection Name=\"cells\"/>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "  </Definitions>"
+  "</SMTK_AttributeSystem>";
+
+smtk::attribute::CollectionPtr createCollection(std::size_t numberOfMaterials)
+{
+  smtk::attribute::CollectionPtr collection = smtk::attribute::Collection::create();
+  smtk::io::Logger logger;
+  smtk::io::AttributeReader reader;
+  if (reader.readContents(collection, testInput, logger))
+  {
+    std::cerr << logger.convertToString();
+    return smtk::attribute::CollectionPtr();
+  }
+
+  smtk::attribute::AttributePtr expr = collection->createAttribute("rho", "expression");
+  expr->findString("formula")->setValue("1000 + 0.5 * t");
+
+  smtk::attribute::AttributePtr previous;
+  for (std::size_t i = 0; i < numberOfMaterials; ++i)
+  {
+    std::ostringstream name;
+    name << "material-" << i;
+    smtk::attribute::AttributePtr att = collection->createAttribute(name.str(), "material");
+    if (i % 3 == 0)
+    {
+      att->findDouble("density")->setExpression(expr);
+    }
+    else
+    {
+      att->findDouble("density")->setValue(0.25 * static_cast<double>(i));
+    }
+    smtk::attribute::DoubleItemPtr vec = att->findDouble("vector");
+    vec->setValue(0, static_cast<double>(i));
+    vec->setValue(1, -1.0 / 3.0);
+    vec->unset(2);
+
+    smtk::attribute::IntItemPtr counts = att->findInt("counts");
+    counts->setNumberOfValues(1 + i % 4);
+    for (std::size_t j = 0; j < counts->numberOfValues(); ++j)
+    {
+      counts->setValue(j, static_cast<int>(i * j));
+    }
+
+    smtk::attribute::StringItemPtr solver = att->findString("solver");
+    solver->setDiscreteIndex(static_cast<int>(i % 2));
+    smtk::dynamic_pointer_cast<smtk::attribute::DoubleItem>(solver->childrenItems().begin()->second)
+      ->setValue(1e-3 / static_cast<double>(i + 1));
+
+    if (previous)
+    {
+      att->findAs<smtk::attribute::RefItem>("next")->setValue(previous);
+    }
+    smtk::attribute::FileItemPtr input = att->findFile("input");
+    input->setValue("/data/mesh-" + name.str() + ".exo");
+    input->addRecentValue("/data/old.exo");
+    att->findDirectory("output")->setIsEnabled(i % 2 == 0);
+    att->findDirectory("output")->setValue("/results");
+
+    smtk::attribute::GroupItemPtr layers = att->findGroup("layers");
+    layers->setNumberOfGroups(1 + i % 3);
+    for (std::size_t j = 0; j < layers->numberOfGroups(); ++j)
+    {
+      smtk::dynamic_pointer_cast<smtk::attribute::DoubleItem>(layers->item(j, 0))
+        ->setValue(0.1 * static_cast<double>(j + 1));
+      layers->item(j, 1)->setIsEnabled(j % 2 == 1);
+    }
+
+    smtk::common::DateTimeZonePair dtz;
+    dtz.deserialize("{\"datetime\": \"20170103T101500\", \"timezone-utc\": true}");
+    att->findDateTime("start")->setValue(dtz);
+
+    // Mesh selections mix long runs of cells with isolated ones. Runs are
+    // kept short since XML stores every selected value as its own element.
+    smtk::attribute::MeshSelectionItemPtr cells =
+      att->findAs<smtk::attribute::MeshSelectionItem>("cells");
+    smtk::attribute::MeshSelectionItem::ValueSet selected;
+    selected.insert(0, static_cast<int>(100 * (i % 8)));
+    selected.insert(static_cast<int>(100 * i + 7));
+    cells->setValues(smtk::common::UUID::random(), selected);
+    if (i % 2 == 0)
+    {
+      cells->setValues(smtk::common::UUID::random(), std::set<int>{ 1, 3, 4, 5, 9 });
+    }
+
+    if (i % 5 == 0)
+    {
+      att->setColor(0.1, 0.2, 0.3, 1.0);
+    }
+    if (i % 7 == 0)
+    {
+      att->item(0)->setAdvanceLevel(0, 1);
+    }
+    previous = att;
+  }
+  return collection;
+}
+
+// Collections keep the attributes of each definition in a std::set of pointers,
+// so writers list them in an unspecified order.  Sort the serialized
+// attributes so documents can be compared independent of that order.
+std::string canonicalXml(const std::string& xml)
+{
+  std::istringstream in(xml);
+  std::string line, result;
+  std::vector<std::string> atts;
+  bool inAttributes = false;
+  while (std::getline(in, line))
+  {
+    if (line.find("</Attributes>") != std::string::npos)
+    {
+      std::sort(atts.begin(), atts.end());
+      for (std::vector<std::string>::const_iterator it = atts.begin(); it != atts.end(); ++it)
+      {
+        result += *it;
+      }
+      atts.clear();
+      inAttributes = false;
+    }
+    else if (line.find("<Attributes>") != std::string::npos)
+    {
+      inAttributes = true;
+      result += line + "\n";
+      continue;
+    }
+    if (inAttributes)
+    {
+      if (line.compare(0, 9, "    <Att ") == 0)
+      {
+        atts.push_back(std::string());
+      }
+      if (!atts.empty())
+      {
+        atts.back() += line + "\n";
+        continue;
+      }
+    }
+    result += line + "\n";
+  }
+  return result;
+}
+
+std::string toXml(smtk::attribute::CollectionPtr collection)
+{
+  smtk::io::Logger logger;
+  smtk::io::AttributeWriter writer;
+  writer.setMaxFileVersion();
+  std::string result;
+  smtkTest(!writer.writeContents(collection, result, logger), "Could not write XML: "
+      << logger.convertToString());
+  return canonicalXml(result);
+}
+
+double elapsed(const std::chrono::high_resolution_clock::time_point& start)
+{
+  return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() -
+           start)
+    .count();
+}
+
+void testRoundTrip()
+{
+  smtk::attribute::CollectionPtr original = createCollection(25);
+  smtkTest(!!original, "Could not create test collection");
+  std::string expected = toXml(original);
+
+  smtk::io::Logger logger;
+  smtk::io::AttributeBinaryWriter writer;
+  std::string binary;
+  smtkTest(!writer.writeContents(original, binary, logger), "Could not write binary: "
+      << logger.convertToString());
+  smtkTest(smtk::io::AttributeBinaryReader::canReadContents(binary.c_str(), binary.size()),
+    "Binary output is missing its signature");
+
+  smtk::attribute::CollectionPtr copy = smtk::attribute::Collection::create();
+  smtk::io::AttributeBinaryReader reader;
+  smtkTest(!reader.readContents(copy, binary, logger), "Could not read binary: "
+      << logger.convertToString());
+  smtkTest(toXml(copy) == expected, "Binary round trip does not match the XML serialization");
+
+  std::string xml;
+  smtk::io::AttributeWriter xmlWriter;
+  xmlWriter.setMaxFileVersion();
+  smtkTest(!xmlWriter.writeContents(original, xml, logger), "Could not write XML");
+  smtk::attribute::CollectionPtr fromXml = smtk::attribute::Collection::create();
+  smtk::io::AttributeReader xmlReader;
+  smtkTest(!xmlReader.readContents(fromXml, xml, logger), "Could not read XML: "
+      << logger.convertToString());
+  smtkTest(toXml(fromXml) == expected, "XML round trip does not match the XML serialization");
+
+  // AttributeReader should recognize binary files on its own.
+  std::string fileName = write_root + "/" + smtk::common::UUID::random().toString() + ".sbi";
+  smtkTest(!writer.write(original, fileName, logger), "Could not write " << fileName);
+  smtk::attribute::CollectionPtr fromFile = smtk::attribute::Collection::create();
+  smtkTest(!xmlReader.read(fromFile, fileName, logger), "AttributeReader could not read "
+      << fileName << ": " << logger.convertToString());
+  smtkTest(toXml(fromFile) == expected, "Binary file does not match the XML serialization");
+  cleanup(fileName);
+
+  // Truncated data must be reported rather than crash.
+  smtk::attribute::CollectionPtr truncated = smtk::attribute::Collection::create();
+  smtkTest(reader.readContents(truncated, binary.c_str(), binary.size() / 2, logger),
+    "Truncated binary data was not reported");
+}
+
+// A selection spanning several entities must come back entity by entity.
+void testMeshSelectionRoundTrip()
+{
+  smtk::attribute::CollectionPtr original = createCollection(1);
+  smtkTest(!!original, "Could not create test collection");
+  smtk::attribute::MeshSelectionItemPtr cells =
+    original->findAttribute("material-0")->findAs<smtk::attribute::MeshSelectionItem>("cells");
+  cells->reset();
+  cells->setModifyMode(smtk::attribute::ACCEPT);
+  cells->setCtrlKeyDown(true);
+
+  std::vector<smtk::common::UUID> entities;
+  std::vector<smtk::attribute::MeshSelectionItem::ValueSet> selections(3);
+  selections[0].insert(0, 499);
+  selections[1].insert(7);
+  selections[1].insert(20, 29);
+  selections[1].insert(100);
+  selections[2].insert(5, 6);
+  for (std::size_t i = 0; i < selections.size(); ++i)
+  {
+    entities.push_back(smtk::common::UUID::random());
+    cells->setValues(entities.back(), selections[i]);
+  }
+
+  smtk::io::Logger logger;
+  std::string binary;
+  smtk::io::AttributeBinaryWriter writer;
+  smtkTest(!writer.writeContents(original, binary, logger), "Could not write binary: "
+      << logger.convertToString());
+  smtk::attribute::CollectionPtr copy = smtk::attribute::Collection::create();
+  smtk::io::AttributeBinaryReader reader;
+  smtkTest(!reader.readContents(copy, binary, logger), "Could not read binary: "
+      << logger.convertToString());
+
+  smtk::attribute::MeshSelectionItemPtr copied =
+    copy->findAttribute("material-0")->findAs<smtk::attribute::MeshSelectionItem>("cells");
+  smtkTest(!!copied, "Mesh selection item was not read");
+  smtkTest(copied->modifyMode() == smtk::attribute::ACCEPT, "Modify mode was not preserved");
+  smtkTest(copied->isCtrlKeyDown(), "Control key state was not preserved");
+  smtkTest(static_cast<std::size_t>(std::distance(copied->begin(), copied->end())) ==
+      entities.size(),
+    "Expected " << entities.size() << " selected entities");
+  for (std::size_t i = 0; i < entities.size(); ++i)
+  {
+    const smtk::attribute::MeshSelectionItem::ValueSet& values = copied->values(entities[i]);
+    smtkTest(values.ranges() == selections[i].ranges(), "Selection of entity " << i
+        << " was not preserved");
+  }
+  smtkTest(copied->numberOfValues() == 500 + 12 + 2, "Wrong number of selected values");
+
+  // XML writes runs of consecutive values as Range elements.
+  std::string xml;
+  smtk::io::AttributeWriter xmlWriter;
+  xmlWriter.setMaxFileVersion();
+  smtkTest(!xmlWriter.writeContents(original, xml, logger), "Could not write XML: "
+      << logger.convertToString());
+  smtkTest(xml.find("<Range") != std::string::npos, "XML mesh selections contain no ranges");
+  smtk::attribute::CollectionPtr fromXml = smtk::attribute::Collection::create();
+  smtk::io::AttributeReader xmlReader;
+  smtkTest(!xmlReader.readContents(fromXml, xml, logger), "Could not read XML: "
+      << logger.convertToString());
+  copied =
+    fromXml->findAttribute("material-0")->findAs<smtk::attribute::MeshSelectionItem>("cells");
+  smtkTest(!!copied, "Mesh selection item was not read from XML");
+  for (std::size_t i = 0; i < entities.size(); ++i)
+  {
+    smtkTest(copied->values(entities[i]).ranges() == selections[i].ranges(),
+      "Selection of entity " << i << " was not preserved by XML");
+  }
+}
+
+void reportTimings(std::size_t numberOfMaterials)
+{
+  smtk::attribute::CollectionPtr original = createCollection(numberOfMaterials);
+  smtk::io::Logger logger;
+
+  std::string xml;
+  std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+  smtk::io::AttributeWriter xmlWriter;
+  xmlWriter.setMaxFileVersion();
+  smtkTest(!xmlWriter.writeContents(original, xml, logger), "Could not write XML");
+  double xmlSave = elapsed(start);
+
+  start = std::chrono::high_resolution_clock::now();
+  smtk::attribute::CollectionPtr fromXml = smtk::attribute::Collection::create();
+  smtk::io::AttributeReader xmlReader;
+  smtkTest(!xmlReader.readContents(fromXml, xml, logger), "Could not read XML");
+  double xmlLoad = elapsed(start);
+
+  std::string binary;
+  start = std::chrono::high_resolution_clock::now();
+  smtk::io::AttributeBinaryWriter writer;
+  smtkTest(!writer.writeContents(original, binary, logger), "Could not write binary");
+  double binarySave = elapsed(start);
+
+  start = std::chrono::high_resolution_clock::now();
+  smtk::attribute::CollectionPtr fromBinary = smtk::attribute::Collection::create();
+  smtk::io::AttributeBinaryReader binaryReader;
+  smtkTest(!binaryReader.readContents(fromBinary, binary, logger), "Could not read binary");
+  double binaryLoad = elapsed(start);
+
+  std::cout << numberOfMaterials << " attributes\n"
+            << "  XML:    " << xml.size() << " bytes, save " << xmlSave << " ms, load " << xmlLoad
+            << " ms\n"
+            << "  binary: " << binary.size() << " bytes, save " << binarySave << " ms, load "
+            << binaryLoad << " ms\n";
+}
+}
+
+int main(int argc, char* argv[])
+{
+  testRoundTrip();
+  testMeshSelectionRoundTrip();
+  reportTimings(argc > 1 ? static_cast<std::size_t>(atoi(argv[1])) : 2000);
+  return 0;
+}
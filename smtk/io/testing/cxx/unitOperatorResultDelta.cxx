@@ -0,0 +1,379 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/io/BinaryTessellations.h"
+#include "smtk/io/LoadJSON.h"
+#include "smtk/io/SaveJSON.h"
+#include "smtk/io/SaveJSON.txx"
+
+#include "smtk/attribute/Collection.h"
+#include "smtk/attribute/DoubleItem.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/StringItem.h"
+
+#include "smtk/model/Face.h"
+#include "smtk/model/Manager.h"
+#include "smtk/model/Model.h"
+#include "smtk/model/Operator.h"
+#include "smtk/model/SessionRef.h"
+#include "smtk/model/Tessellation.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include "cJSON.h"
+
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <string>
+
+#include <stdlib.h>
+#include <string.h>
+
+using namespace smtk::io;
+using namespace smtk::model;
+
+namespace
+{
+
+const int numFaces = 200;
+const int gridSize = 20;
+
+// A gridSize x gridSize patch of triangles on a wavy surface offset by \a dz.
+void patch(Tessellation& tess, int index, double dz)
+{
+  tess.reset();
+  for (int jj = 0; jj <= gridSize; ++jj)
+  {
+    for (int ii = 0; ii <= gridSize; ++ii)
+    {
+      double x = index + static_cast<double>(ii) / gridSize;
+      double y = static_cast<double>(jj) / gridSize;
+      tess.addCoords(x, y, dz + 0.1 * std::sin(3. * x) * std::cos(3. * y));
+    }
+  }
+  for (int jj = 0; jj < gridSize; ++jj)
+  {
+    for (int ii = 0; ii < gridSize; ++ii)
+    {
+      int p0 = jj * (gridSize + 1) + ii;
+      tess.addTriangle(p0, p0 + 1, p0 + gridSize + 2);
+      tess.addTriangle(p0, p0 + gridSize + 2, p0 + gridSize + 1);
+    }
+  }
+}
+
+std::size_t printedSize(cJSON* node)
+{
+  char* text = cJSON_PrintUnformatted(node);
+  std::size_t len = strlen(text);
+  free(text);
+  return len;
+}
+
+void testBase64()
+{
+  std::string bytes;
+  for (int ii = 0; ii < 256; ++ii)
+  {
+    bytes.push_back(static_cast<char>(ii));
+  }
+  for (std::size_t len = 0; len < 5; ++len)
+  {
+    std::string in = bytes.substr(0, 253 + len);
+    std::string out;
+    smtkTest(BinaryTessellations::fromBase64(BinaryTessellations::toBase64(in), out) && in == out,
+      "Base64 round trip failed for " << in.size() << " bytes.");
+  }
+  std::string out;
+  smtkTest(BinaryTessellations::toBase64("Man") == "TWFu", "Unexpected base64 encoding.");
+  smtkTest(!BinaryTessellations::fromBase64("T*Fu", out), "Accepted invalid base64 text.");
+}
+
+// Return a manager holding a complete copy of \a server's model, as a client would.
+ManagerPtr clientCopy(ManagerPtr server)
+{
+  ManagerPtr client = Manager::create();
+  cJSON* initial = cJSON_CreateObject();
+  SaveJSON::fromModelManager(initial, server,
+    static_cast<JSONFlags>(JSON_ENTITIES | JSON_TESSELLATIONS | JSON_PROPERTIES));
+  char* initialText = cJSON_PrintUnformatted(initial);
+  cJSON_Delete(initial);
+  smtkTest(LoadJSON::intoModelManager(initialText, client) != 0, "Could not load initial model.");
+  free(initialText);
+  return client;
+}
+
+/// Stands in for RemusRPCWorker's handling of "operator-apply" requests so
+/// that delta results can be exchanged without a Remus server.
+class WorkerStandIn
+{
+public:
+  WorkerStandIn(ManagerPtr mgr)
+    : m_manager(mgr)
+  {
+  }
+
+  std::string process(const std::string& request)
+  {
+    cJSON* req = cJSON_Parse(request.c_str());
+    cJSON* param = cJSON_GetObjectItem(req, "params");
+    cJSON* response = cJSON_CreateObject();
+    OperatorPtr op;
+    if (param && LoadJSON::ofOperator(param, op, this->m_manager) && op)
+    {
+      OperatorResult ores = op->operate();
+      cJSON* oresult = cJSON_CreateObject();
+      cJSON* client = cJSON_GetObjectItem(param, "client-id");
+      bool haveClient = client && client->type == cJSON_String && client->valuestring &&
+        client->valuestring[0];
+      SaveJSON::forOperatorResultDelta(
+        ores, oresult, haveClient ? &this->m_sentTessellations[client->valuestring] : NULL);
+      cJSON_AddItemToObject(response, "result", oresult);
+    }
+    cJSON_Delete(req);
+    char* text = cJSON_PrintUnformatted(response);
+    cJSON_Delete(response);
+    std::string result(text);
+    free(text);
+    return result;
+  }
+
+protected:
+  ManagerPtr m_manager;
+  std::map<std::string, std::map<smtk::common::UUID, int> > m_sentTessellations;
+};
+
+/// Ask \a worker to set a property on \a faces on behalf of \a client, then apply the result.
+/// Returns whether the result carried any tessellations.
+bool setPropertyFor(WorkerStandIn& worker, SessionRef sess, const Faces& faces, double value,
+  ManagerPtr client, const std::string& clientId)
+{
+  OperatorPtr op = sess.session()->op("set property");
+  op->specification()->findString("name")->setValue("pressure");
+  op->specification()->findDouble("float value")->setNumberOfValues(1);
+  op->specification()->findDouble("float value")->setValue(value);
+  for (auto face : faces)
+  {
+    op->associateEntity(face);
+  }
+
+  cJSON* par;
+  cJSON* req = SaveJSON::createRPCRequest("operator-apply", par, "1", cJSON_Object);
+  SaveJSON::forOperator(op->specification(), par);
+  // A real client holds its own specification; let the worker create its copy.
+  sess.session()->operatorCollection()->removeAttribute(op->specification());
+  cJSON_AddItemToObject(par, "sessionId", cJSON_CreateString(sess.entity().toString().c_str()));
+  cJSON_AddItemToObject(par, "result-format", cJSON_CreateString("delta"));
+  cJSON_AddItemToObject(par, "client-id", cJSON_CreateString(clientId.c_str()));
+  char* reqText = cJSON_PrintUnformatted(req);
+  cJSON_Delete(req);
+  std::string respText = worker.process(reqText);
+  free(reqText);
+
+  cJSON* resp = cJSON_Parse(respText.c_str());
+  cJSON* res = cJSON_GetObjectItem(resp, "result");
+  smtkTest(!!res, "Worker did not apply the operator.");
+  bool haveTessellations = cJSON_GetObjectItem(res, "tessellations") != NULL;
+  smtkTest(LoadJSON::ofOperatorResultRecords(res, client) == 1, "Could not apply result.");
+  cJSON_Delete(resp);
+  return haveTessellations;
+}
+
+void testWorkerStandIn()
+{
+  ManagerPtr server = Manager::create();
+  SessionRef sess = server->createSession("native");
+  Model model = server->addModel(3, 3, "clients");
+  model.setSession(sess);
+  Faces faces;
+  for (int ii = 0; ii < 2; ++ii)
+  {
+    Face face = server->addFace();
+    Tessellation tess;
+    patch(tess, ii, 0.);
+    face.setTessellation(&tess);
+    model.addCell(face);
+    faces.push_back(face);
+  }
+  ManagerPtr first = clientCopy(server);
+  ManagerPtr second = clientCopy(server);
+  WorkerStandIn worker(server);
+
+  Tessellation moved;
+  patch(moved, 0, 1.);
+  faces[0].setTessellation(&moved);
+  smtkTest(setPropertyFor(worker, sess, faces, 1., first, "first"),
+    "Expected the first client to be sent tessellations.");
+  smtkTest(!setPropertyFor(worker, sess, faces, 2., first, "first"),
+    "Expected no tessellations to be resent to the first client.");
+
+  // The worker must not assume the second client holds what it sent the first.
+  smtkTest(setPropertyFor(worker, sess, faces, 3., second, "second"),
+    "Expected the second client to be sent tessellations.");
+  for (auto client : { first, second })
+  {
+    EntityRef cface(client, faces[0].entity());
+    smtkTest(cface.hasTessellation() &&
+        cface.hasTessellation()->coords() == faces[0].hasTessellation()->coords(),
+      "Client does not hold the retessellated face.");
+  }
+  smtkTest(EntityRef(second, faces[1].entity()).floatProperty("pressure")[0] == 3.,
+    "Second client did not receive the property.");
+}
+
+void testRejectedBlobs()
+{
+  ManagerPtr server = Manager::create();
+  ManagerPtr client = Manager::create();
+  Face face = server->addFace();
+  Tessellation tess;
+  tess.addCoords(0., 0., 0.);
+  tess.addCoords(1., 0., 0.);
+  tess.addCoords(0., 1., 0.);
+  tess.addTriangle(0, 1, 3);
+  face.setTessellation(&tess);
+
+  std::string blob;
+  smtk::common::UUIDs ids;
+  ids.insert(face.entity());
+  smtkTest(BinaryTessellations::encode(ids, server, blob) == 1, "Expected one tessellation.");
+  smtkTest(BinaryTessellations::validate(blob) == -1, "Accepted out-of-range connectivity.");
+  smtkTest(BinaryTessellations::decode(blob, client) == -1, "Decoded out-of-range connectivity.");
+  smtkTest(client->tessellations().empty(), "A rejected blob modified the manager.");
+}
+}
+
+int main()
+{
+  testBase64();
+  testWorkerStandIn();
+  testRejectedBlobs();
+
+  // The server holds a model with many tessellated faces.
+  ManagerPtr server = Manager::create();
+  SessionRef sess = server->createSession("native");
+  Model model = server->addModel(3, 3, "delta");
+  model.setSession(sess);
+  Faces faces;
+  std::map<smtk::common::UUID, int> sent;
+  for (int ii = 0; ii < numFaces; ++ii)
+  {
+    Face face = server->addFace();
+    Tessellation tess;
+    patch(tess, ii, 0.);
+    face.setTessellation(&tess);
+    model.addCell(face);
+    faces.push_back(face);
+    sent[face.entity()] = face.tessellationGeneration();
+  }
+
+  // The client starts with a complete copy of the model.
+  ManagerPtr client = clientCopy(server);
+  smtkTest(Model(client, model.entity()).cells().size() == numFaces, "Client is missing faces.");
+
+  // The server retessellates one face and sets a property on two.
+  Tessellation moved;
+  patch(moved, 0, 1.);
+  faces[0].setTessellation(&moved);
+  OperatorPtr op = sess.session()->op("set property");
+  smtkTest(!!op, "No \"set property\" operator.");
+  op->specification()->findString("name")->setValue("pressure");
+  op->specification()->findDouble("float value")->setNumberOfValues(1);
+  op->specification()->findDouble("float value")->setValue(3.5);
+  op->associateEntity(faces[0]);
+  op->associateEntity(faces[1]);
+  OperatorResult result = op->operate();
+  smtkTest(result->findInt("outcome")->value() == smtk::operation::Operator::OPERATION_SUCCEEDED,
+    "Set property failed.");
+
+  // Without deltas, the client must also fetch the changed tessellation as JSON.
+  cJSON* full = cJSON_CreateObject();
+  SaveJSON::forOperatorResult(result, full);
+  EntityRefs changed;
+  changed.insert(faces[0]);
+  cJSON* tessJSON = cJSON_CreateObject();
+  SaveJSON::forEntities(tessJSON, changed, ITERATE_BARE, JSON_TESSELLATIONS);
+  cJSON* delta = cJSON_CreateObject();
+  SaveJSON::forOperatorResultDelta(result, delta, &sent);
+  std::size_t fullSize = printedSize(full) + printedSize(tessJSON);
+  std::size_t deltaSize = printedSize(delta);
+  std::cout << "Full result plus tessellation " << fullSize << " bytes, delta result "
+            << deltaSize << " bytes\n";
+  smtkTest(deltaSize * 2 < fullSize, "Expected the delta result to be much smaller.");
+  smtkTest(!!cJSON_GetObjectItem(delta, "tessellations"), "Expected a changed tessellation.");
+  smtkTest(sent[faces[0].entity()] == faces[0].tessellationGeneration(),
+    "Expected the sent generation to be recorded.");
+
+  // A malformed blob is rejected before any record is applied.
+  cJSON* corrupt = cJSON_Duplicate(delta, 1);
+  cJSON_ReplaceItemInObject(corrupt, "tessellations", cJSON_CreateString("U01US1RFU1M="));
+  smtkTest(LoadJSON::ofOperatorResultRecords(corrupt, client) == 0, "Accepted a malformed blob.");
+  smtkTest(!EntityRef(client, faces[0].entity()).hasFloatProperty("pressure"),
+    "Records were applied despite a malformed blob.");
+  cJSON_Delete(corrupt);
+
+  // The client applies the delta.
+  smtkTest(LoadJSON::ofOperatorResultRecords(delta, client) == 1, "Could not apply delta.");
+  cJSON_Delete(full);
+  cJSON_Delete(tessJSON);
+  cJSON_Delete(delta);
+
+  Model clientModel(client, model.entity());
+  smtkTest(clientModel.cells().size() == numFaces, "Delta dropped the model's references.");
+  for (int ii = 0; ii < 2; ++ii)
+  {
+    EntityRef cface(client, faces[ii].entity());
+    smtkTest(cface.relations().size() == faces[ii].relations().size(),
+      "Relations of face " << ii << " do not match.");
+    smtkTest(cface.hasFloatProperty("pressure") && cface.floatProperty("pressure")[0] == 3.5,
+      "Property was not transferred to face " << ii << ".");
+    // Face 1 still has the tessellation from the initial (JSON, 6-digit) transfer
+    // while the binary transfer of face 0 is exact.
+    const Tessellation* ctess = cface.hasTessellation();
+    const Tessellation* stess = faces[ii].hasTessellation();
+    smtkTest(ctess && ctess->conn() == stess->conn() &&
+        ctess->coords().size() == stess->coords().size(),
+      "Tessellation of face " << ii << " does not match.");
+    double tol = ii == 0 ? 0. : 1e-6;
+    for (std::size_t cc = 0; cc < ctess->coords().size(); ++cc)
+    {
+      smtkTest(std::fabs(ctess->coords()[cc] - stess->coords()[cc]) <= tol,
+        "Coordinates of face " << ii << " do not match.");
+    }
+    smtkTest(cface.tessellationGeneration() == faces[ii].tessellationGeneration(),
+      "Tessellation generation of face " << ii << " does not match.");
+  }
+
+  // Unchanged tessellations are not sent again.
+  cJSON* again = cJSON_CreateObject();
+  SaveJSON::forOperatorResultDelta(result, again, &sent);
+  smtkTest(!cJSON_GetObjectItem(again, "tessellations"), "Expected no tessellations to be resent.");
+  cJSON_Delete(again);
+
+  // Truncated blobs are rejected without modifying the manager.
+  std::string blob;
+  smtk::common::UUIDs ids;
+  ids.insert(faces[2].entity());
+  smtkTest(BinaryTessellations::encode(ids, server, blob) == 1, "Expected one tessellation.");
+  Tessellation& ctess(client->tessellations().find(faces[2].entity())->second);
+  ctess.coords()[0] = -1.;
+  for (std::size_t len = 0; len < blob.size(); len += 97)
+  {
+    smtkTest(BinaryTessellations::decode(blob.substr(0, len), client) == -1,
+      "Accepted a blob truncated to " << len << " bytes.");
+  }
+  smtkTest(ctess.coords()[0] == -1., "A truncated blob modified the manager.");
+  smtkTest(BinaryTessellations::decode(blob, client) == 1, "Could not decode the blob.");
+  smtkTest(EntityRef(client, faces[2].entity()).hasTessellation()->coords() ==
+      faces[2].hasTessellation()->coords(),
+    "Decoded tessellation does not match.");
+
+  return 0;
+}
@@ -103,6 +103,22 @@ std::size_t CellField::dimension() const
     iface->hasCellField(this->m_meshset.range(), dsTag) ? iface->getCellFieldDimension(dsTag) : 0);
 }
 
+smtk::mesh::FieldType CellField::type() const
+{
+  const smtk::mesh::InterfacePtr& iface = this->m_meshset.collection()->interface();
+  if (!iface)
+  {
+    return smtk::mesh::FieldType::MaxFieldType;
+  }
+
+  smtk::mesh::CellFieldTag dsTag(this->m_name);
+  if (!iface->hasCellField(this->m_meshset.range(), dsTag))
+  {
+    return smtk::mesh::FieldType::MaxFieldType;
+  }
+  return iface->getCellFieldType(dsTag);
+}
+
 smtk::mesh::CellSet CellField::cells() const
 {
   return this->m_meshset.cells();
@@ -138,37 +154,38 @@ bool CellField::set(const std::vector<double>& values)
 
 bool CellField::get(const smtk::mesh::HandleRange& cellIds, double* values) const
 {
-  const smtk::mesh::InterfacePtr& iface = this->m_meshset.collection()->interface();
-  if (!iface)
-  {
-    return false;
-  }
-
   if (!this->m_meshset.cells().range().contains(cellIds))
   {
     return false;
   }
 
-  return iface->getField(cellIds, smtk::mesh::CellFieldTag(this->m_name), values);
+  return this->getValues(cellIds, smtk::mesh::FieldType::Double, values);
 }
 
 bool CellField::set(const smtk::mesh::HandleRange& cellIds, const double* const values)
 {
-  const smtk::mesh::InterfacePtr& iface = this->m_meshset.collection()->interface();
-  if (!iface)
-  {
-    return false;
-  }
-
   if (!this->m_meshset.cells().range().contains(cellIds))
   {
     return false;
   }
 
-  return iface->setField(cellIds, smtk::mesh::CellFieldTag(this->m_name), values);
+  return this->setValues(cellIds, smtk::mesh::FieldType::Double, values);
 }
 
 bool CellField::get(double* values) const
+{
+  return this->getValues(
+    this->m_meshset.cells().range(), smtk::mesh::FieldType::Double, values);
+}
+
+bool CellField::set(const double* const values)
+{
+  return this->setValues(
+    this->m_meshset.cells().range(), smtk::mesh::FieldType::Double, values);
+}
+
+bool CellField::getValues(
+  const smtk::mesh::HandleRange& cellIds, smtk::mesh::FieldType type, void* values) const
 {
   const smtk::mesh::InterfacePtr& iface = this->m_meshset.collection()->interface();
   if (!iface)
@@ -176,11 +193,22 @@ bool CellField::get(double* values) const
     return false;
   }
 
-  return iface->getCellField(
-    this->m_meshset.range(), smtk::mesh::CellFieldTag(this->m_name), values);
+  smtk::mesh::CellFieldTag dsTag(this->m_name);
+  smtk::mesh::FieldType storedType = iface->getCellFieldType(dsTag);
+  if (storedType == type)
+  {
+    return iface->getField(cellIds, dsTag, values);
+  }
+
+  //fetch the values as stored, then convert them to the requested type
+  std::size_t numberOfValues = cellIds.size() * iface->getCellFieldDimension(dsTag);
+  std::vector<unsigned char> stored(numberOfValues * smtk::mesh::fieldTypeSize(storedType));
+  return !stored.empty() && iface->getField(cellIds, dsTag, stored.data()) &&
+    smtk::mesh::convertFieldValues(storedType, stored.data(), type, values, numberOfValues);
 }
 
-bool CellField::set(const double* const values)
+bool CellField::setValues(
+  const smtk::mesh::HandleRange& cellIds, smtk::mesh::FieldType type, const void* const values)
 {
   const smtk::mesh::InterfacePtr& iface = this->m_meshset.collection()->interface();
   if (!iface)
@@ -188,8 +216,19 @@ bool CellField::set(const double* const values)
     return false;
   }
 
-  return iface->setCellField(
-    this->m_meshset.range(), smtk::mesh::CellFieldTag(this->m_name), values);
+  smtk::mesh::CellFieldTag dsTag(this->m_name);
+  smtk::mesh::FieldType storedType = iface->getCellFieldType(dsTag);
+  if (storedType == type)
+  {
+    return iface->setField(cellIds, dsTag, values);
+  }
+
+  //convert the values to the type in which they are stored
+  std::size_t numberOfValues = cellIds.size() * iface->getCellFieldDimension(dsTag);
+  std::vector<unsigned char> stored(numberOfValues * smtk::mesh::fieldTypeSize(storedType));
+  return !stored.empty() &&
+    smtk::mesh::convertFieldValues(type, values, storedType, stored.data(), numberOfValues) &&
+    iface->setField(cellIds, dsTag, stored.data());
 }
 }
 }
@@ -0,0 +1,109 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/mesh/core/FieldTypes.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace smtk
+{
+namespace mesh
+{
+
+namespace
+{
+template <typename From, typename To>
+void convertValues(const void* from, void* to, std::size_t numberOfValues)
+{
+  const From* in = static_cast<const From*>(from);
+  To* out = static_cast<To*>(to);
+  std::transform(in, in + numberOfValues, out, [](From value) { return static_cast<To>(value); });
+}
+
+template <typename From>
+bool convertValues(const void* from, FieldType toType, void* to, std::size_t numberOfValues)
+{
+  switch (toType)
+  {
+    case FieldType::Double:
+      convertValues<From, double>(from, to, numberOfValues);
+      return true;
+    case FieldType::Float:
+      convertValues<From, float>(from, to, numberOfValues);
+      return true;
+    case FieldType::Integer:
+      convertValues<From, int>(from, to, numberOfValues);
+      return true;
+    case FieldType::Integer64:
+      convertValues<From, std::int64_t>(from, to, numberOfValues);
+      return true;
+    default:
+      return false;
+  }
+}
+}
+
+/**\brief Return the number of bytes used to store one value of this type (or 0).
+  *
+  */
+std::size_t fieldTypeSize(FieldType type)
+{
+  static std::size_t sizesByType[static_cast<int>(FieldType::MaxFieldType)] = { sizeof(double),
+    sizeof(float), sizeof(int), sizeof(std::int64_t) };
+  const int index = static_cast<int>(type);
+  return index >= 0 && type < FieldType::MaxFieldType ? sizesByType[index] : 0;
+}
+
+/**\brief Return the name of the field type.
+  *
+  */
+std::string fieldTypeName(FieldType type)
+{
+  static const char* fieldTypeNames[static_cast<int>(FieldType::MaxFieldType) + 1] = {
+    "double", "float", "integer", "integer64",
+    "invalid" // MaxFieldType
+  };
+  const int index = static_cast<int>(type);
+  return index >= 0 && type < FieldType::MaxFieldType
+    ? fieldTypeNames[index]
+    : fieldTypeNames[static_cast<int>(FieldType::MaxFieldType)];
+}
+
+/**\brief Convert field values from one type to another.
+  *
+  * Values are converted as by static_cast, so floating-point values are
+  * truncated when converted to integers.
+  */
+bool convertFieldValues(FieldType fromType, const void* from, FieldType toType, void* to,
+  std::size_t numberOfValues)
+{
+  if (fromType == toType && fromType < FieldType::MaxFieldType)
+  {
+    std::memcpy(to, from, numberOfValues * fieldTypeSize(fromType));
+    return true;
+  }
+
+  switch (fromType)
+  {
+    case FieldType::Double:
+      return convertValues<double>(from, toType, to, numberOfValues);
+    case FieldType::Float:
+      return convertValues<float>(from, toType, to, numberOfValues);
+    case FieldType::Integer:
+      return convertValues<int>(from, toType, to, numberOfValues);
+    case FieldType::Integer64:
+      return convertValues<std::int64_t>(from, toType, to, numberOfValues);
+    default:
+      return false;
+  }
+}
+
+} // namespace mesh
+} // namespace smtk
@@ -0,0 +1,75 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef __smtk_mesh_core_FieldTypes_h
+#define __smtk_mesh_core_FieldTypes_h
+
+#include "smtk/CoreExports.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace smtk
+{
+namespace mesh
+{
+
+/**\brief The types in which cell and point field values may be stored.
+  *
+  * When changing this enum, be sure to update fieldTypeSize()
+  * and fieldTypeName()!
+  */
+enum class FieldType : int
+{
+  Double = 0,
+  Float = 1,
+  Integer = 2,
+  Integer64 = 3,
+  MaxFieldType = 4
+};
+
+SMTKCORE_EXPORT std::size_t fieldTypeSize(FieldType type);
+SMTKCORE_EXPORT std::string fieldTypeName(FieldType type);
+
+//Convert <numberOfValues> field values of type <fromType> into values of type
+//<toType>. Returns false if either type is invalid.
+SMTKCORE_EXPORT bool convertFieldValues(FieldType fromType, const void* from, FieldType toType,
+  void* to, std::size_t numberOfValues);
+
+//map a value type to the FieldType that stores it, for templating code on the
+//type of a field's values
+template <typename T>
+struct FieldTypeFor;
+
+template <>
+struct FieldTypeFor<double>
+{
+  static const FieldType type = FieldType::Double;
+};
+template <>
+struct FieldTypeFor<float>
+{
+  static const FieldType type = FieldType::Float;
+};
+template <>
+struct FieldTypeFor<int>
+{
+  static const FieldType type = FieldType::Integer;
+};
+template <>
+struct FieldTypeFor<std::int64_t>
+{
+  static const FieldType type = FieldType::Integer64;
+};
+}
+}
+
+#endif //__smtk_mesh_core_FieldTypes_h
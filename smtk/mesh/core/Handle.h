@@ -14,6 +14,7 @@
 /*! \file Handle.h */
 
 #include "smtk/CoreExports.h"
+#include "smtk/common/RangeSet.h"
 #include "smtk/mesh/moab/HandleRange.h"
 
 #include "cJSON.h"
@@ -33,6 +34,33 @@ typedef smtk::mesh::moab::HandleRangeInserter HandleRangeInserter;
 SMTKCORE_EXPORT cJSON* to_json(const smtk::mesh::HandleRange& range);
 
 SMTKCORE_EXPORT smtk::mesh::HandleRange from_json(cJSON* json);
+
+/// Convert a handle range to a compressed set of values one run at a time,
+/// without visiting each handle.
+template <typename T>
+smtk::common::RangeSet<T> to_rangeSet(const smtk::mesh::HandleRange& range)
+{
+  smtk::common::RangeSet<T> result;
+  for (auto it = range.const_pair_begin(); it != range.const_pair_end(); ++it)
+  {
+    result.insert(static_cast<T>(it->first), static_cast<T>(it->second));
+  }
+  return result;
+}
+
+/// Convert a compressed set of values to a handle range one run at a time.
+template <typename T>
+smtk::mesh::HandleRange from_rangeSet(const smtk::common::RangeSet<T>& values)
+{
+  smtk::mesh::HandleRange result;
+  smtk::mesh::HandleRange::iterator hint = result.begin();
+  for (auto& run : values.ranges())
+  {
+    hint = result.insert(hint, static_cast<smtk::mesh::Handle>(run.first),
+      static_cast<smtk::mesh::Handle>(run.second));
+  }
+  return result;
+}
 }
 }
 
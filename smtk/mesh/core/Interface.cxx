@@ -0,0 +1,65 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/core/Interface.h"
+
+namespace smtk
+{
+namespace mesh
+{
+
+namespace
+{
+// Only a handful of distinct cell sets are queried repeatedly (typically
+// those of the whole collection and a few of its meshes), so keep the cache small.
+const std::size_t maximumCachedExtents = 16;
+}
+
+bool Interface::cachedExtent(
+  const smtk::mesh::HandleRange& cells, std::array<double, 6>& extent) const
+{
+  std::lock_guard<std::mutex> lock(this->m_extentCacheMutex);
+  for (auto& entry : this->m_extentCache)
+  {
+    if (entry.first == cells)
+    {
+      extent = entry.second;
+      return true;
+    }
+  }
+  return false;
+}
+
+void Interface::cacheExtent(
+  const smtk::mesh::HandleRange& cells, const std::array<double, 6>& extent) const
+{
+  std::lock_guard<std::mutex> lock(this->m_extentCacheMutex);
+  for (auto& entry : this->m_extentCache)
+  {
+    if (entry.first == cells)
+    {
+      entry.second = extent;
+      return;
+    }
+  }
+  if (this->m_extentCache.size() >= maximumCachedExtents)
+  {
+    this->m_extentCache.erase(this->m_extentCache.begin());
+  }
+  this->m_extentCache.push_back(std::make_pair(cells, extent));
+}
+
+void Interface::clearExtentCache() const
+{
+  std::lock_guard<std::mutex> lock(this->m_extentCacheMutex);
+  this->m_extentCache.clear();
+}
+}
+}
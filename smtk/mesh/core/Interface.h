@@ -18,10 +18,13 @@
 #include "smtk/mesh/core/CellTraits.h"
 #include "smtk/mesh/core/CellTypes.h"
 #include "smtk/mesh/core/DimensionTypes.h"
+#include "smtk/mesh/core/FieldTypes.h"
 #include "smtk/mesh/core/Handle.h"
 #include "smtk/mesh/core/TypeSet.h"
 
 #include <array>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 namespace smtk
@@ -363,6 +366,11 @@ public:
   //xyz needs to be allocated to 3*points.size()
   virtual bool setCoordinates(const smtk::mesh::HandleRange& points, const float* const xyz) = 0;
 
+  //compute the bounds (xmin, xmax, ymin, ymax, zmin, zmax) of the points in
+  //this range, reading the coordinates in place where the backend allows it.
+  //An empty range produces inverted bounds (each min greater than its max).
+  virtual std::array<double, 6> computeExtent(const smtk::mesh::HandleRange& points) const = 0;
+
   virtual std::vector<std::string> computeNames(const smtk::mesh::HandleRange& meshsets) const = 0;
 
   virtual std::vector<smtk::mesh::Domain> computeDomainValues(
@@ -433,11 +441,16 @@ public:
 
   virtual smtk::common::UUID rootAssociation() const = 0;
 
+  // Create a field named <name> with <dimension> values of the given type for
+  // each cell of <meshsets>. Field values are passed to and from the field
+  // accessors below as arrays of the field's type.
   virtual bool createCellField(const smtk::mesh::HandleRange& meshsets, const std::string& name,
-    std::size_t dimension, const double* data) = 0;
+    std::size_t dimension, smtk::mesh::FieldType type, const void* data) = 0;
 
   virtual int getCellFieldDimension(const smtk::mesh::CellFieldTag& cfTag) const = 0;
 
+  virtual smtk::mesh::FieldType getCellFieldType(const smtk::mesh::CellFieldTag& cfTag) const = 0;
+
   virtual smtk::mesh::HandleRange getMeshsets(
     smtk::mesh::Handle handle, const smtk::mesh::CellFieldTag& cfTag) const = 0;
 
@@ -445,16 +458,16 @@ public:
     const smtk::mesh::HandleRange& meshsets, const smtk::mesh::CellFieldTag& cfTag) const = 0;
 
   virtual bool getCellField(const smtk::mesh::HandleRange& meshsets,
-    const smtk::mesh::CellFieldTag& cfTag, double* data) const = 0;
+    const smtk::mesh::CellFieldTag& cfTag, void* data) const = 0;
 
   virtual bool setCellField(const smtk::mesh::HandleRange& meshsets,
-    const smtk::mesh::CellFieldTag& cfTag, const double* const data) = 0;
+    const smtk::mesh::CellFieldTag& cfTag, const void* const data) = 0;
 
   virtual bool getField(const smtk::mesh::HandleRange& cells, const smtk::mesh::CellFieldTag& cfTag,
-    double* data) const = 0;
+    void* data) const = 0;
 
   virtual bool setField(const smtk::mesh::HandleRange& cells, const smtk::mesh::CellFieldTag& cfTag,
-    const double* const data) = 0;
+    const void* const data) = 0;
 
   virtual std::set<smtk::mesh::CellFieldTag> computeCellFieldTags(
     const smtk::mesh::Handle& handle) const = 0;
@@ -462,11 +475,16 @@ public:
   virtual bool deleteCellField(
     const smtk::mesh::CellFieldTag& dsTag, const smtk::mesh::HandleRange& meshsets) = 0;
 
+  // Create a field named <name> with <dimension> values of the given type for
+  // each point of <meshsets>. Field values are passed to and from the field
+  // accessors below as arrays of the field's type.
   virtual bool createPointField(const smtk::mesh::HandleRange& meshsets, const std::string& name,
-    std::size_t dimension, const double* data) = 0;
+    std::size_t dimension, smtk::mesh::FieldType type, const void* data) = 0;
 
   virtual int getPointFieldDimension(const smtk::mesh::PointFieldTag& pfTag) const = 0;
 
+  virtual smtk::mesh::FieldType getPointFieldType(const smtk::mesh::PointFieldTag& pfTag) const = 0;
+
   virtual smtk::mesh::HandleRange getMeshsets(
     smtk::mesh::Handle handle, const smtk::mesh::PointFieldTag& pfTag) const = 0;
 
@@ -474,16 +492,16 @@ public:
     const smtk::mesh::HandleRange& meshsets, const smtk::mesh::PointFieldTag& pfTag) const = 0;
 
   virtual bool getPointField(const smtk::mesh::HandleRange& meshsets,
-    const smtk::mesh::PointFieldTag& pfTag, double* data) const = 0;
+    const smtk::mesh::PointFieldTag& pfTag, void* data) const = 0;
 
   virtual bool setPointField(const smtk::mesh::HandleRange& meshsets,
-    const smtk::mesh::PointFieldTag& pfTag, const double* const data) = 0;
+    const smtk::mesh::PointFieldTag& pfTag, const void* const data) = 0;
 
   virtual bool getField(const smtk::mesh::HandleRange& points,
-    const smtk::mesh::PointFieldTag& pfTag, double* data) const = 0;
+    const smtk::mesh::PointFieldTag& pfTag, void* data) const = 0;
 
   virtual bool setField(const smtk::mesh::HandleRange& points,
-    const smtk::mesh::PointFieldTag& pfTag, const double* const data) = 0;
+    const smtk::mesh::PointFieldTag& pfTag, const void* const data) = 0;
 
   virtual std::set<smtk::mesh::PointFieldTag> computePointFieldTags(
     const smtk::mesh::Handle& handle) const = 0;
@@ -526,6 +544,21 @@ public:
   //Manually modify the modified state. This is only done to set the modified
   //state to be proper after serialization / deserialization.
   virtual void setModifiedState(bool state) = 0;
+
+  //Extents of the points used by a set of cells are cached (see
+  //smtk::mesh::utility::extent) so that repeated queries are free. Keying on
+  //cells rather than meshsets means that changing which cells a meshset
+  //holds cannot make the cache stale. Implementations clear it whenever
+  //point coordinates or cell connectivity are modified or handles are deleted.
+  bool cachedExtent(const smtk::mesh::HandleRange& cells, std::array<double, 6>& extent) const;
+  void cacheExtent(const smtk::mesh::HandleRange& cells, const std::array<double, 6>& extent) const;
+
+protected:
+  void clearExtentCache() const;
+
+private:
+  mutable std::mutex m_extentCacheMutex;
+  mutable std::vector<std::pair<smtk::mesh::HandleRange, std::array<double, 6> > > m_extentCache;
 };
 }
 }
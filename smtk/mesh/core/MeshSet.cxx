@@ -463,8 +463,29 @@ smtk::mesh::CellField MeshSet::createCellField(
   return this->createCellField(name, dimension, &data[0]);
 }
 
+template <typename T>
+smtk::mesh::CellField MeshSet::createCellField(
+  const std::string& name, int dimension, const std::vector<T>& data)
+{
+  assert(data.size() == this->cells().size() * dimension);
+  return this->createCellField(name, dimension, smtk::mesh::FieldTypeFor<T>::type, data.data());
+}
+
+template smtk::mesh::CellField MeshSet::createCellField(
+  const std::string& name, int dimension, const std::vector<float>& data);
+template smtk::mesh::CellField MeshSet::createCellField(
+  const std::string& name, int dimension, const std::vector<int>& data);
+template smtk::mesh::CellField MeshSet::createCellField(
+  const std::string& name, int dimension, const std::vector<std::int64_t>& data);
+
 smtk::mesh::CellField MeshSet::createCellField(
   const std::string& name, int dimension, const double* const data)
+{
+  return this->createCellField(name, dimension, smtk::mesh::FieldType::Double, data);
+}
+
+smtk::mesh::CellField MeshSet::createCellField(
+  const std::string& name, int dimension, smtk::mesh::FieldType type, const void* const data)
 {
   if (name.empty() || dimension <= 0)
   {
@@ -481,12 +502,14 @@ smtk::mesh::CellField MeshSet::createCellField(
   bool success;
   if (data != nullptr)
   {
-    success = iface->createCellField(m_range, name, dimension, data);
+    success = iface->createCellField(m_range, name, dimension, type, data);
   }
   else
   {
-    std::vector<double> tmp(this->cells().size() * dimension, 0.);
-    success = iface->createCellField(m_range, name, dimension, &tmp[0]);
+    // All of the field types are zeroed by zeroing their bytes
+    std::vector<unsigned char> tmp(
+      this->cells().size() * dimension * smtk::mesh::fieldTypeSize(type), 0);
+    success = iface->createCellField(m_range, name, dimension, type, tmp.data());
   }
   return success ? CellField(*this, name) : CellField();
 }
@@ -532,8 +555,29 @@ smtk::mesh::PointField MeshSet::createPointField(
   return this->createPointField(name, dimension, &data[0]);
 }
 
+template <typename T>
+smtk::mesh::PointField MeshSet::createPointField(
+  const std::string& name, int dimension, const std::vector<T>& data)
+{
+  assert(data.size() == this->points().size() * dimension);
+  return this->createPointField(name, dimension, smtk::mesh::FieldTypeFor<T>::type, data.data());
+}
+
+template smtk::mesh::PointField MeshSet::createPointField(
+  const std::string& name, int dimension, const std::vector<float>& data);
+template smtk::mesh::PointField MeshSet::createPointField(
+  const std::string& name, int dimension, const std::vector<int>& data);
+template smtk::mesh::PointField MeshSet::createPointField(
+  const std::string& name, int dimension, const std::vector<std::int64_t>& data);
+
 smtk::mesh::PointField MeshSet::createPointField(
   const std::string& name, int dimension, const double* const data)
+{
+  return this->createPointField(name, dimension, smtk::mesh::FieldType::Double, data);
+}
+
+smtk::mesh::PointField MeshSet::createPointField(
+  const std::string& name, int dimension, smtk::mesh::FieldType type, const void* const data)
 {
   if (name.empty() || dimension <= 0)
   {
@@ -550,12 +594,14 @@ smtk::mesh::PointField MeshSet::createPointField(
   bool success;
   if (data != nullptr)
   {
-    success = iface->createPointField(m_range, name, dimension, data);
+    success = iface->createPointField(m_range, name, dimension, type, data);
   }
   else
   {
-    std::vector<double> tmp(this->points().size() * dimension, 0.);
-    success = iface->createPointField(m_range, name, dimension, &tmp[0]);
+    // All of the field types are zeroed by zeroing their bytes
+    std::vector<unsigned char> tmp(
+      this->points().size() * dimension * smtk::mesh::fieldTypeSize(type), 0);
+    success = iface->createPointField(m_range, name, dimension, type, tmp.data());
   }
   return success ? PointField(*this, name) : PointField();
 }
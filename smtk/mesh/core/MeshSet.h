@@ -15,6 +15,7 @@
 #include "smtk/PublicPointerDefs.h"
 
 #include "smtk/mesh/core/CellSet.h"
+#include "smtk/mesh/core/FieldTypes.h"
 #include "smtk/mesh/core/Handle.h"
 #include "smtk/mesh/core/PointSet.h"
 #include "smtk/mesh/core/QueryTypes.h"
@@ -175,11 +176,17 @@ public:
 
   //Create a new cell field with the given name, dimension and data. The number
   //of values in <data> must be the # of cells in the meshset multiplied by the
-  //dimension of the cell field.
+  //dimension of the cell field. The field's values are stored as doubles
+  //unless another type is given; without data, the values are zeroed.
   smtk::mesh::CellField createCellField(
     const std::string& name, int dimension, const std::vector<double>& field);
   smtk::mesh::CellField createCellField(
     const std::string& name, int dimension, const double* const field = nullptr);
+  smtk::mesh::CellField createCellField(const std::string& name, int dimension,
+    smtk::mesh::FieldType type, const void* const field = nullptr);
+  template <typename T>
+  smtk::mesh::CellField createCellField(
+    const std::string& name, int dimension, const std::vector<T>& field);
   smtk::mesh::CellField cellField(const std::string& name) const;
   std::set<smtk::mesh::CellField> cellFields() const;
   //Remove the dataset from this meshset.
@@ -187,11 +194,17 @@ public:
 
   //Create a new point field with the given name, dimension and data. The number
   //of values in <data> must be the # of points in the meshset multiplied by the
-  //dimension of the point field.
+  //dimension of the point field. The field's values are stored as doubles
+  //unless another type is given; without data, the values are zeroed.
   smtk::mesh::PointField createPointField(
     const std::string& name, int dimension, const std::vector<double>& field);
   smtk::mesh::PointField createPointField(
     const std::string& name, int dimension, const double* const field = nullptr);
+  smtk::mesh::PointField createPointField(const std::string& name, int dimension,
+    smtk::mesh::FieldType type, const void* const field = nullptr);
+  template <typename T>
+  smtk::mesh::PointField createPointField(
+    const std::string& name, int dimension, const std::vector<T>& field);
   smtk::mesh::PointField pointField(const std::string& name) const;
   std::set<smtk::mesh::PointField> pointFields() const;
   //Remove the dataset from this meshset.
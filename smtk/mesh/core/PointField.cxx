@@ -104,6 +104,22 @@ std::size_t PointField::dimension() const
       : 0);
 }
 
+smtk::mesh::FieldType PointField::type() const
+{
+  const smtk::mesh::InterfacePtr& iface = this->m_meshset.collection()->interface();
+  if (!iface)
+  {
+    return smtk::mesh::FieldType::MaxFieldType;
+  }
+
+  smtk::mesh::PointFieldTag dsTag(this->m_name);
+  if (!iface->hasPointField(this->m_meshset.range(), dsTag))
+  {
+    return smtk::mesh::FieldType::MaxFieldType;
+  }
+  return iface->getPointFieldType(dsTag);
+}
+
 smtk::mesh::PointSet PointField::points() const
 {
   return this->m_meshset.points();
@@ -139,37 +155,38 @@ bool PointField::set(const std::vector<double>& values)
 
 bool PointField::get(const smtk::mesh::HandleRange& pointIds, double* values) const
 {
-  const smtk::mesh::InterfacePtr& iface = this->m_meshset.collection()->interface();
-  if (!iface)
-  {
-    return false;
-  }
-
   if (!this->m_meshset.points().range().contains(pointIds))
   {
     return false;
   }
 
-  return iface->getField(pointIds, smtk::mesh::PointFieldTag(this->m_name), values);
+  return this->getValues(pointIds, smtk::mesh::FieldType::Double, values);
 }
 
 bool PointField::set(const smtk::mesh::HandleRange& pointIds, const double* const values)
 {
-  const smtk::mesh::InterfacePtr& iface = this->m_meshset.collection()->interface();
-  if (!iface)
-  {
-    return false;
-  }
-
   if (!this->m_meshset.points().range().contains(pointIds))
   {
     return false;
   }
 
-  return iface->setField(pointIds, smtk::mesh::PointFieldTag(this->m_name), values);
+  return this->setValues(pointIds, smtk::mesh::FieldType::Double, values);
 }
 
 bool PointField::get(double* values) const
+{
+  return this->getValues(
+    this->m_meshset.points().range(), smtk::mesh::FieldType::Double, values);
+}
+
+bool PointField::set(const double* const values)
+{
+  return this->setValues(
+    this->m_meshset.points().range(), smtk::mesh::FieldType::Double, values);
+}
+
+bool PointField::getValues(
+  const smtk::mesh::HandleRange& pointIds, smtk::mesh::FieldType type, void* values) const
 {
   const smtk::mesh::InterfacePtr& iface = this->m_meshset.collection()->interface();
   if (!iface)
@@ -177,11 +194,22 @@ bool PointField::get(double* values) const
     return false;
   }
 
-  return iface->getPointField(
-    this->m_meshset.range(), smtk::mesh::PointFieldTag(this->m_name), values);
+  smtk::mesh::PointFieldTag dsTag(this->m_name);
+  smtk::mesh::FieldType storedType = iface->getPointFieldType(dsTag);
+  if (storedType == type)
+  {
+    return iface->getField(pointIds, dsTag, values);
+  }
+
+  //fetch the values as stored, then convert them to the requested type
+  std::size_t numberOfValues = pointIds.size() * iface->getPointFieldDimension(dsTag);
+  std::vector<unsigned char> stored(numberOfValues * smtk::mesh::fieldTypeSize(storedType));
+  return !stored.empty() && iface->getField(pointIds, dsTag, stored.data()) &&
+    smtk::mesh::convertFieldValues(storedType, stored.data(), type, values, numberOfValues);
 }
 
-bool PointField::set(const double* const values)
+bool PointField::setValues(
+  const smtk::mesh::HandleRange& pointIds, smtk::mesh::FieldType type, const void* const values)
 {
   const smtk::mesh::InterfacePtr& iface = this->m_meshset.collection()->interface();
   if (!iface)
@@ -189,8 +217,19 @@ bool PointField::set(const double* const values)
     return false;
   }
 
-  return iface->setPointField(
-    this->m_meshset.range(), smtk::mesh::PointFieldTag(this->m_name), values);
+  smtk::mesh::PointFieldTag dsTag(this->m_name);
+  smtk::mesh::FieldType storedType = iface->getPointFieldType(dsTag);
+  if (storedType == type)
+  {
+    return iface->setField(pointIds, dsTag, values);
+  }
+
+  //convert the values to the type in which they are stored
+  std::size_t numberOfValues = pointIds.size() * iface->getPointFieldDimension(dsTag);
+  std::vector<unsigned char> stored(numberOfValues * smtk::mesh::fieldTypeSize(storedType));
+  return !stored.empty() &&
+    smtk::mesh::convertFieldValues(type, values, storedType, stored.data(), numberOfValues) &&
+    iface->setField(pointIds, dsTag, stored.data());
 }
 }
 }
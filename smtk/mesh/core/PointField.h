@@ -14,6 +14,7 @@
 #include "smtk/CoreExports.h"
 #include "smtk/PublicPointerDefs.h"
 
+#include "smtk/mesh/core/FieldTypes.h"
 #include "smtk/mesh/core/Handle.h"
 #include "smtk/mesh/core/MeshSet.h"
 
@@ -26,8 +27,10 @@ namespace smtk
 namespace mesh
 {
 
-//Represents point-centered floating-point data associated with a meshset. We
-//represent the PointField with a unique name and a reference to the meshset.
+//Represents point-centered data associated with a meshset. We represent the
+//PointField with a unique name and a reference to the meshset. A PointField's values
+//are stored as one of the FieldTypes; they may be accessed as any of them,
+//and are converted on access when the types differ.
 class SMTKCORE_EXPORT PointField
 {
 public:
@@ -63,6 +66,9 @@ public:
   //Return the number of components in each data tuple
   std::size_t dimension() const;
 
+  //Return the type in which the data is stored
+  smtk::mesh::FieldType type() const;
+
   //Return the meshset associated with the dataset
   const smtk::mesh::MeshSet& meshset() const { return this->m_meshset; }
 
@@ -102,7 +108,69 @@ public:
   //a success flag. <values> must be at least size() * dimension() in length.
   bool set(const double* const values);
 
+  //Typed variants of the accessors above. Values are converted from (or to)
+  //the type in which the data is stored.
+  template <typename T>
+  std::vector<T> get(const smtk::mesh::HandleRange& pointIds) const
+  {
+    std::vector<T> values(pointIds.size() * this->dimension());
+    this->get(pointIds, values.data());
+    return values;
+  }
+
+  template <typename T>
+  bool set(const smtk::mesh::HandleRange& pointIds, const std::vector<T>& values)
+  {
+    return this->set(pointIds, values.data());
+  }
+
+  template <typename T>
+  std::vector<T> get() const
+  {
+    std::vector<T> values(this->size() * this->dimension());
+    this->get(values.data());
+    return values;
+  }
+
+  template <typename T>
+  bool set(const std::vector<T>& values)
+  {
+    return this->set(values.data());
+  }
+
+  template <typename T>
+  bool get(const smtk::mesh::HandleRange& pointIds, T* values) const
+  {
+    return this->points().range().contains(pointIds) &&
+      this->getValues(pointIds, smtk::mesh::FieldTypeFor<T>::type, values);
+  }
+
+  template <typename T>
+  bool set(const smtk::mesh::HandleRange& pointIds, const T* const values)
+  {
+    return this->points().range().contains(pointIds) &&
+      this->setValues(pointIds, smtk::mesh::FieldTypeFor<T>::type, values);
+  }
+
+  template <typename T>
+  bool get(T* values) const
+  {
+    return this->getValues(this->points().range(), smtk::mesh::FieldTypeFor<T>::type, values);
+  }
+
+  template <typename T>
+  bool set(const T* const values)
+  {
+    return this->setValues(this->points().range(), smtk::mesh::FieldTypeFor<T>::type, values);
+  }
+
 private:
+  //Get (or set) the data associated with <pointIds> as values of type <type>
+  bool getValues(
+    const smtk::mesh::HandleRange& pointIds, smtk::mesh::FieldType type, void* values) const;
+  bool setValues(
+    const smtk::mesh::HandleRange& pointIds, smtk::mesh::FieldType type, const void* const values);
+
   std::string m_name;
   smtk::mesh::MeshSet m_meshset;
 };
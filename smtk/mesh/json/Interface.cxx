@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <limits>
 #include <set>
 
 namespace smtk
@@ -334,6 +335,14 @@ bool Interface::setCoordinates(const smtk::mesh::HandleRange&, const float* cons
   return false;
 }
 
+std::array<double, 6> Interface::computeExtent(const smtk::mesh::HandleRange&) const
+{
+  const double lo = std::numeric_limits<double>::lowest();
+  const double hi = std::numeric_limits<double>::max();
+  std::array<double, 6> extent = { { hi, lo, hi, lo, hi, lo } };
+  return extent;
+}
+
 std::vector<std::string> Interface::computeNames(const smtk::mesh::HandleRange&) const
 {
   return std::vector<std::string>();
@@ -563,8 +572,8 @@ smtk::common::UUID Interface::rootAssociation() const
   return this->m_associated_model;
 }
 
-bool Interface::createCellField(
-  const smtk::mesh::HandleRange&, const std::string&, std::size_t, const double*)
+bool Interface::createCellField(const smtk::mesh::HandleRange&, const std::string&, std::size_t,
+  smtk::mesh::FieldType, const void*)
 {
   return false;
 }
@@ -574,6 +583,11 @@ int Interface::getCellFieldDimension(const smtk::mesh::CellFieldTag&) const
   return 0;
 }
 
+smtk::mesh::FieldType Interface::getCellFieldType(const smtk::mesh::CellFieldTag&) const
+{
+  return smtk::mesh::FieldType::MaxFieldType;
+}
+
 smtk::mesh::HandleRange Interface::getMeshsets(
   smtk::mesh::Handle, const smtk::mesh::CellFieldTag&) const
 {
@@ -586,25 +600,25 @@ bool Interface::hasCellField(const smtk::mesh::HandleRange&, const smtk::mesh::C
 }
 
 bool Interface::getCellField(
-  const smtk::mesh::HandleRange&, const smtk::mesh::CellFieldTag&, double*) const
+  const smtk::mesh::HandleRange&, const smtk::mesh::CellFieldTag&, void*) const
 {
   return false;
 }
 
 bool Interface::setCellField(
-  const smtk::mesh::HandleRange&, const smtk::mesh::CellFieldTag&, const double* const)
+  const smtk::mesh::HandleRange&, const smtk::mesh::CellFieldTag&, const void* const)
 {
   return false;
 }
 
 bool Interface::getField(
-  const smtk::mesh::HandleRange&, const smtk::mesh::CellFieldTag&, double*) const
+  const smtk::mesh::HandleRange&, const smtk::mesh::CellFieldTag&, void*) const
 {
   return false;
 }
 
 bool Interface::setField(
-  const smtk::mesh::HandleRange&, const smtk::mesh::CellFieldTag&, const double* const)
+  const smtk::mesh::HandleRange&, const smtk::mesh::CellFieldTag&, const void* const)
 {
   return false;
 }
@@ -619,8 +633,8 @@ bool Interface::deleteCellField(const smtk::mesh::CellFieldTag&, const smtk::mes
   return false;
 }
 
-bool Interface::createPointField(
-  const smtk::mesh::HandleRange&, const std::string&, std::size_t, const double*)
+bool Interface::createPointField(const smtk::mesh::HandleRange&, const std::string&, std::size_t,
+  smtk::mesh::FieldType, const void*)
 {
   return false;
 }
@@ -630,6 +644,11 @@ int Interface::getPointFieldDimension(const smtk::mesh::PointFieldTag&) const
   return 0;
 }
 
+smtk::mesh::FieldType Interface::getPointFieldType(const smtk::mesh::PointFieldTag&) const
+{
+  return smtk::mesh::FieldType::MaxFieldType;
+}
+
 smtk::mesh::HandleRange Interface::getMeshsets(
   smtk::mesh::Handle, const smtk::mesh::PointFieldTag&) const
 {
@@ -643,25 +662,25 @@ bool Interface::hasPointField(
 }
 
 bool Interface::getPointField(
-  const smtk::mesh::HandleRange&, const smtk::mesh::PointFieldTag&, double*) const
+  const smtk::mesh::HandleRange&, const smtk::mesh::PointFieldTag&, void*) const
 {
   return false;
 }
 
 bool Interface::setPointField(
-  const smtk::mesh::HandleRange&, const smtk::mesh::PointFieldTag&, const double* const)
+  const smtk::mesh::HandleRange&, const smtk::mesh::PointFieldTag&, const void* const)
 {
   return false;
 }
 
 bool Interface::getField(
-  const smtk::mesh::HandleRange&, const smtk::mesh::PointFieldTag&, double*) const
+  const smtk::mesh::HandleRange&, const smtk::mesh::PointFieldTag&, void*) const
 {
   return false;
 }
 
 bool Interface::setField(
-  const smtk::mesh::HandleRange&, const smtk::mesh::PointFieldTag&, const double* const)
+  const smtk::mesh::HandleRange&, const smtk::mesh::PointFieldTag&, const void* const)
 {
   return false;
 }
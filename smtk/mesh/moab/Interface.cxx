@@ -42,7 +42,9 @@ SMTK_THIRDPARTY_POST_INCLUDE
 
 #include <algorithm>
 #include <cstring>
+#include <limits>
 #include <set>
+#include <thread>
 
 namespace smtk
 {
@@ -212,6 +214,48 @@ bool setDenseOpaqueTagValue(T tag, const smtk::mesh::Handle& handle, ::moab::Int
   return (rval == ::moab::MB_SUCCESS);
 }
 
+//find the tag holding the values of the field named <name>, along with the
+//type and number of components of those values
+bool findFieldDataTag(::moab::Interface* iface, const std::string& name, ::moab::Tag& tag,
+  smtk::mesh::FieldType& type, int& dimension)
+{
+  const smtk::mesh::FieldType tagTypes[3] = { smtk::mesh::FieldType::Double,
+    smtk::mesh::FieldType::Float, smtk::mesh::FieldType::Integer64 };
+  for (smtk::mesh::FieldType tagType : tagTypes)
+  {
+    std::string tagName = tag::fieldDataTagName(name, tagType);
+    if (iface->tag_get_handle(tagName.c_str(), tag) != ::moab::MB_SUCCESS)
+    {
+      continue;
+    }
+
+    ::moab::DataType dataType;
+    int length = 0;
+    iface->tag_get_data_type(tag, dataType);
+    iface->tag_get_length(tag, length);
+    if (tagType == smtk::mesh::FieldType::Double)
+    {
+      //doubles and ints are held natively under the same name
+      if (dataType != ::moab::MB_TYPE_DOUBLE && dataType != ::moab::MB_TYPE_INTEGER)
+      {
+        continue;
+      }
+      type = dataType == ::moab::MB_TYPE_DOUBLE ? smtk::mesh::FieldType::Double
+                                                : smtk::mesh::FieldType::Integer;
+      dimension = length;
+      return true;
+    }
+    else if (dataType == ::moab::MB_TYPE_OPAQUE)
+    {
+      //opaque tags are sized in bytes
+      type = tagType;
+      dimension = length / static_cast<int>(smtk::mesh::fieldTypeSize(tagType));
+      return true;
+    }
+  }
+  return false;
+}
+
 } //detail
 
 //construct an empty interface instance
@@ -638,6 +682,7 @@ bool Interface::setCoordinates(const smtk::mesh::HandleRange& points, const doub
     return false;
   }
 
+  this->clearExtentCache();
   m_iface->set_coords(points, xyz);
   return true;
 }
@@ -679,6 +724,127 @@ bool Interface::setCoordinates(const smtk::mesh::HandleRange& points, const floa
   return false;
 }
 
+namespace
+{
+//a contiguous run of vertices in moab's (structure of arrays) coordinate storage
+struct CoordinateBlock
+{
+  const double* x;
+  const double* y;
+  const double* z;
+  std::size_t count;
+};
+
+void growExtent(const double* x, const double* y, const double* z, std::size_t begin,
+  std::size_t end, std::array<double, 6>& extent)
+{
+  double xmin = extent[0], xmax = extent[1];
+  double ymin = extent[2], ymax = extent[3];
+  double zmin = extent[4], zmax = extent[5];
+  for (std::size_t i = begin; i < end; ++i)
+  {
+    xmin = std::min(xmin, x[i]);
+    xmax = std::max(xmax, x[i]);
+    ymin = std::min(ymin, y[i]);
+    ymax = std::max(ymax, y[i]);
+    zmin = std::min(zmin, z[i]);
+    zmax = std::max(zmax, z[i]);
+  }
+  extent = { { xmin, xmax, ymin, ymax, zmin, zmax } };
+}
+
+//below this many points per thread, spawning threads costs more than it saves
+const std::size_t minimumPointsPerThread = 1 << 16;
+}
+
+std::array<double, 6> Interface::computeExtent(const smtk::mesh::HandleRange& points) const
+{
+  const double lo = std::numeric_limits<double>::lowest();
+  const double hi = std::numeric_limits<double>::max();
+  std::array<double, 6> extent = { { hi, lo, hi, lo, hi, lo } };
+  if (points.empty())
+  {
+    return extent;
+  }
+
+  //collect the runs of coordinate storage that hold the points so we can
+  //reduce over them in place instead of copying the coordinates out
+  std::vector<CoordinateBlock> blocks;
+  std::size_t numPoints = 0;
+  bool inPlace = points.all_of_type(::moab::MBVERTEX);
+  for (smtk::mesh::HandleRange::const_iterator i = points.begin(); inPlace && i != points.end();)
+  {
+    double *x, *y, *z;
+    int count = 0;
+    inPlace = m_iface->coords_iterate(i, points.end(), x, y, z, count) == ::moab::MB_SUCCESS &&
+      count > 0;
+    if (inPlace)
+    {
+      CoordinateBlock block = { x, y, z, static_cast<std::size_t>(count) };
+      blocks.push_back(block);
+      numPoints += block.count;
+      i += count;
+    }
+  }
+
+  if (!inPlace)
+  {
+    //fall back to copying the coordinates out
+    std::vector<double> xyz(3 * points.size());
+    if (m_iface->get_coords(points, &xyz[0]) == ::moab::MB_SUCCESS)
+    {
+      for (std::size_t i = 0; i < xyz.size(); i += 3)
+      {
+        growExtent(&xyz[i], &xyz[i + 1], &xyz[i + 2], 0, 1, extent);
+      }
+    }
+    return extent;
+  }
+
+  //split the points evenly among threads; each one reduces the parts of the
+  //blocks that overlap its share
+  std::size_t numThreads = std::min(static_cast<std::size_t>(std::thread::hardware_concurrency()),
+    numPoints / minimumPointsPerThread);
+  numThreads = std::max(numThreads, static_cast<std::size_t>(1));
+  std::vector<std::array<double, 6> > partial(numThreads, extent);
+  auto reduce = [&](std::size_t t) {
+    const std::size_t first = numPoints * t / numThreads;
+    const std::size_t last = numPoints * (t + 1) / numThreads;
+    std::size_t offset = 0;
+    for (std::size_t b = 0; b < blocks.size() && offset < last; ++b)
+    {
+      const CoordinateBlock& block(blocks[b]);
+      const std::size_t begin = std::max(first, offset);
+      const std::size_t end = std::min(last, offset + block.count);
+      if (begin < end)
+      {
+        growExtent(block.x, block.y, block.z, begin - offset, end - offset, partial[t]);
+      }
+      offset += block.count;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 1; t < numThreads; ++t)
+  {
+    threads.push_back(std::thread(reduce, t));
+  }
+  reduce(0);
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  for (auto& part : partial)
+  {
+    for (std::size_t j = 0; j < 3; ++j)
+    {
+      extent[2 * j] = std::min(extent[2 * j], part[2 * j]);
+      extent[2 * j + 1] = std::max(extent[2 * j + 1], part[2 * j + 1]);
+    }
+  }
+  return extent;
+}
+
 std::vector<std::string> Interface::computeNames(const smtk::mesh::HandleRange& meshsets) const
 {
   //construct a name tag query helper class
@@ -860,6 +1026,7 @@ bool Interface::mergeCoincidentContactPoints(
   //of the meshes, not just the highest dimension i expect
   smtk::mesh::moab::MergeMeshVertices meshmerger(this->moabInterface());
   ::moab::ErrorCode rval = meshmerger.merge_entities(meshes, tolerance);
+  this->clearExtentCache();
   if (rval == ::moab::MB_SUCCESS)
   {
     this->m_modified = true;
@@ -1018,6 +1185,11 @@ bool Interface::setAssociation(
   bool tagged = detail::setDenseOpaqueTagValues(mtag, range, this->moabInterface());
   if (tagged)
   {
+    //Index the meshsets by the model entity's key, so they can be read
+    //without the rest of the file
+    tag::QueryEntRefKeyTag ktag(this->moabInterface());
+    std::vector<int> keys(range.size(), Interface::associationKey(modelUUID));
+    tagged = m_iface->tag_set_data(ktag.moabTag(), range, &keys[0]) == ::moab::MB_SUCCESS;
     this->m_modified = true;
   }
   return tagged;
@@ -1047,6 +1219,30 @@ smtk::mesh::HandleRange Interface::findAssociations(
   return result;
 }
 
+const char* Interface::associationKeyTagName()
+{
+  return "ENT_REF_KEY";
+}
+
+const char* Interface::fullyKeyedTagName()
+{
+  return "ENT_REF_KEYED";
+}
+
+// brief Compute the integer key under which meshsets associated with
+// the given model entity are indexed.
+//
+int Interface::associationKey(const smtk::common::UUID& modelUUID)
+{
+  //32-bit FNV-1a, truncated to a non-negative int
+  unsigned int hash = 2166136261u;
+  for (const unsigned char* byte = modelUUID.begin(); byte != modelUUID.end(); ++byte)
+  {
+    hash = (hash ^ *byte) * 16777619u;
+  }
+  return static_cast<int>(hash & 0x7fffffff);
+}
+
 // brief Set the model entity assigned to the root of this interface.
 //
 bool Interface::setRootAssociation(const smtk::common::UUID& modelUUID) const
@@ -1086,10 +1282,10 @@ smtk::common::UUID Interface::rootAssociation() const
   return smtk::common::UUID::null();
 }
 
-//create a data set named <name> with <dimension> doubles for each cell in
-//<meshsets>, and populate it with <data>
+//create a data set named <name> with <dimension> values of type <type> for
+//each cell in <meshsets>, and populate it with <data>
 bool Interface::createCellField(const smtk::mesh::HandleRange& meshsets, const std::string& name,
-  std::size_t dimension, const double* data)
+  std::size_t dimension, smtk::mesh::FieldType type, const void* data)
 {
   if (meshsets.empty())
   {
@@ -1104,15 +1300,27 @@ bool Interface::createCellField(const smtk::mesh::HandleRange& meshsets, const s
     // If there are no cells, then there we return with failure.
     return false;
   }
-  // The double tag is used to associate double-valued data with the cells
-  tag::QueryDoubleTag dtag(name.c_str(), static_cast<int>(dimension), this->moabInterface());
+  // A field's values all share one type, so we cannot reuse the name of a
+  // field of another type
+  ::moab::Tag existing;
+  smtk::mesh::FieldType existingType;
+  int existingDimension;
+  if (detail::findFieldDataTag(
+        this->moabInterface(), name, existing, existingType, existingDimension) &&
+    existingType != type)
+  {
+    return false;
+  }
+
+  // The data tag is used to associate typed data with the cells
+  tag::QueryFieldDataTag dtag(
+    name.c_str(), static_cast<int>(dimension), type, this->moabInterface());
   if (dtag.state() != ::moab::MB_SUCCESS && dtag.state() != ::moab::MB_ALREADY_ALLOCATED)
   {
     return false;
   }
 
-  const double* tag_values = data;
-  ::moab::ErrorCode rval = m_iface->tag_set_data(dtag.moabTag(), cells, tag_values);
+  ::moab::ErrorCode rval = m_iface->tag_set_data(dtag.moabTag(), cells, data);
   bool tagged = (rval == ::moab::MB_SUCCESS);
 
   if (tagged)
@@ -1139,18 +1347,30 @@ bool Interface::createCellField(const smtk::mesh::HandleRange& meshsets, const s
 int Interface::getCellFieldDimension(const smtk::mesh::CellFieldTag& cfTag) const
 {
   ::moab::Tag tag;
-  std::string dTagName = cfTag.name() + std::string("_");
-  ::moab::ErrorCode rval = m_iface->tag_get_handle(dTagName.c_str(), tag);
-  if (rval != ::moab::MB_SUCCESS)
+  smtk::mesh::FieldType type;
+  int dimension = 0;
+  if (!detail::findFieldDataTag(m_iface.get(), cfTag.name(), tag, type, dimension))
   {
     return 0;
   }
-  int dimension = 0;
-  m_iface->tag_get_length(tag, dimension);
 
   return dimension;
 }
 
+//get the type of a dataset's values.
+smtk::mesh::FieldType Interface::getCellFieldType(const smtk::mesh::CellFieldTag& cfTag) const
+{
+  ::moab::Tag tag;
+  smtk::mesh::FieldType type;
+  int dimension = 0;
+  if (!detail::findFieldDataTag(m_iface.get(), cfTag.name(), tag, type, dimension))
+  {
+    return smtk::mesh::FieldType::MaxFieldType;
+  }
+
+  return type;
+}
+
 //find all mesh sets that have this data set
 smtk::mesh::HandleRange Interface::getMeshsets(
   smtk::mesh::Handle handle, const smtk::mesh::CellFieldTag& cfTag) const
@@ -1202,7 +1422,7 @@ bool Interface::hasCellField(
 }
 
 bool Interface::getCellField(const smtk::mesh::HandleRange& meshsets,
-  const smtk::mesh::CellFieldTag& cfTag, double* field) const
+  const smtk::mesh::CellFieldTag& cfTag, void* field) const
 {
   if (meshsets.empty())
   {
@@ -1214,7 +1434,7 @@ bool Interface::getCellField(const smtk::mesh::HandleRange& meshsets,
 }
 
 bool Interface::setCellField(const smtk::mesh::HandleRange& meshsets,
-  const smtk::mesh::CellFieldTag& cfTag, const double* const field)
+  const smtk::mesh::CellFieldTag& cfTag, const void* const field)
 {
   if (meshsets.empty())
   {
@@ -1226,7 +1446,7 @@ bool Interface::setCellField(const smtk::mesh::HandleRange& meshsets,
 }
 
 bool Interface::getField(
-  const smtk::mesh::HandleRange& cells, const smtk::mesh::CellFieldTag& cfTag, double* field) const
+  const smtk::mesh::HandleRange& cells, const smtk::mesh::CellFieldTag& cfTag, void* field) const
 {
   if (cells.empty())
   {
@@ -1234,21 +1454,20 @@ bool Interface::getField(
     return false;
   }
 
-  std::string dTagName = cfTag.name() + std::string("_");
-
   ::moab::Tag moab_tag;
-  ::moab::ErrorCode rval = m_iface->tag_get_handle(dTagName.c_str(), moab_tag);
-  if (rval != ::moab::MB_SUCCESS)
+  smtk::mesh::FieldType type;
+  int dimension;
+  if (!detail::findFieldDataTag(m_iface.get(), cfTag.name(), moab_tag, type, dimension))
   {
     return false;
   }
 
-  rval = m_iface->tag_get_data(moab_tag, cells, field);
+  ::moab::ErrorCode rval = m_iface->tag_get_data(moab_tag, cells, field);
   return (rval == ::moab::MB_SUCCESS);
 }
 
 bool Interface::setField(const smtk::mesh::HandleRange& cells,
-  const smtk::mesh::CellFieldTag& cfTag, const double* const field)
+  const smtk::mesh::CellFieldTag& cfTag, const void* const field)
 {
   if (cells.empty())
   {
@@ -1256,16 +1475,15 @@ bool Interface::setField(const smtk::mesh::HandleRange& cells,
     return false;
   }
 
-  std::string dTagName = cfTag.name() + std::string("_");
-
   ::moab::Tag moab_tag;
-  ::moab::ErrorCode rval = m_iface->tag_get_handle(dTagName.c_str(), moab_tag);
-  if (rval != ::moab::MB_SUCCESS)
+  smtk::mesh::FieldType type;
+  int dimension;
+  if (!detail::findFieldDataTag(m_iface.get(), cfTag.name(), moab_tag, type, dimension))
   {
     return false;
   }
 
-  rval = m_iface->tag_set_data(moab_tag, cells, field);
+  ::moab::ErrorCode rval = m_iface->tag_set_data(moab_tag, cells, field);
 
   this->m_modified = (rval == ::moab::MB_SUCCESS);
   return this->m_modified;
@@ -1319,16 +1537,16 @@ bool Interface::deleteCellField(
   }
 
   // Access the tag associated with the cellsets
-  std::string dTagName = cfTag.name() + std::string("_");
   ::moab::Tag dTag;
-  ::moab::ErrorCode rval = m_iface->tag_get_handle(dTagName.c_str(), dTag);
-  if (rval != ::moab::MB_SUCCESS)
+  smtk::mesh::FieldType type;
+  int dimension;
+  if (!detail::findFieldDataTag(m_iface.get(), cfTag.name(), dTag, type, dimension))
   {
     return false;
   }
 
   // Delete the data from the cellsets
-  rval = m_iface->tag_delete_data(dTag, cells);
+  ::moab::ErrorCode rval = m_iface->tag_delete_data(dTag, cells);
   if (rval != ::moab::MB_SUCCESS)
   {
     return false;
@@ -1353,10 +1571,10 @@ bool Interface::deleteCellField(
   return true;
 }
 
-//create a data set named <name> with <dimension> doubles for each point in
-//<meshsets>, and populate it with <data>
+//create a data set named <name> with <dimension> values of type <type> for
+//each point in <meshsets>, and populate it with <data>
 bool Interface::createPointField(const smtk::mesh::HandleRange& meshsets, const std::string& name,
-  std::size_t dimension, const double* data)
+  std::size_t dimension, smtk::mesh::FieldType type, const void* data)
 {
   if (meshsets.empty())
   {
@@ -1371,15 +1589,27 @@ bool Interface::createPointField(const smtk::mesh::HandleRange& meshsets, const
     // If there are no points, then there we return with failure.
     return false;
   }
-  // The double tag is used to associate double-valued data with the points
-  tag::QueryDoubleTag dtag(name.c_str(), static_cast<int>(dimension), this->moabInterface());
+  // A field's values all share one type, so we cannot reuse the name of a
+  // field of another type
+  ::moab::Tag existing;
+  smtk::mesh::FieldType existingType;
+  int existingDimension;
+  if (detail::findFieldDataTag(
+        this->moabInterface(), name, existing, existingType, existingDimension) &&
+    existingType != type)
+  {
+    return false;
+  }
+
+  // The data tag is used to associate typed data with the points
+  tag::QueryFieldDataTag dtag(
+    name.c_str(), static_cast<int>(dimension), type, this->moabInterface());
   if (dtag.state() != ::moab::MB_SUCCESS && dtag.state() != ::moab::MB_ALREADY_ALLOCATED)
   {
     return false;
   }
 
-  const double* tag_values = data;
-  ::moab::ErrorCode rval = m_iface->tag_set_data(dtag.moabTag(), points, tag_values);
+  ::moab::ErrorCode rval = m_iface->tag_set_data(dtag.moabTag(), points, data);
   bool tagged = (rval == ::moab::MB_SUCCESS);
 
   if (tagged)
@@ -1406,18 +1636,30 @@ bool Interface::createPointField(const smtk::mesh::HandleRange& meshsets, const
 int Interface::getPointFieldDimension(const smtk::mesh::PointFieldTag& pfTag) const
 {
   ::moab::Tag tag;
-  std::string dTagName = pfTag.name() + std::string("_");
-  ::moab::ErrorCode rval = m_iface->tag_get_handle(dTagName.c_str(), tag);
-  if (rval != ::moab::MB_SUCCESS)
+  smtk::mesh::FieldType type;
+  int dimension = 0;
+  if (!detail::findFieldDataTag(m_iface.get(), pfTag.name(), tag, type, dimension))
   {
     return 0;
   }
-  int dimension = 0;
-  m_iface->tag_get_length(tag, dimension);
 
   return dimension;
 }
 
+//get the type of a dataset's values.
+smtk::mesh::FieldType Interface::getPointFieldType(const smtk::mesh::PointFieldTag& pfTag) const
+{
+  ::moab::Tag tag;
+  smtk::mesh::FieldType type;
+  int dimension = 0;
+  if (!detail::findFieldDataTag(m_iface.get(), pfTag.name(), tag, type, dimension))
+  {
+    return smtk::mesh::FieldType::MaxFieldType;
+  }
+
+  return type;
+}
+
 //find all mesh sets that have this data set
 smtk::mesh::HandleRange Interface::getMeshsets(
   smtk::mesh::Handle handle, const smtk::mesh::PointFieldTag& pfTag) const
@@ -1469,7 +1711,7 @@ bool Interface::hasPointField(
 }
 
 bool Interface::getPointField(const smtk::mesh::HandleRange& meshsets,
-  const smtk::mesh::PointFieldTag& pfTag, double* field) const
+  const smtk::mesh::PointFieldTag& pfTag, void* field) const
 {
   if (meshsets.empty())
   {
@@ -1481,7 +1723,7 @@ bool Interface::getPointField(const smtk::mesh::HandleRange& meshsets,
 }
 
 bool Interface::setPointField(const smtk::mesh::HandleRange& meshsets,
-  const smtk::mesh::PointFieldTag& pfTag, const double* const field)
+  const smtk::mesh::PointFieldTag& pfTag, const void* const field)
 {
   if (meshsets.empty())
   {
@@ -1493,7 +1735,7 @@ bool Interface::setPointField(const smtk::mesh::HandleRange& meshsets,
 }
 
 bool Interface::getField(const smtk::mesh::HandleRange& points,
-  const smtk::mesh::PointFieldTag& pfTag, double* field) const
+  const smtk::mesh::PointFieldTag& pfTag, void* field) const
 {
   if (points.empty())
   {
@@ -1501,21 +1743,20 @@ bool Interface::getField(const smtk::mesh::HandleRange& points,
     return false;
   }
 
-  std::string dTagName = pfTag.name() + std::string("_");
-
   ::moab::Tag moab_tag;
-  ::moab::ErrorCode rval = m_iface->tag_get_handle(dTagName.c_str(), moab_tag);
-  if (rval != ::moab::MB_SUCCESS)
+  smtk::mesh::FieldType type;
+  int dimension;
+  if (!detail::findFieldDataTag(m_iface.get(), pfTag.name(), moab_tag, type, dimension))
   {
     return false;
   }
 
-  rval = m_iface->tag_get_data(moab_tag, points, field);
+  ::moab::ErrorCode rval = m_iface->tag_get_data(moab_tag, points, field);
   return (rval == ::moab::MB_SUCCESS);
 }
 
 bool Interface::setField(const smtk::mesh::HandleRange& points,
-  const smtk::mesh::PointFieldTag& pfTag, const double* const field)
+  const smtk::mesh::PointFieldTag& pfTag, const void* const field)
 {
   if (points.empty())
   {
@@ -1523,16 +1764,15 @@ bool Interface::setField(const smtk::mesh::HandleRange& points,
     return false;
   }
 
-  std::string dTagName = pfTag.name() + std::string("_");
-
   ::moab::Tag moab_tag;
-  ::moab::ErrorCode rval = m_iface->tag_get_handle(dTagName.c_str(), moab_tag);
-  if (rval != ::moab::MB_SUCCESS)
+  smtk::mesh::FieldType type;
+  int dimension;
+  if (!detail::findFieldDataTag(m_iface.get(), pfTag.name(), moab_tag, type, dimension))
   {
     return false;
   }
 
-  rval = m_iface->tag_set_data(moab_tag, points, field);
+  ::moab::ErrorCode rval = m_iface->tag_set_data(moab_tag, points, field);
 
   this->m_modified = (rval == ::moab::MB_SUCCESS);
   return this->m_modified;
@@ -1586,16 +1826,16 @@ bool Interface::deletePointField(
   }
 
   // Access the tag associated with the pointsets
-  std::string dTagName = pfTag.name() + std::string("_");
   ::moab::Tag dTag;
-  ::moab::ErrorCode rval = m_iface->tag_get_handle(dTagName.c_str(), dTag);
-  if (rval != ::moab::MB_SUCCESS)
+  smtk::mesh::FieldType type;
+  int dimension;
+  if (!detail::findFieldDataTag(m_iface.get(), pfTag.name(), dTag, type, dimension))
   {
     return false;
   }
 
   // Delete the data from the pointsets
-  rval = m_iface->tag_delete_data(dTag, points);
+  ::moab::ErrorCode rval = m_iface->tag_delete_data(dTag, points);
   if (rval != ::moab::MB_SUCCESS)
   {
     return false;
@@ -1762,6 +2002,7 @@ void Interface::pointForEach(const HandleRange& points, smtk::mesh::PointForEach
       if (shouldBeSaved)
       {
         //save t
+        this->clearExtentCache();
         m_iface->set_coords(subset, &coords[0]);
       }
       start += numPointsPerLoop;
@@ -1786,6 +2027,7 @@ void Interface::pointForEach(const HandleRange& points, smtk::mesh::PointForEach
     if (shouldBeSaved)
     {
       //save t
+      this->clearExtentCache();
       m_iface->set_coords(subset, &coords[0]);
     }
   }
@@ -1857,6 +2099,9 @@ bool Interface::deleteHandles(const smtk::mesh::HandleRange& toDel)
     return true;
   }
 
+  //deleted handles may be reused, so forget any extents keyed by them
+  this->clearExtentCache();
+
   //step 2. verify HandleRange doesn't contain root Handle
   if (toDel.front() == this->getRoot())
   {
@@ -1872,6 +2117,8 @@ bool Interface::deleteHandles(const smtk::mesh::HandleRange& toDel)
     //first remove any model entity relation-ship these meshes have
     tag::QueryEntRefTag mtag(this->moabInterface());
     m_iface->tag_delete_data(mtag.moabTag(), toDel);
+    tag::QueryEntRefKeyTag ktag(this->moabInterface());
+    m_iface->tag_delete_data(ktag.moabTag(), toDel);
 
     //we are all moab entity sets, fine to delete
     const ::moab::ErrorCode rval = m_iface->delete_entities(toDel);
@@ -1882,6 +2129,8 @@ bool Interface::deleteHandles(const smtk::mesh::HandleRange& toDel)
     //first remove any model entity relation-ship these cells have
     tag::QueryEntRefTag mtag(this->moabInterface());
     m_iface->tag_delete_data(mtag.moabTag(), toDel);
+    tag::QueryEntRefKeyTag ktag(this->moabInterface());
+    m_iface->tag_delete_data(ktag.moabTag(), toDel);
 
     //for now we are going to avoid deleting any vertex
     smtk::mesh::HandleRange vertCells = toDel.subset_by_dimension(0);
@@ -187,6 +187,9 @@ public:
   //xyz needs to be allocated to 3*points.size()
   bool setCoordinates(const smtk::mesh::HandleRange& points, const float* const xyz) override;
 
+  //reduces over moab's coordinate storage in place, in parallel for large ranges
+  std::array<double, 6> computeExtent(const smtk::mesh::HandleRange& points) const override;
+
   std::vector<std::string> computeNames(const smtk::mesh::HandleRange& meshsets) const override;
 
   std::vector<smtk::mesh::Domain> computeDomainValues(
@@ -243,10 +246,12 @@ public:
   smtk::common::UUID rootAssociation() const override;
 
   bool createCellField(const smtk::mesh::HandleRange& meshsets, const std::string& name,
-    std::size_t dimension, const double* data) override;
+    std::size_t dimension, smtk::mesh::FieldType type, const void* data) override;
 
   int getCellFieldDimension(const smtk::mesh::CellFieldTag& cfTag) const override;
 
+  smtk::mesh::FieldType getCellFieldType(const smtk::mesh::CellFieldTag& cfTag) const override;
+
   smtk::mesh::HandleRange getMeshsets(
     smtk::mesh::Handle handle, const smtk::mesh::CellFieldTag& cfTag) const override;
 
@@ -254,16 +259,16 @@ public:
     const smtk::mesh::HandleRange& meshsets, const smtk::mesh::CellFieldTag& cfTag) const override;
 
   bool getCellField(const smtk::mesh::HandleRange& meshsets, const smtk::mesh::CellFieldTag& cfTag,
-    double* data) const override;
+    void* data) const override;
 
   bool getField(const smtk::mesh::HandleRange& cells, const smtk::mesh::CellFieldTag& cfTag,
-    double* data) const override;
+    void* data) const override;
 
   bool setField(const smtk::mesh::HandleRange& cells, const smtk::mesh::CellFieldTag& cfTag,
-    const double* const data) override;
+    const void* const data) override;
 
   bool setCellField(const smtk::mesh::HandleRange& meshsets, const smtk::mesh::CellFieldTag& cfTag,
-    const double* const data) override;
+    const void* const data) override;
 
   std::set<smtk::mesh::CellFieldTag> computeCellFieldTags(
     const smtk::mesh::Handle& handle) const override;
@@ -272,10 +277,12 @@ public:
     const smtk::mesh::CellFieldTag& cfTag, const smtk::mesh::HandleRange& meshsets) override;
 
   bool createPointField(const smtk::mesh::HandleRange& meshsets, const std::string& name,
-    std::size_t dimension, const double* data) override;
+    std::size_t dimension, smtk::mesh::FieldType type, const void* data) override;
 
   int getPointFieldDimension(const smtk::mesh::PointFieldTag& pfTag) const override;
 
+  smtk::mesh::FieldType getPointFieldType(const smtk::mesh::PointFieldTag& pfTag) const override;
+
   smtk::mesh::HandleRange getMeshsets(
     smtk::mesh::Handle handle, const smtk::mesh::PointFieldTag& pfTag) const override;
 
@@ -283,16 +290,16 @@ public:
     const smtk::mesh::HandleRange& meshsets, const smtk::mesh::PointFieldTag& pfTag) const override;
 
   bool getPointField(const smtk::mesh::HandleRange& meshsets,
-    const smtk::mesh::PointFieldTag& pfTag, double* data) const override;
+    const smtk::mesh::PointFieldTag& pfTag, void* data) const override;
 
   bool getField(const smtk::mesh::HandleRange& points, const smtk::mesh::PointFieldTag& pfTag,
-    double* data) const override;
+    void* data) const override;
 
   bool setField(const smtk::mesh::HandleRange& points, const smtk::mesh::PointFieldTag& pfTag,
-    const double* const data) override;
+    const void* const data) override;
 
   bool setPointField(const smtk::mesh::HandleRange& meshsets,
-    const smtk::mesh::PointFieldTag& pfTag, const double* const data) override;
+    const smtk::mesh::PointFieldTag& pfTag, const void* const data) override;
 
   std::set<smtk::mesh::PointFieldTag> computePointFieldTags(
     const smtk::mesh::Handle& handle) const override;
@@ -328,6 +335,19 @@ public:
 
   ::moab::Interface* moabInterface() const;
 
+  //MOAB can only read the subset of a file whose meshsets match given values
+  //of an integer tag. So that readers can load just the meshsets associated
+  //with chosen model entities, setAssociation also tags meshsets with an
+  //integer key computed from the model entity's UUID. Keys may collide, so
+  //readers must still verify the association of the meshsets they load.
+  static const char* associationKeyTagName();
+  static int associationKey(const smtk::common::UUID& modelUUID);
+
+  //Writers set this integer tag on the root set of files in which every
+  //meshset associated with a model entity carries its key, so that readers
+  //know the meshsets a key read doesn't find are not in the file at all.
+  static const char* fullyKeyedTagName();
+
   void setModifiedState(bool state) override { m_modified = state; }
 
 private:
@@ -20,8 +20,16 @@
 SMTK_THIRDPARTY_PRE_INCLUDE
 #include "moab/Core.hpp"
 #include "moab/FileOptions.hpp"
+#include "moab/ReaderIface.hpp"
 SMTK_THIRDPARTY_POST_INCLUDE
 
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <set>
+
 namespace smtk
 {
 namespace mesh
@@ -50,6 +58,20 @@ bool is_valid(const T& t)
   return (!!t && t->isValid());
 }
 
+void remove_sense_sets(::moab::Interface* m_iface)
+{
+  //moab has a concept of "reverse meshes" that are mesh sets that span the same
+  //cells and points as an extant mesh set, but are tagged by "NEUSET_SENSE".
+  //In smtk we handle this concept at the model level, so we filter out meshsets
+  // of this type here.
+  ::moab::Range sense_sets;
+  ::moab::Tag sense_tag;
+  m_iface->tag_get_handle("NEUSET_SENSE", 1, ::moab::MB_TYPE_INTEGER, sense_tag);
+  m_iface->get_entities_by_type_and_tag(
+    0, ::moab::MBENTITYSET, &sense_tag, NULL, 1, sense_sets, ::moab::Interface::UNION);
+  m_iface->delete_entities(sense_sets);
+}
+
 bool moab_load(const smtk::mesh::moab::InterfacePtr& interface, const std::string& path,
   const char* subset_name_to_load)
 {
@@ -104,18 +126,7 @@ bool moab_load(const smtk::mesh::moab::InterfacePtr& interface, const std::strin
   }
 #endif
 
-  //moab has a concept of "reverse meshes" that are mesh sets that span the same
-  //cells and points as an extant mesh set, but are tagged by "NEUSET_SENSE".
-  //In smtk we handle this concept at the model level, so we filter out meshsets
-  // of this type here.
-  {
-    ::moab::Range sense_sets;
-    ::moab::Tag sense_tag;
-    m_iface->tag_get_handle("NEUSET_SENSE", 1, ::moab::MB_TYPE_INTEGER, sense_tag);
-    m_iface->get_entities_by_type_and_tag(
-      0, ::moab::MBENTITYSET, &sense_tag, NULL, 1, sense_sets, ::moab::Interface::UNION);
-    m_iface->delete_entities(sense_sets);
-  }
+  remove_sense_sets(m_iface);
 
   const bool readFromDisk = (err == ::moab::MB_SUCCESS);
   if (readFromDisk)
@@ -126,6 +137,340 @@ bool moab_load(const smtk::mesh::moab::InterfacePtr& interface, const std::strin
   return err == ::moab::MB_SUCCESS;
 }
 
+//The identity of a point read from a file: a key computed from the file's
+//path and the point's id within that file. It is kept in a tag whose name
+//starts with "__", which MOAB's writers skip.
+typedef std::array<long, 2> FileIdentity;
+
+const char* file_identity_tag_name()
+{
+  return "__SMTK_FILE_IDENTITY";
+}
+
+::moab::Tag file_identity_tag(::moab::Interface* m_iface)
+{
+  ::moab::Tag identity = 0;
+  const unsigned flags = ::moab::MB_TAG_CREAT | ::moab::MB_TAG_SPARSE | ::moab::MB_TAG_BYTES;
+  m_iface->tag_get_handle(
+    file_identity_tag_name(), sizeof(FileIdentity), ::moab::MB_TYPE_OPAQUE, identity, flags);
+  return identity;
+}
+
+//Return true when the root set holds the flag writers set on files whose
+//associated meshsets are all indexed by their key.
+bool is_fully_keyed(::moab::Interface* m_iface)
+{
+  ::moab::Tag keyed;
+  int fully_keyed = 0;
+  const ::moab::EntityHandle root = 0;
+  return m_iface->tag_get_handle(smtk::mesh::moab::Interface::fullyKeyedTagName(), 1,
+           ::moab::MB_TYPE_INTEGER, keyed) == ::moab::MB_SUCCESS &&
+    m_iface->tag_get_data(keyed, &root, 1, &fully_keyed) == ::moab::MB_SUCCESS &&
+    fully_keyed == 1;
+}
+
+//Load the meshsets of path associated with the model entities in missing,
+//reading only the sets tagged with one of keys when a key tag is given.
+//Keys may collide and partial reads bring in the sets contained by the ones
+//we asked for, so only the sets whose association is missing are kept (and
+//removed from missing), along with the cells they hold and the points those
+//cells use. Readers that report the file ids of what they load give the kept
+//points their file identity.
+::moab::ErrorCode load_associated_sets(::moab::Core* core, const std::string& path,
+  const char* key_name, std::vector<int>& keys, std::set<smtk::common::UUID>& missing,
+  ::moab::Range& kept_sets)
+{
+  ::moab::Interface* m_iface = core;
+
+  //collect everything we load in a temporary set, so that we can prune it
+  //without touching what the interface already held
+  ::moab::EntityHandle file_set;
+  if (m_iface->create_meshset(::moab::MESHSET_SET, file_set) != ::moab::MB_SUCCESS)
+  {
+    return ::moab::MB_FAILURE;
+  }
+
+  //readers store file ids as longs
+  ::moab::Tag file_id;
+  const unsigned flags = ::moab::MB_TAG_CREAT | ::moab::MB_TAG_SPARSE | ::moab::MB_TAG_BYTES;
+  if (m_iface->tag_get_handle("__SMTK_READ_FILE_ID", sizeof(long), ::moab::MB_TYPE_OPAQUE,
+        file_id, flags) != ::moab::MB_SUCCESS)
+  {
+    m_iface->delete_entities(&file_set, 1);
+    return ::moab::MB_FAILURE;
+  }
+
+  ::moab::ReaderIface::IDTag subset = { key_name, key_name ? &keys[0] : NULL,
+    key_name ? static_cast<int>(keys.size()) : 0 };
+  ::moab::ReaderIface::SubsetList subsets = { &subset, 1, 0, 0 };
+  ::moab::ErrorCode err = core->serial_load_file(
+    path.c_str(), &file_set, ::moab::FileOptions(NULL), key_name ? &subsets : NULL, &file_id);
+#ifndef NDEBUG
+  if (err != ::moab::MB_SUCCESS)
+  {
+    std::string msg;
+    m_iface->get_last_error(msg);
+    std::cerr << msg << std::endl;
+    std::cerr << "failed to load file: " << path << std::endl;
+  }
+#endif
+
+  ::moab::Range loaded;
+  m_iface->get_entities_by_handle(file_set, loaded);
+  m_iface->delete_entities(&file_set, 1);
+
+  ::moab::Range loaded_sets = loaded.subset_by_type(::moab::MBENTITYSET);
+  ::moab::Range found_sets;
+  std::set<smtk::common::UUID> found;
+  ::moab::Tag ent_ref;
+  if (m_iface->tag_get_handle("ENT_REF", smtk::common::UUID::SIZE, ::moab::MB_TYPE_OPAQUE,
+        ent_ref, ::moab::MB_TAG_BYTES) == ::moab::MB_SUCCESS)
+  {
+    unsigned char id[smtk::common::UUID::SIZE];
+    for (::moab::Range::const_iterator i = loaded_sets.begin(); i != loaded_sets.end(); ++i)
+    {
+      const ::moab::EntityHandle set = *i;
+      if (m_iface->tag_get_data(ent_ref, &set, 1, id) == ::moab::MB_SUCCESS)
+      {
+        smtk::common::UUID entity(id, id + smtk::common::UUID::SIZE);
+        if (missing.count(entity) > 0)
+        {
+          found_sets.insert(set);
+          found.insert(entity);
+        }
+      }
+    }
+  }
+  for (auto& entity : found)
+  {
+    missing.erase(entity);
+  }
+
+  ::moab::Range found_cells;
+  for (::moab::Range::const_iterator i = found_sets.begin(); i != found_sets.end(); ++i)
+  {
+    m_iface->get_entities_by_handle(*i, found_cells, true);
+  }
+  ::moab::Range found_points = found_cells.subset_by_type(::moab::MBVERTEX);
+  found_cells = ::moab::subtract(found_cells, found_points);
+  m_iface->get_connectivity(found_cells, found_points);
+
+  ::moab::Range loaded_points = loaded.subset_by_type(::moab::MBVERTEX);
+  ::moab::Range loaded_cells =
+    ::moab::subtract(::moab::subtract(loaded, loaded_sets), loaded_points);
+  m_iface->delete_entities(::moab::subtract(loaded_sets, found_sets));
+  m_iface->delete_entities(::moab::subtract(loaded_cells, found_cells));
+  m_iface->delete_entities(::moab::subtract(loaded_points, found_points));
+
+  //points whose reader reported no file id keep no identity, and so are
+  //never merged with another point
+  ::moab::Range identified;
+  m_iface->get_entities_by_type_and_tag(
+    0, ::moab::MBVERTEX, &file_id, NULL, 1, identified, ::moab::Interface::UNION);
+  identified = ::moab::intersect(identified, found_points);
+  if (!identified.empty())
+  {
+    std::vector<long> ids(identified.size());
+    m_iface->tag_get_data(file_id, identified, &ids[0]);
+    const long path_key = static_cast<long>(std::hash<std::string>()(path));
+    std::vector<FileIdentity> identities(identified.size());
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+      identities[i][0] = path_key;
+      identities[i][1] = ids[i];
+    }
+    m_iface->tag_set_data(file_identity_tag(m_iface), identified, &identities[0]);
+  }
+  m_iface->tag_delete(file_id);
+
+  kept_sets.merge(found_sets);
+  return err;
+}
+
+//Each read of a file creates its own copy of the points it needs, so meshes
+//read separately would not share the points on their common boundary.
+//Replace every loaded point that is the same point of the same file as one
+//the interface already held by that point, in both the cells and the
+//meshsets using it. Points are matched by their file identity rather than by
+//their coordinates, so that coincident but distinct points stay distinct.
+void merge_loaded_points(::moab::Interface* m_iface, const ::moab::Range& existing_points,
+  const ::moab::Range& kept_sets)
+{
+  ::moab::Tag identity = file_identity_tag(m_iface);
+  ::moab::Range identified;
+  m_iface->get_entities_by_type_and_tag(
+    0, ::moab::MBVERTEX, &identity, NULL, 1, identified, ::moab::Interface::UNION);
+  ::moab::Range loaded_points = ::moab::subtract(identified, existing_points);
+  ::moab::Range held_points = ::moab::intersect(identified, existing_points);
+  if (held_points.empty() || loaded_points.empty())
+  {
+    return;
+  }
+
+  std::vector<FileIdentity> identities(loaded_points.size());
+  m_iface->tag_get_data(identity, loaded_points, &identities[0]);
+  std::map<FileIdentity, ::moab::EntityHandle> loaded_as;
+  std::size_t index = 0;
+  for (::moab::Range::const_iterator i = loaded_points.begin(); i != loaded_points.end();
+       ++i, ++index)
+  {
+    loaded_as[identities[index]] = *i;
+  }
+
+  identities.resize(held_points.size());
+  m_iface->tag_get_data(identity, held_points, &identities[0]);
+  std::map< ::moab::EntityHandle, ::moab::EntityHandle> replacement;
+  ::moab::Range duplicates;
+  index = 0;
+  for (::moab::Range::const_iterator i = held_points.begin(); i != held_points.end();
+       ++i, ++index)
+  {
+    auto match = loaded_as.find(identities[index]);
+    if (match != loaded_as.end() && replacement.insert(std::make_pair(match->second, *i)).second)
+    {
+      duplicates.insert(match->second);
+    }
+  }
+  if (duplicates.empty())
+  {
+    return;
+  }
+
+  ::moab::Range cells;
+  for (int dimension = 1; dimension <= 3; ++dimension)
+  {
+    m_iface->get_adjacencies(duplicates, dimension, false, cells, ::moab::Interface::UNION);
+  }
+  std::vector< ::moab::EntityHandle> connectivity;
+  for (::moab::Range::const_iterator i = cells.begin(); i != cells.end(); ++i)
+  {
+    const ::moab::EntityHandle cell = *i;
+    m_iface->get_connectivity(&cell, 1, connectivity);
+    for (auto& point : connectivity)
+    {
+      auto match = replacement.find(point);
+      if (match != replacement.end())
+      {
+        point = match->second;
+      }
+    }
+    m_iface->set_connectivity(cell, &connectivity[0], static_cast<int>(connectivity.size()));
+  }
+
+  for (::moab::Range::const_iterator i = kept_sets.begin(); i != kept_sets.end(); ++i)
+  {
+    ::moab::Range points;
+    m_iface->get_entities_by_type(*i, ::moab::MBVERTEX, points);
+    points = ::moab::intersect(points, duplicates);
+    if (!points.empty())
+    {
+      ::moab::Range replaced;
+      for (::moab::Range::const_iterator j = points.begin(); j != points.end(); ++j)
+      {
+        replaced.insert(replacement[*j]);
+      }
+      m_iface->remove_entities(*i, points);
+      m_iface->add_entities(*i, replaced);
+    }
+  }
+
+  m_iface->delete_entities(duplicates);
+}
+
+//Load only the meshsets associated with the given model entities, skipping
+//the entities the interface already holds meshsets for.
+bool moab_load_associated(const smtk::mesh::moab::InterfacePtr& interface,
+  const std::string& path, const smtk::common::UUIDArray& entities)
+{
+  ::moab::Interface* m_iface = interface->moabInterface();
+  ::moab::Core* core = dynamic_cast< ::moab::Core*>(m_iface);
+  if (!core)
+  {
+    return false;
+  }
+
+  bool requested = false;
+  std::set<smtk::common::UUID> wanted;
+  std::vector<int> keys;
+  for (auto& entity : entities)
+  {
+    requested |= !!entity;
+    if (entity && interface->findAssociations(interface->getRoot(), entity).empty() &&
+      wanted.insert(entity).second)
+    {
+      keys.push_back(smtk::mesh::moab::Interface::associationKey(entity));
+    }
+  }
+  if (wanted.empty())
+  {
+    //succeed only if everything asked for is already loaded
+    return requested;
+  }
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+  ::moab::Range existing_points;
+  m_iface->get_entities_by_type(0, ::moab::MBVERTEX, existing_points);
+
+  //Forget whether the last file read was fully keyed; reading this one
+  //sets the flag on the root set again if it is.
+  ::moab::Tag keyed;
+  const ::moab::EntityHandle root = 0;
+  if (m_iface->tag_get_handle(smtk::mesh::moab::Interface::fullyKeyedTagName(), 1,
+        ::moab::MB_TYPE_INTEGER, keyed) == ::moab::MB_SUCCESS)
+  {
+    m_iface->tag_delete_data(keyed, &root, 1);
+  }
+
+  //Ask the file which keys it holds, so that we only ask moab to read the
+  //sets that exist. Points the new cells share with ones already loaded
+  //are merged, so meshes read separately still share their points.
+  const char* key_name = smtk::mesh::moab::Interface::associationKeyTagName();
+  std::vector<int> file_keys;
+  ::moab::ErrorCode err = core->serial_read_tag(path.c_str(), key_name, NULL, file_keys);
+  std::set<smtk::common::UUID> missing(wanted);
+  ::moab::Range kept_sets;
+  bool fully_keyed = false;
+  if (err == ::moab::MB_SUCCESS && !file_keys.empty())
+  {
+    std::sort(file_keys.begin(), file_keys.end());
+    std::vector<int> matches;
+    std::set_intersection(keys.begin(), keys.end(), file_keys.begin(), file_keys.end(),
+      std::back_inserter(matches));
+    if (matches.empty())
+    {
+      //none of the entities is keyed in the file; reading one keyed set is
+      //enough to learn whether the file could still hold unkeyed ones
+      matches.push_back(file_keys.front());
+    }
+    err = load_associated_sets(core, path, key_name, matches, missing, kept_sets);
+    merge_loaded_points(m_iface, existing_points, kept_sets);
+    existing_points.clear();
+    m_iface->get_entities_by_type(0, ::moab::MBVERTEX, existing_points);
+    fully_keyed = (err == ::moab::MB_SUCCESS) && is_fully_keyed(m_iface);
+  }
+
+  //Files written before meshsets were keyed (or that mix keyed and unkeyed
+  //meshsets) and formats that can't read a single tag are loaded whole, and
+  //the entities the keys didn't find are looked up by their association.
+  //Files whose writer flagged every associated meshset as keyed can't hold
+  //the missing entities, so they are not read again.
+  if (!missing.empty() && !fully_keyed)
+  {
+    err = load_associated_sets(core, path, NULL, keys, missing, kept_sets);
+    merge_loaded_points(m_iface, existing_points, kept_sets);
+  }
+
+  remove_sense_sets(m_iface);
+
+  if (err == ::moab::MB_SUCCESS)
+  { //if we are loaded from file, we clear the modified flag
+    interface->setModifiedState(false);
+  }
+
+  return err == ::moab::MB_SUCCESS && !kept_sets.empty();
+}
+
 //requires that interface is not a null shared ptr
 smtk::mesh::moab::InterfacePtr load_file(
   smtk::mesh::moab::InterfacePtr interface, const std::string& path, const char* tag_name = NULL)
@@ -155,6 +500,19 @@ smtk::mesh::CollectionPtr read(const std::string& path, const smtk::mesh::Manage
   return verifyAndMake(load_file(smtk::mesh::moab::make_interface(), path), manager);
 }
 
+//construct an interface to a given file. will load only meshes which are
+//associated with the given model entities
+smtk::mesh::CollectionPtr read_associated(const std::string& path,
+  const smtk::mesh::ManagerPtr& manager, const smtk::common::UUIDArray& entities)
+{
+  smtk::mesh::moab::InterfacePtr interface = smtk::mesh::moab::make_interface();
+  if (!moab_load_associated(interface, path, entities))
+  {
+    interface.reset();
+  }
+  return verifyAndMake(interface, manager);
+}
+
 //construct an interface to a given file. will load all meshes inside the
 //file
 smtk::mesh::CollectionPtr read_domain(
@@ -189,6 +547,15 @@ bool import(const std::string& path, const smtk::mesh::CollectionPtr& c)
   return is_valid(c) && append_file(smtk::mesh::moab::extract_interface(c), path);
 }
 
+//Import the meshes in a file associated with the given model entities into an
+//existing collection
+bool import_associated(const std::string& path, const smtk::mesh::CollectionPtr& c,
+  const smtk::common::UUIDArray& entities)
+{
+  return is_valid(c) &&
+    moab_load_associated(smtk::mesh::moab::extract_interface(c), path, entities);
+}
+
 //Import all the domain sets in a file into an existing collection
 bool import_domain(const std::string& path, const smtk::mesh::CollectionPtr& c)
 {
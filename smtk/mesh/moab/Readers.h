@@ -15,6 +15,8 @@
 
 #include "smtk/PublicPointerDefs.h"
 
+#include "smtk/common/UUID.h"
+
 namespace smtk
 {
 namespace mesh
@@ -26,6 +28,15 @@ namespace moab
 //file. If the file given fails to load we will return a invalid Collection
 smtk::mesh::CollectionPtr read(const std::string& path, const smtk::mesh::ManagerPtr& manager);
 
+//construct an interface to a given file. will load only meshes which are
+//associated with the given model entities, along with the cells and points
+//they hold. Files written with keyed associations are read partially; others
+//are read whole and pruned.
+//If no mesh in the file is associated with the given model entities we will
+//return a invalid Collection
+smtk::mesh::CollectionPtr read_associated(const std::string& path,
+  const smtk::mesh::ManagerPtr& manager, const smtk::common::UUIDArray& entities);
+
 //construct an interface to a given file. will load only meshes which are in
 //the material set.
 //file. If the file given fails to load we will return a invalid Collection
@@ -47,6 +58,12 @@ smtk::mesh::CollectionPtr read_dirichlet(
 //Import everything in a file into an existing collection.
 bool import(const std::string& path, const smtk::mesh::CollectionPtr& c);
 
+//Import the meshes in a file associated with the given model entities into an
+//existing collection. Model entities the collection already holds meshes for
+//are skipped, so subsets can be loaded incrementally.
+bool import_associated(const std::string& path, const smtk::mesh::CollectionPtr& c,
+  const smtk::common::UUIDArray& entities);
+
 //Import all the material sets in a file into an existing collection
 bool import_domain(const std::string& path, const smtk::mesh::CollectionPtr& c);
 
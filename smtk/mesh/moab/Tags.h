@@ -19,6 +19,8 @@
 
 #include "smtk/common/UUID.h"
 
+#include "smtk/mesh/core/FieldTypes.h"
+
 #include "MBTagConventions.hpp"
 
 #include <string.h> // for memcpy (opaque tags)
@@ -134,6 +136,30 @@ public:
   }
 };
 
+/// Meshsets associated with a model entity also carry an integer key derived
+/// from the entity's UUID, since MOAB can only read the subset of a file whose
+/// sets match given values of an integer tag.
+class QueryEntRefKeyTag
+{
+  ::moab::Interface* m_iface;
+  ::moab::TagInfo* m_tag;
+
+public:
+  QueryEntRefKeyTag(::moab::Interface* iface)
+  {
+    this->m_iface = iface;
+
+    //populate our tag
+    ::moab::Tag moab_tag;
+    this->m_iface->tag_get_handle(smtk::mesh::moab::Interface::associationKeyTagName(), 1,
+      ::moab::MB_TYPE_INTEGER, moab_tag, ::moab::MB_TAG_CREAT | ::moab::MB_TAG_SPARSE);
+
+    this->m_tag = moab_tag;
+  }
+
+  ::moab::TagInfo* moabTag() { return this->m_tag; }
+};
+
 class QueryDimTag : public QueryIntTag
 {
 public:
@@ -280,7 +306,23 @@ public:
   }
 };
 
-class QueryDoubleTag
+/// The name of the tag holding the values of the field named <name>. MOAB
+/// tags hold doubles and ints natively; floats and 64-bit integers are held
+/// as opaque bytes, with their type recorded in the tag's name.
+inline std::string fieldDataTagName(const std::string& name, smtk::mesh::FieldType type)
+{
+  switch (type)
+  {
+    case smtk::mesh::FieldType::Float:
+      return name + std::string("_float32_");
+    case smtk::mesh::FieldType::Integer64:
+      return name + std::string("_int64_");
+    default:
+      return name + std::string("_");
+  }
+}
+
+class QueryFieldDataTag
 {
   ::moab::Interface* m_iface;
   ::moab::TagInfo* m_tag;
@@ -289,16 +331,28 @@ class QueryDoubleTag
   int m_size;
 
 public:
-  QueryDoubleTag(const char* name, int size, ::moab::Interface* iface)
+  QueryFieldDataTag(
+    const char* name, int size, smtk::mesh::FieldType type, ::moab::Interface* iface)
   {
     this->m_iface = iface;
-    this->m_tag_name = std::string(name) + std::string("_");
+    this->m_tag_name = fieldDataTagName(name, type);
     this->m_size = size;
 
     //populate our tag
     ::moab::Tag moab_tag;
-    this->m_state = this->m_iface->tag_get_handle(this->m_tag_name.c_str(), this->m_size,
-      ::moab::MB_TYPE_DOUBLE, moab_tag, ::moab::MB_TAG_CREAT | ::moab::MB_TAG_DENSE);
+    if (type == smtk::mesh::FieldType::Double || type == smtk::mesh::FieldType::Integer)
+    {
+      this->m_state = this->m_iface->tag_get_handle(this->m_tag_name.c_str(), this->m_size,
+        type == smtk::mesh::FieldType::Double ? ::moab::MB_TYPE_DOUBLE : ::moab::MB_TYPE_INTEGER,
+        moab_tag, ::moab::MB_TAG_CREAT | ::moab::MB_TAG_DENSE);
+    }
+    else
+    {
+      const int bytes = this->m_size * static_cast<int>(smtk::mesh::fieldTypeSize(type));
+      this->m_state = this->m_iface->tag_get_handle(this->m_tag_name.c_str(), bytes,
+        ::moab::MB_TYPE_OPAQUE, moab_tag,
+        ::moab::MB_TAG_BYTES | ::moab::MB_TAG_CREAT | ::moab::MB_TAG_DENSE);
+    }
     this->m_tag = moab_tag;
   }
 
@@ -14,6 +14,8 @@
 
 #include "smtk/mesh/core/Collection.h"
 
+#include "smtk/common/UUID.h"
+
 SMTK_THIRDPARTY_PRE_INCLUDE
 #include "moab/Interface.hpp"
 SMTK_THIRDPARTY_POST_INCLUDE
@@ -33,6 +35,54 @@ bool is_valid(const T& t)
   return (!!t && t->isValid());
 }
 
+//Flag the root set when every meshset of sets that is associated with a
+//model entity is also indexed by its key, and clear the flag otherwise, so
+//that readers only read the whole file when some associated meshset can't be
+//found by its key.
+void flag_fully_keyed(::moab::Interface* m_iface, const ::moab::Range& sets)
+{
+  ::moab::Tag keyed;
+  if (m_iface->tag_get_handle(smtk::mesh::moab::Interface::fullyKeyedTagName(), 1,
+        ::moab::MB_TYPE_INTEGER, keyed,
+        ::moab::MB_TAG_CREAT | ::moab::MB_TAG_SPARSE) != ::moab::MB_SUCCESS)
+  {
+    return;
+  }
+
+  ::moab::Range unkeyed;
+  ::moab::Tag ent_ref;
+  if (m_iface->tag_get_handle("ENT_REF", smtk::common::UUID::SIZE, ::moab::MB_TYPE_OPAQUE,
+        ent_ref, ::moab::MB_TAG_BYTES) == ::moab::MB_SUCCESS)
+  {
+    ::moab::Range associated;
+    m_iface->get_entities_by_type_and_tag(
+      0, ::moab::MBENTITYSET, &ent_ref, NULL, 1, associated, ::moab::Interface::UNION);
+    unkeyed = ::moab::intersect(associated, sets);
+
+    ::moab::Tag key;
+    if (!unkeyed.empty() &&
+      m_iface->tag_get_handle(smtk::mesh::moab::Interface::associationKeyTagName(), 1,
+        ::moab::MB_TYPE_INTEGER, key) == ::moab::MB_SUCCESS)
+    {
+      ::moab::Range keyed_sets;
+      m_iface->get_entities_by_type_and_tag(
+        0, ::moab::MBENTITYSET, &key, NULL, 1, keyed_sets, ::moab::Interface::UNION);
+      unkeyed = ::moab::subtract(unkeyed, keyed_sets);
+    }
+  }
+
+  const ::moab::EntityHandle root = 0;
+  if (unkeyed.empty())
+  {
+    const int fully_keyed = 1;
+    m_iface->tag_set_data(keyed, &root, 1, &fully_keyed);
+  }
+  else
+  {
+    m_iface->tag_delete_data(keyed, &root, 1);
+  }
+}
+
 bool moab_write(const smtk::mesh::moab::InterfacePtr& interface, const std::string& path,
   const char* subset_name_to_write)
 {
@@ -69,6 +119,7 @@ bool moab_write(const smtk::mesh::moab::InterfacePtr& interface, const std::stri
     ::moab::Range entitiesToSave = setsToSave;
     entitiesToSave.merge(entsToSave);
     entitiesToSave.insert(0);
+    flag_fully_keyed(m_iface, entitiesToSave.subset_by_type(::moab::MBENTITYSET));
 
     //write out just the subset. We let the file extension the user specified
     //determine what writer to use.
@@ -81,6 +132,9 @@ bool moab_write(const smtk::mesh::moab::InterfacePtr& interface, const std::stri
   {
     //write out everything. We let the file extension the user specified
     //determine what writer to use.
+    ::moab::Range sets;
+    m_iface->get_entities_by_type(0, ::moab::MBENTITYSET, sets);
+    flag_fully_keyed(m_iface, sets);
     err = m_iface->write_file(path.c_str());
   }
 
@@ -45,6 +45,7 @@ PySharedPtrClass< smtk::mesh::CellField > pybind11_init_smtk_mesh_CellField(py::
     .def("set", (bool (smtk::mesh::CellField::*)(::smtk::mesh::HandleRange const &, double const * const)) &smtk::mesh::CellField::set, py::arg("cellIds"), py::arg("values"))
     .def("set", (bool (smtk::mesh::CellField::*)(double const * const)) &smtk::mesh::CellField::set, py::arg("values"))
     .def("size", &smtk::mesh::CellField::size)
+    .def("type", &smtk::mesh::CellField::type)
     ;
   return instance;
 }
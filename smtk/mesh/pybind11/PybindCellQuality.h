@@ -0,0 +1,52 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef pybind_smtk_mesh_CellQuality_h
+#define pybind_smtk_mesh_CellQuality_h
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "smtk/mesh/utility/CellQuality.h"
+
+namespace py = pybind11;
+
+void pybind11_init_smtk_mesh_CellQualityMetric(py::module &m)
+{
+  py::enum_<smtk::mesh::utility::CellQualityMetric>(m, "CellQualityMetric")
+    .value("MinimumAngle", smtk::mesh::utility::CellQualityMetric::MinimumAngle)
+    .value("MaximumAngle", smtk::mesh::utility::CellQualityMetric::MaximumAngle)
+    .value("AspectRatio", smtk::mesh::utility::CellQualityMetric::AspectRatio)
+    .value("Skewness", smtk::mesh::utility::CellQualityMetric::Skewness)
+    .value("ScaledJacobian", smtk::mesh::utility::CellQualityMetric::ScaledJacobian)
+    .value("Size", smtk::mesh::utility::CellQualityMetric::Size);
+}
+
+void pybind11_init_smtk_mesh_cell_quality(py::module &m)
+{
+  py::class_<smtk::mesh::utility::CellQualityHistogram>(m, "CellQualityHistogram")
+    .def(py::init<>())
+    .def_readwrite("minimum", &smtk::mesh::utility::CellQualityHistogram::minimum)
+    .def_readwrite("maximum", &smtk::mesh::utility::CellQualityHistogram::maximum)
+    .def_readwrite("mean", &smtk::mesh::utility::CellQualityHistogram::mean)
+    .def_readwrite("numberOfCells", &smtk::mesh::utility::CellQualityHistogram::numberOfCells)
+    .def_readwrite("bins", &smtk::mesh::utility::CellQualityHistogram::bins)
+    ;
+  m.def("cellQualityMetricName", &smtk::mesh::utility::cellQualityMetricName, py::arg("metric"));
+  m.def("cellQualityHistogram", &smtk::mesh::utility::cellQualityHistogram, py::arg("values"), py::arg("numberOfBins"));
+  m.def("computeCellQuality", [](smtk::mesh::MeshSet& ms, const std::vector<smtk::mesh::utility::CellQualityMetric>& metrics, std::size_t numberOfBins)
+    {
+      std::vector<smtk::mesh::utility::CellQualityHistogram> histograms;
+      std::vector<smtk::mesh::CellField> fields = smtk::mesh::utility::computeCellQuality(ms, metrics, &histograms, numberOfBins);
+      return std::make_pair(fields, histograms);
+    }, py::arg("ms"), py::arg("metrics"), py::arg("numberOfBins") = 10);
+}
+
+#endif
@@ -0,0 +1,32 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef pybind_smtk_mesh_FieldTypes_h
+#define pybind_smtk_mesh_FieldTypes_h
+
+#include <pybind11/pybind11.h>
+
+#include "smtk/mesh/core/FieldTypes.h"
+
+namespace py = pybind11;
+
+void pybind11_init_smtk_mesh_FieldType(py::module &m)
+{
+  py::enum_<smtk::mesh::FieldType>(m, "FieldType")
+    .value("Double", smtk::mesh::FieldType::Double)
+    .value("Float", smtk::mesh::FieldType::Float)
+    .value("Integer", smtk::mesh::FieldType::Integer)
+    .value("Integer64", smtk::mesh::FieldType::Integer64)
+    .value("MaxFieldType", smtk::mesh::FieldType::MaxFieldType)
+    .export_values();
+  m.def("fieldTypeName", &smtk::mesh::fieldTypeName, py::arg("type"));
+}
+
+#endif
@@ -118,8 +118,8 @@ PySharedPtrClass< smtk::mesh::Interface > pybind11_init_smtk_mesh_Interface(py::
     .def("computeShell", &smtk::mesh::Interface::computeShell, py::arg("meshes"), py::arg("shell"))
     .def("computeTypes", &smtk::mesh::Interface::computeTypes, py::arg("range"))
     .def("connectivityStorage", &smtk::mesh::Interface::connectivityStorage, py::arg("cells"))
-    .def("createCellField", &smtk::mesh::Interface::createCellField, py::arg("meshsets"), py::arg("name"), py::arg("dimension"), py::arg("field"))
-    .def("createPointField", &smtk::mesh::Interface::createPointField, py::arg("meshsets"), py::arg("name"), py::arg("dimension"), py::arg("field"))
+    .def("createCellField", &smtk::mesh::Interface::createCellField, py::arg("meshsets"), py::arg("name"), py::arg("dimension"), py::arg("type"), py::arg("field"))
+    .def("createPointField", &smtk::mesh::Interface::createPointField, py::arg("meshsets"), py::arg("name"), py::arg("dimension"), py::arg("type"), py::arg("field"))
     .def("createMesh", &smtk::mesh::Interface::createMesh, py::arg("cells"), py::arg("meshHandle"))
     .def("deleteCellField", &smtk::mesh::Interface::deleteCellField, py::arg("cfTag"), py::arg("meshsets"))
     .def("deletePointField", &smtk::mesh::Interface::deletePointField, py::arg("cfTag"), py::arg("meshsets"))
@@ -131,10 +131,11 @@ PySharedPtrClass< smtk::mesh::Interface > pybind11_init_smtk_mesh_Interface(py::
     .def("getCells", (smtk::mesh::HandleRange (smtk::mesh::Interface::*)(::smtk::mesh::HandleRange const &, ::smtk::mesh::DimensionType) const) &smtk::mesh::Interface::getCells, py::arg("meshsets"), py::arg("dim"))
     .def("getCoordinates", (bool (smtk::mesh::Interface::*)(::smtk::mesh::HandleRange const &, double *) const) &smtk::mesh::Interface::getCoordinates, py::arg("points"), py::arg("xyz"))
     .def("getCoordinates", (bool (smtk::mesh::Interface::*)(::smtk::mesh::HandleRange const &, float *) const) &smtk::mesh::Interface::getCoordinates, py::arg("points"), py::arg("xyz"))
-    .def("getField", (bool (smtk::mesh::Interface::*)(const smtk::mesh::HandleRange&, const smtk::mesh::CellFieldTag&, double*) const) &smtk::mesh::Interface::getField, py::arg("cells"), py::arg("cfTag"), py::arg("field"))
-    .def("getField", (bool (smtk::mesh::Interface::*)(const smtk::mesh::HandleRange&, const smtk::mesh::PointFieldTag&, double*) const) &smtk::mesh::Interface::getField, py::arg("points"), py::arg("pfTag"), py::arg("field"))
+    .def("getField", (bool (smtk::mesh::Interface::*)(const smtk::mesh::HandleRange&, const smtk::mesh::CellFieldTag&, void*) const) &smtk::mesh::Interface::getField, py::arg("cells"), py::arg("cfTag"), py::arg("field"))
+    .def("getField", (bool (smtk::mesh::Interface::*)(const smtk::mesh::HandleRange&, const smtk::mesh::PointFieldTag&, void*) const) &smtk::mesh::Interface::getField, py::arg("points"), py::arg("pfTag"), py::arg("field"))
     .def("getCellField", &smtk::mesh::Interface::getCellField, py::arg("meshsets"), py::arg("cfTag"), py::arg("field"))
     .def("getCellFieldDimension", &smtk::mesh::Interface::getCellFieldDimension, py::arg("cfTag"))
+    .def("getCellFieldType", &smtk::mesh::Interface::getCellFieldType, py::arg("cfTag"))
     .def("getMeshsets", (smtk::mesh::HandleRange (smtk::mesh::Interface::*)(::smtk::mesh::Handle) const) &smtk::mesh::Interface::getMeshsets, py::arg("handle"))
     .def("getMeshsets", (smtk::mesh::HandleRange (smtk::mesh::Interface::*)(::smtk::mesh::Handle, int) const) &smtk::mesh::Interface::getMeshsets, py::arg("handle"), py::arg("dimension"))
     .def("getMeshsets", (smtk::mesh::HandleRange (smtk::mesh::Interface::*)(::smtk::mesh::Handle, ::std::string const &) const) &smtk::mesh::Interface::getMeshsets, py::arg("handle"), py::arg("name"))
@@ -145,6 +146,7 @@ PySharedPtrClass< smtk::mesh::Interface > pybind11_init_smtk_mesh_Interface(py::
     .def("getMeshsets", (smtk::mesh::HandleRange (smtk::mesh::Interface::*)(::smtk::mesh::Handle, ::smtk::mesh::PointFieldTag const &) const) &smtk::mesh::Interface::getMeshsets, py::arg("handle"), py::arg("pfTag"))
     .def("getPointField", &smtk::mesh::Interface::getPointField, py::arg("meshsets"), py::arg("cfTag"), py::arg("field"))
     .def("getPointFieldDimension", &smtk::mesh::Interface::getPointFieldDimension, py::arg("cfTag"))
+    .def("getPointFieldType", &smtk::mesh::Interface::getPointFieldType, py::arg("cfTag"))
     .def("getPoints", &smtk::mesh::Interface::getPoints, py::arg("cells"), py::arg("boundary_only") = false)
     .def("getRoot", &smtk::mesh::Interface::getRoot)
     .def("hasCellField", &smtk::mesh::Interface::hasCellField, py::arg("meshsets"), py::arg("cfTag"))
@@ -167,8 +169,8 @@ PySharedPtrClass< smtk::mesh::Interface > pybind11_init_smtk_mesh_Interface(py::
     .def("setAssociation", &smtk::mesh::Interface::setAssociation, py::arg("modelUUID"), py::arg("meshsets"))
     .def("setCoordinates", (bool (smtk::mesh::Interface::*)(::smtk::mesh::HandleRange const &, double const * const)) &smtk::mesh::Interface::setCoordinates, py::arg("points"), py::arg("xyz"))
     .def("setCoordinates", (bool (smtk::mesh::Interface::*)(::smtk::mesh::HandleRange const &, float const * const)) &smtk::mesh::Interface::setCoordinates, py::arg("points"), py::arg("xyz"))
-    .def("setField", (bool (smtk::mesh::Interface::*)(const smtk::mesh::HandleRange&, const smtk::mesh::PointFieldTag&, const double* const)) &smtk::mesh::Interface::setField, py::arg("points"), py::arg("pfTag"), py::arg("field"))
-    .def("setField", (bool (smtk::mesh::Interface::*)(const smtk::mesh::HandleRange&, const smtk::mesh::CellFieldTag&, const double* const)) &smtk::mesh::Interface::setField, py::arg("points"), py::arg("pfTag"), py::arg("field"))
+    .def("setField", (bool (smtk::mesh::Interface::*)(const smtk::mesh::HandleRange&, const smtk::mesh::PointFieldTag&, const void* const)) &smtk::mesh::Interface::setField, py::arg("points"), py::arg("pfTag"), py::arg("field"))
+    .def("setField", (bool (smtk::mesh::Interface::*)(const smtk::mesh::HandleRange&, const smtk::mesh::CellFieldTag&, const void* const)) &smtk::mesh::Interface::setField, py::arg("points"), py::arg("pfTag"), py::arg("field"))
     .def("setCellField", &smtk::mesh::Interface::setCellField, py::arg("meshsets"), py::arg("cfTag"), py::arg("field"))
     .def("setDirichlet", &smtk::mesh::Interface::setDirichlet, py::arg("meshsets"), py::arg("dirichlet"))
     .def("setDomain", &smtk::mesh::Interface::setDomain, py::arg("meshsets"), py::arg("domain"))
@@ -23,6 +23,7 @@ template <typename T, typename... Args>
 using PySharedPtrClass = py::class_<T, std::shared_ptr<T>, Args...>;
 
 #include "PybindCellField.h"
+#include "PybindCellQuality.h"
 #include "PybindCellSet.h"
 #include "PybindCellTypes.h"
 #include "PybindCollection.h"
@@ -30,6 +31,7 @@ using PySharedPtrClass = py::class_<T, std::shared_ptr<T>, Args...>;
 #include "PybindDimensionTypes.h"
 #include "PybindExtractMeshConstants.h"
 #include "PybindExtractTessellation.h"
+#include "PybindFieldTypes.h"
 #include "PybindForEachTypes.h"
 #include "PybindHandle.h"
 #include "PybindHandleRange.h"
@@ -69,6 +71,7 @@ PYBIND11_MODULE(_smtkPybindMesh, mesh)
   pybind11_init_std_bidirectional_iterator_tag(moab);
   PySharedPtrClass< smtk::mesh::Allocator > smtk_mesh_Allocator = pybind11_init_smtk_mesh_Allocator(mesh);
   pybind11_init_smtk_mesh_DimensionType(mesh);
+  pybind11_init_smtk_mesh_FieldType(mesh);
   PySharedPtrClass< smtk::mesh::CellForEach > smtk_mesh_CellForEach = pybind11_init_smtk_mesh_CellForEach(mesh);
   PySharedPtrClass< smtk::mesh::CellSet > smtk_mesh_CellSet = pybind11_init_smtk_mesh_CellSet(mesh);
   PySharedPtrClass< smtk::mesh::Collection > smtk_mesh_Collection = pybind11_init_smtk_mesh_Collection(mesh);
@@ -113,6 +116,8 @@ PYBIND11_MODULE(_smtkPybindMesh, mesh)
   pybind11_init__ZN4smtk4mesh19extractTessellationERNS0_17PointConnectivityERKNS0_8PointSetERNS0_24PreAllocatedTessellationE(mesh);
   pybind11_init__ZN4smtk4mesh19extractTessellationERKNS_5model9EntityRefERKNSt3__110shared_ptrINS0_10CollectionEEERKNS0_8PointSetERNS0_24PreAllocatedTessellationE(mesh);
   pybind11_init_smtk_mesh_metrics(mesh);
+  pybind11_init_smtk_mesh_CellQualityMetric(mesh);
+  pybind11_init_smtk_mesh_cell_quality(mesh);
   pybind11_init_smtk_mesh_cell_for_each(mesh);
   pybind11_init_smtk_mesh_mesh_for_each(mesh);
   pybind11_init_smtk_mesh_point_for_each(mesh);
@@ -23,7 +23,9 @@ void pybind11_init_smtk_mesh_metrics(py::module &m)
 {
   m.def("extent", &smtk::mesh::utility::extent);
   m.def("highestDimension", &smtk::mesh::utility::highestDimension);
+  m.def("topologyCounts", &smtk::mesh::utility::topologyCounts, py::arg("ms"), py::arg("boundaryOnly") = false);
   m.def("eulerCharacteristic", &smtk::mesh::utility::eulerCharacteristic);
+  m.def("boundaryEulerCharacteristic", &smtk::mesh::utility::boundaryEulerCharacteristic);
 }
 
 #endif
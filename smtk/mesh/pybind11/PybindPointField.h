@@ -45,6 +45,7 @@ PySharedPtrClass< smtk::mesh::PointField > pybind11_init_smtk_mesh_PointField(py
     .def("set", (bool (smtk::mesh::PointField::*)(::smtk::mesh::HandleRange const &, double const * const)) &smtk::mesh::PointField::set, py::arg("pointIds"), py::arg("values"))
     .def("set", (bool (smtk::mesh::PointField::*)(double const * const)) &smtk::mesh::PointField::set, py::arg("values"))
     .def("size", &smtk::mesh::PointField::size)
+    .def("type", &smtk::mesh::PointField::type)
     ;
   return instance;
 }
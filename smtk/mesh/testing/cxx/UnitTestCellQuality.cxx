@@ -0,0 +1,198 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/core/CellSet.h"
+#include "smtk/mesh/core/Collection.h"
+#include "smtk/mesh/core/Manager.h"
+
+#include "smtk/mesh/moab/Interface.h"
+
+#include "smtk/mesh/utility/CellQuality.h"
+
+#include "smtk/mesh/testing/cxx/helpers.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace smtk::mesh::utility;
+
+namespace
+{
+
+const double tolerance = 1.e-10;
+
+bool close(double a, double b)
+{
+  return std::fabs(a - b) < tolerance * std::max(1., std::fabs(b));
+}
+
+std::vector<CellQualityMetric> allMetrics()
+{
+  std::vector<CellQualityMetric> metrics;
+  for (int m = 0; m < CellQualityMetric_MAX; ++m)
+  {
+    metrics.push_back(static_cast<CellQualityMetric>(m));
+  }
+  return metrics;
+}
+
+// Build a collection holding one cell of \a type with the given corners.
+smtk::mesh::CollectionPtr makeCell(
+  smtk::mesh::ManagerPtr mgr, smtk::mesh::CellType type, const std::vector<double>& xyz)
+{
+  smtk::mesh::CollectionPtr collection = mgr->makeCollection(smtk::mesh::moab::make_interface());
+  smtk::mesh::BufferedCellAllocatorPtr allocator = collection->interface()->bufferedCellAllocator();
+  int numPts = static_cast<int>(xyz.size() / 3);
+  allocator->reserveNumberOfCoordinates(numPts);
+  std::vector<int> conn;
+  for (int i = 0; i < numPts; ++i)
+  {
+    double coords[3] = { xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2] };
+    allocator->setCoordinate(i, coords);
+    conn.push_back(i);
+  }
+  allocator->addCell(type, &conn[0]);
+  allocator->flush();
+  collection->createMesh(smtk::mesh::CellSet(collection, allocator->cells()));
+  return collection;
+}
+
+// Check the metrics of a single cell against the expected values.
+void verify_cell(smtk::mesh::CellType type, const std::vector<double>& xyz,
+  const double (&expected)[CellQualityMetric_MAX], const std::string& label)
+{
+  smtk::mesh::ManagerPtr mgr = smtk::mesh::Manager::create();
+  smtk::mesh::CollectionPtr c = makeCell(mgr, type, xyz);
+  std::vector<std::vector<double> > values;
+  cellQuality(c->cells(), allMetrics(), values);
+  for (int m = 0; m < CellQualityMetric_MAX; ++m)
+  {
+    test(values[m].size() == 1 && close(values[m][0], expected[m]),
+      "Wrong " + cellQualityMetricName(static_cast<CellQualityMetric>(m)) + " for " + label);
+  }
+}
+
+void verify_ideal_cells()
+{
+  const double s3 = std::sqrt(3.);
+  const double tetAngle = std::acos(1. / 3.) * 180. / 3.14159265358979323846;
+
+  {
+    double expected[] = { 60., 60., 1., 0., 1., s3 / 4. };
+    verify_cell(
+      smtk::mesh::Triangle, { 0., 0., 0., 1., 0., 0., 0.5, s3 / 2., 0. }, expected, "triangle");
+  }
+  {
+    double expected[] = { 90., 90., 1., 0., 1., 1. };
+    verify_cell(
+      smtk::mesh::Quad, { 0., 0., 0., 1., 0., 0., 1., 1., 0., 0., 1., 0. }, expected, "quad");
+  }
+  {
+    double expected[] = { tetAngle, tetAngle, 1., 0., 1., std::sqrt(2.) / 12. };
+    verify_cell(smtk::mesh::Tetrahedron,
+      { 0., 0., 0., 1., 0., 0., 0.5, s3 / 2., 0., 0.5, s3 / 6., std::sqrt(2. / 3.) }, expected,
+      "tetrahedron");
+  }
+  {
+    double expected[] = { 90., 90., 1., 0., 1., 1. };
+    verify_cell(smtk::mesh::Hexahedron, { 0., 0., 0., 1., 0., 0., 1., 1., 0., 0., 1., 0., 0., 0.,
+                                          1., 1., 0., 1., 1., 1., 1., 0., 1., 1. },
+      expected, "hexahedron");
+  }
+}
+
+void verify_distorted_cells()
+{
+  {
+    // A right isosceles triangle: R / (2 r) = (1 + sqrt(2)) / 2.
+    double expected[] = { 45., 90., (1. + std::sqrt(2.)) / 2., 0.25, std::sqrt(2. / 3.), 0.5 };
+    verify_cell(smtk::mesh::Triangle, { 0., 0., 0., 1., 0., 0., 0., 1., 0. }, expected,
+      "right triangle");
+  }
+  {
+    // A 2 x 1 rectangle differs from the ideal quad only in its aspect ratio.
+    double expected[] = { 90., 90., 2., 0., 1., 2. };
+    verify_cell(smtk::mesh::Quad, { 0., 0., 0., 2., 0., 0., 2., 1., 0., 0., 1., 0. }, expected,
+      "rectangle");
+  }
+  {
+    // A 2 x 1 x 1 brick, stored inside-out.
+    double expected[] = { 90., 90., 2., 0., -1., -2. };
+    verify_cell(smtk::mesh::Hexahedron, { 0., 0., 0., 0., 1., 0., 2., 1., 0., 2., 0., 0., 0., 0.,
+                                          1., 0., 1., 1., 2., 1., 1., 2., 0., 1. },
+      expected, "inverted brick");
+  }
+}
+
+void verify_fields_and_histograms()
+{
+  // A strip of n quads whose widths grow linearly, plus a line cell whose
+  // quality is not defined.
+  const int n = 10;
+  smtk::mesh::ManagerPtr mgr = smtk::mesh::Manager::create();
+  smtk::mesh::CollectionPtr c = mgr->makeCollection(smtk::mesh::moab::make_interface());
+  smtk::mesh::BufferedCellAllocatorPtr allocator = c->interface()->bufferedCellAllocator();
+  allocator->reserveNumberOfCoordinates(2 * (n + 1));
+  double x = 0.;
+  for (int i = 0; i <= n; ++i)
+  {
+    double lower[3] = { x, 0., 0. };
+    double upper[3] = { x, 1., 0. };
+    allocator->setCoordinate(2 * i, lower);
+    allocator->setCoordinate(2 * i + 1, upper);
+    x += i + 1;
+  }
+  for (int i = 0; i < n; ++i)
+  {
+    int quad[4] = { 2 * i, 2 * i + 2, 2 * i + 3, 2 * i + 1 };
+    allocator->addCell(smtk::mesh::Quad, quad);
+  }
+  int line[2] = { 0, 1 };
+  allocator->addCell(smtk::mesh::Line, line);
+  allocator->flush();
+  smtk::mesh::MeshSet ms = c->createMesh(smtk::mesh::CellSet(c, allocator->cells()));
+
+  std::vector<CellQualityMetric> metrics = { Size, AspectRatio };
+  std::vector<CellQualityHistogram> histograms;
+  std::vector<smtk::mesh::CellField> fields = computeCellQuality(ms, metrics, &histograms, 5);
+  test(fields.size() == 2 && histograms.size() == 2, "Expected a field and histogram per metric");
+
+  // The quads have areas 1, 2, ..., n.
+  test(fields[0].name() == "size" && fields[0].isValid(), "Expected a valid \"size\" field");
+  std::vector<double> areas = fields[0].get();
+  test(areas.size() == static_cast<std::size_t>(n + 1), "Wrong number of field values");
+  test(ms.cellFields().size() == 2, "Expected the fields to be stored on the mesh");
+  std::vector<double> lineArea = fields[0].get(c->cells(smtk::mesh::Line).range());
+  test(lineArea.size() == 1 && std::isnan(lineArea[0]), "Line cells should have no quality");
+
+  const CellQualityHistogram& sizes(histograms[0]);
+  test(sizes.numberOfCells == static_cast<std::size_t>(n), "Line cells should not be counted");
+  test(close(sizes.minimum, 1.) && close(sizes.maximum, n), "Wrong size range");
+  test(close(sizes.mean, (n + 1) / 2.), "Wrong mean size");
+  test(sizes.bins.size() == 5, "Wrong number of bins");
+  for (std::size_t b = 0; b < sizes.bins.size(); ++b)
+  {
+    test(sizes.bins[b] == 2, "Sizes should be evenly distributed");
+  }
+
+  // The aspect ratio of a w x 1 quad is max(w, 1 / w).
+  const CellQualityHistogram& ratios(histograms[1]);
+  test(close(ratios.minimum, 1.) && close(ratios.maximum, n), "Wrong aspect ratio range");
+}
+}
+
+int UnitTestCellQuality(int, char** const)
+{
+  verify_ideal_cells();
+  verify_distorted_cells();
+  verify_fields_and_histograms();
+
+  return 0;
+}
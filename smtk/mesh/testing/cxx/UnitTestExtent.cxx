@@ -0,0 +1,156 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/core/CellSet.h"
+#include "smtk/mesh/core/Collection.h"
+#include "smtk/mesh/core/Manager.h"
+#include "smtk/mesh/core/PointSet.h"
+
+#include "smtk/mesh/moab/Interface.h"
+
+#include "smtk/mesh/utility/ApplyToMesh.h"
+#include "smtk/mesh/utility/Metrics.h"
+
+#include "smtk/mesh/testing/cxx/helpers.h"
+
+#include "moab/Interface.hpp"
+
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+
+// Build an n x n x n grid of hexahedra spanning [0, n]^3 in a single mesh.
+smtk::mesh::CollectionPtr makeGrid(smtk::mesh::ManagerPtr mgr, int n)
+{
+  smtk::mesh::CollectionPtr collection = mgr->makeCollection(smtk::mesh::moab::make_interface());
+  smtk::mesh::BufferedCellAllocatorPtr allocator = collection->interface()->bufferedCellAllocator();
+  allocator->reserveNumberOfCoordinates((n + 1) * (n + 1) * (n + 1));
+  auto id = [n](int i, int j, int k) { return i + (n + 1) * (j + (n + 1) * k); };
+  for (int k = 0; k <= n; ++k)
+  {
+    for (int j = 0; j <= n; ++j)
+    {
+      for (int i = 0; i <= n; ++i)
+      {
+        double xyz[3] = { static_cast<double>(i), static_cast<double>(j),
+          static_cast<double>(k) };
+        allocator->setCoordinate(id(i, j, k), xyz);
+      }
+    }
+  }
+  for (int k = 0; k < n; ++k)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      for (int i = 0; i < n; ++i)
+      {
+        int hex[8] = { id(i, j, k), id(i + 1, j, k), id(i + 1, j + 1, k), id(i, j + 1, k),
+          id(i, j, k + 1), id(i + 1, j, k + 1), id(i + 1, j + 1, k + 1), id(i, j + 1, k + 1) };
+        allocator->addCell(smtk::mesh::Hexahedron, hex);
+      }
+    }
+  }
+  allocator->flush();
+  collection->createMesh(smtk::mesh::CellSet(collection, allocator->cells()));
+  return collection;
+}
+
+void verify_extent(const std::array<double, 6>& extent, const std::array<double, 6>& expected,
+  const std::string& msg)
+{
+  for (std::size_t i = 0; i < 6; ++i)
+  {
+    test(extent[i] == expected[i], msg);
+  }
+}
+
+void verify_extent_and_cache()
+{
+  const int n = 40;
+  smtk::mesh::ManagerPtr mgr = smtk::mesh::Manager::create();
+  smtk::mesh::CollectionPtr c = makeGrid(mgr, n);
+  smtk::mesh::MeshSet ms = c->meshes();
+  const double dn = static_cast<double>(n);
+
+  smtk::mesh::HandleRange cells = ms.cells().range();
+  std::array<double, 6> cached;
+  test(!c->interface()->cachedExtent(cells, cached), "Nothing should be cached yet");
+
+  auto start = std::chrono::steady_clock::now();
+  std::array<double, 6> extent = smtk::mesh::utility::extent(ms);
+  auto mid = std::chrono::steady_clock::now();
+  std::array<double, 6> again = smtk::mesh::utility::extent(ms);
+  auto stop = std::chrono::steady_clock::now();
+  std::cout << "Extent of " << ms.points().size() << " points in "
+            << std::chrono::duration_cast<std::chrono::microseconds>(mid - start).count()
+            << " us, cached in "
+            << std::chrono::duration_cast<std::chrono::microseconds>(stop - mid).count()
+            << " us\n";
+  verify_extent(extent, { { 0., dn, 0., dn, 0., dn } }, "Wrong extent");
+  verify_extent(again, extent, "Cached extent differs");
+  test(c->interface()->cachedExtent(cells, cached), "Expected the extent to be cached");
+
+  // The reduction over coordinate storage matches a copy of the coordinates.
+  std::array<double, 6> direct = c->interface()->computeExtent(ms.points().range());
+  verify_extent(direct, extent, "Direct extent differs");
+  std::array<double, 6> empty = c->interface()->computeExtent(smtk::mesh::HandleRange());
+  test(empty[0] > empty[1], "The extent of no points should be inverted");
+
+  // Warping the points changes the extent and clears the cache.
+  smtk::mesh::utility::applyWarp(
+    [](std::array<double, 3> x) {
+      return std::array<double, 3>{ { 2. * x[0], x[1] - 1., x[2] } };
+    },
+    ms, true);
+  test(!c->interface()->cachedExtent(cells, cached), "Warping should clear the cache");
+  verify_extent(smtk::mesh::utility::extent(ms), { { 0., 2. * dn, -1., dn - 1., 0., dn } },
+    "Wrong extent after warping");
+
+  smtk::mesh::utility::undoWarp(ms);
+  verify_extent(smtk::mesh::utility::extent(ms), { { 0., dn, 0., dn, 0., dn } },
+    "Wrong extent after undoing the warp");
+
+  // So does setting coordinates directly.
+  smtk::mesh::PointSet ps = ms.points();
+  std::vector<double> xyz;
+  ps.get(xyz);
+  xyz[0] = -5.;
+  ps.set(xyz);
+  verify_extent(smtk::mesh::utility::extent(ms), { { -5., dn, 0., dn, 0., dn } },
+    "Wrong extent after setting coordinates");
+
+  // Subsets of the mesh have their own extents.
+  smtk::mesh::HandleRange firstCell;
+  firstCell.insert(ms.cells().range().front());
+  smtk::mesh::MeshSet first = c->createMesh(smtk::mesh::CellSet(c, firstCell));
+  verify_extent(smtk::mesh::utility::extent(first), { { -5., 1., 0., 1., 0., 1. } },
+    "Wrong extent of a single cell");
+  verify_extent(smtk::mesh::utility::extent(ms), { { -5., dn, 0., dn, 0., dn } },
+    "Wrong extent of the whole mesh");
+
+  // Extents are keyed on cells rather than meshsets, so the cached extent
+  // of a meshset's old contents is not returned after its cells change.
+  ::moab::Interface* iface = smtk::mesh::moab::extract_moab_interface(c->interface());
+  ::moab::EntityHandle lastCell = ms.cells().range().back();
+  test(iface->add_entities(first.range().front(), &lastCell, 1) == ::moab::MB_SUCCESS,
+    "Could not add a cell to the mesh");
+  verify_extent(smtk::mesh::utility::extent(first), { { -5., dn, 0., dn, 0., dn } },
+    "Wrong extent after adding a cell");
+}
+}
+
+int UnitTestExtent(int, char** const)
+{
+  verify_extent_and_cache();
+
+  return 0;
+}
@@ -23,6 +23,7 @@
 using namespace boost::filesystem;
 
 #include <cmath>
+#include <cstdint>
 
 namespace
 {
@@ -290,6 +291,59 @@ void verify_incremental_data_assignment()
   }
 }
 
+void verify_typed_pointfields()
+{
+  smtk::mesh::ManagerPtr mngr = smtk::mesh::Manager::create();
+  smtk::mesh::CollectionPtr c = load_mesh(mngr);
+  smtk::mesh::MeshSet mesh = c->meshes(smtk::mesh::Dims2);
+  const std::size_t size = mesh.points().size();
+
+  std::vector<float> floatValues(2 * size);
+  std::vector<int> intValues(size);
+  std::vector<std::int64_t> int64Values(size);
+  for (std::size_t i = 0; i < size; i++)
+  {
+    floatValues[2 * i] = static_cast<float>(i) + 0.5f;
+    floatValues[2 * i + 1] = -static_cast<float>(i);
+    intValues[i] = static_cast<int>(i);
+    int64Values[i] = (static_cast<std::int64_t>(1) << 40) + static_cast<std::int64_t>(i);
+  }
+
+  smtk::mesh::PointField floatField = mesh.createPointField("float data", 2, floatValues);
+  smtk::mesh::PointField intField = mesh.createPointField("int data", 1, intValues);
+  smtk::mesh::PointField int64Field = mesh.createPointField("int64 data", 1, int64Values);
+  test(floatField.isValid() && intField.isValid() && int64Field.isValid(),
+    "typed point fields should be valid");
+  test(floatField.type() == smtk::mesh::FieldType::Float, "field should hold floats");
+  test(intField.type() == smtk::mesh::FieldType::Integer, "field should hold ints");
+  test(int64Field.type() == smtk::mesh::FieldType::Integer64, "field should hold 64-bit ints");
+  test(floatField.dimension() == 2, "typed field has the wrong dimension");
+
+  test(floatField.get<float>() == floatValues, "float values were not preserved");
+  test(intField.get<int>() == intValues, "int values were not preserved");
+  test(int64Field.get<std::int64_t>() == int64Values, "64-bit values were not preserved");
+
+  //values are converted when accessed as another type
+  std::vector<double> asDoubles = floatField.get();
+  for (std::size_t i = 0; i < asDoubles.size(); i++)
+  {
+    test(asDoubles[i] == static_cast<double>(floatValues[i]), "float values were not converted");
+  }
+  test(intField.set(std::vector<double>(size, 3.)), "failed to set int values from doubles");
+  test(intField.get<int>() == std::vector<int>(size, 3), "double values were not converted");
+
+  //a field's name cannot be reused for values of another type
+  test(!mesh.createPointField("int data", 1, std::vector<float>(size)).isValid(),
+    "field names should not be reused across types");
+  test(intField.type() == smtk::mesh::FieldType::Integer, "field type should not change");
+
+  //fields created without data are zeroed
+  smtk::mesh::PointField zeroed =
+    mesh.createPointField("zeroed data", 3, smtk::mesh::FieldType::Integer64);
+  test(zeroed.get<std::int64_t>() == std::vector<std::int64_t>(3 * size, 0),
+    "typed field should be zeroed");
+}
+
 void verify_pointfield_persistency()
 {
   std::string write_path(write_root);
@@ -345,6 +399,54 @@ void verify_pointfield_persistency()
     }
   }
 }
+
+void verify_typed_pointfield_persistency()
+{
+  std::string write_path(write_root);
+  write_path += "/" + smtk::common::UUID::random().toString() + ".h5m";
+
+  std::vector<float> floatValues;
+  std::vector<std::int64_t> int64Values;
+  {
+    smtk::mesh::ManagerPtr mngr = smtk::mesh::Manager::create();
+    smtk::mesh::CollectionPtr c = load_mesh(mngr);
+
+    smtk::mesh::MeshSet one = c->meshes(smtk::mesh::Dims2).subset(0);
+    for (std::size_t i = 0; i < one.points().size(); i++)
+    {
+      floatValues.push_back(static_cast<float>(i) / 3.f);
+      int64Values.push_back(-(static_cast<std::int64_t>(1) << 40) - static_cast<std::int64_t>(i));
+    }
+    one.createPointField("float data", 1, floatValues);
+    one.createPointField("int64 data", 1, int64Values);
+
+    //write out the mesh.
+    smtk::io::WriteMesh write;
+    bool result = write(write_path, c);
+    if (!result)
+    {
+      cleanup(write_path);
+      test(result == true, "failed to properly write out a valid hdf5 collection");
+    }
+  }
+
+  {
+    smtk::mesh::ManagerPtr mngr = smtk::mesh::Manager::create();
+    smtk::io::ReadMesh read;
+    smtk::mesh::CollectionPtr c = read(write_path, mngr);
+
+    //remove the file from disk
+    cleanup(write_path);
+
+    smtk::mesh::MeshSet two = c->meshes(smtk::mesh::Dims2).subset(0);
+    smtk::mesh::PointField floatField = two.pointField("float data");
+    smtk::mesh::PointField int64Field = two.pointField("int64 data");
+    test(floatField.type() == smtk::mesh::FieldType::Float, "float type was not persisted");
+    test(int64Field.type() == smtk::mesh::FieldType::Integer64, "int64 type was not persisted");
+    test(floatField.get<float>() == floatValues, "float values were not persisted");
+    test(int64Field.get<std::int64_t>() == int64Values, "int64 values were not persisted");
+  }
+}
 }
 
 int UnitTestPointField(int, char** const)
@@ -352,7 +454,9 @@ int UnitTestPointField(int, char** const)
   verify_partial_pointfields();
   verify_duplicate_pointfields();
   verify_incremental_data_assignment();
+  verify_typed_pointfields();
   verify_pointfield_persistency();
+  verify_typed_pointfield_persistency();
 
   return 0;
 }
@@ -0,0 +1,233 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/UUID.h"
+#include "smtk/io/ReadMesh.h"
+#include "smtk/io/WriteMesh.h"
+#include "smtk/mesh/core/Collection.h"
+#include "smtk/mesh/core/Manager.h"
+#include "smtk/mesh/moab/Interface.h"
+
+#include "smtk/mesh/testing/cxx/helpers.h"
+
+#include "moab/Interface.hpp"
+
+//force to use filesystem version 3
+#define BOOST_FILESYSTEM_VERSION 3
+#include <boost/filesystem.hpp>
+using namespace boost::filesystem;
+
+namespace
+{
+
+std::string write_root = SMTK_SCRATCH_DIR;
+
+void cleanup(const std::string& file_path)
+{
+  //first verify the file exists
+  ::boost::filesystem::path path(file_path);
+  if (::boost::filesystem::is_regular_file(path))
+  {
+    //remove the file_path if it exists.
+    ::boost::filesystem::remove(path);
+  }
+}
+
+//Write a strip of three quads, each in its own mesh associated with its own
+//model entity. Neighboring quads share an edge. Only the first numKeyed
+//meshes are indexed by their association, so unkeyed and partly keyed strips
+//mimic files written (or appended to) before meshsets were indexed.
+std::string write_strip(const smtk::common::UUIDArray& entities, std::size_t numKeyed)
+{
+  smtk::mesh::ManagerPtr manager = smtk::mesh::Manager::create();
+  smtk::mesh::CollectionPtr collection =
+    manager->makeCollection(smtk::mesh::moab::make_interface());
+  smtk::mesh::IncrementalAllocatorPtr allocator = collection->interface()->incrementalAllocator();
+
+  for (int i = 0; i < 4; ++i)
+  {
+    for (int j = 0; j < 2; ++j)
+    {
+      double xyz[3] = { static_cast<double>(i), static_cast<double>(j), 0. };
+      allocator->addCoordinate(xyz);
+    }
+  }
+  for (int i = 0; i < 3; ++i)
+  {
+    int connectivity[4] = { 2 * i, 2 * i + 2, 2 * i + 3, 2 * i + 1 };
+    test(allocator->addCell(smtk::mesh::Quad, connectivity, 4));
+  }
+  test(allocator->flush());
+
+  ::moab::Interface* iface = smtk::mesh::moab::extract_moab_interface(collection->interface());
+  ::moab::Tag key;
+  iface->tag_get_handle(
+    smtk::mesh::moab::Interface::associationKeyTagName(), 1, ::moab::MB_TYPE_INTEGER, key);
+
+  smtk::mesh::HandleRange cells = allocator->cells();
+  std::size_t index = 0;
+  for (auto cell = cells.begin(); cell != cells.end(); ++cell, ++index)
+  {
+    smtk::mesh::HandleRange single;
+    single.insert(*cell);
+    smtk::mesh::MeshSet mesh = collection->createMesh(smtk::mesh::CellSet(collection, single));
+    test(mesh.setModelEntityId(entities[index]), "failed to associate mesh");
+    if (index >= numKeyed)
+    {
+      const smtk::mesh::Handle set = mesh.range().front();
+      test(iface->tag_delete_data(key, &set, 1) == ::moab::MB_SUCCESS,
+        "failed to remove association key");
+    }
+  }
+
+  std::string write_path(write_root);
+  write_path += "/" + smtk::common::UUID::random().toString() + ".h5m";
+  smtk::io::WriteMesh write;
+  test(write(write_path, collection), "failed to write the strip");
+
+  //only files whose associated meshes are all keyed are flagged as such
+  ::moab::Tag keyed;
+  int fully_keyed = 0;
+  const ::moab::EntityHandle root = 0;
+  const bool flagged = iface->tag_get_handle(smtk::mesh::moab::Interface::fullyKeyedTagName(), 1,
+                         ::moab::MB_TYPE_INTEGER, keyed) == ::moab::MB_SUCCESS &&
+    iface->tag_get_data(keyed, &root, 1, &fully_keyed) == ::moab::MB_SUCCESS && fully_keyed == 1;
+  test(flagged == (numKeyed == entities.size()), "wrong fully keyed flag");
+  return write_path;
+}
+
+//Write two neighboring quads, each in its own mesh associated with its own
+//model entity, that deliberately do not share the points along their
+//common edge.
+std::string write_unshared_pair(const smtk::common::UUIDArray& entities)
+{
+  smtk::mesh::ManagerPtr manager = smtk::mesh::Manager::create();
+  smtk::mesh::CollectionPtr collection =
+    manager->makeCollection(smtk::mesh::moab::make_interface());
+  smtk::mesh::IncrementalAllocatorPtr allocator = collection->interface()->incrementalAllocator();
+
+  for (int i = 0; i < 2; ++i)
+  {
+    const double corners[4][2] = { { 0., 0. }, { 1., 0. }, { 1., 1. }, { 0., 1. } };
+    int connectivity[4];
+    for (int j = 0; j < 4; ++j)
+    {
+      double xyz[3] = { corners[j][0] + i, corners[j][1], 0. };
+      connectivity[j] = static_cast<int>(allocator->addCoordinate(xyz));
+    }
+    test(allocator->addCell(smtk::mesh::Quad, connectivity, 4));
+  }
+  test(allocator->flush());
+
+  smtk::mesh::HandleRange cells = allocator->cells();
+  std::size_t index = 0;
+  for (auto cell = cells.begin(); cell != cells.end(); ++cell, ++index)
+  {
+    smtk::mesh::HandleRange single;
+    single.insert(*cell);
+    smtk::mesh::MeshSet mesh = collection->createMesh(smtk::mesh::CellSet(collection, single));
+    test(mesh.setModelEntityId(entities[index]), "failed to associate mesh");
+  }
+
+  std::string write_path(write_root);
+  write_path += "/" + smtk::common::UUID::random().toString() + ".h5m";
+  smtk::io::WriteMesh write;
+  test(write(write_path, collection), "failed to write the pair");
+  return write_path;
+}
+
+void verify_read_associated(const std::string& path, const smtk::common::UUIDArray& entities)
+{
+  smtk::mesh::ManagerPtr manager = smtk::mesh::Manager::create();
+
+  smtk::common::UUIDArray first(1, entities[0]);
+  smtk::mesh::CollectionPtr c = smtk::io::readAssociated(path, manager, first);
+  test(c->isValid(), "collection should be valid");
+  test(c->numberOfMeshes() == 1, "should only load the associated mesh");
+  test(c->cells().size() == 1, "should only load the associated cells");
+  test(c->points().size() == 4, "should only load the points the cells use");
+  test(c->meshes().modelEntityIds() == first, "loaded the wrong mesh");
+  test(!c->isModified(), "a freshly read collection shouldn't be modified");
+
+  //load the quad next to the first one, and ask for the first quad again
+  smtk::common::UUIDArray more;
+  more.push_back(entities[1]);
+  more.push_back(entities[0]);
+  test(smtk::io::readAssociated(path, c, more), "failed to import more meshes");
+  test(c->numberOfMeshes() == 2, "meshes already loaded shouldn't be loaded again");
+  test(c->cells().size() == 2, "cells already loaded shouldn't be loaded again");
+  test(c->points().size() == 6, "points shared with loaded cells shouldn't be loaded again");
+  test(c->findAssociatedMeshes(entities[0]).points().size() == 4,
+    "the first quad lost its points");
+  test(c->findAssociatedMeshes(entities[1]).points().size() == 4,
+    "the second quad lost its points");
+
+  //the end of the strip shares its points with the second quad
+  more.assign(1, entities[2]);
+  test(smtk::io::readAssociated(path, c, more), "failed to import the last mesh");
+  test(c->numberOfMeshes() == 3, "should load the last mesh");
+  test(c->points().size() == 8, "points shared with loaded cells shouldn't be loaded again");
+
+  //asking only for what is loaded is a successful no-op
+  test(smtk::io::readAssociated(path, c, first), "re-reading a loaded mesh should succeed");
+  test(c->numberOfMeshes() == 3, "re-reading a loaded mesh shouldn't change the collection");
+}
+
+void verify_read_unshared(const std::string& path, const smtk::common::UUIDArray& entities)
+{
+  smtk::mesh::ManagerPtr manager = smtk::mesh::Manager::create();
+
+  smtk::common::UUIDArray first(1, entities[0]);
+  smtk::mesh::CollectionPtr c = smtk::io::readAssociated(path, manager, first);
+  test(c->isValid(), "collection should be valid");
+  test(c->points().size() == 4, "should only load the points the cells use");
+
+  //coincident points that are distinct in the file stay distinct
+  smtk::common::UUIDArray second(1, entities[1]);
+  test(smtk::io::readAssociated(path, c, second), "failed to import the second mesh");
+  test(c->numberOfMeshes() == 2, "should load the second mesh");
+  test(c->points().size() == 8, "distinct points of the file shouldn't be merged");
+}
+
+void verify_read_unassociated(const std::string& path)
+{
+  smtk::mesh::ManagerPtr manager = smtk::mesh::Manager::create();
+
+  smtk::common::UUIDArray missing(1, smtk::common::UUID::random());
+  smtk::mesh::CollectionPtr c = smtk::io::readAssociated(path, manager, missing);
+  test(!c->isValid(), "collection shouldn't be valid");
+  test(manager->numberOfCollections() == 0, "an invalid collection shouldn't be managed");
+}
+}
+
+int UnitTestReadAssociatedMesh(int, char** const)
+{
+  smtk::common::UUIDArray entities;
+  for (int i = 0; i < 3; ++i)
+  {
+    entities.push_back(smtk::common::UUID::random());
+  }
+
+  //every mesh keyed, only the first mesh keyed, and no mesh keyed
+  const std::size_t numKeyed[] = { 3, 1, 0 };
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    std::string path = write_strip(entities, numKeyed[i]);
+    verify_read_associated(path, entities);
+    verify_read_unassociated(path);
+    cleanup(path);
+  }
+
+  std::string path = write_unshared_pair(entities);
+  verify_read_unshared(path, entities);
+  cleanup(path);
+
+  return 0;
+}
@@ -146,6 +146,31 @@ void verify_large_number_of_values_handle()
   smtk::mesh::HandleRange result = smtk::mesh::from_json(json);
   test(result == range, "mixed cell set handle didn't serialize properly");
 }
+
+void verify_range_set_conversion()
+{
+  smtk::mesh::HandleRange range;
+  range.insert(to_handle(::moab::MBENTITYSET, 1), to_handle(::moab::MBENTITYSET, 45));
+  range.insert(to_handle(::moab::MBENTITYSET, 100));
+  range.insert(to_handle(::moab::MBHEX, 0), to_handle(::moab::MBHEX, 8388607));
+
+  //runs of handles are converted without expanding them
+  smtk::common::RangeSet<smtk::mesh::Handle> values =
+    smtk::mesh::to_rangeSet<smtk::mesh::Handle>(range);
+  test(values.numberOfRanges() == 3, "handle runs were not preserved");
+  test(values.size() == range.size(), "handle range converted to the wrong number of values");
+
+  smtk::mesh::HandleRange result = smtk::mesh::from_rangeSet(values);
+  test(result == range, "handle range didn't survive conversion to a range set");
+
+  //cell indices, as held by mesh selections, convert the same way
+  smtk::common::RangeSet<int> indices;
+  indices.insert(3, 9);
+  indices.insert(20);
+  result = smtk::mesh::from_rangeSet(indices);
+  test(result.size() == 8 && result.psize() == 2, "cell indices converted incorrectly");
+  test(smtk::mesh::to_rangeSet<int>(result) == indices, "cell indices didn't round trip");
+}
 }
 
 int UnitTestReadWriteHandles(int, char** const)
@@ -157,5 +182,7 @@ int UnitTestReadWriteHandles(int, char** const)
   verify_mixed_handle();
 
   verify_large_number_of_values_handle();
+
+  verify_range_set_conversion();
   return 0;
 }
@@ -0,0 +1,178 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/core/CellSet.h"
+#include "smtk/mesh/core/Collection.h"
+#include "smtk/mesh/core/Manager.h"
+
+#include "smtk/mesh/moab/Interface.h"
+
+#include "smtk/mesh/utility/Metrics.h"
+
+#include "smtk/mesh/testing/cxx/helpers.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+
+enum GridCells
+{
+  Hexahedra,
+  Tetrahedra,
+  Quads
+};
+
+// Build an n x n x n grid of cells (or an n x n grid of quads). When
+// withHole is true, the column of cells through the middle is omitted.
+smtk::mesh::CollectionPtr makeGrid(
+  smtk::mesh::ManagerPtr mgr, int n, GridCells cellType, bool withHole)
+{
+  smtk::mesh::CollectionPtr collection = mgr->makeCollection(smtk::mesh::moab::make_interface());
+  smtk::mesh::BufferedCellAllocatorPtr allocator = collection->interface()->bufferedCellAllocator();
+
+  int nz = cellType == Quads ? 0 : n;
+  allocator->reserveNumberOfCoordinates((n + 1) * (n + 1) * (nz + 1));
+  auto id = [n](int i, int j, int k) { return i + (n + 1) * (j + (n + 1) * k); };
+  for (int k = 0; k <= nz; ++k)
+  {
+    for (int j = 0; j <= n; ++j)
+    {
+      for (int i = 0; i <= n; ++i)
+      {
+        double xyz[3] = { static_cast<double>(i), static_cast<double>(j),
+          static_cast<double>(k) };
+        allocator->setCoordinate(id(i, j, k), xyz);
+      }
+    }
+  }
+
+  for (int k = 0; k < std::max(nz, 1); ++k)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      for (int i = 0; i < n; ++i)
+      {
+        if (withHole && i == n / 2 && j == n / 2)
+        {
+          continue;
+        }
+        if (cellType == Quads)
+        {
+          int quad[4] = { id(i, j, 0), id(i + 1, j, 0), id(i + 1, j + 1, 0), id(i, j + 1, 0) };
+          allocator->addCell(smtk::mesh::Quad, quad);
+          continue;
+        }
+        int corner[8] = { id(i, j, k), id(i + 1, j, k), id(i + 1, j + 1, k), id(i, j + 1, k),
+          id(i, j, k + 1), id(i + 1, j, k + 1), id(i + 1, j + 1, k + 1), id(i, j + 1, k + 1) };
+        if (cellType == Hexahedra)
+        {
+          allocator->addCell(smtk::mesh::Hexahedron, corner);
+          continue;
+        }
+        // Split each cube into 6 tetrahedra along its main diagonal so that
+        // neighboring cubes share triangles.
+        const int steps[6][2] = { { 1, 2 }, { 1, 4 }, { 2, 1 }, { 2, 4 }, { 4, 1 }, { 4, 2 } };
+        const int bit[8] = { 0, 1, 3, 2, 4, 5, 7, 6 };
+        for (int t = 0; t < 6; ++t)
+        {
+          int a = steps[t][0];
+          int b = a | steps[t][1];
+          int tet[4] = { corner[bit[0]], corner[bit[a]], corner[bit[b]], corner[bit[7]] };
+          allocator->addCell(smtk::mesh::Tetrahedron, tet);
+        }
+      }
+    }
+  }
+  allocator->flush();
+  collection->createMesh(smtk::mesh::CellSet(collection, allocator->cells()));
+  return collection;
+}
+
+void verify_hex_counts()
+{
+  smtk::mesh::ManagerPtr mgr = smtk::mesh::Manager::create();
+  const std::size_t n = 6;
+  smtk::mesh::CollectionPtr c = makeGrid(mgr, static_cast<int>(n), Hexahedra, false);
+  std::size_t numCells = c->cells().size();
+  std::size_t numMeshes = c->meshes().size();
+
+  std::array<std::size_t, 4> counts = smtk::mesh::utility::topologyCounts(c->meshes());
+  test(counts[0] == (n + 1) * (n + 1) * (n + 1), "Wrong number of points");
+  test(counts[1] == 3 * n * (n + 1) * (n + 1), "Wrong number of edges");
+  test(counts[2] == 3 * n * n * (n + 1), "Wrong number of faces");
+  test(counts[3] == n * n * n, "Wrong number of volumes");
+
+  std::array<std::size_t, 4> boundary = smtk::mesh::utility::topologyCounts(c->meshes(), true);
+  test(boundary[0] == (n + 1) * (n + 1) * (n + 1) - (n - 1) * (n - 1) * (n - 1),
+    "Wrong number of boundary points");
+  test(boundary[1] == 12 * n * n, "Wrong number of boundary edges");
+  test(boundary[2] == 6 * n * n, "Wrong number of boundary faces");
+  test(boundary[3] == 0, "The boundary has no volumes");
+
+  test(smtk::mesh::utility::eulerCharacteristic(c->meshes()) == 1);
+  test(smtk::mesh::utility::boundaryEulerCharacteristic(c->meshes()) == 2);
+
+  // Counting must not create any cells or meshes.
+  test(c->cells().size() == numCells, "Topology counting created cells");
+  test(c->meshes().size() == numMeshes, "Topology counting created meshes");
+}
+
+void verify_tet_counts()
+{
+  smtk::mesh::ManagerPtr mgr = smtk::mesh::Manager::create();
+  const int n = 24;
+  smtk::mesh::CollectionPtr c = makeGrid(mgr, n, Tetrahedra, false);
+  std::size_t numCells = c->cells().size();
+  test(numCells == static_cast<std::size_t>(6 * n * n * n), "Wrong number of tetrahedra");
+
+  auto start = std::chrono::steady_clock::now();
+  int xi = smtk::mesh::utility::eulerCharacteristic(c->meshes());
+  auto stop = std::chrono::steady_clock::now();
+  std::cout << "Euler characteristic of " << numCells << " tetrahedra in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(stop - start).count()
+            << " ms\n";
+  test(xi == 1, "A solid cube should have an Euler characteristic of 1");
+  test(smtk::mesh::utility::boundaryEulerCharacteristic(c->meshes()) == 2,
+    "The surface of a cube should have an Euler characteristic of 2");
+  test(c->cells().size() == numCells, "Topology counting created cells");
+}
+
+void verify_hole()
+{
+  smtk::mesh::ManagerPtr mgr = smtk::mesh::Manager::create();
+  smtk::mesh::CollectionPtr c = makeGrid(mgr, 5, Tetrahedra, true);
+  test(smtk::mesh::utility::eulerCharacteristic(c->meshes()) == 0,
+    "A solid torus should have an Euler characteristic of 0");
+  int boundary = smtk::mesh::utility::boundaryEulerCharacteristic(c->meshes());
+  test(boundary == 0, "A torus should have an Euler characteristic of 0");
+  // Agree with the skinning approach.
+  test(smtk::mesh::utility::eulerCharacteristic(c->meshes().extractShell()) == boundary);
+
+  smtk::mesh::CollectionPtr quads = makeGrid(mgr, 5, Quads, true);
+  test(smtk::mesh::utility::eulerCharacteristic(quads->meshes()) == 0,
+    "An annulus should have an Euler characteristic of 0");
+  test(smtk::mesh::utility::boundaryEulerCharacteristic(quads->meshes()) == 0,
+    "Two circles should have an Euler characteristic of 0");
+  std::array<std::size_t, 4> counts = smtk::mesh::utility::topologyCounts(quads->meshes(), true);
+  test(counts[0] == 24 && counts[1] == 24, "Wrong number of boundary points or edges");
+}
+}
+
+int UnitTestTopologyCounts(int, char** const)
+{
+  verify_hex_counts();
+  verify_tet_counts();
+  verify_hole();
+
+  return 0;
+}
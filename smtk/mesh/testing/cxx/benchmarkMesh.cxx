@@ -0,0 +1,492 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/io/ExportMesh.h"
+#include "smtk/io/ImportMesh.h"
+#include "smtk/io/ReadMesh.h"
+#include "smtk/io/WriteMesh.h"
+
+#include "smtk/mesh/core/CellField.h"
+#include "smtk/mesh/core/CellSet.h"
+#include "smtk/mesh/core/Collection.h"
+#include "smtk/mesh/core/ForEachTypes.h"
+#include "smtk/mesh/core/Interface.h"
+#include "smtk/mesh/core/Manager.h"
+#include "smtk/mesh/core/MeshSet.h"
+#include "smtk/mesh/core/PointLocator.h"
+#include "smtk/mesh/core/PointSet.h"
+
+#include "smtk/mesh/interpolation/InverseDistanceWeighting.h"
+#include "smtk/mesh/interpolation/PointCloud.h"
+#include "smtk/mesh/interpolation/RadialAverage.h"
+
+#include "smtk/mesh/utility/ApplyToMesh.h"
+#include "smtk/mesh/utility/ExtractTessellation.h"
+
+#include "smtk/model/testing/cxx/helpers.h"
+
+#include "cJSON.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+// Time the hot paths of smtk::mesh on synthetic triangle, tetrahedron and
+// hexahedron collections and report the results as JSON.
+//
+// Usage: benchmarkMesh [cellsPerSide [output.json]]
+//
+// Each collection discretizes the unit square (triangles) or cube (tets and
+// hexes) with cellsPerSide cells along each axis. The domain is split into
+// two meshes at x = 0.5 whose points are allocated separately, so the points
+// on the shared plane are duplicated until mergeCoincidentContactPoints runs.
+// Timings are in seconds. The results go to stdout unless a file is given.
+// The h5m timings are only reported when MOAB is built with HDF5.
+
+using namespace smtk::model::testing;
+
+namespace
+{
+
+//SMTK_SCRATCH_DIR is a define setup by cmake
+std::string write_root = SMTK_SCRATCH_DIR;
+
+// The number of samples along each axis of the point cloud we interpolate from.
+const int cloudSamplesPerSide = 10;
+
+// Report the peak resident set size of the process in megabytes (or -1 if unknown).
+double peakMemoryMB()
+{
+#ifndef _WIN32
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+  {
+#ifdef __APPLE__
+    return usage.ru_maxrss / (1024. * 1024.);
+#else
+    return usage.ru_maxrss / 1024.;
+#endif
+  }
+#endif
+  return -1.;
+}
+
+std::string cellTypeName(smtk::mesh::CellType type)
+{
+  switch (type)
+  {
+    case smtk::mesh::Triangle:
+      return "triangle";
+    case smtk::mesh::Tetrahedron:
+      return "tetrahedron";
+    case smtk::mesh::Hexahedron:
+      return "hexahedron";
+    default:
+      break;
+  }
+  return "unknown";
+}
+
+// Allocate the cells of columns [i0, i1) of a structured grid with n cells per
+// side as a single mesh with its own points, and assign it the given domain.
+smtk::mesh::MeshSet makeBlock(
+  smtk::mesh::CollectionPtr collection, smtk::mesh::CellType type, int n, int i0, int i1, int domain)
+{
+  const bool planar = type == smtk::mesh::Triangle;
+  const int nx = i1 - i0;
+  const int ny = n;
+  const int nz = planar ? 0 : n;
+  const double h = 1. / n;
+
+  smtk::mesh::AllocatorPtr allocator = collection->interface()->allocator();
+
+  std::size_t numPoints = static_cast<std::size_t>(nx + 1) * (ny + 1) * (nz + 1);
+  smtk::mesh::Handle firstVertex;
+  std::vector<double*> coords;
+  allocator->allocatePoints(numPoints, firstVertex, coords);
+
+  std::size_t index = 0;
+  for (int k = 0; k <= nz; ++k)
+  {
+    for (int j = 0; j <= ny; ++j)
+    {
+      for (int i = i0; i <= i1; ++i, ++index)
+      {
+        coords[0][index] = i * h;
+        coords[1][index] = j * h;
+        coords[2][index] = k * h;
+      }
+    }
+  }
+
+  auto pt = [&](int i, int j, int k) {
+    return firstVertex + (i - i0) + static_cast<smtk::mesh::Handle>(nx + 1) * (j + (ny + 1) * k);
+  };
+
+  std::size_t numCells = static_cast<std::size_t>(nx) * ny * (planar ? 2 : nz);
+  if (type == smtk::mesh::Tetrahedron)
+  {
+    numCells *= 6;
+  }
+  const int vertsPerCell = smtk::mesh::verticesPerCell(type);
+  smtk::mesh::HandleRange cellIds;
+  smtk::mesh::Handle* conn;
+  allocator->allocateCells(type, numCells, vertsPerCell, cellIds, conn);
+
+  // The six tetrahedra of a cube that share its main diagonal (0, 6), using
+  // the hexahedron's vertex numbering.
+  static const int kuhn[6][4] = { { 0, 1, 2, 6 }, { 0, 2, 3, 6 }, { 0, 3, 7, 6 }, { 0, 7, 4, 6 },
+    { 0, 4, 5, 6 }, { 0, 5, 1, 6 } };
+
+  smtk::mesh::Handle* c = conn;
+  for (int k = 0; k < (planar ? 1 : nz); ++k)
+  {
+    for (int j = 0; j < ny; ++j)
+    {
+      for (int i = i0; i < i1; ++i)
+      {
+        smtk::mesh::Handle hex[8] = { pt(i, j, k), pt(i + 1, j, k), pt(i + 1, j + 1, k),
+          pt(i, j + 1, k), 0, 0, 0, 0 };
+        if (planar)
+        {
+          *c++ = hex[0];
+          *c++ = hex[1];
+          *c++ = hex[2];
+          *c++ = hex[0];
+          *c++ = hex[2];
+          *c++ = hex[3];
+          continue;
+        }
+        hex[4] = pt(i, j, k + 1);
+        hex[5] = pt(i + 1, j, k + 1);
+        hex[6] = pt(i + 1, j + 1, k + 1);
+        hex[7] = pt(i, j + 1, k + 1);
+        if (type == smtk::mesh::Hexahedron)
+        {
+          for (int v = 0; v < 8; ++v)
+          {
+            *c++ = hex[v];
+          }
+        }
+        else
+        {
+          for (int t = 0; t < 6; ++t)
+          {
+            for (int v = 0; v < 4; ++v)
+            {
+              *c++ = hex[kuhn[t][v]];
+            }
+          }
+        }
+      }
+    }
+  }
+  allocator->connectivityModified(cellIds, vertsPerCell, conn);
+
+  smtk::mesh::MeshSet mesh = collection->createMesh(smtk::mesh::CellSet(collection, cellIds));
+  collection->setDomainOnMeshes(mesh, smtk::mesh::Domain(domain));
+  return mesh;
+}
+
+class SumCoordinates : public smtk::mesh::PointForEach
+{
+public:
+  SumCoordinates()
+    : m_sum(0.)
+  {
+  }
+
+  void forPoints(const smtk::mesh::HandleRange&, std::vector<double>& xyz, bool&) override
+  {
+    for (double value : xyz)
+    {
+      this->m_sum += value;
+    }
+  }
+
+  double m_sum;
+};
+
+class SumCellCoordinates : public smtk::mesh::CellForEach
+{
+public:
+  SumCellCoordinates()
+    : smtk::mesh::CellForEach(true)
+    , m_sum(0.)
+    , m_numCells(0)
+  {
+  }
+
+  void forCell(const smtk::mesh::Handle&, smtk::mesh::CellType, int numPts) override
+  {
+    const std::vector<double>& xyz = this->coordinates();
+    for (int i = 0; i < 3 * numPts; ++i)
+    {
+      this->m_sum += xyz[i];
+    }
+    ++this->m_numCells;
+  }
+
+  double m_sum;
+  std::size_t m_numCells;
+};
+
+// Run every benchmark on one synthetic collection, adding its timings to
+// <result>. Returns false if any operation fails.
+bool benchmark(smtk::mesh::ManagerPtr manager, smtk::mesh::CellType type, int n, cJSON* result)
+{
+  const bool planar = type == smtk::mesh::Triangle;
+  bool ok = true;
+  Timer timer;
+  cJSON* timings = cJSON_CreateObject();
+  auto record = [&](const char* name) { cJSON_AddNumberToObject(timings, name, timer.elapsed()); };
+  auto check = [&](bool condition, const std::string& message) {
+    if (!condition)
+    {
+      std::cerr << cellTypeName(type) << ": " << message << "\n";
+      ok = false;
+    }
+  };
+
+  timer.mark();
+  smtk::mesh::CollectionPtr collection = manager->makeCollection();
+  makeBlock(collection, type, n, 0, n / 2, 1);
+  makeBlock(collection, type, n, n / 2, n, 2);
+  record("generate");
+
+  smtk::mesh::MeshSet meshes = collection->meshes();
+  const std::size_t numCells = collection->cells(planar ? smtk::mesh::Dims2 : smtk::mesh::Dims3)
+                                 .size();
+  const std::size_t numPoints = collection->points().size();
+  cJSON_AddStringToObject(result, "cellType", cellTypeName(type).c_str());
+  cJSON_AddNumberToObject(result, "cells", static_cast<double>(numCells));
+  cJSON_AddNumberToObject(result, "points", static_cast<double>(numPoints));
+
+  // ### for_each over points and cells ###
+  {
+    SumCoordinates sumPoints;
+    timer.mark();
+    smtk::mesh::for_each(collection->points(), sumPoints);
+    record("forEachPoint");
+
+    SumCellCoordinates sumCells;
+    timer.mark();
+    smtk::mesh::for_each(collection->cells(), sumCells);
+    record("forEachCell");
+    check(sumCells.m_numCells == numCells, "for_each visited the wrong number of cells");
+  }
+
+  // ### Tessellation extraction ###
+  {
+    smtk::mesh::utility::Tessellation tess;
+    timer.mark();
+    tess.extract(meshes);
+    record("extractTessellation");
+    check(tess.cellTypes().size() == numCells, "tessellation has the wrong number of cells");
+  }
+
+  // ### Point locator construction and queries ###
+  {
+    smtk::mesh::PointSet points = collection->points();
+    timer.mark();
+    smtk::mesh::PointLocator locator(points);
+    record("pointLocatorBuild");
+
+    std::vector<double> xyz(3 * numPoints);
+    points.get(&xyz[0]);
+    smtk::mesh::PointLocator::LocatorResults results;
+    std::size_t numFound = 0;
+    timer.mark();
+    for (std::size_t i = 0; i < numPoints; ++i)
+    {
+      locator.find(xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2], 0.25 / n, results);
+      numFound += results.pointIds.size();
+    }
+    record("pointLocatorQuery");
+    check(numFound >= numPoints, "point locator queries missed points");
+  }
+
+  // ### Interpolation from a point cloud ###
+  {
+    const int s = cloudSamplesPerSide;
+    std::vector<double> cloudXYZ;
+    std::vector<double> cloudData;
+    for (int k = 0; k < s; ++k)
+    {
+      for (int j = 0; j < s; ++j)
+      {
+        for (int i = 0; i < s; ++i)
+        {
+          double x[3] = { (i + 0.5) / s, (j + 0.5) / s, (k + 0.5) / s };
+          cloudXYZ.insert(cloudXYZ.end(), x, x + 3);
+          cloudData.push_back(std::sin(6. * x[0]) * std::cos(6. * x[1]) + x[2]);
+        }
+      }
+    }
+    smtk::mesh::PointCloud cloud(cloudData.size(), &cloudXYZ[0], &cloudData[0]);
+
+    // The radial average adds the cloud to a collection of its own so that
+    // it does not perturb the collection being measured.
+    smtk::mesh::CollectionPtr cloudCollection = manager->makeCollection();
+    timer.mark();
+    smtk::mesh::RadialAverage radial(cloudCollection, cloud, 1.5 / s);
+    bool applied = smtk::mesh::utility::applyScalarPointField(radial, "radial average", meshes);
+    record("radialAverage");
+    check(applied, "could not apply the radial average");
+    manager->removeCollection(cloudCollection);
+
+    timer.mark();
+    smtk::mesh::InverseDistanceWeighting idw(cloud, 2.);
+    applied = smtk::mesh::utility::applyScalarPointField(idw, "inverse distance", meshes);
+    record("inverseDistanceWeighting");
+    check(applied, "could not apply inverse distance weighting");
+  }
+
+  // ### Cell field access ###
+  {
+    std::vector<double> values(numCells);
+    for (std::size_t i = 0; i < numCells; ++i)
+    {
+      values[i] = static_cast<double>(i);
+    }
+    smtk::mesh::MeshSet cellMeshes = collection->meshes(planar ? smtk::mesh::Dims2
+                                                               : smtk::mesh::Dims3);
+    timer.mark();
+    smtk::mesh::CellField field = cellMeshes.createCellField("benchmark", 1, values);
+    record("cellFieldCreate");
+
+    timer.mark();
+    bool set = field.set(values);
+    record("cellFieldSet");
+
+    timer.mark();
+    std::vector<double> fetched = field.get();
+    record("cellFieldGet");
+    check(set && fetched == values, "cell field values did not round trip");
+  }
+
+#if BENCHMARK_H5M
+  // ### MOAB (h5m) write and read ###
+  {
+    std::string path = write_root + "/benchmarkMesh_" + cellTypeName(type) + ".h5m";
+    timer.mark();
+    bool written = smtk::io::writeMesh(path, collection);
+    record("writeH5M");
+    check(written, "could not write " + path);
+
+    timer.mark();
+    smtk::mesh::CollectionPtr reread = smtk::io::readMesh(path, manager);
+    record("readH5M");
+    check(reread && reread->isValid() && reread->points().size() == numPoints,
+      "could not read " + path);
+    if (reread)
+    {
+      manager->removeCollection(reread);
+    }
+    std::remove(path.c_str());
+  }
+#endif
+
+  // ### XMS export and import ###
+  {
+    std::string path = write_root + "/benchmarkMesh_" + cellTypeName(type) +
+      (planar ? ".2dm" : ".3dm");
+    timer.mark();
+    bool written = smtk::io::exportMesh(path, collection);
+    record("exportXMS");
+    check(written, "could not export " + path);
+
+    timer.mark();
+    smtk::mesh::CollectionPtr imported = smtk::io::importMesh(path, manager);
+    record("importXMS");
+    check(imported && imported->isValid() && imported->cells().size() == numCells,
+      "could not import " + path);
+    if (imported)
+    {
+      manager->removeCollection(imported);
+    }
+    std::remove(path.c_str());
+  }
+
+  // ### Shell extraction ###
+  {
+    timer.mark();
+    smtk::mesh::MeshSet shell = meshes.extractShell();
+    record("extractShell");
+    check(!shell.is_empty(), "shell is empty");
+  }
+
+  // ### Merging the duplicated points on x = 0.5 ###
+  {
+    timer.mark();
+    bool merged = collection->meshes().mergeCoincidentContactPoints();
+    record("mergeCoincidentContactPoints");
+    std::size_t mergedPoints = static_cast<std::size_t>(std::pow(n + 1, planar ? 2 : 3));
+    check(merged && collection->points().size() == mergedPoints,
+      "coincident points were not merged");
+  }
+
+  manager->removeCollection(collection);
+  cJSON_AddItemToObject(result, "timings", timings);
+  return ok;
+}
+}
+
+int main(int argc, char* argv[])
+{
+  int n = argc > 1 ? std::atoi(argv[1]) : 20;
+  if (n < 2)
+  {
+    std::cerr << "Usage: " << argv[0] << " [cellsPerSide [output.json]]\n";
+    return 1;
+  }
+
+  smtk::mesh::ManagerPtr manager = smtk::mesh::Manager::create();
+  cJSON* report = cJSON_CreateObject();
+  cJSON_AddStringToObject(report, "benchmark", "smtk::mesh");
+  cJSON_AddNumberToObject(report, "cellsPerSide", n);
+  cJSON* collections = cJSON_CreateArray();
+  cJSON_AddItemToObject(report, "collections", collections);
+
+  bool ok = true;
+  smtk::mesh::CellType types[] = { smtk::mesh::Triangle, smtk::mesh::Tetrahedron,
+    smtk::mesh::Hexahedron };
+  for (smtk::mesh::CellType type : types)
+  {
+    cJSON* result = cJSON_CreateObject();
+    ok &= benchmark(manager, type, n, result);
+    cJSON_AddItemToArray(collections, result);
+  }
+  cJSON_AddNumberToObject(report, "peakMemoryMB", peakMemoryMB());
+
+  char* json = cJSON_Print(report);
+  if (argc > 2)
+  {
+    std::ofstream file(argv[2]);
+    file << json << "\n";
+    ok &= file.good();
+  }
+  else
+  {
+    std::cout << json << "\n";
+  }
+  free(json);
+  cJSON_Delete(report);
+
+  return ok ? 0 : 1;
+}
@@ -60,12 +60,14 @@ class StoreAndWarpPoints : public smtk::mesh::PointForEach
 {
   const std::function<std::array<double, 3>(std::array<double, 3>)>& m_mapping;
   std::vector<double> m_data;
+  std::size_t m_counter;
 
 public:
   StoreAndWarpPoints(
     const std::function<std::array<double, 3>(std::array<double, 3>)>& mapping, std::size_t nPoints)
     : m_mapping(mapping)
     , m_data(3 * nPoints)
+    , m_counter(0)
   {
   }
 
@@ -79,11 +81,14 @@ public:
     {
       std::copy(&xyz[offset], &xyz[offset] + 3, &x[0]);
 
-      std::copy(std::begin(x), std::end(x), &this->m_data[offset]);
+      // Points are visited in chunks, so <m_counter> tracks the position of
+      // the chunk in the stored coordinates.
+      std::copy(std::begin(x), std::end(x), &this->m_data[this->m_counter + offset]);
 
       f_x = this->m_mapping(x);
       std::copy(std::begin(f_x), std::end(f_x), &xyz[offset]);
     }
+    this->m_counter += offset;
     coordinatesModified = true; //mark we are going to modify the points
   }
 
@@ -93,14 +98,19 @@ public:
 class UndoWarpPoints : public smtk::mesh::PointForEach
 {
   std::vector<double> m_data;
+  std::size_t m_counter;
 
 public:
-  UndoWarpPoints() {}
+  UndoWarpPoints()
+    : m_counter(0)
+  {
+  }
 
   void forPoints(
     const smtk::mesh::HandleRange&, std::vector<double>& xyz, bool& coordinatesModified) override
   {
-    xyz = this->m_data;
+    std::copy(&this->m_data[this->m_counter], &this->m_data[this->m_counter] + xyz.size(), &xyz[0]);
+    this->m_counter += xyz.size();
     coordinatesModified = true;
   }
 
@@ -0,0 +1,523 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/utility/CellQuality.h"
+
+#include "smtk/mesh/core/PointConnectivity.h"
+#include "smtk/mesh/core/PointSet.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace smtk
+{
+namespace mesh
+{
+namespace utility
+{
+
+namespace
+{
+
+// Cells are gathered into batches of at most batchSize cells of one type whose
+// corner coordinates are stored component-wise (x[corner][cell], ...). Each
+// kernel then evaluates every metric with straight-line loops over the cells
+// of a batch, which the compiler is free to vectorize.
+const std::size_t batchSize = 64;
+
+const double radiansToDegrees = 180. / 3.14159265358979323846;
+const double largeValue = std::numeric_limits<double>::max();
+
+struct Batch
+{
+  Batch()
+    : size(0)
+  {
+  }
+
+  std::size_t size;
+  // The position of each cell of the batch in the output arrays.
+  std::size_t index[batchSize];
+  double x[8][batchSize];
+  double y[8][batchSize];
+  double z[8][batchSize];
+  double result[CellQualityMetric_MAX][batchSize];
+};
+
+struct Vec
+{
+  double x, y, z;
+};
+
+inline Vec corner(const Batch& b, int c, std::size_t i)
+{
+  Vec v = { b.x[c][i], b.y[c][i], b.z[c][i] };
+  return v;
+}
+
+inline Vec sub(const Vec& a, const Vec& b)
+{
+  Vec v = { a.x - b.x, a.y - b.y, a.z - b.z };
+  return v;
+}
+
+inline Vec neg(const Vec& a)
+{
+  Vec v = { -a.x, -a.y, -a.z };
+  return v;
+}
+
+inline Vec cross(const Vec& a, const Vec& b)
+{
+  Vec v = { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+  return v;
+}
+
+inline double dot(const Vec& a, const Vec& b)
+{
+  return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+inline double norm(const Vec& a)
+{
+  return std::sqrt(dot(a, a));
+}
+
+inline double det(const Vec& a, const Vec& b, const Vec& c)
+{
+  return dot(a, cross(b, c));
+}
+
+// Divide, mapping degenerate denominators to a large value of the numerator's sign.
+inline double safeDivide(double num, double den)
+{
+  return den > 0. ? num / den : (num < 0. ? -largeValue : largeValue);
+}
+
+// The angle between two vectors in degrees.
+inline double angle(const Vec& a, const Vec& b)
+{
+  double c = safeDivide(dot(a, b), norm(a) * norm(b));
+  return std::acos(std::max(-1., std::min(1., c))) * radiansToDegrees;
+}
+
+inline double skew(double minAngle, double maxAngle, double ideal)
+{
+  return std::max((maxAngle - ideal) / (180. - ideal), (ideal - minAngle) / ideal);
+}
+
+void triangles(Batch& b)
+{
+  const double jacobianScale = 2. / std::sqrt(3.);
+  for (std::size_t i = 0; i < b.size; ++i)
+  {
+    Vec p0 = corner(b, 0, i), p1 = corner(b, 1, i), p2 = corner(b, 2, i);
+    Vec e0 = sub(p1, p0), e1 = sub(p2, p1), e2 = sub(p0, p2);
+    double l0 = norm(e0), l1 = norm(e1), l2 = norm(e2);
+    double twiceArea = norm(cross(e0, e2));
+
+    double a0 = angle(e0, neg(e2));
+    double a1 = angle(neg(e0), e1);
+    double a2 = 180. - a0 - a1;
+    double minAngle = std::min(a0, std::min(a1, a2));
+    double maxAngle = std::max(a0, std::max(a1, a2));
+
+    // R / (2 r) = l0 l1 l2 (l0 + l1 + l2) / (4 (2 A)^2)
+    double radiusRatio = safeDivide(l0 * l1 * l2 * (l0 + l1 + l2), 4. * twiceArea * twiceArea);
+    double maxProduct = std::max(l0 * l1, std::max(l1 * l2, l2 * l0));
+
+    b.result[MinimumAngle][i] = minAngle;
+    b.result[MaximumAngle][i] = maxAngle;
+    b.result[AspectRatio][i] = radiusRatio;
+    b.result[Skewness][i] = skew(minAngle, maxAngle, 60.);
+    // Every corner Jacobian is twice the area, so the smallest relative to
+    // its edges is at the corner between the two longest edges.
+    b.result[ScaledJacobian][i] = jacobianScale * safeDivide(twiceArea, maxProduct);
+    b.result[Size][i] = 0.5 * twiceArea;
+  }
+}
+
+void quads(Batch& b)
+{
+  for (std::size_t i = 0; i < b.size; ++i)
+  {
+    Vec p[4] = { corner(b, 0, i), corner(b, 1, i), corner(b, 2, i), corner(b, 3, i) };
+    Vec normal = cross(sub(p[2], p[0]), sub(p[3], p[1]));
+    double twiceArea = norm(normal);
+
+    double minAngle = 180., maxAngle = 0.;
+    double minJacobian = largeValue;
+    double lmin = largeValue, lmax = 0.;
+    for (int c = 0; c < 4; ++c)
+    {
+      Vec a = sub(p[(c + 1) % 4], p[c]);
+      Vec d = sub(p[(c + 3) % 4], p[c]);
+      double la = norm(a);
+      double ang = angle(a, d);
+      minAngle = std::min(minAngle, ang);
+      maxAngle = std::max(maxAngle, ang);
+      minJacobian =
+        std::min(minJacobian, safeDivide(dot(cross(a, d), normal), la * norm(d) * twiceArea));
+      lmin = std::min(lmin, la);
+      lmax = std::max(lmax, la);
+    }
+
+    b.result[MinimumAngle][i] = minAngle;
+    b.result[MaximumAngle][i] = maxAngle;
+    b.result[AspectRatio][i] = safeDivide(lmax, lmin);
+    b.result[Skewness][i] = skew(minAngle, maxAngle, 90.);
+    b.result[ScaledJacobian][i] = minJacobian;
+    b.result[Size][i] = 0.5 * twiceArea;
+  }
+}
+
+void tetrahedra(Batch& b)
+{
+  const double idealDihedral = std::acos(1. / 3.) * radiansToDegrees;
+  const double jacobianScale = std::sqrt(2.);
+  // The corners of the face opposite each corner.
+  const int faces[4][3] = { { 1, 2, 3 }, { 0, 2, 3 }, { 0, 1, 3 }, { 0, 1, 2 } };
+  for (std::size_t i = 0; i < b.size; ++i)
+  {
+    Vec p[4] = { corner(b, 0, i), corner(b, 1, i), corner(b, 2, i), corner(b, 3, i) };
+    Vec a = sub(p[1], p[0]), c = sub(p[2], p[0]), d = sub(p[3], p[0]);
+    Vec e = sub(p[2], p[1]), f = sub(p[3], p[1]), g = sub(p[3], p[2]);
+    double la = norm(a), lc = norm(c), ld = norm(d);
+    double le = norm(e), lf = norm(f), lg = norm(g);
+    double jacobian = det(a, c, d);
+
+    // Outward face normals scaled by twice the face areas.
+    Vec n[4];
+    double surface = 0.;
+    for (int k = 0; k < 4; ++k)
+    {
+      const Vec& q0 = p[faces[k][0]];
+      n[k] = cross(sub(p[faces[k][1]], q0), sub(p[faces[k][2]], q0));
+      if (dot(n[k], sub(p[k], q0)) > 0.)
+      {
+        n[k] = neg(n[k]);
+      }
+      surface += 0.5 * norm(n[k]);
+    }
+    // Faces k and l share the edge opposite both corners k and l.
+    double minAngle = 180., maxAngle = 0.;
+    for (int k = 0; k < 3; ++k)
+    {
+      for (int l = k + 1; l < 4; ++l)
+      {
+        double dihedral = 180. - angle(n[k], n[l]);
+        minAngle = std::min(minAngle, dihedral);
+        maxAngle = std::max(maxAngle, dihedral);
+      }
+    }
+
+    // R / (3 r) with R = |a^2 (c x d) + c^2 (d x a) + d^2 (a x c)| / (12 V)
+    // and r = 3 V / S.
+    Vec cd = cross(c, d), da = cross(d, a), ac = cross(a, c);
+    Vec num = { la * la * cd.x + lc * lc * da.x + ld * ld * ac.x,
+      la * la * cd.y + lc * lc * da.y + ld * ld * ac.y,
+      la * la * cd.z + lc * lc * da.z + ld * ld * ac.z };
+    double volume = jacobian / 6.;
+    double radiusRatio = safeDivide(norm(num) * surface, 108. * volume * volume);
+
+    double maxProduct =
+      std::max(std::max(la * lc * ld, la * le * lf), std::max(lc * le * lg, ld * lf * lg));
+
+    b.result[MinimumAngle][i] = minAngle;
+    b.result[MaximumAngle][i] = maxAngle;
+    b.result[AspectRatio][i] = radiusRatio;
+    b.result[Skewness][i] = skew(minAngle, maxAngle, idealDihedral);
+    b.result[ScaledJacobian][i] = safeDivide(jacobianScale * jacobian, maxProduct);
+    b.result[Size][i] = volume;
+  }
+}
+
+void hexahedra(Batch& b)
+{
+  // The neighbors of each corner ordered so that their edge vectors form a
+  // right-handed frame for a positively oriented hexahedron.
+  const int neighbors[8][3] = { { 1, 3, 4 }, { 2, 0, 5 }, { 3, 1, 6 }, { 0, 2, 7 }, { 7, 5, 0 },
+    { 4, 6, 1 }, { 5, 7, 2 }, { 6, 4, 3 } };
+  const int edges[12][2] = { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 }, { 4, 5 }, { 5, 6 }, { 6, 7 },
+    { 7, 4 }, { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 } };
+  // The volume is the sum of 6 tetrahedra around the diagonal from corner 0
+  // to corner 6, each walking along one edge in each of the three directions.
+  // Corners are addressed by (x, y, z) bits and tetrahedra walking along an
+  // odd permutation of the axes are inverted.
+  const int bit[8] = { 0, 1, 3, 2, 4, 5, 7, 6 };
+  const int steps[6][2] = { { 1, 2 }, { 2, 4 }, { 4, 1 }, { 1, 4 }, { 2, 1 }, { 4, 2 } };
+  const double signs[6] = { 1., 1., 1., -1., -1., -1. };
+  for (std::size_t i = 0; i < b.size; ++i)
+  {
+    Vec p[8];
+    for (int c = 0; c < 8; ++c)
+    {
+      p[c] = corner(b, c, i);
+    }
+
+    double minAngle = 180., maxAngle = 0.;
+    double minJacobian = largeValue;
+    for (int c = 0; c < 8; ++c)
+    {
+      Vec e1 = sub(p[neighbors[c][0]], p[c]);
+      Vec e2 = sub(p[neighbors[c][1]], p[c]);
+      Vec e3 = sub(p[neighbors[c][2]], p[c]);
+      double a12 = angle(e1, e2), a23 = angle(e2, e3), a31 = angle(e3, e1);
+      minAngle = std::min(minAngle, std::min(a12, std::min(a23, a31)));
+      maxAngle = std::max(maxAngle, std::max(a12, std::max(a23, a31)));
+      minJacobian =
+        std::min(minJacobian, safeDivide(det(e1, e2, e3), norm(e1) * norm(e2) * norm(e3)));
+    }
+
+    double lmin = largeValue, lmax = 0.;
+    for (int k = 0; k < 12; ++k)
+    {
+      double len = norm(sub(p[edges[k][1]], p[edges[k][0]]));
+      lmin = std::min(lmin, len);
+      lmax = std::max(lmax, len);
+    }
+
+    double volume = 0.;
+    for (int t = 0; t < 6; ++t)
+    {
+      int s0 = steps[t][0];
+      int s1 = s0 | steps[t][1];
+      Vec q0 = p[bit[0]];
+      volume += signs[t] *
+        det(sub(p[bit[s0]], q0), sub(p[bit[s1]], q0), sub(p[bit[7]], q0)) / 6.;
+    }
+
+    b.result[MinimumAngle][i] = minAngle;
+    b.result[MaximumAngle][i] = maxAngle;
+    b.result[AspectRatio][i] = safeDivide(lmax, lmin);
+    b.result[Skewness][i] = skew(minAngle, maxAngle, 90.);
+    b.result[ScaledJacobian][i] = minJacobian;
+    b.result[Size][i] = volume;
+  }
+}
+
+typedef void (*Kernel)(Batch&);
+
+class BatchEvaluator
+{
+public:
+  BatchEvaluator(const std::vector<CellQualityMetric>& metrics,
+    std::vector<std::vector<double> >& values)
+    : m_metrics(metrics)
+    , m_values(values)
+    , m_batches(smtk::mesh::CellType_MAX)
+  {
+    for (int t = 0; t < smtk::mesh::CellType_MAX; ++t)
+    {
+      this->m_kernels[t] = nullptr;
+    }
+    this->m_kernels[smtk::mesh::Triangle] = triangles;
+    this->m_kernels[smtk::mesh::Quad] = quads;
+    this->m_kernels[smtk::mesh::Tetrahedron] = tetrahedra;
+    this->m_kernels[smtk::mesh::Hexahedron] = hexahedra;
+  }
+
+  bool supports(smtk::mesh::CellType type, int numPts) const
+  {
+    return this->m_kernels[type] != nullptr && numPts == smtk::mesh::verticesPerCell(type);
+  }
+
+  // Append a cell to the batch of its type, evaluating the batch when full.
+  void add(smtk::mesh::CellType type, std::size_t index, const std::size_t* pointIndices,
+    int numPts, const std::vector<double>& coords)
+  {
+    Batch& b(this->m_batches[type]);
+    std::size_t i = b.size;
+    b.index[i] = index;
+    for (int c = 0; c < numPts; ++c)
+    {
+      const double* xyz = &coords[3 * pointIndices[c]];
+      b.x[c][i] = xyz[0];
+      b.y[c][i] = xyz[1];
+      b.z[c][i] = xyz[2];
+    }
+    if (++b.size == batchSize)
+    {
+      this->evaluate(type);
+    }
+  }
+
+  void flush()
+  {
+    for (int t = 0; t < smtk::mesh::CellType_MAX; ++t)
+    {
+      if (this->m_kernels[t] && this->m_batches[t].size > 0)
+      {
+        this->evaluate(static_cast<smtk::mesh::CellType>(t));
+      }
+    }
+  }
+
+protected:
+  void evaluate(smtk::mesh::CellType type)
+  {
+    Batch& b(this->m_batches[type]);
+    this->m_kernels[type](b);
+    for (std::size_t m = 0; m < this->m_metrics.size(); ++m)
+    {
+      const double* result = b.result[this->m_metrics[m]];
+      std::vector<double>& out(this->m_values[m]);
+      for (std::size_t i = 0; i < b.size; ++i)
+      {
+        out[b.index[i]] = result[i];
+      }
+    }
+    b.size = 0;
+  }
+
+  const std::vector<CellQualityMetric>& m_metrics;
+  std::vector<std::vector<double> >& m_values;
+  Kernel m_kernels[smtk::mesh::CellType_MAX];
+  std::vector<Batch> m_batches;
+};
+}
+
+std::string cellQualityMetricName(CellQualityMetric metric)
+{
+  switch (metric)
+  {
+    case MinimumAngle:
+      return "minimum angle";
+    case MaximumAngle:
+      return "maximum angle";
+    case AspectRatio:
+      return "aspect ratio";
+    case Skewness:
+      return "skewness";
+    case ScaledJacobian:
+      return "scaled jacobian";
+    case Size:
+      return "size";
+    default:
+      break;
+  }
+  return std::string();
+}
+
+CellQualityHistogram::CellQualityHistogram()
+  : minimum(0.)
+  , maximum(0.)
+  , mean(0.)
+  , numberOfCells(0)
+{
+}
+
+CellQualityHistogram cellQualityHistogram(
+  const std::vector<double>& values, std::size_t numberOfBins)
+{
+  CellQualityHistogram hist;
+  hist.bins.assign(std::max(numberOfBins, static_cast<std::size_t>(1)), 0);
+  double sum = 0.;
+  for (auto value : values)
+  {
+    if (!std::isfinite(value))
+    {
+      continue;
+    }
+    if (hist.numberOfCells == 0)
+    {
+      hist.minimum = hist.maximum = value;
+    }
+    hist.minimum = std::min(hist.minimum, value);
+    hist.maximum = std::max(hist.maximum, value);
+    sum += value;
+    ++hist.numberOfCells;
+  }
+  if (hist.numberOfCells == 0)
+  {
+    return hist;
+  }
+  hist.mean = sum / hist.numberOfCells;
+
+  double range = hist.maximum - hist.minimum;
+  std::size_t lastBin = hist.bins.size() - 1;
+  for (auto value : values)
+  {
+    if (!std::isfinite(value))
+    {
+      continue;
+    }
+    std::size_t bin = 0;
+    if (range > 0.)
+    {
+      bin = std::min(
+        static_cast<std::size_t>((value - hist.minimum) / range * hist.bins.size()), lastBin);
+    }
+    ++hist.bins[bin];
+  }
+  return hist;
+}
+
+void cellQuality(const smtk::mesh::CellSet& cells, const std::vector<CellQualityMetric>& metrics,
+  std::vector<std::vector<double> >& values)
+{
+  values.assign(
+    metrics.size(), std::vector<double>(cells.size(), std::numeric_limits<double>::quiet_NaN()));
+  if (cells.is_empty() || metrics.empty())
+  {
+    return;
+  }
+
+  smtk::mesh::PointSet ps = cells.points();
+  std::vector<double> coords;
+  ps.get(coords);
+
+  BatchEvaluator evaluator(metrics, values);
+  smtk::mesh::PointConnectivity pc = cells.pointConnectivity();
+  smtk::mesh::CellType type;
+  int numPts = 0;
+  const smtk::mesh::Handle* pointIds;
+  std::size_t pointIndices[8];
+  std::size_t index = 0;
+  for (pc.initCellTraversal(); pc.fetchNextCell(type, numPts, pointIds); ++index)
+  {
+    if (!evaluator.supports(type, numPts))
+    {
+      continue;
+    }
+    for (int c = 0; c < numPts; ++c)
+    {
+      pointIndices[c] = ps.find(pointIds[c]);
+    }
+    evaluator.add(type, index, pointIndices, numPts, coords);
+  }
+  evaluator.flush();
+}
+
+std::vector<smtk::mesh::CellField> computeCellQuality(smtk::mesh::MeshSet& ms,
+  const std::vector<CellQualityMetric>& metrics, std::vector<CellQualityHistogram>* histograms,
+  std::size_t numberOfBins)
+{
+  std::vector<smtk::mesh::CellField> fields;
+  std::vector<std::vector<double> > values;
+  cellQuality(ms.cells(), metrics, values);
+  if (histograms)
+  {
+    histograms->clear();
+  }
+  for (std::size_t m = 0; m < metrics.size(); ++m)
+  {
+    fields.push_back(ms.createCellField(cellQualityMetricName(metrics[m]), 1, values[m]));
+    if (histograms)
+    {
+      histograms->push_back(cellQualityHistogram(values[m], numberOfBins));
+    }
+  }
+  return fields;
+}
+}
+}
+}
@@ -0,0 +1,96 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef __smtk_mesh_utility_CellQuality_h
+#define __smtk_mesh_utility_CellQuality_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+
+#include "smtk/mesh/core/CellField.h"
+#include "smtk/mesh/core/CellSet.h"
+#include "smtk/mesh/core/MeshSet.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace smtk
+{
+namespace mesh
+{
+namespace utility
+{
+
+// Per-cell quality measures for triangles, quads, tetrahedra and hexahedra.
+//
+// Angles are in degrees: interior angles of triangles and quads, dihedral
+// angles of tetrahedra and the angles between edges at hexahedron corners.
+// The aspect ratio is the normalized radius ratio (circumradius over inradius)
+// of triangles and tetrahedra and the longest over the shortest edge of quads
+// and hexahedra; it is 1 for ideal cells. Skewness is the equiangle skew, 0
+// for ideal cells and 1 for degenerate ones. The scaled Jacobian is the
+// minimum corner Jacobian divided by the lengths of the corner's edges; it is
+// 1 for ideal cells and negative for inverted ones. Size is the area of 2-d
+// cells and the (signed) volume of 3-d cells.
+enum CellQualityMetric
+{
+  MinimumAngle = 0,
+  MaximumAngle = 1,
+  AspectRatio = 2,
+  Skewness = 3,
+  ScaledJacobian = 4,
+  Size = 5,
+  CellQualityMetric_MAX = 6
+};
+
+// Return the name of a metric (e.g., "minimum angle"), which is also the name
+// of the CellField computeCellQuality() stores it in.
+SMTKCORE_EXPORT
+std::string cellQualityMetricName(CellQualityMetric metric);
+
+// A summary of the values of a metric over a set of cells.
+struct SMTKCORE_EXPORT CellQualityHistogram
+{
+  CellQualityHistogram();
+
+  double minimum;
+  double maximum;
+  double mean;
+  // The number of cells of supported types (and thus with a value).
+  std::size_t numberOfCells;
+  // Cell counts in equal-width bins spanning [minimum, maximum].
+  std::vector<std::size_t> bins;
+};
+
+// Compute a histogram of the finite entries of \a values.
+SMTKCORE_EXPORT
+CellQualityHistogram cellQualityHistogram(
+  const std::vector<double>& values, std::size_t numberOfBins);
+
+// Compute the requested metrics for each of \a cells (in the order of their
+// handles). On output, values[i][j] holds metrics[i] for the j-th cell; cells
+// of unsupported types are assigned NaN.
+SMTKCORE_EXPORT
+void cellQuality(const smtk::mesh::CellSet& cells, const std::vector<CellQualityMetric>& metrics,
+  std::vector<std::vector<double> >& values);
+
+// Compute the requested metrics for the cells of \a ms and store each in a
+// CellField named by cellQualityMetricName(). If \a histograms is non-null,
+// it is filled with a histogram of each metric.
+SMTKCORE_EXPORT
+std::vector<smtk::mesh::CellField> computeCellQuality(smtk::mesh::MeshSet& ms,
+  const std::vector<CellQualityMetric>& metrics,
+  std::vector<CellQualityHistogram>* histograms = nullptr, std::size_t numberOfBins = 10);
+}
+}
+}
+
+#endif
@@ -10,9 +10,15 @@
 
 #include "smtk/mesh/utility/Metrics.h"
 
+#include "smtk/mesh/core/CellSet.h"
+#include "smtk/mesh/core/Collection.h"
 #include "smtk/mesh/core/ForEachTypes.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <limits>
+#include <thread>
+#include <vector>
 
 namespace smtk
 {
@@ -23,81 +29,443 @@ namespace utility
 
 std::array<double, 6> extent(const smtk::mesh::MeshSet& ms)
 {
-  class Extent : public smtk::mesh::PointForEach
+  const smtk::mesh::InterfacePtr& iface = ms.collection()->interface();
+  // Gathering the points of a meshset costs about as much as reducing their
+  // coordinates, so the cache is keyed on the (cheaply found) cells instead.
+  smtk::mesh::HandleRange cells = ms.cells().range();
+  std::array<double, 6> values;
+  if (!iface->cachedExtent(cells, values))
   {
-  public:
-    Extent()
-      : smtk::mesh::PointForEach()
+    values = iface->computeExtent(ms.points().range());
+    iface->cacheExtent(cells, values);
+  }
+  return values;
+}
+
+smtk::mesh::DimensionType highestDimension(const smtk::mesh::MeshSet& ms)
+{
+  int highestDimension = smtk::mesh::Dims3;
+  while (ms.cells(static_cast<smtk::mesh::DimensionType>(highestDimension)).is_empty() &&
+    highestDimension >= 0)
+  {
+    --highestDimension;
+  }
+
+  return highestDimension >= 0 ? static_cast<smtk::mesh::DimensionType>(highestDimension)
+                               : smtk::mesh::DimensionType_MAX;
+}
+
+namespace
+{
+// Sub-entities are identified by the indices of their corner points.
+typedef std::uint32_t PointIndex;
+typedef std::uint64_t EdgeKey;
+typedef std::array<PointIndex, 4> FaceKey;
+
+const PointIndex noPoint = std::numeric_limits<PointIndex>::max();
+
+// The edges and faces of each cell type in terms of the cell's corner points.
+// Face corners are listed in cyclic order; triangles are padded with -1.
+struct SubEntities
+{
+  int numEdges;
+  int edges[12][2];
+  int numFaces;
+  int faces[6][4];
+};
+
+const SubEntities subEntities[smtk::mesh::CellType_MAX] = {
+  // Vertex
+  { 0, {}, 0, {} },
+  // Line
+  { 1, { { 0, 1 } }, 0, {} },
+  // Triangle
+  { 3, { { 0, 1 }, { 1, 2 }, { 2, 0 } }, 1, { { 0, 1, 2, -1 } } },
+  // Quad
+  { 4, { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 } }, 1, { { 0, 1, 2, 3 } } },
+  // Polygon (handled separately as its number of corners varies)
+  { 0, {}, 0, {} },
+  // Tetrahedron
+  { 6, { { 0, 1 }, { 1, 2 }, { 2, 0 }, { 0, 3 }, { 1, 3 }, { 2, 3 } }, 4,
+    { { 0, 1, 3, -1 }, { 1, 2, 3, -1 }, { 2, 0, 3, -1 }, { 0, 2, 1, -1 } } },
+  // Pyramid
+  { 8, { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 }, { 0, 4 }, { 1, 4 }, { 2, 4 }, { 3, 4 } }, 5,
+    { { 0, 1, 2, 3 }, { 0, 1, 4, -1 }, { 1, 2, 4, -1 }, { 2, 3, 4, -1 }, { 3, 0, 4, -1 } } },
+  // Wedge
+  { 9, { { 0, 1 }, { 1, 2 }, { 2, 0 }, { 3, 4 }, { 4, 5 }, { 5, 3 }, { 0, 3 }, { 1, 4 },
+         { 2, 5 } },
+    5, { { 0, 1, 2, -1 }, { 3, 4, 5, -1 }, { 0, 1, 4, 3 }, { 1, 2, 5, 4 }, { 2, 0, 3, 5 } } },
+  // Hexahedron
+  { 12, { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 }, { 4, 5 }, { 5, 6 }, { 6, 7 }, { 7, 4 },
+          { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 } },
+    6, { { 0, 1, 2, 3 }, { 4, 5, 6, 7 }, { 0, 1, 5, 4 }, { 1, 2, 6, 5 }, { 2, 3, 7, 6 },
+         { 3, 0, 4, 7 } } },
+};
+
+inline std::uint64_t mix(std::uint64_t x)
+{
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+inline std::uint64_t hashKey(PointIndex key)
+{
+  return mix(key);
+}
+
+inline std::uint64_t hashKey(EdgeKey key)
+{
+  return mix(key);
+}
+
+inline std::uint64_t hashKey(const FaceKey& key)
+{
+  return mix((static_cast<std::uint64_t>(key[0]) << 32 | key[1]) ^
+    mix(static_cast<std::uint64_t>(key[2]) << 32 | key[3]));
+}
+
+inline EdgeKey edgeKey(PointIndex a, PointIndex b)
+{
+  return a < b ? (static_cast<EdgeKey>(a) << 32 | b) : (static_cast<EdgeKey>(b) << 32 | a);
+}
+
+// Rotate and orient a face's cyclic list of corners so it starts at its
+// smallest corner and proceeds toward the smaller neighbor. Either orientation
+// of the same face then yields the same key, and the key still lists the
+// face's corners in cyclic order.
+FaceKey faceKey(const PointIndex* corners, int numCorners)
+{
+  int first = 0;
+  for (int ii = 1; ii < numCorners; ++ii)
+  {
+    if (corners[ii] < corners[first])
     {
-      m_values[0] = m_values[2] = m_values[4] = std::numeric_limits<double>::max();
-      m_values[1] = m_values[3] = m_values[5] = std::numeric_limits<double>::lowest();
+      first = ii;
     }
+  }
+  int step = corners[(first + 1) % numCorners] < corners[(first + numCorners - 1) % numCorners]
+    ? 1
+    : numCorners - 1;
+  FaceKey key = { { noPoint, noPoint, noPoint, noPoint } };
+  for (int ii = 0; ii < numCorners; ++ii)
+  {
+    key[ii] = corners[(first + ii * step) % numCorners];
+  }
+  return key;
+}
+
+// Sub-entity keys emitted by one thread, partitioned by hash so that each
+// partition can be deduplicated independently.
+template <typename Key>
+class Partitions
+{
+public:
+  void resize(std::size_t numThreads, std::size_t numParts)
+  {
+    m_parts.assign(numThreads, std::vector<std::vector<Key> >(numParts));
+  }
+
+  void emit(std::size_t thread, const Key& key)
+  {
+    std::vector<std::vector<Key> >& parts(m_parts[thread]);
+    parts[hashKey(key) % parts.size()].push_back(key);
+  }
+
+  // Count the distinct keys. If \a singles is non-null, also collect
+  // the keys that were emitted exactly once.
+  std::size_t countUnique(std::size_t numThreads, std::vector<Key>* singles);
+
+  std::vector<std::vector<std::vector<Key> > > m_parts;
+};
+
+// Run body(thread, begin, end) over numThreads contiguous chunks of [0, count).
+template <typename Body>
+void parallelFor(std::size_t count, std::size_t numThreads, Body body)
+{
+  if (numThreads <= 1)
+  {
+    body(0, 0, count);
+    return;
+  }
+  std::vector<std::thread> threads;
+  std::size_t chunk = (count + numThreads - 1) / numThreads;
+  for (std::size_t tt = 0; tt < numThreads; ++tt)
+  {
+    std::size_t begin = std::min(count, tt * chunk);
+    std::size_t end = std::min(count, begin + chunk);
+    threads.push_back(std::thread(body, tt, begin, end));
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+}
 
-    void forPoints(const smtk::mesh::HandleRange&, std::vector<double>& xyz, bool&) override
+template <typename Key>
+std::size_t Partitions<Key>::countUnique(std::size_t numThreads, std::vector<Key>* singles)
+{
+  std::size_t numParts = m_parts.empty() ? 0 : m_parts[0].size();
+  std::vector<std::size_t> uniqueCounts(numParts, 0);
+  std::vector<std::vector<Key> > singleParts(numParts);
+  parallelFor(numParts, numThreads, [&](std::size_t, std::size_t begin, std::size_t end) {
+    for (std::size_t pp = begin; pp < end; ++pp)
     {
-      for (std::size_t i = 0; i < xyz.size(); i += 3)
+      std::size_t total = 0;
+      for (auto& parts : m_parts)
+      {
+        total += parts[pp].size();
+      }
+      std::vector<Key> keys;
+      keys.reserve(total);
+      for (auto& parts : m_parts)
+      {
+        keys.insert(keys.end(), parts[pp].begin(), parts[pp].end());
+        std::vector<Key>().swap(parts[pp]);
+      }
+      std::sort(keys.begin(), keys.end());
+      for (auto it = keys.begin(); it != keys.end();)
       {
-        for (std::size_t j = 0; j < 3; j++)
+        auto next = std::upper_bound(it, keys.end(), *it);
+        ++uniqueCounts[pp];
+        if (singles && next - it == 1)
         {
-          if (xyz[i + j] < this->m_values[2 * j])
-          {
-            this->m_values[2 * j] = xyz[i + j];
-          }
-          if (xyz[i + j] > this->m_values[2 * j + 1])
-          {
-            this->m_values[2 * j + 1] = xyz[i + j];
-          }
+          singleParts[pp].push_back(*it);
         }
+        it = next;
       }
     }
+  });
 
-    std::array<double, 6> m_values;
-  };
-
-  Extent extent;
-  smtk::mesh::for_each(ms.points(), extent);
-  return extent.m_values;
+  std::size_t result = 0;
+  for (std::size_t pp = 0; pp < numParts; ++pp)
+  {
+    result += uniqueCounts[pp];
+    if (singles)
+    {
+      singles->insert(singles->end(), singleParts[pp].begin(), singleParts[pp].end());
+    }
+  }
+  return result;
 }
 
-smtk::mesh::DimensionType highestDimension(const smtk::mesh::MeshSet& ms)
+// Gather the corner points of cells without their coordinates.
+class CornerCollector : public smtk::mesh::CellForEach
 {
-  int highestDimension = smtk::mesh::Dims3;
-  while (ms.cells(static_cast<smtk::mesh::DimensionType>(highestDimension)).is_empty() &&
-    highestDimension >= 0)
+public:
+  CornerCollector()
+    : smtk::mesh::CellForEach(false)
   {
-    --highestDimension;
+    m_offsets.push_back(0);
   }
 
-  return highestDimension >= 0 ? static_cast<smtk::mesh::DimensionType>(highestDimension)
-                               : smtk::mesh::DimensionType_MAX;
+  void forCell(const smtk::mesh::Handle&, smtk::mesh::CellType cellType, int numPointIds) override
+  {
+    // Higher-order cells list their corner points first.
+    int numCorners = cellType == smtk::mesh::Polygon
+      ? numPointIds
+      : std::min(numPointIds, smtk::mesh::verticesPerCell(cellType));
+    m_types.push_back(static_cast<unsigned char>(cellType));
+    m_corners.insert(m_corners.end(), this->pointIds(), this->pointIds() + numCorners);
+    m_offsets.push_back(m_corners.size());
+  }
+
+  std::vector<unsigned char> m_types;
+  std::vector<std::size_t> m_offsets;
+  std::vector<smtk::mesh::Handle> m_corners;
+};
 }
 
-int eulerCharacteristic(const smtk::mesh::MeshSet& ms)
+std::array<std::size_t, 4> topologyCounts(const smtk::mesh::MeshSet& ms, bool boundaryOnly)
 {
-  // We store xi as a long long rather than an int because the algorithm adds
-  // and subtracts large integral values during its computation.
-  long long xi = 0;
-  smtk::mesh::MeshSet meshSet = ms;
-
+  std::array<std::size_t, 4> counts = { { 0, 0, 0, 0 } };
   smtk::mesh::DimensionType highestDim = highestDimension(ms);
+  if (highestDim == smtk::mesh::DimensionType_MAX ||
+    (highestDim == smtk::mesh::Dims0 && boundaryOnly))
+  {
+    return counts;
+  }
+  if (highestDim == smtk::mesh::Dims0)
+  {
+    counts[0] = ms.points(true).size();
+    return counts;
+  }
+
+  CornerCollector cells;
+  smtk::mesh::for_each(ms.cells(highestDim), cells);
+  std::size_t numCells = cells.m_types.size();
+  counts[highestDim] = numCells;
+
+  // Replace point handles with dense indices so keys stay small.
+  std::vector<smtk::mesh::Handle> points(cells.m_corners);
+  std::sort(points.begin(), points.end());
+  points.erase(std::unique(points.begin(), points.end()), points.end());
+  if (!boundaryOnly)
+  {
+    counts[0] = points.size();
+  }
+
+  std::size_t numThreads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+  numThreads = std::min(numThreads, numCells / 4096 + 1);
+
+  std::vector<PointIndex> corners(cells.m_corners.size());
+  parallelFor(corners.size(), numThreads, [&](std::size_t, std::size_t begin, std::size_t end) {
+    for (std::size_t ii = begin; ii < end; ++ii)
+    {
+      corners[ii] = static_cast<PointIndex>(
+        std::lower_bound(points.begin(), points.end(), cells.m_corners[ii]) - points.begin());
+    }
+  });
+  std::vector<smtk::mesh::Handle>().swap(cells.m_corners);
+  std::vector<smtk::mesh::Handle>().swap(points);
+
+  // Hash the sorted corners of each cell's edges and faces in parallel chunks.
+  Partitions<PointIndex> pointKeys;
+  Partitions<EdgeKey> edgeKeys;
+  Partitions<FaceKey> faceKeys;
+  pointKeys.resize(numThreads, numThreads);
+  edgeKeys.resize(numThreads, numThreads);
+  faceKeys.resize(numThreads, numThreads);
+  parallelFor(numCells, numThreads, [&](std::size_t tt, std::size_t begin, std::size_t end) {
+    for (std::size_t cc = begin; cc < end; ++cc)
+    {
+      const PointIndex* pts = &corners[0] + cells.m_offsets[cc];
+      int numCorners = static_cast<int>(cells.m_offsets[cc + 1] - cells.m_offsets[cc]);
+      smtk::mesh::CellType cellType = static_cast<smtk::mesh::CellType>(cells.m_types[cc]);
+      if (highestDim == smtk::mesh::Dims1)
+      {
+        if (boundaryOnly && numCorners == 2)
+        {
+          pointKeys.emit(tt, pts[0]);
+          pointKeys.emit(tt, pts[1]);
+        }
+      }
+      else if (cellType == smtk::mesh::Polygon)
+      {
+        for (int ii = 0; ii < numCorners; ++ii)
+        {
+          edgeKeys.emit(tt, edgeKey(pts[ii], pts[(ii + 1) % numCorners]));
+        }
+      }
+      else
+      {
+        const SubEntities& sub(subEntities[cellType]);
+        if (highestDim == smtk::mesh::Dims2 || !boundaryOnly)
+        {
+          for (int ee = 0; ee < sub.numEdges; ++ee)
+          {
+            edgeKeys.emit(tt, edgeKey(pts[sub.edges[ee][0]], pts[sub.edges[ee][1]]));
+          }
+        }
+        if (highestDim == smtk::mesh::Dims3)
+        {
+          for (int ff = 0; ff < sub.numFaces; ++ff)
+          {
+            PointIndex face[4];
+            int numFaceCorners = sub.faces[ff][3] < 0 ? 3 : 4;
+            for (int ii = 0; ii < numFaceCorners; ++ii)
+            {
+              face[ii] = pts[sub.faces[ff][ii]];
+            }
+            faceKeys.emit(tt, faceKey(face, numFaceCorners));
+          }
+        }
+      }
+    }
+  });
 
-  if (highestDim == smtk::mesh::DimensionType_MAX)
+  if (!boundaryOnly)
   {
-    return 0;
+    if (highestDim >= smtk::mesh::Dims2)
+    {
+      counts[1] = edgeKeys.countUnique(numThreads, nullptr);
+    }
+    if (highestDim == smtk::mesh::Dims3)
+    {
+      counts[2] = faceKeys.countUnique(numThreads, nullptr);
+    }
+    return counts;
   }
 
-  // We compute xi by counting the number of adjacency cells at each dimension.
-  // Because of the way MOAB deals with higher-order cells, we must treat the
-  // vertex count by specifically requesting the number of "corners-only" points
-  // rather than the zero-dimensional adjacencies.
-  for (int i = highestDim; i >= smtk::mesh::Dims1; i--)
+  // The boundary consists of the facets that bound exactly one cell.
+  counts[highestDim] = 0;
+  if (highestDim == smtk::mesh::Dims1)
+  {
+    std::vector<PointIndex> ends;
+    pointKeys.countUnique(numThreads, &ends);
+    counts[0] = ends.size();
+    return counts;
+  }
+
+  std::vector<FaceKey> boundaryFaces;
+  std::vector<EdgeKey> boundaryEdges;
+  if (highestDim == smtk::mesh::Dims3)
+  {
+    faceKeys.countUnique(numThreads, &boundaryFaces);
+    counts[2] = boundaryFaces.size();
+    edgeKeys.resize(numThreads, numThreads);
+    parallelFor(boundaryFaces.size(), numThreads,
+      [&](std::size_t tt, std::size_t begin, std::size_t end) {
+        for (std::size_t ff = begin; ff < end; ++ff)
+        {
+          const FaceKey& face(boundaryFaces[ff]);
+          int numFaceCorners = face[3] == noPoint ? 3 : 4;
+          for (int ii = 0; ii < numFaceCorners; ++ii)
+          {
+            edgeKeys.emit(tt, edgeKey(face[ii], face[(ii + 1) % numFaceCorners]));
+          }
+        }
+      });
+    counts[1] = edgeKeys.countUnique(numThreads, nullptr);
+    for (auto& face : boundaryFaces)
+    {
+      for (auto point : face)
+      {
+        if (point != noPoint)
+        {
+          corners.push_back(point);
+        }
+      }
+    }
+  }
+  else
   {
-    meshSet = meshSet.extractAdjacenciesOfDimension(i);
-    int prefactor = (i % 2 == 0 ? +1 : -1);
-    xi += static_cast<long long>(prefactor * meshSet.cells().size());
+    edgeKeys.countUnique(numThreads, &boundaryEdges);
+    counts[1] = boundaryEdges.size();
+    for (auto edge : boundaryEdges)
+    {
+      corners.push_back(static_cast<PointIndex>(edge >> 32));
+      corners.push_back(static_cast<PointIndex>(edge & 0xffffffff));
+    }
   }
-  xi += static_cast<long long>(meshSet.points(true).size());
 
+  // Count the points of the boundary facets, which were appended to corners.
+  std::size_t numCellCorners = cells.m_offsets.back();
+  std::sort(corners.begin() + numCellCorners, corners.end());
+  counts[0] = static_cast<std::size_t>(
+    std::unique(corners.begin() + numCellCorners, corners.end()) - corners.begin() -
+    numCellCorners);
+  return counts;
+}
+
+int eulerCharacteristic(const smtk::mesh::MeshSet& ms)
+{
+  // We store xi as a long long rather than an int because the algorithm adds
+  // and subtracts large integral values during its computation.
+  std::array<std::size_t, 4> counts = topologyCounts(ms);
+  long long xi = static_cast<long long>(counts[0]) - static_cast<long long>(counts[1]) +
+    static_cast<long long>(counts[2]) - static_cast<long long>(counts[3]);
+  return static_cast<int>(xi);
+}
+
+int boundaryEulerCharacteristic(const smtk::mesh::MeshSet& ms)
+{
+  std::array<std::size_t, 4> counts = topologyCounts(ms, true);
+  long long xi = static_cast<long long>(counts[0]) - static_cast<long long>(counts[1]) +
+    static_cast<long long>(counts[2]) - static_cast<long long>(counts[3]);
   return static_cast<int>(xi);
 }
 }
@@ -18,6 +18,7 @@
 #include "smtk/mesh/core/MeshSet.h"
 
 #include <array>
+#include <cstddef>
 #include <string>
 
 namespace smtk
@@ -27,7 +28,8 @@ namespace mesh
 namespace utility
 {
 
-// Compute the bounding box of a mesh set
+// Compute the bounding box of a mesh set. The result is cached by the
+// collection's interface until the coordinates of its points change.
 SMTKCORE_EXPORT
 std::array<double, 6> extent(const smtk::mesh::MeshSet& ms);
 
@@ -35,9 +37,25 @@ std::array<double, 6> extent(const smtk::mesh::MeshSet& ms);
 SMTKCORE_EXPORT
 smtk::mesh::DimensionType highestDimension(const smtk::mesh::MeshSet& ms);
 
+// Count the unique corner points, edges, faces and volumes (indexed by
+// dimension) spanned by the highest-dimension cells of a mesh set.
+//
+// Sub-entities are identified by hashing their sorted corner points, so no
+// adjacency cells are created in the underlying mesh. When boundaryOnly is
+// true, only the boundary of those cells is counted: the sub-entities one
+// dimension lower that bound exactly one cell, plus their own sub-entities.
+SMTKCORE_EXPORT
+std::array<std::size_t, 4> topologyCounts(
+  const smtk::mesh::MeshSet& ms, bool boundaryOnly = false);
+
 // Compute the Euler-Poincare characteristic of a mesh set
 SMTKCORE_EXPORT
 int eulerCharacteristic(const smtk::mesh::MeshSet& ms);
+
+// Compute the Euler-Poincare characteristic of the boundary of a mesh set.
+// This matches eulerCharacteristic(ms.extractShell()) without creating the shell.
+SMTKCORE_EXPORT
+int boundaryEulerCharacteristic(const smtk::mesh::MeshSet& ms);
 }
 }
 }
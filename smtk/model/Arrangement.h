@@ -10,6 +10,7 @@
 #ifndef smtk_model_Arrangement_h
 #define smtk_model_Arrangement_h
 
+#include "smtk/common/PoolAllocator.h"
 #include "smtk/common/UUID.h"
 
 #include "smtk/model/ArrangementKind.h"
@@ -172,13 +173,18 @@ public:
 /// A vector of Arrangements is associated to each Manager entity.
 typedef std::vector<Arrangement> Arrangements;
 /// A map holding Arrangements of different ArrangementKinds.
-typedef std::map<ArrangementKind, Arrangements> KindsToArrangements;
+///
+/// Each entity holds one of these, so its nodes are pooled rather than
+/// allocated individually.
+typedef std::map<ArrangementKind, Arrangements, std::less<ArrangementKind>,
+  smtk::common::PoolAllocator<std::pair<const ArrangementKind, Arrangements> > >
+  KindsToArrangements;
 /// Each Manager entity's UUID is mapped to a vector of Arrangment instances.
 typedef std::map<smtk::common::UUID, KindsToArrangements> UUIDsToArrangements;
 /// An iterator referencing a (UUID,KindsToArrangements)-tuple.
 typedef std::map<smtk::common::UUID, KindsToArrangements>::iterator UUIDWithArrangementDictionary;
 /// An iterator referencing an (ArrangementKind,Arrangements)-tuple.
-typedef std::map<ArrangementKind, Arrangements>::iterator ArrangementKindWithArrangements;
+typedef KindsToArrangements::iterator ArrangementKindWithArrangements;
 /// An array of ArrangementReference objects used, for instance, to enumerate inverse relations.
 typedef std::vector<ArrangementReference> ArrangementReferences;
 
@@ -0,0 +1,678 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/model/BVHPointLocator.h"
+
+#include "smtk/model/EntityRef.h"
+#include "smtk/model/Manager.h"
+#include "smtk/model/Tessellation.h"
+
+#include "smtk/AutoInit.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace smtk
+{
+namespace model
+{
+
+namespace
+{
+
+// Query batches smaller than this are not worth splitting across threads.
+const std::size_t minPointsPerThread = 1024;
+// Leaves hold at most this many primitives.
+const std::size_t maxPrimitivesPerLeaf = 4;
+// At most this many entity hierarchies are kept around.
+const std::size_t maxCachedEntities = 32;
+
+/// A vertex (1 point), line segment (2 points) or triangle (3 points).
+struct Primitive
+{
+  int size;
+  int pts[3];
+};
+
+struct Node
+{
+  double bounds[6];
+  std::size_t first;  // first primitive (leaf) or left child (interior)
+  std::size_t second; // right child (interior)
+  std::size_t count;  // number of primitives; zero for interior nodes
+};
+
+/// The (entity, tessellation generation, coordinate and connectivity size)
+/// tuples a hierarchy was built from. Any change invalidates the hierarchy.
+struct Source
+{
+  smtk::common::UUID entity;
+  int generation;
+  std::size_t coordSize;
+  std::size_t connSize;
+
+  bool operator==(const Source& other) const
+  {
+    return this->entity == other.entity && this->generation == other.generation &&
+      this->coordSize == other.coordSize && this->connSize == other.connSize;
+  }
+};
+
+inline double dot(const double* a, const double* b)
+{
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+inline void sub(const double* a, const double* b, double* r)
+{
+  r[0] = a[0] - b[0];
+  r[1] = a[1] - b[1];
+  r[2] = a[2] - b[2];
+}
+
+inline double dist2(const double* a, const double* b)
+{
+  double d[3];
+  sub(a, b, d);
+  return dot(d, d);
+}
+
+void closestPointOnSegment(const double* p, const double* a, const double* b, double* r)
+{
+  double ab[3];
+  double ap[3];
+  sub(b, a, ab);
+  sub(p, a, ap);
+  double len2 = dot(ab, ab);
+  double t = len2 > 0.0 ? dot(ap, ab) / len2 : 0.0;
+  t = t < 0.0 ? 0.0 : (t > 1.0 ? 1.0 : t);
+  for (int ii = 0; ii < 3; ++ii)
+  {
+    r[ii] = a[ii] + t * ab[ii];
+  }
+}
+
+// Classify p against the Voronoi regions of triangle abc (see Ericson,
+// "Real-Time Collision Detection", section 5.1.5).
+void closestPointOnTriangle(
+  const double* p, const double* a, const double* b, const double* c, double* r)
+{
+  double ab[3];
+  double ac[3];
+  double ap[3];
+  sub(b, a, ab);
+  sub(c, a, ac);
+  sub(p, a, ap);
+  double d1 = dot(ab, ap);
+  double d2 = dot(ac, ap);
+  if (d1 <= 0.0 && d2 <= 0.0)
+  {
+    std::copy(a, a + 3, r);
+    return;
+  }
+
+  double bp[3];
+  sub(p, b, bp);
+  double d3 = dot(ab, bp);
+  double d4 = dot(ac, bp);
+  if (d3 >= 0.0 && d4 <= d3)
+  {
+    std::copy(b, b + 3, r);
+    return;
+  }
+
+  double vc = d1 * d4 - d3 * d2;
+  if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+  {
+    double v = (d1 - d3) != 0.0 ? d1 / (d1 - d3) : 0.0;
+    for (int ii = 0; ii < 3; ++ii)
+    {
+      r[ii] = a[ii] + v * ab[ii];
+    }
+    return;
+  }
+
+  double cp[3];
+  sub(p, c, cp);
+  double d5 = dot(ab, cp);
+  double d6 = dot(ac, cp);
+  if (d6 >= 0.0 && d5 <= d6)
+  {
+    std::copy(c, c + 3, r);
+    return;
+  }
+
+  double vb = d5 * d2 - d1 * d6;
+  if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+  {
+    double w = (d2 - d6) != 0.0 ? d2 / (d2 - d6) : 0.0;
+    for (int ii = 0; ii < 3; ++ii)
+    {
+      r[ii] = a[ii] + w * ac[ii];
+    }
+    return;
+  }
+
+  double va = d3 * d6 - d5 * d4;
+  if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0)
+  {
+    double w = (d4 - d3) + (d5 - d6);
+    w = w != 0.0 ? (d4 - d3) / w : 0.0;
+    for (int ii = 0; ii < 3; ++ii)
+    {
+      r[ii] = b[ii] + w * (c[ii] - b[ii]);
+    }
+    return;
+  }
+
+  double denom = va + vb + vc;
+  if (denom == 0.0)
+  { // Degenerate (zero-area) triangle; use the nearest edge.
+    double e0[3];
+    double e1[3];
+    double e2[3];
+    closestPointOnSegment(p, a, b, e0);
+    closestPointOnSegment(p, b, c, e1);
+    closestPointOnSegment(p, c, a, e2);
+    const double* best = e0;
+    if (dist2(p, e1) < dist2(p, best))
+    {
+      best = e1;
+    }
+    if (dist2(p, e2) < dist2(p, best))
+    {
+      best = e2;
+    }
+    std::copy(best, best + 3, r);
+    return;
+  }
+  double v = vb / denom;
+  double w = vc / denom;
+  for (int ii = 0; ii < 3; ++ii)
+  {
+    r[ii] = a[ii] + ab[ii] * v + ac[ii] * w;
+  }
+}
+
+/// Squared distance from \a p to an axis-aligned box (zero when inside).
+inline double boxDist2(const double* p, const double* bounds)
+{
+  double d2 = 0.0;
+  for (int ii = 0; ii < 3; ++ii)
+  {
+    double lo = bounds[2 * ii];
+    double hi = bounds[2 * ii + 1];
+    double d = p[ii] < lo ? lo - p[ii] : (p[ii] > hi ? p[ii] - hi : 0.0);
+    d2 += d * d;
+  }
+  return d2;
+}
+
+/// A bounding-volume hierarchy over the primitives of one or more tessellations.
+class Hierarchy
+{
+public:
+  std::vector<Source> m_sources;
+
+  void addTessellation(const Tessellation& tess);
+  void build();
+  bool empty() const { return this->m_primitives.empty(); }
+  void closestPoint(const double* p, double* result) const;
+
+protected:
+  void primitiveBounds(const Primitive& prim, double bounds[6]) const;
+  void centroid(const Primitive& prim, double ctr[3]) const;
+  std::size_t buildNode(std::size_t begin, std::size_t end);
+
+  std::vector<double> m_coords;
+  std::vector<Primitive> m_primitives;
+  std::vector<double> m_centroids;
+  std::vector<Node> m_nodes;
+};
+
+void Hierarchy::addTessellation(const Tessellation& tess)
+{
+  int offset = static_cast<int>(this->m_coords.size() / 3);
+  int npts = static_cast<int>(tess.coords().size() / 3);
+  this->m_coords.insert(this->m_coords.end(), tess.coords().begin(),
+    tess.coords().begin() + 3 * static_cast<std::size_t>(npts));
+
+  std::vector<int> cellConn;
+  auto addPrim = [this, offset, npts](int n, int a, int b, int c) {
+    // Skip primitives that reference points outside the coordinate array.
+    if (a < 0 || a >= npts || (n > 1 && (b < 0 || b >= npts)) || (n > 2 && (c < 0 || c >= npts)))
+    {
+      return;
+    }
+    Primitive prim;
+    prim.size = n;
+    prim.pts[0] = offset + a;
+    prim.pts[1] = offset + (n > 1 ? b : a);
+    prim.pts[2] = offset + (n > 2 ? c : a);
+    this->m_primitives.push_back(prim);
+  };
+  Tessellation::size_type off;
+  for (off = tess.begin(); off != tess.end(); off = tess.nextCellOffset(off))
+  {
+    Tessellation::size_type cellType;
+    Tessellation::size_type nv = tess.numberOfCellVertices(off, &cellType);
+    if (nv <= 0)
+    {
+      continue;
+    }
+    cellConn.clear();
+    tess.vertexIdsOfCell(off, cellConn);
+    switch (Tessellation::cellShapeFromType(cellType))
+    {
+      case TESS_VERTEX:
+      case TESS_POLYVERTEX:
+        for (auto pt : cellConn)
+        {
+          addPrim(1, pt, pt, pt);
+        }
+        break;
+      case TESS_POLYLINE:
+        if (nv == 1)
+        {
+          addPrim(1, cellConn[0], 0, 0);
+        }
+        for (Tessellation::size_type ii = 1; ii < nv; ++ii)
+        {
+          addPrim(2, cellConn[ii - 1], cellConn[ii], 0);
+        }
+        break;
+      case TESS_TRIANGLE:
+      case TESS_QUAD:
+      case TESS_POLYGON:
+        // Fan-triangulate; this is exact for convex cells.
+        for (Tessellation::size_type ii = 2; ii < nv; ++ii)
+        {
+          addPrim(3, cellConn[0], cellConn[ii - 1], cellConn[ii]);
+        }
+        break;
+      case TESS_TRIANGLE_STRIP:
+        for (Tessellation::size_type ii = 2; ii < nv; ++ii)
+        {
+          addPrim(3, cellConn[ii - 2], cellConn[ii - 1], cellConn[ii]);
+        }
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+void Hierarchy::primitiveBounds(const Primitive& prim, double bounds[6]) const
+{
+  Tessellation::invalidBoundingBox(bounds);
+  for (int ii = 0; ii < prim.size; ++ii)
+  {
+    const double* x = &this->m_coords[3 * prim.pts[ii]];
+    for (int jj = 0; jj < 3; ++jj)
+    {
+      bounds[2 * jj] = std::min(bounds[2 * jj], x[jj]);
+      bounds[2 * jj + 1] = std::max(bounds[2 * jj + 1], x[jj]);
+    }
+  }
+}
+
+void Hierarchy::centroid(const Primitive& prim, double ctr[3]) const
+{
+  ctr[0] = ctr[1] = ctr[2] = 0.0;
+  for (int ii = 0; ii < prim.size; ++ii)
+  {
+    const double* x = &this->m_coords[3 * prim.pts[ii]];
+    for (int jj = 0; jj < 3; ++jj)
+    {
+      ctr[jj] += x[jj] / prim.size;
+    }
+  }
+}
+
+void Hierarchy::build()
+{
+  this->m_nodes.clear();
+  this->m_centroids.resize(3 * this->m_primitives.size());
+  for (std::size_t ii = 0; ii < this->m_primitives.size(); ++ii)
+  {
+    this->centroid(this->m_primitives[ii], &this->m_centroids[3 * ii]);
+  }
+  if (!this->m_primitives.empty())
+  {
+    this->m_nodes.reserve(2 * this->m_primitives.size() / maxPrimitivesPerLeaf + 1);
+    this->buildNode(0, this->m_primitives.size());
+  }
+  // Centroids are only needed while partitioning.
+  std::vector<double>().swap(this->m_centroids);
+}
+
+/// Build the subtree for primitives [begin, end) and return its node index.
+std::size_t Hierarchy::buildNode(std::size_t begin, std::size_t end)
+{
+  std::size_t index = this->m_nodes.size();
+  this->m_nodes.push_back(Node());
+  double bounds[6];
+  double cbounds[6];
+  Tessellation::invalidBoundingBox(bounds);
+  Tessellation::invalidBoundingBox(cbounds);
+  for (std::size_t ii = begin; ii < end; ++ii)
+  {
+    double pb[6];
+    this->primitiveBounds(this->m_primitives[ii], pb);
+    const double* ctr = &this->m_centroids[3 * ii];
+    for (int jj = 0; jj < 3; ++jj)
+    {
+      bounds[2 * jj] = std::min(bounds[2 * jj], pb[2 * jj]);
+      bounds[2 * jj + 1] = std::max(bounds[2 * jj + 1], pb[2 * jj + 1]);
+      cbounds[2 * jj] = std::min(cbounds[2 * jj], ctr[jj]);
+      cbounds[2 * jj + 1] = std::max(cbounds[2 * jj + 1], ctr[jj]);
+    }
+  }
+  std::copy(bounds, bounds + 6, this->m_nodes[index].bounds);
+
+  int axis = 0;
+  double extent = -1.0;
+  for (int jj = 0; jj < 3; ++jj)
+  {
+    if (cbounds[2 * jj + 1] - cbounds[2 * jj] > extent)
+    {
+      extent = cbounds[2 * jj + 1] - cbounds[2 * jj];
+      axis = jj;
+    }
+  }
+  if (end - begin <= maxPrimitivesPerLeaf || extent <= 0.0)
+  {
+    this->m_nodes[index].first = begin;
+    this->m_nodes[index].second = 0;
+    this->m_nodes[index].count = end - begin;
+    return index;
+  }
+
+  // Split at the median centroid along the longest axis. Primitives and
+  // their centroids are permuted together through an index array.
+  std::size_t mid = begin + (end - begin) / 2;
+  std::vector<std::size_t> order(end - begin);
+  for (std::size_t ii = 0; ii < order.size(); ++ii)
+  {
+    order[ii] = begin + ii;
+  }
+  const std::vector<double>& ctrs(this->m_centroids);
+  std::nth_element(order.begin(), order.begin() + (mid - begin), order.end(),
+    [&ctrs, axis](std::size_t a, std::size_t b) {
+      return ctrs[3 * a + axis] < ctrs[3 * b + axis];
+    });
+  std::vector<Primitive> prims(order.size());
+  std::vector<double> centers(3 * order.size());
+  for (std::size_t ii = 0; ii < order.size(); ++ii)
+  {
+    prims[ii] = this->m_primitives[order[ii]];
+    std::copy(&ctrs[3 * order[ii]], &ctrs[3 * order[ii]] + 3, &centers[3 * ii]);
+  }
+  std::copy(prims.begin(), prims.end(), this->m_primitives.begin() + begin);
+  std::copy(centers.begin(), centers.end(), this->m_centroids.begin() + 3 * begin);
+
+  std::size_t left = this->buildNode(begin, mid);
+  std::size_t right = this->buildNode(mid, end);
+  this->m_nodes[index].first = left;
+  this->m_nodes[index].second = right;
+  this->m_nodes[index].count = 0;
+  return index;
+}
+
+void Hierarchy::closestPoint(const double* p, double* result) const
+{
+  double best = std::numeric_limits<double>::max();
+  std::vector<std::size_t> stack;
+  stack.reserve(64);
+  stack.push_back(0);
+  while (!stack.empty())
+  {
+    const Node& node(this->m_nodes[stack.back()]);
+    stack.pop_back();
+    if (boxDist2(p, node.bounds) >= best)
+    {
+      continue;
+    }
+    if (node.count > 0)
+    {
+      for (std::size_t ii = node.first; ii < node.first + node.count; ++ii)
+      {
+        const Primitive& prim(this->m_primitives[ii]);
+        const double* a = &this->m_coords[3 * prim.pts[0]];
+        double candidate[3];
+        switch (prim.size)
+        {
+          case 1:
+            std::copy(a, a + 3, candidate);
+            break;
+          case 2:
+            closestPointOnSegment(p, a, &this->m_coords[3 * prim.pts[1]], candidate);
+            break;
+          default:
+            closestPointOnTriangle(p, a, &this->m_coords[3 * prim.pts[1]],
+              &this->m_coords[3 * prim.pts[2]], candidate);
+            break;
+        }
+        double d2 = dist2(p, candidate);
+        if (d2 < best)
+        {
+          best = d2;
+          std::copy(candidate, candidate + 3, result);
+        }
+      }
+      continue;
+    }
+    // Push the farther child first so the nearer one is visited first and
+    // tightens the bound sooner.
+    std::size_t left = node.first;
+    std::size_t right = node.second;
+    double dl = boxDist2(p, this->m_nodes[left].bounds);
+    double dr = boxDist2(p, this->m_nodes[right].bounds);
+    if (dl < dr)
+    {
+      stack.push_back(right);
+      stack.push_back(left);
+    }
+    else
+    {
+      stack.push_back(left);
+      stack.push_back(right);
+    }
+  }
+}
+
+typedef std::shared_ptr<const Hierarchy> HierarchyPtr;
+
+// Entities in different managers may share a UUID (e.g., the same file read
+// twice), so hierarchies are cached per manager.
+typedef std::pair<const Manager*, smtk::common::UUID> CacheKey;
+
+struct CacheEntry
+{
+  // Guards against a new manager reusing the address of a destroyed one.
+  std::weak_ptr<Manager> manager;
+  HierarchyPtr hierarchy;
+  std::size_t lastUsed;
+};
+
+std::mutex s_cacheMutex;
+std::map<CacheKey, CacheEntry> s_cache;
+std::size_t s_cacheClock = 0;
+
+/// Collect the entities whose tessellations make up the surface of \a entity.
+std::vector<EntityRef> tessellatedEntities(const EntityRef& entity)
+{
+  std::vector<EntityRef> result;
+  if (entity.hasTessellation())
+  {
+    result.push_back(entity);
+  }
+  std::map<EntityRef, EntityRef> related;
+  std::set<EntityRef> touched;
+  entity.findEntitiesWithTessellation(related, touched);
+  for (auto& entry : related)
+  {
+    if (entry.first != entity)
+    {
+      result.push_back(entry.first);
+    }
+  }
+  return result;
+}
+
+std::vector<Source> sourcesOf(const std::vector<EntityRef>& entities)
+{
+  std::vector<Source> sources;
+  sources.reserve(entities.size());
+  for (auto& ent : entities)
+  {
+    const Tessellation* tess = ent.hasTessellation();
+    Source src;
+    src.entity = ent.entity();
+    src.generation = ent.tessellationGeneration();
+    src.coordSize = tess->coords().size();
+    src.connSize = tess->conn().size();
+    sources.push_back(src);
+  }
+  return sources;
+}
+
+/// Return a hierarchy for \a entity, building it only if the cached one is stale.
+HierarchyPtr hierarchyFor(const EntityRef& entity)
+{
+  std::vector<EntityRef> entities = tessellatedEntities(entity);
+  std::vector<Source> sources = sourcesOf(entities);
+  ManagerPtr manager = entity.manager();
+  CacheKey key(manager.get(), entity.entity());
+  {
+    std::lock_guard<std::mutex> guard(s_cacheMutex);
+    auto it = s_cache.find(key);
+    if (it != s_cache.end() && it->second.manager.lock() == manager &&
+      it->second.hierarchy->m_sources == sources)
+    {
+      it->second.lastUsed = ++s_cacheClock;
+      return it->second.hierarchy;
+    }
+  }
+
+  // Build outside the lock so queries on other entities are not blocked.
+  std::shared_ptr<Hierarchy> hierarchy = std::make_shared<Hierarchy>();
+  hierarchy->m_sources = sources;
+  for (auto& ent : entities)
+  {
+    hierarchy->addTessellation(*ent.hasTessellation());
+  }
+  hierarchy->build();
+
+  std::lock_guard<std::mutex> guard(s_cacheMutex);
+  if (s_cache.find(key) == s_cache.end() && s_cache.size() >= maxCachedEntities)
+  {
+    auto oldest = s_cache.begin();
+    for (auto it = s_cache.begin(); it != s_cache.end(); ++it)
+    {
+      if (it->second.lastUsed < oldest->second.lastUsed)
+      {
+        oldest = it;
+      }
+    }
+    s_cache.erase(oldest);
+  }
+  CacheEntry& entry(s_cache[key]);
+  entry.manager = manager;
+  entry.hierarchy = hierarchy;
+  entry.lastUsed = ++s_cacheClock;
+  return hierarchy;
+}
+}
+
+BVHPointLocator::BVHPointLocator()
+{
+}
+
+BVHPointLocator::~BVHPointLocator()
+{
+}
+
+bool BVHPointLocator::closestPointOn(const EntityRef& entity, std::vector<double>& closestPoints,
+  const std::vector<double>& sourcePoints)
+{
+  if (!entity.isValid())
+  {
+    return false;
+  }
+  HierarchyPtr hierarchy = hierarchyFor(entity);
+  if (!hierarchy || hierarchy->empty())
+  {
+    return false;
+  }
+
+  // Callers may pass the same vector for both arguments (snapping in place).
+  // Each point is read before its result is written, so that is safe as long
+  // as resizing does not happen; only resize when the vectors differ.
+  std::size_t npts = sourcePoints.size() / 3;
+  if (&closestPoints != &sourcePoints)
+  {
+    closestPoints.resize(3 * npts);
+  }
+  const double* src = sourcePoints.data();
+  double* dst = closestPoints.data();
+  auto project = [&hierarchy, src, dst](std::size_t begin, std::size_t end) {
+    for (std::size_t ii = begin; ii < end; ++ii)
+    {
+      double pt[3] = { src[3 * ii], src[3 * ii + 1], src[3 * ii + 2] };
+      hierarchy->closestPoint(pt, dst + 3 * ii);
+    }
+  };
+
+  std::size_t numThreads = std::max(1u, std::thread::hardware_concurrency());
+  numThreads = std::min(numThreads, npts / minPointsPerThread);
+  if (numThreads <= 1)
+  {
+    project(0, npts);
+    return true;
+  }
+  std::vector<std::thread> workers;
+  workers.reserve(numThreads - 1);
+  std::size_t chunk = (npts + numThreads - 1) / numThreads;
+  for (std::size_t tt = 1; tt < numThreads; ++tt)
+  {
+    std::size_t begin = std::min(npts, tt * chunk);
+    std::size_t end = std::min(npts, begin + chunk);
+    workers.push_back(std::thread(project, begin, end));
+  }
+  project(0, std::min(npts, chunk));
+  for (auto& worker : workers)
+  {
+    worker.join();
+  }
+  return true;
+}
+
+void BVHPointLocator::clearCache()
+{
+  std::lock_guard<std::mutex> guard(s_cacheMutex);
+  s_cache.clear();
+}
+
+std::size_t BVHPointLocator::numberOfCachedEntities()
+{
+  std::lock_guard<std::mutex> guard(s_cacheMutex);
+  return s_cache.size();
+}
+}
+}
+
+smtkDeclareExtension(SMTKCORE_EXPORT, model_entity_bvh_point_locator, smtk::model::BVHPointLocator);
+
+smtkComponentInitMacro(smtk_model_entity_bvh_point_locator_extension);
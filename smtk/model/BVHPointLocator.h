@@ -0,0 +1,63 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_model_BVHPointLocator_h
+#define smtk_model_BVHPointLocator_h
+
+#include "smtk/model/PointLocatorExtension.h"
+
+#include <cstddef>
+
+namespace smtk
+{
+namespace model
+{
+
+/**\brief Locate the closest point on the SMTK tessellation of a model entity.
+  *
+  * Unlike locators that return the nearest tessellation vertex, this extension
+  * projects each query point onto the triangles, line segments and vertices
+  * of the entity's Tessellation (plus those of any entities bounding it or,
+  * for models and groups, contained in it). It does not depend on VTK, so it
+  * can be used to snap Instance placements in headless applications.
+  *
+  * A bounding-volume hierarchy is built the first time an entity is queried
+  * and cached per (model manager, entity). The cached hierarchy is reused
+  * until the tessellation generation of any contributing entity changes.
+  * Large batches of query points are split across threads.
+  *
+  * This extension is registered by smtkCore as "model_entity_bvh_point_locator",
+  * so it may be named as an instance's "snap rule". Instance::generateTessellation()
+  * also uses it when no extension matching an instance's "snap rule" has been
+  * registered.
+  */
+class SMTKCORE_EXPORT BVHPointLocator : public PointLocatorExtension
+{
+public:
+  smtkTypeMacro(BVHPointLocator);
+  smtkCreateMacro(smtk::common::Extension);
+  smtkSuperclassMacro(smtk::model::PointLocatorExtension);
+  virtual ~BVHPointLocator();
+
+  /// Overwrites \a closestPoints with points on \a entity closest to \a sourcePoints.
+  bool closestPointOn(const EntityRef& entity, std::vector<double>& closestPoints,
+    const std::vector<double>& sourcePoints) override;
+
+  /// Discard all cached hierarchies.
+  static void clearCache();
+  /// Return the number of entities whose hierarchies are currently cached.
+  static std::size_t numberOfCachedEntities();
+
+protected:
+  BVHPointLocator();
+};
+}
+}
+
+#endif
@@ -16,11 +16,96 @@ namespace smtk
 namespace model
 {
 
+namespace
+{
+
+// Order entities by type and then by dimension. Returns false when neither
+// distinguishes \a fa from \a fb; otherwise \a less holds whether \a fa comes first.
+bool compareEntityFlags(BitFlags fa, BitFlags fb, bool& less)
+{
+  // Entity type
+  BitFlags eta = fa & ENTITY_MASK;
+  BitFlags etb = fb & ENTITY_MASK;
+  if (eta != etb)
+  {
+    switch (eta)
+    {
+      case CELL_ENTITY: // 0x0100
+        less = etb == MODEL_ENTITY ? false : true;
+        return true;
+      case USE_ENTITY: // 0x0200
+        less = etb == MODEL_ENTITY || etb < USE_ENTITY ? false : true;
+        return true;
+      case SHELL_ENTITY: // 0x0400
+        less = etb == MODEL_ENTITY || etb < SHELL_ENTITY ? false : true;
+        return true;
+      case GROUP_ENTITY: // 0x0800
+        less = etb == MODEL_ENTITY || etb < SHELL_ENTITY ? false : true;
+        return true;
+      case MODEL_ENTITY: // 0x1000
+        less = true;
+        return true;
+      case INSTANCE_ENTITY: // 0x2000
+        less = false;
+        return true;
+      default:
+        less = eta < etb ? true : false;
+        return true;
+    }
+  }
+
+  // Dimension
+  eta = fa & ANY_DIMENSION;
+  etb = fb & ANY_DIMENSION;
+  if (eta != etb)
+  {
+    less = eta < etb;
+    return true;
+  }
+  return false;
+}
+
+// Order titles, with care taken when differences are numeric values.
+bool compareTitles(const std::string& ta, const std::string& tb)
+{
+  if (ta.empty())
+    return true;
+  if (tb.empty())
+    return false;
+  std::string::size_type minlen = ta.size() < tb.size() ? ta.size() : tb.size();
+  std::string::size_type i;
+  for (i = 0; i < minlen; ++i)
+    if (ta[i] != tb[i])
+      break; // Stop at the first difference between ta and tb.
+
+  // Shorter strings are less than longer versions with the same start:
+  if (i == minlen)
+    return ta.size() < tb.size() ? true : false;
+
+  // Both ta & tb have some character present and different.
+  bool da = isdigit(ta[i]) ? true : false;
+  bool db = isdigit(tb[i]) ? true : false;
+  if (da && !db)
+    return true; // digits come before other things
+  if (!da && db)
+    return false; // non-digits come after digits
+  if (!da && !db)
+    return ta[i] < tb[i];
+  // Now, both ta and tb differ with some numeric value.
+  // Convert to a number and compare the numbers.
+  double na = atof(ta.substr(i).c_str());
+  double nb = atof(tb.substr(i).c_str());
+  return na < nb;
+}
+}
+
 unsigned int DescriptivePhrase::s_nextPhraseId = 0;
 
 DescriptivePhrase::DescriptivePhrase()
   : m_type(INVALID_DESCRIPTION)
   , m_subphrasesBuilt(false)
+  , m_subphrasesPaged(false)
+  , m_hasSubphrases(-1)
 {
   this->m_phraseId = DescriptivePhrase::s_nextPhraseId++;
 }
@@ -29,7 +114,7 @@ DescriptivePhrasePtr DescriptivePhrase::setup(DescriptivePhraseType ptype, Ptr p
 {
   this->m_parent = parnt;
   this->m_type = ptype;
-  this->m_subphrasesBuilt = false;
+  this->markDirty(true);
   return shared_from_this();
 }
 
@@ -53,6 +138,59 @@ DescriptivePhrases DescriptivePhrase::subphrases() const
   return this->m_subphrases;
 }
 
+/**\brief Return this phrase's subphrases, building no more than the first \a count of them.
+  *
+  * Subphrases are generated a page at a time, so that presenting the first
+  * few children of a phrase with very many does not generate them all.
+  * The result holds fewer than \a count entries only when there are no more.
+  * Asking for all of them with subphrases() appends the rest.
+  */
+DescriptivePhrases& DescriptivePhrase::leadingSubphrases(int count)
+{
+  int built = static_cast<int>(this->m_subphrases.size());
+  if (this->m_subphrasesBuilt || (this->m_subphrasesPaged && built >= count))
+    return this->m_subphrases;
+
+  if (!this->m_subphrasesPaged)
+  {
+    this->m_subphrases.clear();
+    built = 0;
+    if (count <= 0)
+      return this->m_subphrases;
+  }
+  SubphraseGeneratorPtr delegate = this->findDelegate();
+  if (!delegate)
+  {
+    this->m_subphrasesBuilt = true;
+    this->m_subphrasesPaged = false;
+    return this->m_subphrases;
+  }
+  DescriptivePhrases page = delegate->pageOfSubphrases(shared_from_this(), built, count - built);
+  this->m_subphrases.insert(this->m_subphrases.end(), page.begin(), page.end());
+  // A short page means there are no more subphrases.
+  this->m_subphrasesBuilt = static_cast<int>(page.size()) < count - built;
+  this->m_subphrasesPaged = !this->m_subphrasesBuilt;
+  return this->m_subphrases;
+}
+
+/**\brief Return whether this phrase has any subphrases.
+  *
+  * When no subphrases have been built, the subphrase generator is asked
+  * (without building them) and its answer is kept until markDirty() is called.
+  */
+bool DescriptivePhrase::hasSubphrases()
+{
+  if (this->m_subphrasesBuilt || this->m_subphrasesPaged)
+    return !this->m_subphrases.empty();
+
+  if (this->m_hasSubphrases < 0)
+  {
+    SubphraseGeneratorPtr delegate = this->findDelegate();
+    this->m_hasSubphrases = delegate && delegate->hasSubphrases(shared_from_this()) ? 1 : 0;
+  }
+  return this->m_hasSubphrases == 1;
+}
+
 /// Return the index of the given phrase in this instance's subphrases (or -1).
 int DescriptivePhrase::argFindChild(const DescriptivePhrase* child) const
 {
@@ -157,8 +295,16 @@ void DescriptivePhrase::buildSubphrases()
   {
     this->m_subphrasesBuilt = true;
     SubphraseGeneratorPtr delegate = this->findDelegate();
-    if (delegate)
+    if (delegate && this->m_subphrasesPaged)
+    {
+      // Keep the pages already built (views may refer to them) and append the rest.
+      DescriptivePhrases rest = delegate->pageOfSubphrases(
+        shared_from_this(), static_cast<int>(this->m_subphrases.size()), -1);
+      this->m_subphrases.insert(this->m_subphrases.end(), rest.begin(), rest.end());
+    }
+    else if (delegate)
       this->m_subphrases = delegate->subphrases(shared_from_this());
+    this->m_subphrasesPaged = false;
   }
 }
 
@@ -211,72 +357,30 @@ bool DescriptivePhrase::compareByModelInfo(
   }
 
   // II. Sort by entity type/dimension
-  // II.a. Entity type
-  BitFlags eta = a->relatedEntity().entityFlags() & ENTITY_MASK;
-  BitFlags etb = b->relatedEntity().entityFlags() & ENTITY_MASK;
-  if (eta != etb)
-  {
-    switch (eta)
-    {
-      case CELL_ENTITY: // 0x0100
-        return etb == MODEL_ENTITY ? false : true;
-      case USE_ENTITY: // 0x0200
-        return etb == MODEL_ENTITY || etb < USE_ENTITY ? false : true;
-      case SHELL_ENTITY: // 0x0400
-        return etb == MODEL_ENTITY || etb < SHELL_ENTITY ? false : true;
-      case GROUP_ENTITY: // 0x0800
-        return etb == MODEL_ENTITY || etb < SHELL_ENTITY ? false : true;
-      case MODEL_ENTITY: // 0x1000
-        return true;
-      case INSTANCE_ENTITY: // 0x2000
-        return false;
-      default:
-        return eta < etb ? true : false;
-    }
-  }
-
-  // II.b. Dimension
-  eta = a->relatedEntity().entityFlags() & ANY_DIMENSION;
-  etb = b->relatedEntity().entityFlags() & ANY_DIMENSION;
-  if (eta != etb)
-    return eta < etb;
+  bool less;
+  if (compareEntityFlags(a->relatedEntity().entityFlags(), b->relatedEntity().entityFlags(), less))
+    return less;
 
   // III. Sort by title, with care taken when differences are numeric values.
   return compareByTitle(a, b);
 }
 
-bool DescriptivePhrase::compareByTitle(const DescriptivePhrasePtr& a, const DescriptivePhrasePtr& b)
+/**\brief Order entities as compareByModelInfo() orders the entity phrases presenting them.
+  *
+  * This lets a subphrase generator sort entities before creating phrases for them.
+  */
+bool DescriptivePhrase::compareEntitiesByModelInfo(const EntityRef& a, const EntityRef& b)
 {
-  std::string ta(a->title());
-  std::string tb(b->title());
-  if (ta.empty())
-    return true;
-  if (tb.empty())
-    return false;
-  std::string::size_type minlen = ta.size() < tb.size() ? ta.size() : tb.size();
-  std::string::size_type i;
-  for (i = 0; i < minlen; ++i)
-    if (ta[i] != tb[i])
-      break; // Stop at the first difference between ta and tb.
+  bool less;
+  if (compareEntityFlags(a.entityFlags(), b.entityFlags(), less))
+    return less;
 
-  // Shorter strings are less than longer versions with the same start:
-  if (i == minlen)
-    return ta.size() < tb.size() ? true : false;
+  return compareTitles(a.name(), b.name());
+}
 
-  // Both ta & tb have some character present and different.
-  bool da = isdigit(ta[i]) ? true : false;
-  bool db = isdigit(tb[i]) ? true : false;
-  if (da && !db)
-    return true; // digits come before other things
-  if (!da && db)
-    return false; // non-digits come after digits
-  if (!da && !db)
-    return ta[i] < tb[i];
-  // Now, both ta and tb differ with some numeric value.
-  // Convert to a number and compare the numbers.
-  double na = atof(ta.substr(i).c_str());
-  double nb = atof(tb.substr(i).c_str());
-  return na < nb;
+bool DescriptivePhrase::compareByTitle(const DescriptivePhrasePtr& a, const DescriptivePhrasePtr& b)
+{
+  return compareTitles(a->title(), b->title());
 }
 
 } // model namespace
@@ -98,8 +98,17 @@ public:
   virtual DescriptivePhrasePtr parent() const { return this->m_parent.lock(); }
   virtual DescriptivePhrases& subphrases();
   virtual DescriptivePhrases subphrases() const;
+  DescriptivePhrases& leadingSubphrases(int count);
+  bool hasSubphrases();
   virtual bool areSubphrasesBuilt() const { return this->m_subphrasesBuilt; }
-  virtual void markDirty(bool dirty = true) { this->m_subphrasesBuilt = !dirty; }
+  /// Return true when only the leading pages of subphrases have been built.
+  bool areSubphrasesPaged() const { return this->m_subphrasesPaged; }
+  virtual void markDirty(bool dirty = true)
+  {
+    this->m_subphrasesBuilt = !dirty;
+    this->m_subphrasesPaged = false;
+    this->m_hasSubphrases = -1;
+  }
   virtual int argFindChild(const DescriptivePhrase* child) const;
   virtual int argFindChild(const EntityRef& child) const;
   virtual int argFindChild(const smtk::mesh::MeshSet& child) const;
@@ -148,6 +157,7 @@ public:
   */
 
   static bool compareByModelInfo(const DescriptivePhrasePtr& a, const DescriptivePhrasePtr& b);
+  static bool compareEntitiesByModelInfo(const EntityRef& a, const EntityRef& b);
 
   /**\brief Ttile-based Comparison method for DescriptivePhrases
   *
@@ -168,6 +178,8 @@ protected:
   unsigned int m_phraseId;
   mutable DescriptivePhrases m_subphrases;
   mutable bool m_subphrasesBuilt;
+  bool m_subphrasesPaged;
+  int m_hasSubphrases; // -1 when the generator has not been asked
 
 private:
   static unsigned int s_nextPhraseId;
@@ -10,6 +10,7 @@
 #include "smtk/model/Entity.h"
 #include "smtk/model/Manager.h"
 
+#include "smtk/common/PoolAllocator.h"
 #include "smtk/common/StringUtil.h"
 
 #include "smtk/resource/Resource.h"
@@ -57,6 +58,7 @@ static const char* entityTypeNames[] = { "cell", "use", "shell", "group", "model
 Entity::Entity()
   : m_entityFlags(INVALID)
   , m_firstInvalid(-1)
+  , m_snapshotGeneration(0)
 {
 }
 
@@ -64,10 +66,46 @@ Entity::~Entity()
 {
 }
 
-/// Create and set up an entity object in a single call. This version sets the Entity's UUID.
+namespace
+{
+// Entity's constructor is protected; this lets std::allocate_shared call it.
+class PooledEntity : public Entity
+{
+public:
+  PooledEntity(const smtk::shared_ptr<smtk::common::MemoryPools>& pools)
+  {
+    this->m_arrangements = KindsToArrangements(KindsToArrangements::allocator_type(pools));
+  }
+};
+
+// Allocate an entity (and its shared-pointer control block and arrangement
+// map nodes) from \a pools, or from the heap when \a pools is null.
+EntityPtr createPooledEntity(const smtk::shared_ptr<smtk::common::MemoryPools>& pools)
+{
+  return std::allocate_shared<PooledEntity>(
+    smtk::common::PoolAllocator<PooledEntity>(pools), pools);
+}
+
+smtk::shared_ptr<smtk::common::MemoryPools> memoryPoolsOf(const ManagerPtr& resource)
+{
+  return resource ? resource->memoryPools() : smtk::shared_ptr<smtk::common::MemoryPools>();
+}
+}
+
+/// Create an entity object that is not allocated from any model manager's memory pools.
+EntityPtr Entity::create()
+{
+  return createPooledEntity(nullptr);
+}
+
+/**\brief Create and set up an entity object in a single call. This version sets the Entity's UUID.
+  *
+  * Models may hold hundreds of thousands of entities, so when \a resource
+  * is provided, the entity is allocated from its memory pools.
+  */
 EntityPtr Entity::create(const UUID& uid, BitFlags entityFlags, ManagerPtr resource)
 {
-  EntityPtr result = Entity::create();
+  EntityPtr result = createPooledEntity(memoryPoolsOf(resource));
   int dim = Entity::dimensionBitsToDimension(entityFlags & EntityTypeBits::ANY_DIMENSION);
   result->setId(uid);
   result->setup(entityFlags, dim, resource);
@@ -77,7 +115,7 @@ EntityPtr Entity::create(const UUID& uid, BitFlags entityFlags, ManagerPtr resou
 /// Create and set up an entity object in a single call. This version does not set the UUID.
 EntityPtr Entity::create(BitFlags entityFlags, int dimension, ManagerPtr resource)
 {
-  EntityPtr result = Entity::create();
+  EntityPtr result = createPooledEntity(memoryPoolsOf(resource));
   result->setup(entityFlags, dimension, resource);
   return result;
 }
@@ -109,6 +147,19 @@ EntityPtr Entity::setup(BitFlags entFlags, int dim, Manager::Ptr resource, bool
   return shared_from_this();
 }
 
+/// Return a copy of this entity (with the same UUID, relations, arrangements and resource).
+EntityPtr Entity::clone() const
+{
+  EntityPtr result = createPooledEntity(this->m_arrangements.get_allocator().pools());
+  result->setId(this->m_id);
+  result->m_entityFlags = this->m_entityFlags;
+  result->m_relations = this->m_relations;
+  result->m_resource = this->m_resource;
+  result->m_arrangements = this->m_arrangements;
+  result->m_firstInvalid = this->m_firstInvalid;
+  return result;
+}
+
 const ResourcePtr Entity::resource() const
 {
   return std::dynamic_pointer_cast<smtk::resource::Resource>(this->m_resource.lock());
@@ -52,14 +52,22 @@ public:
   using ResourcePtr = smtk::resource::ResourcePtr;
 
   smtkTypeMacro(Entity);
-  smtkSharedPtrCreateMacro(smtk::resource::Component);
+  smtkSharedFromThisMacro(smtk::resource::Component);
   virtual ~Entity();
 
+  static EntityPtr create();
+  static EntityPtr create(EntityPtr& ref)
+  {
+    ref = Entity::create();
+    return ref;
+  }
+
   static EntityPtr create(
     const UUID& uid, BitFlags entityFlags = EntityTypeBits::INVALID, ManagerPtr resource = nullptr);
   static EntityPtr create(BitFlags entityFlags, int dimension, ManagerPtr resource = nullptr);
   EntityPtr setup(
     BitFlags entityFlags, int dimension, ManagerPtr resource = nullptr, bool resetRelations = true);
+  EntityPtr clone() const;
 
   const ResourcePtr resource() const override;
   ManagerPtr modelResource() const;
@@ -140,6 +148,7 @@ protected:
   KindsToArrangements m_arrangements;
   int m_firstInvalid;
   smtk::common::UUID m_id;
+  int m_snapshotGeneration; // See Manager::detachEntity().
 };
 
 /// An abbreviation for the record type used by maps of Entity records.
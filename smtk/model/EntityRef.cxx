@@ -99,10 +99,14 @@ const smtk::common::UUID& EntityRef::entity() const
   return this->m_entity;
 }
 
-/// Return the smtk::model::Entity record for this model entity.
+/**\brief Return the smtk::model::Entity record for this model entity.
+  *
+  * The record may be shared with snapshots of the manager, so it must not be
+  * modified; call Manager::findEntity() on a non-const manager for that.
+  */
 smtk::model::EntityPtr EntityRef::entityRecord() const
 {
-  auto mgr = this->manager();
+  smtk::shared_ptr<const Manager> mgr = this->m_manager.lock();
   if (!mgr)
   {
     return nullptr;
@@ -129,7 +133,7 @@ smtk::resource::ComponentPtr EntityRef::component() const
   */
 int EntityRef::dimension() const
 {
-  ManagerPtr mgr = this->m_manager.lock();
+  smtk::shared_ptr<const Manager> mgr = this->m_manager.lock();
   if (mgr && !this->m_entity.isNull())
   {
     EntityPtr entRec = mgr->findEntity(this->m_entity);
@@ -149,7 +153,7 @@ int EntityRef::dimension() const
   */
 int EntityRef::dimensionBits() const
 {
-  ManagerPtr mgr = this->m_manager.lock();
+  smtk::shared_ptr<const Manager> mgr = this->m_manager.lock();
   if (mgr && !this->m_entity.isNull())
   {
     EntityPtr entRec = mgr->findEntity(this->m_entity);
@@ -230,7 +234,7 @@ int EntityRef::embeddingDimension() const
 /// Return the bit vector describing the entity's type. \sa isVector, isEdge, ...
 BitFlags EntityRef::entityFlags() const
 {
-  ManagerPtr mgr = this->m_manager.lock();
+  smtk::shared_ptr<const Manager> mgr = this->m_manager.lock();
   if (mgr && !this->m_entity.isNull())
   {
     EntityPtr entRec = mgr->findEntity(this->m_entity);
@@ -248,7 +252,7 @@ BitFlags EntityRef::entityFlags() const
   */
 std::string EntityRef::flagSummary(int form) const
 {
-  ManagerPtr mgr = this->m_manager.lock();
+  smtk::shared_ptr<const Manager> mgr = this->m_manager.lock();
   if (mgr)
   {
     EntityPtr ent = mgr->findEntity(this->m_entity);
@@ -435,28 +439,40 @@ bool EntityRef::isValid() const
   * and the entity is valid.
   */
 bool EntityRef::isValid(EntityPtr* entityRecord) const
+{
+  // Only copy a record shared with a snapshot when the caller may modify it.
+  EntityPtr rec = this->findEntityRecord(entityRecord != nullptr);
+  if (rec && entityRecord)
+  {
+    *entityRecord = rec;
+  }
+  return rec ? true : false;
+}
+
+/**\brief Return the entity's record without asking sessions to transcribe it (or NULL).
+  *
+  * Unless \a forModification is true, the record is found through the const
+  * manager so that a record shared with a snapshot is not copied just to read it.
+  */
+EntityPtr EntityRef::findEntityRecord(bool forModification) const
 {
   ManagerPtr mgr = this->m_manager.lock();
-  bool status = mgr && !this->m_entity.isNull();
-  if (status)
+  if (!mgr || this->m_entity.isNull())
   {
-    EntityPtr rec = mgr->findEntity(this->m_entity, false);
-    status = rec ? true : false;
-    if (status && entityRecord)
-    {
-      *entityRecord = rec;
-    }
+    return nullptr;
   }
-  return status;
+  return forModification ? mgr->findEntity(this->m_entity, false)
+                         : static_cast<const Manager*>(mgr.get())->findEntity(this->m_entity, false);
 }
 
 /**\brief A wrapper around EntityRef::isValid() which also verifies an arrangement exists.
   *
   */
-bool EntityRef::checkForArrangements(ArrangementKind k, EntityPtr& entRec, Arrangements*& arr) const
+bool EntityRef::checkForArrangements(
+  ArrangementKind k, EntityPtr& entRec, const Arrangements*& arr) const
 {
-  ManagerPtr mgr = this->m_manager.lock();
-  if (this->isValid(&entRec))
+  smtk::shared_ptr<const Manager> mgr = this->m_manager.lock();
+  if (this->isValid() && (entRec = this->findEntityRecord(false)))
   {
     arr = NULL;
     if ((arr = mgr->hasArrangementsOfKindForEntity(this->m_entity, k)) && !arr->empty())
@@ -492,6 +508,22 @@ EntityRefs EntityRef::boundaryEntities(int ofDimension) const
 }
 
 std::vector<double> EntityRef::boundingBox() const
+{
+  ManagerPtr mgr = this->m_manager.lock();
+  if (!mgr || this->m_entity.isNull() || this->hasFloatProperty(SMTK_BOUNDING_BOX_PROP))
+  {
+    return this->computeBoundingBox();
+  }
+  std::vector<double> bBox;
+  if (!mgr->cachedBoundingBox(this->m_entity, bBox))
+  {
+    bBox = this->computeBoundingBox();
+    mgr->cacheBoundingBox(this->m_entity, bBox);
+  }
+  return bBox;
+}
+
+std::vector<double> EntityRef::computeBoundingBox() const
 {
   std::vector<double> bBox, dummy;
   // initialize the BBox, following VTK's rule
@@ -724,6 +756,8 @@ Tessellation* EntityRef::resetTessellation()
   ManagerPtr mgr = this->m_manager.lock();
   if (mgr && !this->m_entity.isNull())
   {
+    // The caller fills in the returned tessellation.
+    mgr->invalidateBoundingBoxes();
     UUIDsToTessellations::iterator it = mgr->tessellations().find(this->m_entity);
     if (it != mgr->tessellations().end())
     {
@@ -989,8 +1023,10 @@ void EntityRef::setFloatProperty(
 
 smtk::model::FloatList const& EntityRef::floatProperty(const std::string& propName) const
 {
+  // Use the manager's const accessor; the mutable one discards cached bounding boxes.
   ManagerPtr mgr = this->m_manager.lock();
-  return mgr->floatProperty(this->m_entity, propName);
+  const Manager& cmgr(*mgr);
+  return cmgr.floatProperty(this->m_entity, propName);
 }
 
 smtk::model::FloatList& EntityRef::floatProperty(const std::string& propName)
@@ -1048,25 +1084,14 @@ std::set<std::string> EntityRef::floatPropertyNames() const
 FloatData& EntityRef::floatProperties()
 {
   ManagerPtr mgr = this->m_manager.lock();
-  auto pit = mgr->floatProperties().find(this->m_entity);
-  if (pit == mgr->floatProperties().end())
-  {
-    auto blank = std::make_pair(this->m_entity, FloatData());
-    pit = mgr->floatProperties().insert(blank).first;
-  }
-  return pit->second;
+  return *mgr->floatProperties()[this->m_entity];
 }
 
 FloatData const& EntityRef::floatProperties() const
 {
   ManagerPtr mgr = this->m_manager.lock();
-  auto pit = mgr->floatProperties().find(this->m_entity);
-  if (pit == mgr->floatProperties().end())
-  {
-    auto blank = std::make_pair(this->m_entity, FloatData());
-    pit = mgr->floatProperties().insert(blank).first;
-  }
-  return pit->second;
+  // Do not copy a record shared with a snapshot just to read it.
+  return mgr->floatProperties()[this->m_entity].data();
 }
 
 void EntityRef::setStringProperty(const std::string& propName, const smtk::model::String& propValue)
@@ -1150,25 +1175,14 @@ std::set<std::string> EntityRef::stringPropertyNames() const
 StringData& EntityRef::stringProperties()
 {
   ManagerPtr mgr = this->m_manager.lock();
-  auto pit = mgr->stringProperties().find(this->m_entity);
-  if (pit == mgr->stringProperties().end())
-  {
-    auto blank = std::make_pair(this->m_entity, StringData());
-    pit = mgr->stringProperties().insert(blank).first;
-  }
-  return pit->second;
+  return *mgr->stringProperties()[this->m_entity];
 }
 
 StringData const& EntityRef::stringProperties() const
 {
   ManagerPtr mgr = this->m_manager.lock();
-  auto pit = mgr->stringProperties().find(this->m_entity);
-  if (pit == mgr->stringProperties().end())
-  {
-    auto blank = std::make_pair(this->m_entity, StringData());
-    pit = mgr->stringProperties().insert(blank).first;
-  }
-  return pit->second;
+  // Do not copy a record shared with a snapshot just to read it.
+  return mgr->stringProperties()[this->m_entity].data();
 }
 
 void EntityRef::setIntegerProperty(const std::string& propName, smtk::model::Integer propValue)
@@ -1252,31 +1266,20 @@ std::set<std::string> EntityRef::integerPropertyNames() const
 IntegerData& EntityRef::integerProperties()
 {
   ManagerPtr mgr = this->m_manager.lock();
-  auto pit = mgr->integerProperties().find(this->m_entity);
-  if (pit == mgr->integerProperties().end())
-  {
-    auto blank = std::make_pair(this->m_entity, IntegerData());
-    pit = mgr->integerProperties().insert(blank).first;
-  }
-  return pit->second;
+  return *mgr->integerProperties()[this->m_entity];
 }
 
 IntegerData const& EntityRef::integerProperties() const
 {
   ManagerPtr mgr = this->m_manager.lock();
-  auto pit = mgr->integerProperties().find(this->m_entity);
-  if (pit == mgr->integerProperties().end())
-  {
-    auto blank = std::make_pair(this->m_entity, IntegerData());
-    pit = mgr->integerProperties().insert(blank).first;
-  }
-  return pit->second;
+  // Do not copy a record shared with a snapshot just to read it.
+  return mgr->integerProperties()[this->m_entity].data();
 }
 
 /// Return the number of arrangements of the given kind \a k.
 int EntityRef::numberOfArrangementsOfKind(ArrangementKind k) const
 {
-  ManagerPtr mgr = this->m_manager.lock();
+  smtk::shared_ptr<const Manager> mgr = this->m_manager.lock();
   const Arrangements* arr = mgr->hasArrangementsOfKindForEntity(this->m_entity, k);
   return arr ? static_cast<int>(arr->size()) : 0;
 }
@@ -1291,7 +1294,7 @@ Arrangement* EntityRef::findArrangement(ArrangementKind k, int i)
 /// Return the \a i-th arrangement of kind \a k (or NULL).
 const Arrangement* EntityRef::findArrangement(ArrangementKind k, int i) const
 {
-  ManagerPtr mgr = this->m_manager.lock();
+  smtk::shared_ptr<const Manager> mgr = this->m_manager.lock();
   return mgr->findArrangement(this->m_entity, k, i);
 }
 
@@ -1309,7 +1312,7 @@ EntityRef EntityRef::relationFromArrangement(
   ArrangementKind k, int arrangementIndex, int offset) const
 {
   ManagerPtr mgr = this->m_manager.lock();
-  EntityPtr ent = mgr->findEntity(this->m_entity);
+  EntityPtr ent = static_cast<const Manager*>(mgr.get())->findEntity(this->m_entity);
   if (ent)
   {
     const Arrangement* arr = this->findArrangement(k, arrangementIndex);
@@ -1539,12 +1542,9 @@ std::size_t entityrefHash(const EntityRef& c)
 template <>
 SMTKCORE_EXPORT StringData* EntityRef::properties<StringData>()
 {
-  if (!this->hasStringProperties())
+  if (!this->manager() || !this->entity())
   {
-    if (!this->manager() || !this->entity())
-      return NULL;
-    StringData blank;
-    this->manager()->stringProperties().insert(std::pair<UUID, StringData>(this->entity(), blank));
+    return NULL;
   }
   return &(this->stringProperties());
 }
@@ -1552,12 +1552,9 @@ SMTKCORE_EXPORT StringData* EntityRef::properties<StringData>()
 template <>
 SMTKCORE_EXPORT FloatData* EntityRef::properties<FloatData>()
 {
-  if (!this->hasFloatProperties())
+  if (!this->manager() || !this->entity())
   {
-    if (!this->manager() || !this->entity())
-      return NULL;
-    FloatData blank;
-    this->manager()->floatProperties().insert(std::pair<UUID, FloatData>(this->entity(), blank));
+    return NULL;
   }
   return &(this->floatProperties());
 }
@@ -1565,13 +1562,9 @@ SMTKCORE_EXPORT FloatData* EntityRef::properties<FloatData>()
 template <>
 SMTKCORE_EXPORT IntegerData* EntityRef::properties<IntegerData>()
 {
-  if (!this->hasIntegerProperties())
+  if (!this->manager() || !this->entity())
   {
-    if (!this->manager() || !this->entity())
-      return NULL;
-    IntegerData blank;
-    this->manager()->integerProperties().insert(
-      std::pair<UUID, IntegerData>(this->entity(), blank));
+    return NULL;
   }
   return &(this->integerProperties());
 }
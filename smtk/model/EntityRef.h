@@ -62,9 +62,9 @@ class MeshSet;
   bool isValid() const { return this->EntityRef::isValid(); }                                      \
   bool isValid(EntityPtr* entRec) const override                                                   \
   {                                                                                                \
-    EntityPtr er;                                                                                  \
-    if (/* NB: EntityRef::isValid() may return true even when er == NULL */                        \
-      this->EntityRef::isValid(&er) && er && smtk::model::typecheck(er->entityFlags()))            \
+    /* Only copy a record shared with a snapshot when the caller may modify it. */                 \
+    EntityPtr er = this->findEntityRecord(entRec != nullptr);                                      \
+    if (er && smtk::model::typecheck(er->entityFlags()))                                           \
     {                                                                                              \
       if (entRec)                                                                                  \
         *entRec = er;                                                                              \
@@ -138,7 +138,8 @@ public:
 
   bool isValid() const;
   virtual bool isValid(EntityPtr* entityRecord) const;
-  virtual bool checkForArrangements(ArrangementKind k, EntityPtr& entry, Arrangements*& arr) const;
+  virtual bool checkForArrangements(
+    ArrangementKind k, EntityPtr& entry, const Arrangements*& arr) const;
 
   bool isCellEntity() const { return smtk::model::isCellEntity(this->entityFlags()); }
   bool isUseEntity() const { return smtk::model::isUseEntity(this->entityFlags()); }
@@ -183,6 +184,9 @@ public:
   EntityRefs bordantEntities(int ofDimension = -2) const;
   EntityRefs boundaryEntities(int ofDimension = -2) const;
 
+  // Return the bounding box as [xmin, xmax, ymin, ymax, zmin, zmax]. Boxes of
+  // entities without their own (models, groups, volumes) are unions of their
+  // children's and are cached by the manager until its geometry changes.
   std::vector<double> boundingBox() const;
   std::vector<double> unionBoundingBox(
     const std::vector<double>& b1, const std::vector<double>& b2) const;
@@ -321,6 +325,8 @@ protected:
   WeakManagerPtr m_manager;
   smtk::common::UUID m_entity;
 
+  EntityPtr findEntityRecord(bool forModification) const;
+
   // Manage subset_of/superset_of relationships
   EntityRef& addMemberEntity(const EntityRef& memberToAdd);
   template <typename T>
@@ -333,6 +339,9 @@ protected:
   EntityRef& removeMemberEntities(T begin, T end);
 
   ManagerEventRelationType subsetRelationType(const EntityRef& member) const;
+
+  // Compute the bounding box without consulting the manager's cache.
+  std::vector<double> computeBoundingBox() const;
   ManagerEventRelationType embeddingRelationType(const EntityRef& embedded) const;
 };
 
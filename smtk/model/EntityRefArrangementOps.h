@@ -32,13 +32,13 @@ public:
   static T firstRelation(const EntityRef& c, ArrangementKind k)
   {
     EntityPtr entRec;
-    Arrangements* arr;
+    const Arrangements* arr;
     if (c.checkForArrangements(k, entRec, arr))
     {
       smtk::common::UUIDArray const& relations(entRec->relations());
-      for (Arrangements::iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
+      for (Arrangements::const_iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
       {
-        std::vector<int>::iterator it;
+        std::vector<int>::const_iterator it;
         for (it = arrIt->details().begin(); it != arrIt->details().end(); ++it)
         {
           return T(c.manager(), relations[*it]);
@@ -57,7 +57,7 @@ public:
   static void appendAllRelations(const EntityRef& c, ArrangementKind k, T& result)
   {
     EntityPtr entRec;
-    Arrangements* arr;
+    const Arrangements* arr;
     if (c.checkForArrangements(k, entRec, arr))
     {
       switch (k)
@@ -92,10 +92,10 @@ public:
     */
   template <typename T>
   static void appendAllUseHasCellRelations(
-    ManagerPtr manager, EntityPtr entRec, Arrangements* arr, T& result)
+    ManagerPtr manager, EntityPtr entRec, const Arrangements* arr, T& result)
   {
     smtk::common::UUIDArray const& relations(entRec->relations());
-    for (Arrangements::iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
+    for (Arrangements::const_iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
     {
       // Use HAS_CELL arrangements are specified as [relIdx, sense] tuples.
       int relIdx, relSense;
@@ -109,10 +109,10 @@ public:
   }
   template <typename T>
   static void appendAllCellHasUseRelations(
-    ManagerPtr manager, EntityPtr entRec, Arrangements* arr, T& result)
+    ManagerPtr manager, EntityPtr entRec, const Arrangements* arr, T& result)
   {
     smtk::common::UUIDArray const& relations(entRec->relations());
-    for (Arrangements::iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
+    for (Arrangements::const_iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
     {
       // Cell HAS_USE arrangements are specified as [relIdx, sense, orientation] tuples.
       int relIdx, relSense;
@@ -127,10 +127,10 @@ public:
   }
   template <typename T>
   static void appendAllShellHasUseRelations(
-    ManagerPtr manager, EntityPtr entRec, Arrangements* arr, T& result)
+    ManagerPtr manager, EntityPtr entRec, const Arrangements* arr, T& result)
   {
     smtk::common::UUIDArray const& relations(entRec->relations());
-    for (Arrangements::iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
+    for (Arrangements::const_iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
     {
       // Shell HAS_USE arrangements are specified as [min,max[ offset-ranges,
       // not arrays of offset values.
@@ -175,12 +175,12 @@ public:
   }
   template <typename T>
   static void appendAllSimpleRelations(
-    ManagerPtr manager, EntityPtr entRec, Arrangements* arr, T& result)
+    ManagerPtr manager, EntityPtr entRec, const Arrangements* arr, T& result)
   {
     smtk::common::UUIDArray const& relations(entRec->relations());
-    for (Arrangements::iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
+    for (Arrangements::const_iterator arrIt = arr->begin(); arrIt != arr->end(); ++arrIt)
     {
-      std::vector<int>::iterator it;
+      std::vector<int>::const_iterator it;
       for (it = arrIt->details().begin(); it != arrIt->details().end(); ++it)
       {
         if (*it < 0)
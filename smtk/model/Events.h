@@ -147,6 +147,20 @@ typedef std::pair<OneToManyCallback, void*> OneToManyObserver;
 /// A trigger entry for an event-observer pair.
 typedef std::pair<ManagerEventType, OneToManyObserver> OneToManyTrigger;
 
+/**\brief Callbacks for batches of events.
+  *
+  * Each entity appears at most once per batch. For relationship events, the
+  * batch holds the first entity of each relationship (e.g., the model of
+  * MODEL_INCLUDES_FREE_CELL).
+  * Inside a Manager transaction, batches are delivered when the outermost
+  * transaction ends; otherwise each event is delivered as a batch of one.
+  */
+typedef int (*BatchCallback)(ManagerEventType, const smtk::model::EntityRefArray&, void*);
+/// An observer of batches of events.
+typedef std::pair<BatchCallback, void*> BatchObserver;
+/// A trigger entry for an event-observer pair.
+typedef std::pair<ManagerEventType, BatchObserver> BatchTrigger;
+
 typedef smtk::operation::Operator::EventType OperatorEventType;
 typedef smtk::operation::Operator::Callback BareOperatorCallback;
 typedef smtk::operation::Operator::Observer BareOperatorObserver;
@@ -12,6 +12,7 @@
 
 #include "smtk/SystemConfig.h"
 
+#include "smtk/common/CopyOnWrite.h"
 #include "smtk/common/UUID.h"
 
 #include <map>
@@ -26,8 +27,10 @@ namespace model
 typedef double Float;
 typedef std::vector<Float> FloatList;
 typedef std::map<std::string, FloatList> FloatData;
-typedef std::map<smtk::common::UUID, FloatData> UUIDsToFloatData;
+/// Each entity's record is shared with snapshots of its Manager until it is modified.
+typedef std::map<smtk::common::UUID, smtk::common::CopyOnWrite<FloatData> > UUIDsToFloatData;
 typedef UUIDsToFloatData::iterator UUIDWithFloatProperties;
+typedef UUIDsToFloatData::const_iterator UUIDWithConstFloatProperties;
 typedef FloatData::iterator PropertyNameWithFloats;
 typedef FloatData::const_iterator PropertyNameWithConstFloats;
 
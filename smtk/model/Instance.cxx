@@ -10,6 +10,7 @@
 #include "smtk/model/Instance.h"
 
 #include "smtk/model/Arrangement.h"
+#include "smtk/model/BVHPointLocator.h"
 #include "smtk/model/EntityRefArrangementOps.h"
 #include "smtk/model/Manager.h"
 #include "smtk/model/PointLocatorExtension.h"
@@ -102,12 +103,23 @@ static void SnapPlacementsTo(const Instance& inst, const EntityRefs& snaps, Tess
   }
   auto snapper = smtk::common::Extension::findAs<PointLocatorExtension>(snapRule);
   if (!snapper)
+  {
+    // Fall back to projecting onto the SMTK tessellation so that snapping
+    // works without the VTK/ParaView locators.
+    snapper = BVHPointLocator::create();
+  }
+  if (!snapper)
   {
     smtkErrorMacro(inst.manager()->log(), "Could not create object (" << snapRule << ")"
                                                                       << " to perform snapping.");
     return;
   }
-  snapper->closestPointOn(*snaps.begin(), tess->coords(), tess->coords());
+  if (!snapper->closestPointOn(*snaps.begin(), tess->coords(), tess->coords()))
+  {
+    smtkErrorMacro(inst.manager()->log(), "Could not snap placements of " << inst.name() << " to "
+                                                                          << snaps.begin()->name()
+                                                                          << ".");
+  }
 }
 
 static void ComputeBounds(Tessellation* tess, const std::vector<double>& pbox, double bbox[6])
@@ -12,6 +12,7 @@
 
 #include "smtk/SystemConfig.h"
 
+#include "smtk/common/CopyOnWrite.h"
 #include "smtk/common/UUID.h"
 
 #include <map>
@@ -26,8 +27,10 @@ namespace model
 typedef long Integer;
 typedef std::vector<long> IntegerList;
 typedef std::map<std::string, IntegerList> IntegerData;
-typedef std::map<smtk::common::UUID, IntegerData> UUIDsToIntegerData;
+/// Each entity's record is shared with snapshots of its Manager until it is modified.
+typedef std::map<smtk::common::UUID, smtk::common::CopyOnWrite<IntegerData> > UUIDsToIntegerData;
 typedef UUIDsToIntegerData::iterator UUIDWithIntegerProperties;
+typedef UUIDsToIntegerData::const_iterator UUIDWithConstIntegerProperties;
 typedef IntegerData::iterator PropertyNameWithIntegers;
 typedef IntegerData::const_iterator PropertyNameWithConstIntegers;
 
@@ -71,7 +71,9 @@ namespace model
 /// Create a default, empty model manager.
 Manager::Manager()
   : smtk::resource::Resource(nullptr)
-  , m_topology(new UUIDsToEntities)
+  , m_memoryPools(new smtk::common::MemoryPools)
+  , m_topology(new UUIDsToEntities(
+      std::less<smtk::common::UUID>(), UUIDsToEntities::allocator_type(m_memoryPools)))
   , m_floatData(new UUIDsToFloatData)
   , m_stringData(new UUIDsToStringData)
   , m_integerData(new UUIDsToIntegerData)
@@ -82,6 +84,9 @@ Manager::Manager()
   , m_sessions(new UUIDsToSessions)
   , m_resources(new Set)
   , m_globalCounters(2, 1) // first entry is session counter, second is model counter
+  , m_transactionDepth(0)
+  , m_isSnapshot(false)
+  , m_snapshotGeneration(0)
 {
   // TODO: throw() when topology == NULL?
   this->log().setFlushToStdout(false);
@@ -92,6 +97,7 @@ Manager::Manager(shared_ptr<UUIDsToEntities> inTopology, shared_ptr<UUIDsToTesse
   shared_ptr<UUIDsToTessellations> analysismesh, shared_ptr<smtk::mesh::Manager> meshes,
   shared_ptr<UUIDsToAttributeAssignments> attribs)
   : smtk::resource::Resource(nullptr)
+  , m_memoryPools(new smtk::common::MemoryPools)
   , m_topology(inTopology)
   , m_floatData(new UUIDsToFloatData)
   , m_stringData(new UUIDsToStringData)
@@ -103,6 +109,9 @@ Manager::Manager(shared_ptr<UUIDsToEntities> inTopology, shared_ptr<UUIDsToTesse
   , m_sessions(new UUIDsToSessions)
   , m_resources(new Set)
   , m_globalCounters(2, 1) // first entry is session counter, second is model counter
+  , m_transactionDepth(0)
+  , m_isSnapshot(false)
+  , m_snapshotGeneration(0)
 {
   this->log().setFlushToStdout(false);
 }
@@ -118,7 +127,10 @@ Manager::~Manager()
     // listeners that deletions are occurring.
     this->unregisterSession(this->m_defaultSession, false);
   }
-  this->m_attributeAssignments->clear();
+  if (!this->m_attributeAssignments.isShared())
+  {
+    this->m_attributeAssignments->clear();
+  }
 }
 //@}
 
@@ -127,34 +139,39 @@ Manager::~Manager()
   *
   */
 //@{
+/**\brief Return the table of entity records.
+  *
+  * Records in the table may be shared with snapshots of this manager.
+  * Call the non-const findEntity() to obtain a record you intend to modify.
+  */
 UUIDsToEntities& Manager::topology()
 {
-  return *this->m_topology.get();
+  return *this->m_topology;
 }
 
 const UUIDsToEntities& Manager::topology() const
 {
-  return *this->m_topology.get();
+  return *this->m_topology;
 }
 
 UUIDsToTessellations& Manager::tessellations()
 {
-  return *this->m_tessellations.get();
+  return *this->m_tessellations;
 }
 
 const UUIDsToTessellations& Manager::tessellations() const
 {
-  return *this->m_tessellations.get();
+  return *this->m_tessellations;
 }
 
 UUIDsToTessellations& Manager::analysisMesh()
 {
-  return *this->m_analysisMesh.get();
+  return *this->m_analysisMesh;
 }
 
 const UUIDsToTessellations& Manager::analysisMesh() const
 {
-  return *this->m_analysisMesh.get();
+  return *this->m_analysisMesh;
 }
 
 smtk::mesh::ManagerPtr Manager::meshes() const
@@ -162,6 +179,67 @@ smtk::mesh::ManagerPtr Manager::meshes() const
   return this->m_meshes;
 }
 
+/**\brief Return a read-only copy of this manager's model records.
+  *
+  * The snapshot shares the entity, property, tessellation and attribute
+  * association tables with this manager, so taking it is cheap regardless
+  * of model size. The first change to a shared table makes a shallow copy
+  * of it; the entity and property records it holds remain shared, and each
+  * is copied only when this manager modifies it. (Tessellations and
+  * attribute associations are copied a table at a time.) The snapshot thus
+  * never observes later changes.
+  *
+  * Other threads may read a snapshot while this manager is being modified,
+  * provided they use const access (e.g., through a `const Manager&`);
+  * non-const accessors may copy shared data.
+  *
+  * Snapshots have no sessions, observers or meshes and must not be modified.
+  * Entity records obtained from this manager before the snapshot was taken
+  * should not be modified after it is taken; fetch them again instead.
+  */
+ManagerPtr Manager::snapshot()
+{
+  ManagerPtr result = Manager::create();
+  result->m_topology = this->m_topology;
+  result->m_floatData = this->m_floatData;
+  result->m_stringData = this->m_stringData;
+  result->m_integerData = this->m_integerData;
+  result->m_tessellations = this->m_tessellations;
+  result->m_analysisMesh = this->m_analysisMesh;
+  result->m_attributeAssignments = this->m_attributeAssignments;
+  result->m_globalCounters = this->m_globalCounters;
+  result->m_memoryPools = this->m_memoryPools;
+  result->m_isSnapshot = true;
+  ++this->m_snapshotGeneration;
+  return result;
+}
+
+/**\brief Replace this manager's model records with those of a \a snapshot.
+  *
+  * This is intended for undoing operations; the snapshot remains valid and
+  * may be restored again. Since tables are shared, this is cheap.
+  *
+  * Observers are not notified of the changes, and sessions are not informed;
+  * applications should rebuild any state that depends on the model.
+  */
+void Manager::restore(const ManagerPtr& snapshot)
+{
+  if (!snapshot || snapshot.get() == this)
+  {
+    return;
+  }
+  this->m_topology = snapshot->m_topology;
+  this->m_floatData = snapshot->m_floatData;
+  this->m_stringData = snapshot->m_stringData;
+  this->m_integerData = snapshot->m_integerData;
+  this->m_tessellations = snapshot->m_tessellations;
+  this->m_analysisMesh = snapshot->m_analysisMesh;
+  this->m_attributeAssignments = snapshot->m_attributeAssignments;
+  this->m_globalCounters = snapshot->m_globalCounters;
+  ++this->m_snapshotGeneration;
+  this->invalidateBoundingBoxes();
+}
+
 const UUIDsToAttributeAssignments& Manager::attributeAssignments() const
 {
   return *this->m_attributeAssignments;
@@ -186,6 +264,7 @@ const UUIDsToAttributeAssignments& Manager::attributeAssignments() const
   */
 SessionInfoBits Manager::erase(const UUID& uid, SessionInfoBits flags)
 {
+  this->invalidateBoundingBoxes();
   SessionInfoBits actual = flags;
   if (flags & SESSION_ENTITY_RELATIONS)
     actual |= SESSION_ARRANGEMENTS;
@@ -198,6 +277,7 @@ SessionInfoBits Manager::erase(const UUID& uid, SessionInfoBits flags)
     if (ent != this->m_topology->end())
     {
       haveEnt = true;
+      this->detachEntity(ent);
       if (flags & SESSION_ENTITY_TYPE)
       {
         // Trigger an event before the erasure so the observers
@@ -470,6 +550,7 @@ Manager::iter_type Manager::insertEntity(EntityPtr c)
 Manager::iter_type Manager::setEntityOfTypeAndDimension(
   const UUID& uid, BitFlags entityFlags, int dim)
 {
+  this->invalidateBoundingBoxes();
   UUIDWithEntityPtr it;
   if (uid.isNull())
   {
@@ -487,6 +568,7 @@ Manager::iter_type Manager::setEntityOfTypeAndDimension(
   }
   EntityPtr entrec = Entity::create(entityFlags, dim, shared_from_this());
   entrec->setId(uid);
+  entrec->m_snapshotGeneration = this->m_snapshotGeneration;
   std::pair<UUID, EntityPtr> entry(uid, entrec);
   this->prepareForEntity(entry);
   std::pair<Manager::iter_type, bool> result = this->m_topology->insert(entry);
@@ -506,8 +588,10 @@ Manager::iter_type Manager::setEntityOfTypeAndDimension(
   */
 Manager::iter_type Manager::setEntity(EntityPtr c)
 {
+  this->invalidateBoundingBoxes();
   UUIDWithEntityPtr it;
   c->reparent(shared_from_this());
+  c->m_snapshotGeneration = this->m_snapshotGeneration;
   if (c->id().isNull())
   {
     std::ostringstream msg;
@@ -589,14 +673,14 @@ UUID Manager::addCellOfDimensionWithUUID(const UUID& uid, int dim)
 /// Return the type of entity that the link represents.
 BitFlags Manager::type(const UUID& ofEntity) const
 {
-  UUIDWithEntityPtr it = this->m_topology->find(ofEntity);
+  UUIDWithConstEntityPtr it = this->m_topology->find(ofEntity);
   return (it == this->m_topology->end() ? INVALID : it->second->entityFlags());
 }
 
 /// Return the dimension of the manifold that the passed entity represents.
 int Manager::dimension(const UUID& ofEntity) const
 {
-  UUIDWithEntityPtr it = this->m_topology->find(ofEntity);
+  UUIDWithConstEntityPtr it = this->m_topology->find(ofEntity);
   return (it == this->m_topology->end() ? -1 : it->second->dimension());
 }
 
@@ -616,7 +700,7 @@ std::string Manager::name(const UUID& ofEntity) const
       return nprop[0];
     }
   }
-  UUIDWithEntityPtr it = this->m_topology->find(ofEntity);
+  UUIDWithConstEntityPtr it = this->m_topology->find(ofEntity);
   if (it == this->m_topology->end())
   {
     return "invalid id " + ofEntity.toString();
@@ -706,7 +790,7 @@ UUIDs Manager::boundaryEntities(const UUID& ofEntity, int ofDimension) const
     // can't ask for "lower" dimensional boundaries that are higher than the dimension of this cell.
     return result;
   }
-  UUIDWithEntityPtr other;
+  UUIDWithConstEntityPtr other;
   for (UUIDArray::const_iterator ai = it->second->relations().begin();
        ai != it->second->relations().end(); ++ai)
   {
@@ -895,6 +979,10 @@ UUIDs Manager::entitiesOfDimension(int dim)
 //@}
 
 /**\brief Return the smtk::model::Entity associated with \a uid (or NULL).
+  *
+  * The record returned may be shared with snapshots of this manager and
+  * must not be modified; use the non-const overload to obtain a record that
+  * you intend to modify.
   *
   * Note that even though const, this method may change the records in
   * \a m_topology when \a trySessions is true (as transcription may modify
@@ -906,7 +994,7 @@ UUIDs Manager::entitiesOfDimension(int dim)
   */
 EntityPtr Manager::findEntity(const UUID& uid, bool trySessions) const
 {
-  UUIDWithEntityPtr it = this->m_topology->find(uid);
+  UUIDWithConstEntityPtr it = this->m_topology->find(uid);
   if (it == this->m_topology->end())
   {
     // Not in storage... is it in any session's dangling entity list?
@@ -932,6 +1020,41 @@ EntityPtr Manager::findEntity(const UUID& uid, bool trySessions) const
   return it->second;
 }
 
+/**\brief Return the smtk::model::Entity associated with \a uid (or NULL) for modification.
+  *
+  * Unlike the const overload, this copies the record first if it is shared
+  * with a snapshot, so changes made through the returned pointer are not
+  * seen by snapshots. Snapshots themselves are read-only and never copy.
+  */
+EntityPtr Manager::findEntity(const UUID& uid, bool trySessions)
+{
+  if (!this->m_isSnapshot)
+  {
+    UUIDWithEntityPtr it = this->m_topology->find(uid);
+    if (it != this->m_topology->end())
+    {
+      this->detachEntity(it);
+      return it->second;
+    }
+  }
+  // Records transcribed by sessions are new, so they are not shared.
+  return static_cast<const Manager*>(this)->findEntity(uid, trySessions);
+}
+
+/**\brief Copy the entity record at \a it if it is shared with a snapshot.
+  *
+  * Methods that modify records found in the topology() table directly
+  * (rather than through the non-const findEntity()) must call this first.
+  */
+void Manager::detachEntity(UUIDWithEntityPtr it)
+{
+  if (!this->m_isSnapshot && it->second->m_snapshotGeneration != this->m_snapshotGeneration)
+  {
+    it->second = it->second->clone();
+    it->second->m_snapshotGeneration = this->m_snapshotGeneration;
+  }
+}
+
 smtk::resource::ComponentPtr Manager::find(const smtk::common::UUID& uid) const
 {
   return std::dynamic_pointer_cast<smtk::resource::Component>(this->findEntity(uid));
@@ -962,7 +1085,7 @@ void Manager::insertEntityReferences(const UUIDWithEntityPtr& c)
   */
 bool Manager::elideOneEntityReference(const UUIDWithEntityPtr& c, const UUID& r)
 {
-  UUIDArray::const_iterator bit;
+  this->detachEntity(c);
   return c->second->invalidateRelation(r) < 0 ? false : true;
 }
 
@@ -1025,6 +1148,7 @@ void Manager::addToGroup(const UUID& groupId, const UUIDs& uids)
   {
     return;
   }
+  this->detachEntity(result);
 
   for (UUIDs::const_iterator it = uids.begin(); it != uids.end(); ++it)
   {
@@ -1050,17 +1174,25 @@ void Manager::setFloatProperty(
 {
   if (!entity.isNull())
   {
-    (*this->m_floatData)[entity][propName] = propValue;
+    if (propName == SMTK_BOUNDING_BOX_PROP)
+    {
+      this->invalidateBoundingBoxes();
+    }
+    (*(*this->m_floatData)[entity])[propName] = propValue;
   }
 }
 
 smtk::model::FloatList const& Manager::floatProperty(
   const UUID& entity, const std::string& propName) const
 {
-  if (!entity.isNull())
+  auto it = this->m_floatData->find(entity);
+  if (it != this->m_floatData->end())
   {
-    FloatData& floats((*this->m_floatData)[entity]);
-    return floats[propName];
+    auto pit = it->second->find(propName);
+    if (pit != it->second->end())
+    {
+      return pit->second;
+    }
   }
   static FloatList dummy;
   return dummy;
@@ -1070,7 +1202,12 @@ smtk::model::FloatList& Manager::floatProperty(const UUID& entity, const std::st
 {
   if (!entity.isNull())
   {
-    FloatData& floats((*this->m_floatData)[entity]);
+    // The caller may modify the bounding box through the returned reference.
+    if (propName == SMTK_BOUNDING_BOX_PROP)
+    {
+      this->invalidateBoundingBoxes();
+    }
+    FloatData& floats(*(*this->m_floatData)[entity]);
     return floats[propName];
   }
   static FloatList dummy;
@@ -1084,9 +1221,9 @@ bool Manager::hasFloatProperty(const UUID& entity, const std::string& propName)
   {
     return false;
   }
-  FloatData::const_iterator sit = uit->second.find(propName);
+  FloatData::const_iterator sit = uit->second->find(propName);
   // FIXME: Should we return true even when the array (*sit) is empty?
-  return sit == uit->second.end() ? false : true;
+  return sit == uit->second->end() ? false : true;
 }
 
 bool Manager::removeFloatProperty(const UUID& entity, const std::string& propName)
@@ -1096,18 +1233,22 @@ bool Manager::removeFloatProperty(const UUID& entity, const std::string& propNam
   {
     return false;
   }
-  FloatData::iterator sit = uit->second.find(propName);
-  if (sit == uit->second.end())
+  // Test for the property before modifying a record that may be shared with a snapshot.
+  if (uit->second.data().find(propName) == uit->second.data().end())
   {
     return false;
   }
-  uit->second.erase(sit);
-  if (uit->second.empty())
+  if (propName == SMTK_BOUNDING_BOX_PROP)
+  {
+    this->invalidateBoundingBoxes();
+  }
+  uit->second->erase(propName);
+  if (uit->second->empty())
     this->m_floatData->erase(uit);
   return true;
 }
 
-const UUIDWithFloatProperties Manager::floatPropertiesForEntity(const UUID& entity) const
+UUIDWithConstFloatProperties Manager::floatPropertiesForEntity(const UUID& entity) const
 {
   return this->m_floatData->find(entity);
 }
@@ -1130,17 +1271,21 @@ void Manager::setStringProperty(
 {
   if (!entity.isNull())
   {
-    (*this->m_stringData)[entity][propName] = propValue;
+    (*(*this->m_stringData)[entity])[propName] = propValue;
   }
 }
 
 smtk::model::StringList const& Manager::stringProperty(
   const UUID& entity, const std::string& propName) const
 {
-  if (!entity.isNull())
+  auto it = this->m_stringData->find(entity);
+  if (it != this->m_stringData->end())
   {
-    StringData& strings((*this->m_stringData)[entity]);
-    return strings[propName];
+    auto pit = it->second->find(propName);
+    if (pit != it->second->end())
+    {
+      return pit->second;
+    }
   }
   static StringList dummy;
   return dummy;
@@ -1150,7 +1295,7 @@ smtk::model::StringList& Manager::stringProperty(const UUID& entity, const std::
 {
   if (!entity.isNull())
   {
-    StringData& strings((*this->m_stringData)[entity]);
+    StringData& strings(*(*this->m_stringData)[entity]);
     return strings[propName];
   }
   static StringList dummy;
@@ -1164,9 +1309,9 @@ bool Manager::hasStringProperty(const UUID& entity, const std::string& propName)
   {
     return false;
   }
-  StringData::const_iterator sit = uit->second.find(propName);
+  StringData::const_iterator sit = uit->second->find(propName);
   // FIXME: Should we return true even when the array (*sit) is empty?
-  return sit == uit->second.end() ? false : true;
+  return sit == uit->second->end() ? false : true;
 }
 
 bool Manager::removeStringProperty(const UUID& entity, const std::string& propName)
@@ -1176,18 +1321,18 @@ bool Manager::removeStringProperty(const UUID& entity, const std::string& propNa
   {
     return false;
   }
-  StringData::iterator sit = uit->second.find(propName);
-  if (sit == uit->second.end())
+  // Test for the property before modifying a record that may be shared with a snapshot.
+  if (uit->second.data().find(propName) == uit->second.data().end())
   {
     return false;
   }
-  uit->second.erase(sit);
-  if (uit->second.empty())
+  uit->second->erase(propName);
+  if (uit->second->empty())
     this->m_stringData->erase(uit);
   return true;
 }
 
-const UUIDWithStringProperties Manager::stringPropertiesForEntity(const UUID& entity) const
+UUIDWithConstStringProperties Manager::stringPropertiesForEntity(const UUID& entity) const
 {
   return this->m_stringData->find(entity);
 }
@@ -1210,17 +1355,21 @@ void Manager::setIntegerProperty(
 {
   if (!entity.isNull())
   {
-    (*this->m_integerData)[entity][propName] = propValue;
+    (*(*this->m_integerData)[entity])[propName] = propValue;
   }
 }
 
 smtk::model::IntegerList const& Manager::integerProperty(
   const UUID& entity, const std::string& propName) const
 {
-  if (!entity.isNull())
+  auto it = this->m_integerData->find(entity);
+  if (it != this->m_integerData->end())
   {
-    IntegerData& integers((*this->m_integerData)[entity]);
-    return integers[propName];
+    auto pit = it->second->find(propName);
+    if (pit != it->second->end())
+    {
+      return pit->second;
+    }
   }
   static IntegerList dummy;
   return dummy;
@@ -1230,7 +1379,7 @@ smtk::model::IntegerList& Manager::integerProperty(const UUID& entity, const std
 {
   if (!entity.isNull())
   {
-    IntegerData& integers((*this->m_integerData)[entity]);
+    IntegerData& integers(*(*this->m_integerData)[entity]);
     return integers[propName];
   }
   static IntegerList dummy;
@@ -1244,9 +1393,9 @@ bool Manager::hasIntegerProperty(const UUID& entity, const std::string& propName
   {
     return false;
   }
-  IntegerData::const_iterator sit = uit->second.find(propName);
+  IntegerData::const_iterator sit = uit->second->find(propName);
   // FIXME: Should we return true even when the array (*sit) is empty?
-  return sit == uit->second.end() ? false : true;
+  return sit == uit->second->end() ? false : true;
 }
 
 bool Manager::removeIntegerProperty(const UUID& entity, const std::string& propName)
@@ -1256,18 +1405,18 @@ bool Manager::removeIntegerProperty(const UUID& entity, const std::string& propN
   {
     return false;
   }
-  IntegerData::iterator sit = uit->second.find(propName);
-  if (sit == uit->second.end())
+  // Test for the property before modifying a record that may be shared with a snapshot.
+  if (uit->second.data().find(propName) == uit->second.data().end())
   {
     return false;
   }
-  uit->second.erase(sit);
-  if (uit->second.empty())
+  uit->second->erase(propName);
+  if (uit->second->empty())
     this->m_integerData->erase(uit);
   return true;
 }
 
-const UUIDWithIntegerProperties Manager::integerPropertiesForEntity(const UUID& entity) const
+UUIDWithConstIntegerProperties Manager::integerPropertiesForEntity(const UUID& entity) const
 {
   return this->m_integerData->find(entity);
 }
@@ -1831,21 +1980,23 @@ Manager::tess_iter_type Manager::setTessellation(
   if (cellId.isNull())
     throw std::string("Nil cell ID");
 
-  smtk::shared_ptr<UUIDsToTessellations> storage;
+  this->invalidateBoundingBoxes();
+  UUIDsToTessellations* storage;
   const char* genProp;
   if (!analysis)
   { // store as display tessellation
-    storage = this->m_tessellations;
+    storage = &*this->m_tessellations;
     genProp = SMTK_TESS_GEN_PROP;
   }
   else
   { // store as analysis mesh
-    storage = this->m_analysisMesh;
+    storage = &*this->m_analysisMesh;
     genProp = SMTK_MESH_GEN_PROP;
   }
 
   tess_iter_type result = storage->find(cellId);
-  if (result == storage->end())
+  bool added = result == storage->end();
+  if (added)
   {
     std::pair<UUID, Tessellation> blank;
     blank.first = cellId;
@@ -1862,6 +2013,11 @@ Manager::tess_iter_type Manager::setTessellation(
   if (generation)
     *generation = gen[0];
 
+  if (!analysis)
+  {
+    this->trigger(std::make_pair(added ? ADD_EVENT : MOD_EVENT, TESSELLATION_ENTRY),
+      EntityRef(this->shared_from_this(), cellId));
+  }
   return result;
 }
 
@@ -1885,16 +2041,16 @@ Manager::tess_iter_type Manager::setTessellationAndBoundingBox(
   if (cellId.isNull())
     throw std::string("Nil cell ID");
 
-  smtk::shared_ptr<UUIDsToTessellations> storage;
+  UUIDsToTessellations* storage;
   const char* genProp;
   if (!analysis)
   { // store as display tessellation
-    storage = this->m_tessellations;
+    storage = &*this->m_tessellations;
     genProp = SMTK_TESS_GEN_PROP;
   }
   else
   { // store as analysis mesh
-    storage = this->m_analysisMesh;
+    storage = &*this->m_analysisMesh;
     genProp = SMTK_MESH_GEN_PROP;
   }
 
@@ -1930,6 +2086,7 @@ Manager::tess_iter_type Manager::setTessellationAndBoundingBox(
 bool Manager::setBoundingBox(
   const UUID& cellId, const std::vector<double>& coords, int providedbBox)
 {
+  this->invalidateBoundingBoxes();
   smtk::model::FloatList bBox;
   if (providedbBox)
   {
@@ -1972,6 +2129,7 @@ bool Manager::setBoundingBox(
   */
 bool Manager::removeTessellation(const smtk::common::UUID& entityId, bool removeGen)
 {
+  this->invalidateBoundingBoxes();
   bool didRemove;
   UUIDWithTessellation tref = this->m_tessellations->find(entityId);
   didRemove = (tref == this->m_tessellations->end());
@@ -1983,6 +2141,38 @@ bool Manager::removeTessellation(const smtk::common::UUID& entityId, bool remove
   return didRemove;
 }
 
+/// Fetch the bounding box cached for \a entityId, returning false if there is none.
+bool Manager::cachedBoundingBox(const UUID& entityId, std::vector<double>& bbox) const
+{
+  std::map<UUID, std::vector<double> >::const_iterator it =
+    this->m_boundingBoxCache.find(entityId);
+  if (it == this->m_boundingBoxCache.end())
+  {
+    return false;
+  }
+  bbox = it->second;
+  return true;
+}
+
+/// Cache the bounding box of \a entityId until the next call to invalidateBoundingBoxes().
+void Manager::cacheBoundingBox(const UUID& entityId, const std::vector<double>& bbox)
+{
+  this->m_boundingBoxCache[entityId] = bbox;
+}
+
+/**\brief Discard all cached bounding boxes.
+  *
+  * This is called whenever this manager changes a tessellation, bounding box,
+  * entity or arrangement, and whenever it hands out a mutable reference to a
+  * tessellation (EntityRef::resetTessellation) or bounding box property.
+  * Code that edits entity relations or tessellations in place through
+  * topology() or tessellations() should call it.
+  */
+void Manager::invalidateBoundingBoxes()
+{
+  this->m_boundingBoxCache.clear();
+}
+
 /**\brief Add or replace information about the arrangement of an entity.
   *
   * When \a index is -1, the arrangement is considered new and added to the end of
@@ -1993,11 +2183,13 @@ bool Manager::removeTessellation(const smtk::common::UUID& entityId, bool remove
 int Manager::arrangeEntity(
   const UUID& entityId, ArrangementKind kind, const Arrangement& arr, int index)
 {
+  this->invalidateBoundingBoxes();
   UUIDsToEntities::iterator eit = this->m_topology->find(entityId);
   if (eit == this->m_topology->end())
   {
     return -1;
   }
+  this->detachEntity(eit);
   return eit->second->arrange(kind, arr, index);
 }
 
@@ -2017,11 +2209,13 @@ int Manager::arrangeEntity(
   */
 int Manager::unarrangeEntity(const UUID& entityId, ArrangementKind k, int index, bool removeIfLast)
 {
+  this->invalidateBoundingBoxes();
   auto eit = this->m_topology->find(entityId);
   if (eit == this->m_topology->end())
   {
     return 0;
   }
+  this->detachEntity(eit);
   int result = eit->second->unarrange(k, index);
 
   // If we removed the last arrangement relating this entity to others,
@@ -2051,11 +2245,13 @@ int Manager::unarrangeEntity(const UUID& entityId, ArrangementKind k, int index,
   */
 bool Manager::clearArrangements(const smtk::common::UUID& entityId)
 {
+  this->invalidateBoundingBoxes();
   auto eit = this->m_topology->find(entityId);
   if (eit == this->m_topology->end())
   {
     return false;
   }
+  this->detachEntity(eit);
   return eit->second->clearArrangements();
 }
 
@@ -2072,6 +2268,7 @@ Arrangements* Manager::hasArrangementsOfKindForEntity(const UUID& entity, Arrang
   {
     return nullptr;
   }
+  this->detachEntity(eit);
   return eit->second->hasArrangementsOfKind(kind);
 }
 
@@ -2098,6 +2295,7 @@ const Arrangements* Manager::hasArrangementsOfKindForEntity(
 Arrangements& Manager::arrangementsOfKindForEntity(const UUID& entity, ArrangementKind kind)
 {
   auto eit = this->m_topology->find(entity);
+  this->detachEntity(eit);
   return eit->second->arrangementsOfKind(kind);
 }
 
@@ -2138,6 +2336,7 @@ Arrangement* Manager::findArrangement(const UUID& entityId, ArrangementKind kind
   {
     return nullptr;
   }
+  this->detachEntity(eit);
 
   return eit->second->findArrangement(kind, index);
 }
@@ -3448,6 +3647,29 @@ void Manager::observe(ManagerEventType event, OneToManyCallback functionHandle,
     OneToManyTrigger(event, OneToManyObserver(functionHandle, callData)));
 }
 
+/**\brief Request batched notification from this manager instance when \a event occurs.
+  *
+  * Unlike other observers, \a functionHandle is called once per transaction
+  * (see beginTransaction()) with the distinct entities the event affected.
+  */
+void Manager::observe(ManagerEventType event, BatchCallback functionHandle, void* callData)
+{
+  if (event.first == ANY_EVENT)
+  {
+    int i;
+    int iend = static_cast<int>(ANY_EVENT);
+    for (i = static_cast<int>(ADD_EVENT); i != iend; ++i)
+    {
+      event.first = static_cast<ManagerEventChangeType>(i);
+      this->observe(event, functionHandle, callData);
+    }
+
+    return;
+  }
+
+  this->m_batchTriggers.insert(BatchTrigger(event, BatchObserver(functionHandle, callData)));
+}
+
 /// Request notification from this manager instance when \a event occurs.
 void Manager::observe(OperatorEventType event, BareOperatorCallback functionHandle, void* callData)
 {
@@ -3522,6 +3744,25 @@ void Manager::unobserve(ManagerEventType event, OneToManyCallback functionHandle
     OneToManyTrigger(event, OneToManyObserver(functionHandle, callData)));
 }
 
+/// Decline further notification from this manager instance when \a event occurs.
+void Manager::unobserve(ManagerEventType event, BatchCallback functionHandle, void* callData)
+{
+  if (event.first == ANY_EVENT)
+  {
+    int i;
+    int iend = static_cast<int>(ANY_EVENT);
+    for (i = static_cast<int>(ADD_EVENT); i != iend; ++i)
+    {
+      event.first = static_cast<ManagerEventChangeType>(i);
+      this->unobserve(event, functionHandle, callData);
+    }
+
+    return;
+  }
+
+  this->m_batchTriggers.erase(BatchTrigger(event, BatchObserver(functionHandle, callData)));
+}
+
 /// Decline further notification from this manager instance when \a event occurs.
 void Manager::unobserve(
   OperatorEventType event, BareOperatorCallback functionHandle, void* callData)
@@ -3533,6 +3774,7 @@ void Manager::unobserve(
 /// Called by this Manager instance or EntityRef instances referencing it when \a event occurs.
 void Manager::trigger(ManagerEventType event, const smtk::model::EntityRef& src)
 {
+  this->invalidateBoundingBoxes();
   std::set<ConditionTrigger>::const_iterator begin = this->m_conditionTriggers.lower_bound(
     ConditionTrigger(event, ConditionObserver(ConditionCallback(), static_cast<void*>(NULL))));
   std::set<ConditionTrigger>::const_iterator end =
@@ -3541,12 +3783,14 @@ void Manager::trigger(ManagerEventType event, const smtk::model::EntityRef& src)
       ConditionObserver(ConditionCallback(), static_cast<void*>(NULL))));
   for (std::set<ConditionTrigger>::const_iterator it = begin; it != end; ++it)
     (*it->second.first)(it->first, src, it->second.second);
+  this->queueBatchEvent(event, src);
 }
 
 /// Called by this Manager instance or EntityRef instances referencing it when \a event occurs.
 void Manager::trigger(
   ManagerEventType event, const smtk::model::EntityRef& src, const smtk::model::EntityRef& related)
 {
+  this->invalidateBoundingBoxes();
   std::set<OneToOneTrigger>::const_iterator begin = this->m_oneToOneTriggers.lower_bound(
     OneToOneTrigger(event, OneToOneObserver(OneToOneCallback(), static_cast<void*>(NULL))));
   std::set<OneToOneTrigger>::const_iterator end =
@@ -3555,12 +3799,14 @@ void Manager::trigger(
       OneToOneObserver(OneToOneCallback(), static_cast<void*>(NULL))));
   for (std::set<OneToOneTrigger>::const_iterator it = begin; it != end; ++it)
     (*it->second.first)(it->first, src, related, it->second.second);
+  this->queueBatchEvent(event, src);
 }
 
 /// Called by this Manager instance or EntityRef instances referencing it when \a event occurs.
 void Manager::trigger(ManagerEventType event, const smtk::model::EntityRef& src,
   const smtk::model::EntityRefArray& related)
 {
+  this->invalidateBoundingBoxes();
   std::set<OneToManyTrigger>::const_iterator begin = this->m_oneToManyTriggers.lower_bound(
     OneToManyTrigger(event, OneToManyObserver(OneToManyCallback(), static_cast<void*>(NULL))));
   std::set<OneToManyTrigger>::const_iterator end =
@@ -3569,6 +3815,7 @@ void Manager::trigger(ManagerEventType event, const smtk::model::EntityRef& src,
       OneToManyObserver(OneToManyCallback(), static_cast<void*>(NULL))));
   for (std::set<OneToManyTrigger>::const_iterator it = begin; it != end; ++it)
     (*it->second.first)(it->first, src, related, it->second.second);
+  this->queueBatchEvent(event, src);
 }
 
 /// Called by this Manager instance or Session instances referencing it when \a event occurs.
@@ -3583,6 +3830,75 @@ void Manager::trigger(OperatorEventType event, const smtk::model::Operator& src)
 }
 //@}
 
+/**\brief Begin collecting events for batch observers.
+  *
+  * Until the matching call to endTransaction(), events are recorded
+  * rather than delivered to observers registered with a BatchCallback.
+  * Other observers are notified immediately, as usual.
+  * Transactions may be nested; batches are delivered when the outermost
+  * transaction ends.
+  * Model operators run inside a transaction.
+  */
+void Manager::beginTransaction()
+{
+  ++this->m_transactionDepth;
+}
+
+/**\brief End a transaction and deliver batched events if it is the outermost.
+  *
+  * Each batch observer is called once per event type that occurred,
+  * in order of the event type (additions before modifications before
+  * removals). Batches may refer to entities that were removed later in
+  * the transaction.
+  */
+void Manager::endTransaction()
+{
+  if (this->m_transactionDepth <= 0 || --this->m_transactionDepth > 0)
+  {
+    return;
+  }
+
+  // Observers may cause further events, which are delivered immediately.
+  std::map<ManagerEventType, PendingBatch> pending;
+  pending.swap(this->m_pendingBatches);
+  for (auto& batch : pending)
+  {
+    auto begin = this->m_batchTriggers.lower_bound(
+      BatchTrigger(batch.first, BatchObserver(BatchCallback(), static_cast<void*>(NULL))));
+    for (auto it = begin; it != this->m_batchTriggers.end() && it->first == batch.first; ++it)
+    {
+      (*it->second.first)(it->first, batch.second.entities, it->second.second);
+    }
+  }
+}
+
+/// Deliver \a event to batch observers or hold it until the current transaction ends.
+void Manager::queueBatchEvent(ManagerEventType event, const smtk::model::EntityRef& src)
+{
+  auto begin = this->m_batchTriggers.lower_bound(
+    BatchTrigger(event, BatchObserver(BatchCallback(), static_cast<void*>(NULL))));
+  if (begin == this->m_batchTriggers.end() || begin->first != event)
+  {
+    return;
+  }
+
+  if (this->m_transactionDepth > 0)
+  {
+    PendingBatch& batch = this->m_pendingBatches[event];
+    if (batch.seen.insert(src.entity()).second)
+    {
+      batch.entities.push_back(src);
+    }
+    return;
+  }
+
+  EntityRefArray entities(1, src);
+  for (auto it = begin; it != this->m_batchTriggers.end() && it->first == event; ++it)
+  {
+    (*it->second.first)(it->first, entities, it->second.second);
+  }
+}
+
 template <typename T>
 std::string uniqueResourceName(EntityRef ent, const T& preexisting, int& counter)
 {
@@ -28,6 +28,8 @@
 #include "smtk/model/StringData.h"
 #include "smtk/model/Tessellation.h"
 
+#include "smtk/common/CopyOnWrite.h"
+#include "smtk/common/PoolAllocator.h"
 #include "smtk/common/UUID.h"
 
 #include "smtk/resource/Resource.h"
@@ -74,11 +76,16 @@ namespace model
 {
 
 /// Store information mapping IDs to Entity records. This is the primary storage for SMTK models.
-typedef std::map<smtk::common::UUID, EntityPtr> UUIDsToEntities;
+///
+/// Map nodes (like the Entity records themselves) are allocated from a pool.
+typedef std::map<smtk::common::UUID, EntityPtr, std::less<smtk::common::UUID>,
+  smtk::common::PoolAllocator<std::pair<const smtk::common::UUID, EntityPtr> > >
+  UUIDsToEntities;
 
 /// An abbreviation for an iterator into primary model storage.
 typedef UUIDsToEntities::iterator UUIDWithEntityPtr;
 typedef UUIDsToEntities::const_iterator UUIDWithConstEntityPtr;
+
 /**\brief Store information about solid models.
   *
   */
@@ -109,6 +116,16 @@ public:
 
   smtk::mesh::ManagerPtr meshes() const;
 
+  /// The pools that this manager's entity records are allocated from.
+  const smtk::shared_ptr<smtk::common::MemoryPools>& memoryPools() const
+  {
+    return this->m_memoryPools;
+  }
+
+  ManagerPtr snapshot();
+  void restore(const ManagerPtr& snapshot);
+  bool isSnapshot() const { return this->m_isSnapshot; }
+
   smtk::resource::SetPtr resources(bool skipUpdate = false)
   {
     if (!skipUpdate)
@@ -125,6 +142,7 @@ public:
   std::string name(const smtk::common::UUID& ofEntity) const;
 
   EntityPtr findEntity(const smtk::common::UUID& uid, bool trySessions = true) const;
+  EntityPtr findEntity(const smtk::common::UUID& uid, bool trySessions = true);
 
   smtk::resource::ComponentPtr find(const smtk::common::UUID& uid) const override;
   Resource::Type type() const override { return smtk::resource::Resource::MODEL; }
@@ -191,7 +209,7 @@ public:
     const smtk::common::UUID& entity, const std::string& propName);
   bool hasFloatProperty(const smtk::common::UUID& entity, const std::string& propName) const;
   bool removeFloatProperty(const smtk::common::UUID& entity, const std::string& propName);
-  const UUIDWithFloatProperties floatPropertiesForEntity(const smtk::common::UUID& entity) const;
+  UUIDWithConstFloatProperties floatPropertiesForEntity(const smtk::common::UUID& entity) const;
   UUIDWithFloatProperties floatPropertiesForEntity(const smtk::common::UUID& entity);
   UUIDsToFloatData& floatProperties() { return *this->m_floatData; }
   UUIDsToFloatData const& floatProperties() const { return *this->m_floatData; }
@@ -206,7 +224,7 @@ public:
     const smtk::common::UUID& entity, const std::string& propName);
   bool hasStringProperty(const smtk::common::UUID& entity, const std::string& propName) const;
   bool removeStringProperty(const smtk::common::UUID& entity, const std::string& propName);
-  const UUIDWithStringProperties stringPropertiesForEntity(const smtk::common::UUID& entity) const;
+  UUIDWithConstStringProperties stringPropertiesForEntity(const smtk::common::UUID& entity) const;
   UUIDWithStringProperties stringPropertiesForEntity(const smtk::common::UUID& entity);
   UUIDsToStringData& stringProperties() { return *this->m_stringData; }
   UUIDsToStringData const& stringProperties() const { return *this->m_stringData; }
@@ -221,8 +239,7 @@ public:
     const smtk::common::UUID& entity, const std::string& propName);
   bool hasIntegerProperty(const smtk::common::UUID& entity, const std::string& propName) const;
   bool removeIntegerProperty(const smtk::common::UUID& entity, const std::string& propName);
-  const UUIDWithIntegerProperties integerPropertiesForEntity(
-    const smtk::common::UUID& entity) const;
+  UUIDWithConstIntegerProperties integerPropertiesForEntity(const smtk::common::UUID& entity) const;
   UUIDWithIntegerProperties integerPropertiesForEntity(const smtk::common::UUID& entity);
   UUIDsToIntegerData& integerProperties() { return *this->m_integerData; }
   UUIDsToIntegerData const& integerProperties() const { return *this->m_integerData; }
@@ -284,6 +301,13 @@ public:
     const smtk::common::UUID& cellId, const std::vector<double>& coords, int providedBBox = 0);
   bool removeTessellation(const smtk::common::UUID& cellId, bool removeGen = false);
 
+  // Bounding boxes of entities computed from their children (see
+  // EntityRef::boundingBox) are cached until a tessellation, bounding box or
+  // arrangement held by this manager changes.
+  bool cachedBoundingBox(const smtk::common::UUID& entityId, std::vector<double>& bbox) const;
+  void cacheBoundingBox(const smtk::common::UUID& entityId, const std::vector<double>& bbox);
+  void invalidateBoundingBoxes();
+
   int arrangeEntity(
     const smtk::common::UUID& entityId, ArrangementKind, const Arrangement& arr, int index = -1);
   int unarrangeEntity(
@@ -421,10 +445,12 @@ public:
   void observe(ManagerEventType event, ConditionCallback functionHandle, void* callData);
   void observe(ManagerEventType event, OneToOneCallback functionHandle, void* callData);
   void observe(ManagerEventType event, OneToManyCallback functionHandle, void* callData);
+  void observe(ManagerEventType event, BatchCallback functionHandle, void* callData);
   void observe(OperatorEventType event, BareOperatorCallback functionHandle, void* callData);
   void unobserve(ManagerEventType event, ConditionCallback functionHandle, void* callData);
   void unobserve(ManagerEventType event, OneToOneCallback functionHandle, void* callData);
   void unobserve(ManagerEventType event, OneToManyCallback functionHandle, void* callData);
+  void unobserve(ManagerEventType event, BatchCallback functionHandle, void* callData);
   void unobserve(OperatorEventType event, BareOperatorCallback functionHandle, void* callData);
   void trigger(ManagerEventType event, const smtk::model::EntityRef& src);
   void trigger(ManagerEventType event, const smtk::model::EntityRef& src,
@@ -433,6 +459,39 @@ public:
     const smtk::model::EntityRefArray& related);
   void trigger(OperatorEventType event, const smtk::model::Operator& src);
 
+  void beginTransaction();
+  void endTransaction();
+  bool inTransaction() const { return this->m_transactionDepth > 0; }
+
+  /// Hold a transaction open on a manager for the lifetime of this object.
+  class Transaction
+  {
+  public:
+    Transaction(const ManagerPtr& manager)
+      : m_manager(manager)
+    {
+      if (this->m_manager)
+      {
+        this->m_manager->beginTransaction();
+      }
+    }
+    ~Transaction() { this->end(); }
+    /// End the transaction before this object is destroyed.
+    void end()
+    {
+      if (this->m_manager)
+      {
+        this->m_manager->endTransaction();
+        this->m_manager = nullptr;
+      }
+    }
+    Transaction(const Transaction&) = delete;
+    Transaction& operator=(const Transaction&) = delete;
+
+  private:
+    ManagerPtr m_manager;
+  };
+
   smtk::io::Logger& log() { return smtk::io::Logger::instance(); }
 
 protected:
@@ -443,22 +502,30 @@ protected:
   std::string assignDefaultName(const smtk::common::UUID& uid, BitFlags entityFlags);
   IntegerList& entityCounts(const smtk::common::UUID& modelId, BitFlags entityFlags);
   void prepareForEntity(std::pair<smtk::common::UUID, EntityPtr>& entry);
+  void detachEntity(UUIDWithEntityPtr it);
   void computeResources();
+  void queueBatchEvent(ManagerEventType event, const smtk::model::EntityRef& src);
 
   smtk::common::UUID modelOwningEntityRecursive(
     const smtk::common::UUID& uid, std::set<smtk::common::UUID>& visited) const;
   smtk::common::UUID sessionOwningEntityRecursive(
     const smtk::common::UUID& uid, std::set<smtk::common::UUID>& visited) const;
 
+  // Entity records and the nodes of m_topology are allocated from these.
+  // Each record keeps the pools alive, so they are freed once this manager,
+  // its snapshots and every record they created are gone.
+  smtk::shared_ptr<smtk::common::MemoryPools> m_memoryPools;
+
   // Below are all the different things that can be mapped to a UUID:
-  smtk::shared_ptr<UUIDsToEntities> m_topology;
-  smtk::shared_ptr<UUIDsToFloatData> m_floatData;
-  smtk::shared_ptr<UUIDsToStringData> m_stringData;
-  smtk::shared_ptr<UUIDsToIntegerData> m_integerData;
-  smtk::shared_ptr<UUIDsToTessellations> m_tessellations;
-  smtk::shared_ptr<UUIDsToTessellations> m_analysisMesh;
+  smtk::common::CopyOnWrite<UUIDsToEntities> m_topology;
+  smtk::common::CopyOnWrite<UUIDsToFloatData> m_floatData;
+  smtk::common::CopyOnWrite<UUIDsToStringData> m_stringData;
+  smtk::common::CopyOnWrite<UUIDsToIntegerData> m_integerData;
+  smtk::common::CopyOnWrite<UUIDsToTessellations> m_tessellations;
+  smtk::common::CopyOnWrite<UUIDsToTessellations> m_analysisMesh;
+  std::map<smtk::common::UUID, std::vector<double> > m_boundingBoxCache;
   smtk::shared_ptr<smtk::mesh::Manager> m_meshes;
-  smtk::shared_ptr<UUIDsToAttributeAssignments> m_attributeAssignments;
+  smtk::common::CopyOnWrite<UUIDsToAttributeAssignments> m_attributeAssignments;
   smtk::shared_ptr<UUIDsToSessions> m_sessions;
   smtk::shared_ptr<resource::Set> m_resources;
   typedef std::owner_less<smtk::attribute::WeakCollectionPtr> CollectionLessThan;
@@ -473,17 +540,33 @@ protected:
   std::set<OneToOneTrigger> m_oneToOneTriggers;
   std::set<OneToManyTrigger> m_oneToManyTriggers;
   std::set<BareOperatorTrigger> m_operatorTriggers;
+  std::set<BatchTrigger> m_batchTriggers;
+
+  // Events collected for batch observers while a transaction is open.
+  struct PendingBatch
+  {
+    EntityRefArray entities;
+    smtk::common::UUIDs seen;
+  };
+  int m_transactionDepth;
+  std::map<ManagerEventType, PendingBatch> m_pendingBatches;
+  bool m_isSnapshot;
+  // Incremented whenever entity records become shared with a snapshot; records
+  // stamped with an earlier generation are copied by detachEntity() before
+  // they are modified.
+  int m_snapshotGeneration;
 };
 
 template <typename Collection>
 Collection Manager::findEntitiesByPropertyAs(const std::string& pname, Integer pval)
 {
   Collection collection;
-  UUIDWithIntegerProperties pit;
-  for (pit = this->m_integerData->begin(); pit != this->m_integerData->end(); ++pit)
+  const UUIDsToIntegerData& properties(this->m_integerData.data());
+  UUIDWithConstIntegerProperties pit;
+  for (pit = properties.begin(); pit != properties.end(); ++pit)
   {
-    PropertyNameWithIntegers it;
-    for (it = pit->second.begin(); it != pit->second.end(); ++it)
+    PropertyNameWithConstIntegers it;
+    for (it = pit->second->begin(); it != pit->second->end(); ++it)
     {
       if (it->first == pname && it->second.size() == 1 && it->second[0] == pval)
       {
@@ -500,11 +583,12 @@ template <typename Collection>
 Collection Manager::findEntitiesByPropertyAs(const std::string& pname, const IntegerList& pval)
 {
   Collection collection;
-  UUIDWithIntegerProperties pit;
-  for (pit = this->m_integerData->begin(); pit != this->m_integerData->end(); ++pit)
+  const UUIDsToIntegerData& properties(this->m_integerData.data());
+  UUIDWithConstIntegerProperties pit;
+  for (pit = properties.begin(); pit != properties.end(); ++pit)
   {
-    PropertyNameWithIntegers it;
-    for (it = pit->second.begin(); it != pit->second.end(); ++it)
+    PropertyNameWithConstIntegers it;
+    for (it = pit->second->begin(); it != pit->second->end(); ++it)
     {
       if (it->first == pname && it->second == pval)
       {
@@ -521,11 +605,12 @@ template <typename Collection>
 Collection Manager::findEntitiesByPropertyAs(const std::string& pname, Float pval)
 {
   Collection collection;
-  UUIDWithFloatProperties pit;
-  for (pit = this->m_floatData->begin(); pit != this->m_floatData->end(); ++pit)
+  const UUIDsToFloatData& properties(this->m_floatData.data());
+  UUIDWithConstFloatProperties pit;
+  for (pit = properties.begin(); pit != properties.end(); ++pit)
   {
-    PropertyNameWithFloats it;
-    for (it = pit->second.begin(); it != pit->second.end(); ++it)
+    PropertyNameWithConstFloats it;
+    for (it = pit->second->begin(); it != pit->second->end(); ++it)
     {
       if (it->first == pname && it->second.size() == 1 && it->second[0] == pval)
       {
@@ -542,11 +627,12 @@ template <typename Collection>
 Collection Manager::findEntitiesByPropertyAs(const std::string& pname, const FloatList& pval)
 {
   Collection collection;
-  UUIDWithFloatProperties pit;
-  for (pit = this->m_floatData->begin(); pit != this->m_floatData->end(); ++pit)
+  const UUIDsToFloatData& properties(this->m_floatData.data());
+  UUIDWithConstFloatProperties pit;
+  for (pit = properties.begin(); pit != properties.end(); ++pit)
   {
-    PropertyNameWithFloats it;
-    for (it = pit->second.begin(); it != pit->second.end(); ++it)
+    PropertyNameWithConstFloats it;
+    for (it = pit->second->begin(); it != pit->second->end(); ++it)
     {
       if (it->first == pname && it->second == pval)
       {
@@ -563,11 +649,12 @@ template <typename Collection>
 Collection Manager::findEntitiesByPropertyAs(const std::string& pname, const std::string& pval)
 {
   Collection collection;
-  UUIDWithStringProperties pit;
-  for (pit = this->m_stringData->begin(); pit != this->m_stringData->end(); ++pit)
+  const UUIDsToStringData& properties(this->m_stringData.data());
+  UUIDWithConstStringProperties pit;
+  for (pit = properties.begin(); pit != properties.end(); ++pit)
   {
-    PropertyNameWithStrings it;
-    for (it = pit->second.begin(); it != pit->second.end(); ++it)
+    PropertyNameWithConstStrings it;
+    for (it = pit->second->begin(); it != pit->second->end(); ++it)
     {
       if (it->first == pname && it->second.size() == 1 && it->second[0] == pval)
       {
@@ -584,11 +671,12 @@ template <typename Collection>
 Collection Manager::findEntitiesByPropertyAs(const std::string& pname, const StringList& pval)
 {
   Collection collection;
-  UUIDWithStringProperties pit;
-  for (pit = this->m_stringData->begin(); pit != this->m_stringData->end(); ++pit)
+  const UUIDsToStringData& properties(this->m_stringData.data());
+  UUIDWithConstStringProperties pit;
+  for (pit = properties.begin(); pit != properties.end(); ++pit)
   {
-    PropertyNameWithStrings it;
-    for (it = pit->second.begin(); it != pit->second.end(); ++it)
+    PropertyNameWithConstStrings it;
+    for (it = pit->second->begin(); it != pit->second->end(); ++it)
     {
       if (it->first == pname && it->second == pval)
       {
@@ -122,7 +122,7 @@ CellEntities Model::cells() const
   EntityRefArrangementOps::appendAllRelations(*this, INCLUDES, result);
   if (result.empty())
   { // We may have a "simple" model that has no arrangements but does have relations.
-    EntityPtr erec = mgr->findEntity(this->m_entity);
+    EntityPtr erec = static_cast<const Manager*>(mgr.get())->findEntity(this->m_entity);
     if (erec)
     {
       smtk::common::UUIDArray::const_iterator rit;
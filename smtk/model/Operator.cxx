@@ -33,6 +33,8 @@
 #include "smtk/mesh/core/Manager.h"
 #include "smtk/mesh/core/MeshSet.h"
 
+#include "smtk/operation/OperatorTrace.h"
+
 #include "cJSON.h"
 
 #include <sstream>
@@ -106,7 +108,9 @@ static void markResultModels(OperatorResult result)
 
 /**\brief Perform the solid modeling operation the subclass implements.
   *
-  * This method first tests whether the operation is well-defined by
+  * As with smtk::operation::Operator::operate(), the resources returned
+  * by resourcesToLock() are locked for the duration of the call.
+  * This method then tests whether the operation is well-defined by
   * invoking ableToOperate(). If it returns true, then the
   * operateInternal() method (implemented by subclasses) is invoked.
   *
@@ -114,21 +118,41 @@ static void markResultModels(OperatorResult result)
   * proceeding: you can be signaled when the operation is about
   * to be executed and just after it does execute. Neither will
   * be called if the ableToOperate method returns false.
+  *
+  * When smtk::operation::OperatorTrace is enabled, the time spent in
+  * each of these steps is recorded.
   */
 OperatorResult Operator::operate()
 {
   // Remember where the log was so we only serialize messages for this operation:
   std::size_t logStart = this->log().numberOfRecords();
+  smtk::operation::OperatorTrace::Recorder trace(*this);
+  typedef smtk::operation::OperatorTrace::Phase TracePhase;
+  ResourceLocks locks(*this);
 
   OperatorResult result;
-  if (this->ableToOperate())
+  bool able;
+  {
+    TracePhase phase(trace, "ableToOperate");
+    able = this->ableToOperate();
+  }
+  if (able)
   {
     // Set the debug level if specified as a convenience for subclasses:
     smtk::attribute::IntItem::Ptr debugItem = this->specification()->findInt("debug level");
     this->m_debugLevel = (debugItem->isEnabled() ? debugItem->value() : 0);
-    // Run the operation if possible:
-    if (!this->trigger(OperatorEventType::WILL_OPERATE))
+    // Run the operation if possible, batching the manager's events until it completes:
+    Manager::Transaction transaction(this->m_manager);
+    int canceled;
+    {
+      TracePhase phase(trace, "observe WILL_OPERATE");
+      canceled = this->trigger(OperatorEventType::WILL_OPERATE);
+    }
+    if (!canceled)
+    {
+      TracePhase phase(trace, "operateInternal");
       result = this->operateInternal();
+    }
     else
       result = this->createResult(OPERATION_CANCELED);
     // Assign names if requested:
@@ -136,6 +160,7 @@ OperatorResult Operator::operate()
     int outcome = result->findInt("outcome")->value();
     if (outcome == OPERATION_SUCCEEDED)
     {
+      TracePhase phase(trace, "mark result models");
       markResultModels(result);
       if ((assignNamesItem = this->specification()->findInt("assign names")) &&
         assignNamesItem->isEnabled() && assignNamesItem->value() != 0)
@@ -150,24 +175,35 @@ OperatorResult Operator::operate()
         }
       }
     }
-    this->generateSummary(result);
-    // Now grab all log messages and serialize them into the result attribute.
-    std::size_t logEnd = this->log().numberOfRecords();
-    if (logEnd > logStart)
-    { // Serialize relevant log records to JSON.
-      cJSON* array = cJSON_CreateArray();
-      smtk::io::SaveJSON::forLog(array, this->log(), logStart, logEnd);
-      char* logstr = cJSON_Print(array);
-      cJSON_Delete(array);
-      result->findString("log")->appendValue(logstr);
-      free(logstr);
+    {
+      TracePhase phase(trace, "observe manager events");
+      transaction.end();
+    }
+    {
+      TracePhase phase(trace, "transcribe result");
+      this->generateSummary(result);
+      // Now grab all log messages and serialize them into the result attribute.
+      std::size_t logEnd = this->log().numberOfRecords();
+      if (logEnd > logStart)
+      { // Serialize relevant log records to JSON.
+        cJSON* array = cJSON_CreateArray();
+        smtk::io::SaveJSON::forLog(array, this->log(), logStart, logEnd);
+        char* logstr = cJSON_Print(array);
+        cJSON_Delete(array);
+        result->findString("log")->appendValue(logstr);
+        free(logstr);
+      }
     }
     // Inform observers that the operation completed.
-    this->trigger(OperatorEventType::DID_OPERATE, result);
+    {
+      TracePhase phase(trace, "observe DID_OPERATE");
+      this->trigger(OperatorEventType::DID_OPERATE, result);
+    }
 
     smtk::attribute::ModelEntityItem::Ptr tess_changed = result->findModelEntity("tess_changed");
     if (tess_changed)
     {
+      TracePhase phase(trace, "discard stale meshes");
       for (auto it = tess_changed->begin(); it != tess_changed->end(); ++it)
       {
         smtk::mesh::CollectionPtr collection =
@@ -199,9 +235,56 @@ OperatorResult Operator::operate()
       free(logstr);
     }
   }
+  if (trace.isRecording())
+  {
+    trace.setOutcome(result->findInt("outcome")->value());
+  }
   return result;
 }
 
+/**\brief Return the resources this operation reads or writes.
+  *
+  * In addition to the resources named by the specification, model operators
+  * lock their model manager for writing (since results are recorded there)
+  * along with the mesh collections associated with the models of any
+  * specified entities (since operate() discards their meshes when
+  * tessellations change).
+  */
+Operator::ResourceAccessMap Operator::resourcesToLock() const
+{
+  ResourceAccessMap access = this->smtk::operation::Operator::resourcesToLock();
+  ManagerPtr mgr = this->manager();
+  if (!mgr)
+  {
+    return access;
+  }
+  access[mgr] = smtk::resource::LockType::Write;
+
+  std::set<smtk::model::Model> models;
+  EntityRefs entities = this->associatedEntitiesAs<EntityRefs>();
+  smtk::attribute::AttributePtr spec = this->specification();
+  for (std::size_t i = 0; i < spec->numberOfItems(); ++i)
+  {
+    auto entityItem = smtk::dynamic_pointer_cast<ModelEntityItem>(spec->item(static_cast<int>(i)));
+    if (entityItem && entityItem->isEnabled())
+    {
+      entities.insert(entityItem->begin(), entityItem->end());
+    }
+  }
+  for (auto entity : entities)
+  {
+    Model model = entity.isModel() ? entity.as<Model>() : entity.owningModel();
+    if (model.isValid() && models.insert(model).second)
+    {
+      for (auto collection : mgr->meshes()->associatedCollections(model))
+      {
+        access[collection] = smtk::resource::LockType::Write;
+      }
+    }
+  }
+  return access;
+}
+
 /// Return the manager associated with this operator (or a "null"/invalid shared-pointer).
 ManagerPtr Operator::manager() const
 {
@@ -123,6 +123,7 @@ public:
   smtkSharedFromThisMacro(smtk::operation::Operator);
 
   OperatorResult operate() override;
+  ResourceAccessMap resourcesToLock() const override;
 
   ManagerPtr manager() const;
   Ptr setManager(ManagerPtr s);
@@ -71,6 +71,68 @@ DescriptivePhrases SimpleModelSubphrases::subphrases(DescriptivePhrase::Ptr src)
   return result;
 }
 
+/**\brief Return the \a count subphrases of \a src starting with the one at \a first.
+  *
+  * Entity lists may hold very many entities, so rather than generating
+  * a phrase for each, their entities are sorted when the first page is
+  * asked for and phrases are created only for the entities on the page.
+  */
+DescriptivePhrases SimpleModelSubphrases::pageOfSubphrases(
+  DescriptivePhrase::Ptr src, int first, int count)
+{
+  EntityListPhrase::Ptr elist;
+  if (src && src->phraseType() == ENTITY_LIST)
+  {
+    elist = dynamic_pointer_cast<EntityListPhrase>(src);
+  }
+  if (!elist)
+  {
+    return this->SubphraseGenerator::pageOfSubphrases(src, first, count);
+  }
+
+  EntityRefArray& ents(elist->relatedEntities());
+  if (first <= 0)
+  {
+    std::sort(ents.begin(), ents.end(), DescriptivePhrase::compareEntitiesByModelInfo);
+    BitFlags commonFlags = INVALID;
+    BitFlags unionFlags = 0;
+    for (EntityRefArray::const_iterator it = ents.begin(); it != ents.end(); ++it)
+    {
+      commonFlags &= it->entityFlags();
+      unionFlags |= it->entityFlags();
+    }
+    elist->setFlags(commonFlags, unionFlags);
+  }
+
+  DescriptivePhrases result;
+  int total = static_cast<int>(ents.size());
+  first = std::max(0, std::min(first, total));
+  int last = count < 0 ? total : std::min(total, first + count);
+  for (int i = first; i < last; ++i)
+  {
+    result.push_back(EntityPhrase::create()->setup(ents[i], src));
+  }
+  return result;
+}
+
+bool SimpleModelSubphrases::hasSubphrases(DescriptivePhrase::Ptr src)
+{
+  if (!src || src->isPropertyValueType())
+  {
+    return false;
+  }
+
+  // Entity lists have one subphrase per entity, so there is no need to
+  // generate (and sort) them.
+  if (src->phraseType() == ENTITY_LIST)
+  {
+    EntityListPhrase::Ptr elist = dynamic_pointer_cast<EntityListPhrase>(src);
+    return elist && !elist->relatedEntities().empty();
+  }
+
+  return this->SubphraseGenerator::hasSubphrases(src);
+}
+
 bool SimpleModelSubphrases::shouldOmitProperty(
   DescriptivePhrase::Ptr parent, smtk::resource::PropertyType ptype, const std::string& pname) const
 {
@@ -33,6 +33,8 @@ public:
   virtual ~SimpleModelSubphrases() {}
 
   DescriptivePhrases subphrases(DescriptivePhrase::Ptr src) override;
+  DescriptivePhrases pageOfSubphrases(DescriptivePhrase::Ptr src, int first, int count) override;
+  bool hasSubphrases(DescriptivePhrase::Ptr src) override;
   bool shouldOmitProperty(DescriptivePhrase::Ptr parent, smtk::resource::PropertyType ptype,
     const std::string& pname) const override;
 
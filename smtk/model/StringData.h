@@ -15,6 +15,7 @@
 
 #include "smtk/SystemConfig.h"
 
+#include "smtk/common/CopyOnWrite.h"
 #include "smtk/common/UUID.h"
 
 #include <map>
@@ -33,9 +34,11 @@ typedef std::vector<String> StringList;
 /// A dictionary of property names mapped to their values (string vectors)
 typedef std::map<std::string, StringList> StringData;
 /// A dictionary of model entities mapped to all the string properties defined on them.
-typedef std::map<smtk::common::UUID, StringData> UUIDsToStringData;
+/// Each entity's record is shared with snapshots of its Manager until it is modified.
+typedef std::map<smtk::common::UUID, smtk::common::CopyOnWrite<StringData> > UUIDsToStringData;
 /// A convenient typedef that describes how an iterator to model-entity string properties is used.
 typedef UUIDsToStringData::iterator UUIDWithStringProperties;
+typedef UUIDsToStringData::const_iterator UUIDWithConstStringProperties;
 /// A convenient typedef that describes how the iterator to one string property is used.
 typedef StringData::iterator PropertyNameWithStrings;
 /// A convenient typedef that describes how the const_iterator to one string property is used.
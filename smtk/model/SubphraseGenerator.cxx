@@ -59,6 +59,34 @@ DescriptivePhrases SubphraseGenerator::subphrases(DescriptivePhrase::Ptr src)
   return empty;
 }
 
+/**\brief Return the \a count subphrases of \a src starting with the one at \a first.
+  *
+  * A negative \a count asks for every subphrase from \a first on.
+  * Fewer than \a count are returned only when there are no more.
+  * The default generates all of the subphrases and discards the rest;
+  * subclasses should override it where a page can be generated by itself.
+  */
+DescriptivePhrases SubphraseGenerator::pageOfSubphrases(
+  DescriptivePhrase::Ptr src, int first, int count)
+{
+  DescriptivePhrases all = this->subphrases(src);
+  int total = static_cast<int>(all.size());
+  first = std::max(0, std::min(first, total));
+  int last = count < 0 ? total : std::min(total, first + count);
+  return DescriptivePhrases(all.begin() + first, all.begin() + last);
+}
+
+/**\brief Return whether \a src has any subphrases, without attaching them to \a src.
+  *
+  * Views ask this of every visible row to decide whether to draw an
+  * expansion indicator. The default generates the subphrases and discards
+  * them; subclasses should override it with cheaper tests where possible.
+  */
+bool SubphraseGenerator::hasSubphrases(DescriptivePhrase::Ptr src)
+{
+  return src && !src->isPropertyValueType() && !this->subphrases(src).empty();
+}
+
 /**\brief The maximum number of subphrases to directly include before turning into a list.
   *
   * The helper methods in SubphraseGenerator (such as InstancesOfEntity()), will
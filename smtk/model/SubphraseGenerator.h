@@ -46,6 +46,8 @@ public:
   virtual ~SubphraseGenerator() {}
 
   virtual DescriptivePhrases subphrases(DescriptivePhrase::Ptr src);
+  virtual DescriptivePhrases pageOfSubphrases(DescriptivePhrase::Ptr src, int first, int count);
+  virtual bool hasSubphrases(DescriptivePhrase::Ptr src);
   virtual int directLimit() const;
   virtual bool setDirectLimit(int val);
   virtual bool shouldOmitProperty(DescriptivePhrase::Ptr parent, smtk::resource::PropertyType ptype,
@@ -40,7 +40,7 @@ Orientation UseEntity::orientation() const
   // that arrangement's orientation.
 
   // Find the cell for this use record.
-  ManagerPtr mgr = this->manager();
+  smtk::shared_ptr<const Manager> mgr = this->manager();
   if (!mgr)
     return UNDEFINED;
 
@@ -71,7 +71,7 @@ Orientation UseEntity::orientation() const
 /// Return the sense of the given use with respect to its parent cell.
 int UseEntity::sense() const
 {
-  ManagerPtr mgr = this->manager();
+  smtk::shared_ptr<const Manager> mgr = this->manager();
   // Find the cell for this use record.
   EntityPtr ent = mgr->findEntity(this->m_entity);
   const Arrangement* arr = mgr->findArrangement(this->m_entity, HAS_CELL, 0);
@@ -141,14 +141,14 @@ PySharedPtrClass< smtk::model::Manager, smtk::resource::Resource > pybind11_init
     .def("findEntitiesByProperty", (smtk::model::EntityRefArray (smtk::model::Manager::*)(::std::string const &, ::smtk::model::FloatList const &)) &smtk::model::Manager::findEntitiesByProperty, py::arg("pname"), py::arg("pval"))
     .def("findEntitiesByProperty", (smtk::model::EntityRefArray (smtk::model::Manager::*)(::std::string const &, ::smtk::model::StringList const &)) &smtk::model::Manager::findEntitiesByProperty, py::arg("pname"), py::arg("pval"))
     .def("_findEntitiesOfType", &smtk::model::Manager::findEntitiesOfType, py::arg("flags"), py::arg("exactMatch") = true)
-    .def("findEntity", &smtk::model::Manager::findEntity, py::arg("uid"), py::arg("trySessions") = true)
+    .def("findEntity", (smtk::model::EntityPtr (smtk::model::Manager::*)(::smtk::common::UUID const &, bool)) &smtk::model::Manager::findEntity, py::arg("uid"), py::arg("trySessions") = true)
     .def("findOrAddEntityToGroup", &smtk::model::Manager::findOrAddEntityToGroup, py::arg("grp"), py::arg("ent"))
     .def("findOrAddIncludedShell", &smtk::model::Manager::findOrAddIncludedShell, py::arg("parentUseOrShell"), py::arg("shellToInclude"))
     .def("findOrAddInclusionToCellOrModel", &smtk::model::Manager::findOrAddInclusionToCellOrModel, py::arg("cell"), py::arg("inclusion"))
     .def("findOrAddUseToShell", &smtk::model::Manager::findOrAddUseToShell, py::arg("shell"), py::arg("use"))
     .def("floatProperties", (smtk::model::UUIDsToFloatData & (smtk::model::Manager::*)()) &smtk::model::Manager::floatProperties)
     .def("floatProperties", (smtk::model::UUIDsToFloatData const & (smtk::model::Manager::*)() const) &smtk::model::Manager::floatProperties)
-    .def("floatPropertiesForEntity", (smtk::model::UUIDWithFloatProperties const (smtk::model::Manager::*)(::smtk::common::UUID const &) const) &smtk::model::Manager::floatPropertiesForEntity, py::arg("entity"))
+    .def("floatPropertiesForEntity", (smtk::model::UUIDWithConstFloatProperties (smtk::model::Manager::*)(::smtk::common::UUID const &) const) &smtk::model::Manager::floatPropertiesForEntity, py::arg("entity"))
     .def("floatPropertiesForEntity", (smtk::model::UUIDWithFloatProperties (smtk::model::Manager::*)(::smtk::common::UUID const &)) &smtk::model::Manager::floatPropertiesForEntity, py::arg("entity"))
     .def("floatProperty", (smtk::model::FloatList const & (smtk::model::Manager::*)(::smtk::common::UUID const &, ::std::string const &) const) &smtk::model::Manager::floatProperty, py::arg("entity"), py::arg("propName"))
     .def("floatProperty", (smtk::model::FloatList & (smtk::model::Manager::*)(::smtk::common::UUID const &, ::std::string const &)) &smtk::model::Manager::floatProperty, py::arg("entity"), py::arg("propName"))
@@ -180,7 +180,7 @@ PySharedPtrClass< smtk::model::Manager, smtk::resource::Resource > pybind11_init
     .def("insertVolumeUse", &smtk::model::Manager::insertVolumeUse, py::arg("uid"))
     .def("integerProperties", (smtk::model::UUIDsToIntegerData & (smtk::model::Manager::*)()) &smtk::model::Manager::integerProperties)
     .def("integerProperties", (smtk::model::UUIDsToIntegerData const & (smtk::model::Manager::*)() const) &smtk::model::Manager::integerProperties)
-    .def("integerPropertiesForEntity", (smtk::model::UUIDWithIntegerProperties const (smtk::model::Manager::*)(::smtk::common::UUID const &) const) &smtk::model::Manager::integerPropertiesForEntity, py::arg("entity"))
+    .def("integerPropertiesForEntity", (smtk::model::UUIDWithConstIntegerProperties (smtk::model::Manager::*)(::smtk::common::UUID const &) const) &smtk::model::Manager::integerPropertiesForEntity, py::arg("entity"))
     .def("integerPropertiesForEntity", (smtk::model::UUIDWithIntegerProperties (smtk::model::Manager::*)(::smtk::common::UUID const &)) &smtk::model::Manager::integerPropertiesForEntity, py::arg("entity"))
     .def("integerProperty", (smtk::model::IntegerList const & (smtk::model::Manager::*)(::smtk::common::UUID const &, ::std::string const &) const) &smtk::model::Manager::integerProperty, py::arg("entity"), py::arg("propName"))
     .def("integerProperty", (smtk::model::IntegerList & (smtk::model::Manager::*)(::smtk::common::UUID const &, ::std::string const &)) &smtk::model::Manager::integerProperty, py::arg("entity"), py::arg("propName"))
@@ -233,7 +233,7 @@ PySharedPtrClass< smtk::model::Manager, smtk::resource::Resource > pybind11_init
     .def_static("shortUUIDName", &smtk::model::Manager::shortUUIDName, py::arg("uid"), py::arg("entityFlags"))
     .def("stringProperties", (smtk::model::UUIDsToStringData & (smtk::model::Manager::*)()) &smtk::model::Manager::stringProperties)
     .def("stringProperties", (smtk::model::UUIDsToStringData const & (smtk::model::Manager::*)() const) &smtk::model::Manager::stringProperties)
-    .def("stringPropertiesForEntity", (smtk::model::UUIDWithStringProperties const (smtk::model::Manager::*)(::smtk::common::UUID const &) const) &smtk::model::Manager::stringPropertiesForEntity, py::arg("entity"))
+    .def("stringPropertiesForEntity", (smtk::model::UUIDWithConstStringProperties (smtk::model::Manager::*)(::smtk::common::UUID const &) const) &smtk::model::Manager::stringPropertiesForEntity, py::arg("entity"))
     .def("stringPropertiesForEntity", (smtk::model::UUIDWithStringProperties (smtk::model::Manager::*)(::smtk::common::UUID const &)) &smtk::model::Manager::stringPropertiesForEntity, py::arg("entity"))
     .def("stringProperty", (smtk::model::StringList const & (smtk::model::Manager::*)(::smtk::common::UUID const &, ::std::string const &) const) &smtk::model::Manager::stringProperty, py::arg("entity"), py::arg("propName"))
     .def("stringProperty", (smtk::model::StringList & (smtk::model::Manager::*)(::smtk::common::UUID const &, ::std::string const &)) &smtk::model::Manager::stringProperty, py::arg("entity"), py::arg("propName"))
@@ -14,26 +14,45 @@
 
 #include "cJSON.h"
 
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
 using namespace smtk::common;
 using namespace smtk::model;
 using namespace smtk::model::testing;
 using namespace smtk::io;
 
-int main(int argc, char* argv[])
+// Report the peak resident set size of the process in megabytes (or -1 if unknown).
+static double peakMemoryMB()
 {
-  (void)argc;
-  (void)argv;
+#ifndef _WIN32
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+  {
+#ifdef __APPLE__
+    return usage.ru_maxrss / (1024. * 1024.);
+#else
+    return usage.ru_maxrss / 1024.;
+#endif
+  }
+#endif
+  return -1.;
+}
 
+int main(int argc, char* argv[])
+{
   ManagerPtr sm = Manager::create();
   Timer t;
   double deltaT;
 
   // ### Benchmark entity creation ###
   // This includes generating new UUIDs which takes up the bulk of the time.
-  int numObj = 1000;
+  int numObj = argc > 1 ? std::atoi(argv[1]) : 1000;
   t.mark();
   for (int i = 0; i < numObj; ++i)
   {
@@ -42,7 +61,8 @@ int main(int argc, char* argv[])
   deltaT = t.elapsed();
   std::cout << numObj << " objects " << deltaT << " seconds " << (numObj / deltaT) << " objs/sec\n"
             << "  " << sm->topology().size() << " entities " << deltaT << " seconds "
-            << (sm->topology().size() / deltaT) << " entities/sec\n";
+            << (sm->topology().size() / deltaT) << " entities/sec\n"
+            << "  " << peakMemoryMB() << " MB peak resident memory\n";
 
   // ### Benchmark entity lookup ###
   // #### Misses
@@ -99,7 +119,8 @@ int main(int argc, char* argv[])
     LoadJSON::intoModelManager(json.c_str(), sm2);
     deltaT = t.elapsed();
   }
-  std::cout << deltaT << " seconds to ingest JSON.\n";
+  std::cout << deltaT << " seconds to ingest JSON.\n"
+            << peakMemoryMB() << " MB peak resident memory\n";
 
   return 0;
 }
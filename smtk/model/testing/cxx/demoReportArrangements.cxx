@@ -65,9 +65,9 @@ void ReportEntity(ManagerPtr sm, UUIDWithEntityPtr& eit)
   fpit = sm->floatPropertiesForEntity(eit->first);
   if (fpit != sm->floatProperties().end())
   {
-    PropertyNameWithFloats fpval;
-    std::cout << "        " << fpit->second.size() << " float properties:\n";
-    for (fpval = fpit->second.begin(); fpval != fpit->second.end(); ++fpval)
+    PropertyNameWithConstFloats fpval;
+    std::cout << "        " << fpit->second.data().size() << " float properties:\n";
+    for (fpval = fpit->second.data().begin(); fpval != fpit->second.data().end(); ++fpval)
     {
       if (!fpval->second.empty())
       {
@@ -78,9 +78,9 @@ void ReportEntity(ManagerPtr sm, UUIDWithEntityPtr& eit)
   spit = sm->stringPropertiesForEntity(eit->first);
   if (spit != sm->stringProperties().end())
   {
-    PropertyNameWithStrings spval;
-    std::cout << "        " << spit->second.size() << " string properties:\n";
-    for (spval = spit->second.begin(); spval != spit->second.end(); ++spval)
+    PropertyNameWithConstStrings spval;
+    std::cout << "        " << spit->second.data().size() << " string properties:\n";
+    for (spval = spit->second.data().begin(); spval != spit->second.data().end(); ++spval)
     {
       if (!spval->second.empty())
       {
@@ -91,9 +91,9 @@ void ReportEntity(ManagerPtr sm, UUIDWithEntityPtr& eit)
   ipit = sm->integerPropertiesForEntity(eit->first);
   if (ipit != sm->integerProperties().end())
   {
-    PropertyNameWithIntegers ipval;
-    std::cout << "        " << ipit->second.size() << " integer properties:\n";
-    for (ipval = ipit->second.begin(); ipval != ipit->second.end(); ++ipval)
+    PropertyNameWithConstIntegers ipval;
+    std::cout << "        " << ipit->second.data().size() << " integer properties:\n";
+    for (ipval = ipit->second.data().begin(); ipval != ipit->second.data().end(); ++ipval)
     {
       if (!ipval->second.empty())
       {
@@ -0,0 +1,228 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/model/BVHPointLocator.h"
+#include "smtk/model/Face.h"
+#include "smtk/model/Instance.h"
+#include "smtk/model/Manager.h"
+#include "smtk/model/Tessellation.h"
+#include "smtk/model/Vertex.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+using namespace smtk::model;
+
+namespace
+{
+
+const int gridSize = 100;
+
+// A bumpy sheet over [0,10]x[0,10] whose height is offset by dz.
+void bumpySheet(Tessellation& tess, double dz)
+{
+  tess.reset();
+  for (int jj = 0; jj <= gridSize; ++jj)
+  {
+    for (int ii = 0; ii <= gridSize; ++ii)
+    {
+      double x = 10.0 * ii / gridSize;
+      double y = 10.0 * jj / gridSize;
+      tess.addCoords(x, y, 0.5 * std::sin(x) * std::cos(y) + dz);
+    }
+  }
+  for (int jj = 0; jj < gridSize; ++jj)
+  {
+    for (int ii = 0; ii < gridSize; ++ii)
+    {
+      int p0 = jj * (gridSize + 1) + ii;
+      int p1 = p0 + 1;
+      int p2 = p1 + gridSize + 1;
+      int p3 = p0 + gridSize + 1;
+      if ((ii + jj) % 2)
+      { // Exercise both triangles and quads.
+        tess.addQuad(p0, p1, p2, p3);
+      }
+      else
+      {
+        tess.addTriangle(p0, p1, p2);
+        tess.addTriangle(p0, p2, p3);
+      }
+    }
+  }
+}
+
+// Find the squared distance from p to the nearest of a grid of samples
+// taken on every triangle; this bounds the true distance from above.
+double bruteForceDistance2(const Tessellation& tess, const double* p)
+{
+  double best = -1.0;
+  const std::vector<double>& x(tess.coords());
+  std::vector<int> conn;
+  for (int off = tess.begin(); off != tess.end(); off = tess.nextCellOffset(off))
+  {
+    conn.clear();
+    tess.vertexIdsOfCell(off, conn);
+    for (std::size_t tt = 2; tt < conn.size(); ++tt)
+    {
+      const double* a = &x[3 * conn[0]];
+      const double* b = &x[3 * conn[tt - 1]];
+      const double* c = &x[3 * conn[tt]];
+      const int steps = 8;
+      for (int uu = 0; uu <= steps; ++uu)
+      {
+        for (int vv = 0; vv <= steps - uu; ++vv)
+        {
+          double u = static_cast<double>(uu) / steps;
+          double v = static_cast<double>(vv) / steps;
+          double d2 = 0.0;
+          for (int kk = 0; kk < 3; ++kk)
+          {
+            double q = a[kk] + u * (b[kk] - a[kk]) + v * (c[kk] - a[kk]);
+            d2 += (q - p[kk]) * (q - p[kk]);
+          }
+          if (best < 0.0 || d2 < best)
+          {
+            best = d2;
+          }
+        }
+      }
+    }
+  }
+  return best;
+}
+
+double distance2(const double* a, const double* b)
+{
+  return (a[0] - b[0]) * (a[0] - b[0]) + (a[1] - b[1]) * (a[1] - b[1]) +
+    (a[2] - b[2]) * (a[2] - b[2]);
+}
+}
+
+int main()
+{
+  ManagerPtr mgr = Manager::create();
+  Face face = mgr->addFace();
+  Tessellation sheet;
+  bumpySheet(sheet, 0.0);
+  face.setTessellation(&sheet);
+
+  std::mt19937 gen(1234);
+  std::uniform_real_distribution<> distXY(-1.0, 11.0);
+  std::uniform_real_distribution<> distZ(-2.0, 2.0);
+  const std::size_t numQuery = 50000;
+  std::vector<double> queries(3 * numQuery);
+  for (std::size_t ii = 0; ii < numQuery; ++ii)
+  {
+    queries[3 * ii] = distXY(gen);
+    queries[3 * ii + 1] = distXY(gen);
+    queries[3 * ii + 2] = distZ(gen);
+  }
+
+  BVHPointLocator::clearCache();
+  auto locator = BVHPointLocator::create();
+  std::vector<double> closest;
+  auto start = std::chrono::steady_clock::now();
+  smtkTest(locator->closestPointOn(face, closest, queries), "Expected projection to succeed.");
+  auto stop = std::chrono::steady_clock::now();
+  smtkTest(closest.size() == queries.size(), "Expected one result per query point.");
+  smtkTest(BVHPointLocator::numberOfCachedEntities() == 1, "Expected one cached hierarchy.");
+  std::cout << "Projected " << numQuery << " points onto " << 2 * gridSize * gridSize
+            << " triangles in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(stop - start).count()
+            << " ms (including hierarchy construction)\n";
+
+  // Results must lie on the surface and be no farther than any sampled surface point.
+  const Tessellation* stored = face.hasTessellation();
+  for (std::size_t ii = 0; ii < numQuery; ii += 997)
+  {
+    const double* p = &queries[3 * ii];
+    const double* c = &closest[3 * ii];
+    double found = distance2(p, c);
+    double sampled = bruteForceDistance2(*stored, p);
+    smtkTest(found <= sampled + 1e-9, "Point " << ii << " projected to distance^2 " << found
+                                               << " but the surface has a point at " << sampled);
+    smtkTest(c[0] >= -1e-9 && c[0] <= 10.0 + 1e-9 && c[1] >= -1e-9 && c[1] <= 10.0 + 1e-9,
+      "Point " << ii << " projected outside the sheet.");
+  }
+
+  // Points on the surface map to themselves.
+  std::vector<double> onSurface(stored->coords().begin(), stored->coords().begin() + 300);
+  std::vector<double> same;
+  locator->closestPointOn(face, same, onSurface);
+  for (std::size_t ii = 0; ii < onSurface.size(); ++ii)
+  {
+    smtkTest(std::fabs(same[ii] - onSurface[ii]) < 1e-12, "Surface point moved.");
+  }
+
+  // A second query reuses the cached hierarchy and gives identical answers.
+  std::vector<double> again;
+  start = std::chrono::steady_clock::now();
+  locator->closestPointOn(face, again, queries);
+  stop = std::chrono::steady_clock::now();
+  smtkTest(again == closest, "Expected cached hierarchy to give identical results.");
+  std::cout << "Projected again in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(stop - start).count()
+            << " ms (cached hierarchy)\n";
+
+  // Replacing the tessellation bumps its generation and invalidates the cache.
+  bumpySheet(sheet, 1.0);
+  face.setTessellation(&sheet);
+  locator->closestPointOn(face, again, queries);
+  for (std::size_t ii = 0; ii < numQuery; ii += 997)
+  {
+    double x = again[3 * ii];
+    double y = again[3 * ii + 1];
+    double z = again[3 * ii + 2];
+    smtkTest(std::fabs(z - 1.0 - 0.5 * std::sin(x) * std::cos(y)) < 0.05,
+      "Expected projection onto the regenerated tessellation.");
+  }
+  smtkTest(BVHPointLocator::numberOfCachedEntities() == 1, "Expected stale entry to be replaced.");
+
+  // Instances snap onto the surface even when the named snap rule is not registered.
+  Vertex proto = mgr->addVertex();
+  Instance inst = mgr->addInstance(proto);
+  inst.setRule("tabular");
+  std::vector<double> placements(queries.begin(), queries.begin() + 30);
+  inst.setFloatProperty("placements", placements);
+  inst.setStringProperty("snap rule", "model_entity_point_locator");
+  smtkTest(inst.setSnapEntity(face), "Could not set snap entity.");
+  Tessellation* snapped = inst.generateTessellation();
+  smtkTest(snapped && snapped->coords().size() == placements.size(), "Expected 10 placements.");
+  std::vector<double> expected;
+  locator->closestPointOn(face, expected, placements);
+  smtkTest(snapped->coords() == expected, "Expected placements to be snapped to the face.");
+
+  // The locator is registered by name, so snap rules may ask for it explicitly.
+  auto registered =
+    smtk::common::Extension::findAs<PointLocatorExtension>("model_entity_bvh_point_locator");
+  smtkTest(!!std::dynamic_pointer_cast<BVHPointLocator>(registered),
+    "Expected model_entity_bvh_point_locator to be registered.");
+
+  // A face with the same UUID in another manager gets its own hierarchy.
+  BVHPointLocator::clearCache();
+  locator->closestPointOn(face, again, queries);
+  ManagerPtr other = Manager::create();
+  Face twin = other->insertFace(face.entity());
+  bumpySheet(sheet, -1.0);
+  twin.setTessellation(&sheet);
+  std::vector<double> onTwin;
+  smtkTest(registered->closestPointOn(twin, onTwin, queries), "Expected projection onto twin.");
+  smtkTest(BVHPointLocator::numberOfCachedEntities() == 2, "Expected one hierarchy per manager.");
+  smtkTest(onTwin != again, "Expected the twin's own tessellation to be used.");
+
+  BVHPointLocator::clearCache();
+  smtkTest(BVHPointLocator::numberOfCachedEntities() == 0, "Expected an empty cache.");
+  return 0;
+}
+
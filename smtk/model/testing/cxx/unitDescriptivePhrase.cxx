@@ -18,6 +18,7 @@
 #include "smtk/common/testing/cxx/helpers.h"
 #include "smtk/model/testing/cxx/helpers.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -30,6 +31,60 @@ using namespace smtk::model;
 using namespace smtk::model::testing;
 using namespace smtk::io;
 
+// Verify that asking the generator whether a phrase has subphrases agrees
+// with the subphrases it builds, without building them first.
+void checkHasSubphrases(SubphraseGenerator::Ptr spg, DescriptivePhrase::Ptr p, int depth)
+{
+  if (depth > 6)
+    return;
+
+  test(!p->areSubphrasesBuilt(), "Subphrases should be built on demand.");
+  bool expected = spg->hasSubphrases(p);
+  test(!p->areSubphrasesBuilt(), "hasSubphrases() should not build subphrases.");
+  DescriptivePhrases sub = p->subphrases();
+  test(expected == !sub.empty(), "hasSubphrases() disagrees with the subphrases built.");
+  for (DescriptivePhrases::iterator it = sub.begin(); it != sub.end(); ++it)
+  {
+    checkHasSubphrases(spg, *it, depth + 1);
+  }
+}
+
+// Verify that building an entity list's subphrases a page at a time creates
+// phrases only for the pages asked for, in the order of the full list.
+void checkPagedSubphrases(SubphraseGenerator::Ptr spg, const EntityRefArray& ents)
+{
+  DescriptivePhrase::Ptr dit;
+  EntityListPhrase::Ptr paged = EntityListPhrase::create()->setup(ents, dit);
+  paged->setDelegate(spg);
+  EntityListPhrase::Ptr whole = EntityListPhrase::create()->setup(ents, dit);
+  whole->setDelegate(spg);
+
+  test(paged->hasSubphrases() == !ents.empty(), "hasSubphrases() disagrees with the entity list.");
+  test(!paged->areSubphrasesBuilt() && !paged->areSubphrasesPaged(),
+    "hasSubphrases() should not build subphrases.");
+
+  const int pageSize = 2;
+  DescriptivePhrases& first = paged->leadingSubphrases(pageSize);
+  test(static_cast<int>(first.size()) == std::min(pageSize, static_cast<int>(ents.size())),
+    "Expected a single page of subphrases.");
+  test(paged->areSubphrasesPaged() == (static_cast<int>(ents.size()) > pageSize),
+    "Only part of a long list should be built.");
+  DescriptivePhrase::Ptr firstPhrase = first.empty() ? dit : first.front();
+
+  DescriptivePhrases all = paged->subphrases();
+  DescriptivePhrases expected = whole->subphrases();
+  test(paged->areSubphrasesBuilt() && !paged->areSubphrasesPaged(),
+    "Asking for every subphrase should build the rest.");
+  test(all.size() == expected.size(), "Paged and whole lists differ in size.");
+  test(all.empty() || all.front() == firstPhrase, "Pages already built should be kept.");
+  for (std::size_t i = 0; i < all.size(); ++i)
+  {
+    test(all[i]->relatedEntity().entityFlags() == expected[i]->relatedEntity().entityFlags() &&
+        all[i]->title() == expected[i]->title(),
+      "Paged subphrases are not in the order of the whole list.");
+  }
+}
+
 int main(int argc, char* argv[])
 {
   ManagerPtr sm = Manager::create();
@@ -71,6 +126,11 @@ int main(int argc, char* argv[])
     EntityListPhrase::Ptr elist = EntityListPhrase::create()->setup(ents, dit);
     SimpleModelSubphrases::Ptr spg = SimpleModelSubphrases::create();
     elist->setDelegate(spg);
+    checkHasSubphrases(spg, elist, 0);
+
+    EntityRefArray cells;
+    EntityRef::EntityRefsFromUUIDs(cells, sm, sm->entitiesMatchingFlags(CELL_ENTITY, false));
+    checkPagedSubphrases(spg, cells);
     printPhrase(std::cout, 0, elist);
   }
   else
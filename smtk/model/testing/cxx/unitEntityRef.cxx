@@ -22,6 +22,7 @@
 #include "smtk/model/Manager.h"
 #include "smtk/model/Model.h"
 #include "smtk/model/Shell.h"
+#include "smtk/model/Tessellation.h"
 #include "smtk/model/UseEntity.h"
 #include "smtk/model/Vertex.h"
 #include "smtk/model/VertexUse.h"
@@ -224,6 +225,71 @@ void testResourceComponentConversion()
     "Component/Entity mismatch.");
 }
 
+void testBoundingBoxCache()
+{
+  ManagerPtr sm = Manager::create();
+  Model model = sm->addModel(3, 3, "bounds");
+  Model submodel = sm->addModel(3, 3, "sub");
+  model.addSubmodel(submodel);
+  Face f0 = sm->addFace();
+  Face f1 = sm->addFace();
+  model.addCell(f0);
+  submodel.addCell(f1);
+
+  Tessellation t0;
+  t0.addCoords(0., 0., 0.);
+  t0.addCoords(1., 2., 3.);
+  f0.setTessellationAndBoundingBox(&t0);
+  Tessellation t1;
+  t1.addCoords(-1., 0., 0.);
+  t1.addCoords(0., 1., 1.);
+  f1.setTessellationAndBoundingBox(&t1);
+
+  std::vector<double> expected = { -1., 1., 0., 2., 0., 3. };
+  test(model.boundingBox() == expected, "Wrong model bounding box.");
+  std::vector<double> cached;
+  test(sm->cachedBoundingBox(model.entity(), cached) && cached == expected,
+    "Expected the model's bounding box to be cached.");
+  test(!sm->cachedBoundingBox(f0.entity(), cached), "Faces have their own bounding boxes.");
+  test(model.boundingBox() == expected, "Cached model bounding box differs.");
+
+  // Changing the geometry of a nested cell invalidates the cache.
+  t1.addCoords(0., 0., 5.);
+  f1.setTessellationAndBoundingBox(&t1);
+  test(!sm->cachedBoundingBox(model.entity(), cached), "Retessellating should clear the cache.");
+  expected[5] = 5.;
+  test(model.boundingBox() == expected, "Wrong model bounding box after retessellating.");
+  test(submodel.boundingBox() == std::vector<double>({ -1., 0., 0., 1., 0., 5. }),
+    "Wrong submodel bounding box.");
+
+  // So does changing the model's topology.
+  Face f2 = sm->addFace();
+  Tessellation t2;
+  t2.addCoords(10., 0., 0.);
+  f2.setTessellationAndBoundingBox(&t2);
+  model.boundingBox();
+  model.addCell(f2);
+  expected[1] = 10.;
+  test(model.boundingBox() == expected, "Wrong model bounding box after adding a cell.");
+  model.removeCell(f2);
+  expected[1] = 1.;
+  test(model.boundingBox() == expected, "Wrong model bounding box after removing a cell.");
+
+  // Bounding boxes may be edited through the reference the manager hands out.
+  model.boundingBox();
+  f1.floatProperty(SMTK_BOUNDING_BOX_PROP)[5] = 7.;
+  expected[5] = 7.;
+  test(model.boundingBox() == expected, "Wrong model bounding box after editing a face's box.");
+
+  // Every way of changing a tessellation discards cached boxes.
+  model.boundingBox();
+  f0.setTessellation(&t0);
+  test(!sm->cachedBoundingBox(model.entity(), cached), "setTessellation should clear the cache.");
+  model.boundingBox();
+  f0.resetTessellation();
+  test(!sm->cachedBoundingBox(model.entity(), cached), "resetTessellation should clear the cache.");
+}
+
 int main(int argc, char* argv[])
 {
   (void)argc;
@@ -574,6 +640,7 @@ int main(int argc, char* argv[])
     testVolumeEntityRef();
     testModelMethods();
     testResourceComponentConversion();
+    testBoundingBoxCache();
   }
   catch (const std::string& msg)
   {
@@ -9,10 +9,15 @@
 //=========================================================================
 #include "smtk/io/SaveJSON.h"
 #include "smtk/model/CellEntity.h"
+#include "smtk/model/Edge.h"
+#include "smtk/model/Face.h"
 #include "smtk/model/Manager.h"
 #include "smtk/model/Model.h"
+#include "smtk/model/Vertex.h"
 #include "smtk/model/Volume.h"
 
+#include "smtk/common/PoolAllocator.h"
+
 #include "smtk/common/testing/cxx/helpers.h"
 #include "smtk/model/testing/cxx/helpers.h"
 
@@ -56,6 +61,93 @@ int addEntityToModel(ManagerEventType evt, const smtk::model::EntityRef& src,
   return 0;
 }
 
+static int batches = 0;
+static std::size_t batchedEntities = 0;
+
+int batchEvent(ManagerEventType evt, const smtk::model::EntityRefArray& ents, void*)
+{
+  if (evt.first == ADD_EVENT)
+  {
+    ++batches;
+    batchedEntities += ents.size();
+  }
+  return 0;
+}
+
+void testBatchedEvents()
+{
+  ManagerPtr sm = Manager::create();
+  int count = entCount;
+  sm->observe(std::make_pair(ANY_EVENT, ENTITY_ENTRY), &entityManagerEvent, NULL);
+  sm->observe(std::make_pair(ANY_EVENT, ENTITY_ENTRY), &batchEvent, NULL);
+  sm->observe(std::make_pair(ANY_EVENT, MODEL_INCLUDES_FREE_CELL), &batchEvent, NULL);
+
+  // Outside of a transaction, batch observers see each event.
+  Model model = sm->addModel(3, 3, "batch");
+  test(batches == 1 && batchedEntities == 1, "Expected an unbatched event.");
+
+  batches = 0;
+  batchedEntities = 0;
+  {
+    Manager::Transaction transaction(sm);
+    {
+      // Nested transactions are delivered with the outermost.
+      Manager::Transaction nested(sm);
+      for (int i = 0; i < 500; ++i)
+      {
+        model.addCell(sm->addVertex());
+      }
+    }
+    for (int i = 0; i < 500; ++i)
+    {
+      model.addCell(sm->addEdge());
+    }
+    test(sm->inTransaction() && batches == 0, "Events were delivered during a transaction.");
+  }
+  test(!sm->inTransaction(), "Transaction did not end.");
+  test(entCount - count == 1001, "Unbatched observers should see every event.");
+  // One batch of 1000 new cells and one batch holding the model (which had
+  // 1000 free cells added).
+  test(batches == 2 && batchedEntities == 1001, "Events were not coalesced.");
+
+  {
+    Manager::Transaction transaction(sm);
+    model.addCell(sm->addFace());
+    transaction.end();
+    test(!sm->inTransaction() && batches == 4, "Transaction did not end early.");
+  }
+  test(!sm->inTransaction() && batches == 4, "Transaction ended twice.");
+
+  sm->unobserve(std::make_pair(ANY_EVENT, ENTITY_ENTRY), &batchEvent, NULL);
+  sm->unobserve(std::make_pair(ANY_EVENT, MODEL_INCLUDES_FREE_CELL), &batchEvent, NULL);
+  sm->beginTransaction();
+  sm->addFace();
+  sm->endTransaction();
+  test(batches == 4, "Unobserved batch callback was invoked.");
+}
+
+// Entity records are allocated from their manager's memory pools, which are
+// freed once the manager and every record it allocated are gone.
+void testMemoryPools()
+{
+  std::weak_ptr<MemoryPools> pools;
+  EntityPtr survivor;
+  {
+    ManagerPtr mgr = Manager::create();
+    pools = mgr->memoryPools();
+    Model model = mgr->addModel(3, 3, "pooled");
+    for (int i = 0; i < 100; ++i)
+    {
+      model.addCell(mgr->addVertex());
+    }
+    test(pools.lock()->numberOfSlabs() > 0, "Entity records were not pooled.");
+    survivor = mgr->findEntity(model.entity());
+  }
+  test(!pools.expired(), "Pools were freed while an entity record was held.");
+  survivor.reset();
+  test(pools.expired(), "Pools were not freed with their manager.");
+}
+
 int main(int argc, char* argv[])
 {
   (void)argc;
@@ -226,6 +318,9 @@ int main(int argc, char* argv[])
     "unarrangeEntity(..., true) failed to remove the entity afterwards.");
   test(sm->erase(uids[0]), "Failed to erase a vertex.");
 
+  testBatchedEvents();
+  testMemoryPools();
+
   std::cout << entCount << " total entities:\n";
   std::cout << "subgroups " << subgroups << "\n";
   std::cout << "submodels " << submodels << "\n";
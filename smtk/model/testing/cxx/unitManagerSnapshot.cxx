@@ -0,0 +1,193 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/model/Edge.h"
+#include "smtk/model/EntityRef.h"
+#include "smtk/model/Manager.h"
+#include "smtk/model/Model.h"
+#include "smtk/model/Tessellation.h"
+#include "smtk/model/Vertex.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace smtk::common;
+using namespace smtk::model;
+
+namespace
+{
+
+void testSnapshotIsolation()
+{
+  ManagerPtr manager = Manager::create();
+  Model model = manager->addModel(3, 3, "model");
+  Vertex v0 = manager->addVertex();
+  Vertex v1 = manager->addVertex();
+  Edge edge = manager->addEdge();
+  edge.setName("edge");
+  edge.setFloatProperty("length", 1.0);
+  model.addCell(v0);
+  Tessellation tess;
+  tess.addCoords(0., 0., 0.);
+  v0.setTessellation(&tess);
+
+  std::size_t numberOfEntities = manager->topology().size();
+  std::size_t numberOfArrangements = manager->findEntity(model.entity())->arrangementMap().size();
+
+  ManagerPtr snapshot = manager->snapshot();
+  test(snapshot->isSnapshot() && !manager->isSnapshot(), "Snapshot not marked.");
+  test(snapshot->topology().size() == numberOfEntities, "Snapshot is missing entities.");
+
+  // Modify the live manager in every table the snapshot shares.
+  manager->addVertex();
+  model.addCell(v1);
+  edge.setName("renamed");
+  edge.setFloatProperty("length", 2.0);
+  v0.setStringProperty("color", "red");
+  tess.addCoords(1., 0., 0.);
+  v0.setTessellation(&tess);
+  manager->erase(edge);
+
+  test(manager->topology().size() == numberOfEntities, "Live manager not modified.");
+  test(snapshot->topology().size() == numberOfEntities, "Snapshot entities changed.");
+  test(snapshot->findEntity(edge.entity(), false) != nullptr, "Snapshot lost an erased entity.");
+  test(manager->findEntity(edge.entity(), false) == nullptr, "Entity was not erased.");
+  test(snapshot->findEntity(model.entity(), false)->arrangementMap().size() ==
+      numberOfArrangements,
+    "Snapshot arrangements changed.");
+  test(EntityRef(snapshot, edge.entity()).name() == "edge", "Snapshot name changed.");
+  test(snapshot->floatProperty(edge.entity(), "length")[0] == 1.0, "Snapshot property changed.");
+  test(!snapshot->hasStringProperty(v0.entity(), "color"), "Snapshot gained a property.");
+  test(snapshot->tessellations().find(v0.entity())->second.coords().size() == 3,
+    "Snapshot tessellation changed.");
+  test(manager->tessellations().find(v0.entity())->second.coords().size() == 6,
+    "Live tessellation not modified.");
+
+  // Restoring the snapshot undoes the changes.
+  manager->restore(snapshot);
+  test(manager->topology().size() == numberOfEntities, "Restore did not revert entities.");
+  test(manager->findEntity(edge.entity(), false) != nullptr, "Restore did not revert erasure.");
+  test(EntityRef(manager, edge.entity()).name() == "edge", "Restore did not revert name.");
+  test(manager->floatProperty(edge.entity(), "length")[0] == 1.0, "Restore did not revert.");
+  test(!manager->hasStringProperty(v0.entity(), "color"), "Restore did not remove property.");
+
+  // The snapshot may be restored again after further edits.
+  EntityRef(manager, edge.entity()).setName("again");
+  test(EntityRef(snapshot, edge.entity()).name() == "edge", "Snapshot changed after restore.");
+  manager->restore(snapshot);
+  test(EntityRef(manager, edge.entity()).name() == "edge", "Second restore failed.");
+}
+
+void testPerEntitySharing()
+{
+  ManagerPtr manager = Manager::create();
+  Model model = manager->addModel(3, 3, "model");
+  Vertex touched = manager->addVertex();
+  Vertex untouched = manager->addVertex();
+  touched.setIntegerProperty("index", 0);
+  untouched.setIntegerProperty("index", 1);
+
+  ManagerPtr snapshot = manager->snapshot();
+  const Manager& live(*manager);
+  const Manager& frozen(*snapshot);
+  test(live.findEntity(untouched.entity()) == frozen.findEntity(untouched.entity()),
+    "Snapshot did not share an entity record.");
+
+  // Writing one entity copies only that entity's records.
+  touched.setIntegerProperty("index", 2);
+  model.addCell(touched);
+  test(live.findEntity(touched.entity()) != frozen.findEntity(touched.entity()),
+    "Modified entity record is still shared.");
+  test(live.findEntity(untouched.entity()) == frozen.findEntity(untouched.entity()),
+    "Unmodified entity record was copied.");
+  test(&live.integerProperties().find(untouched.entity())->second.data() ==
+      &frozen.integerProperties().find(untouched.entity())->second.data(),
+    "Unmodified property record was copied.");
+  test(&live.integerProperties().find(touched.entity())->second.data() !=
+      &frozen.integerProperties().find(touched.entity())->second.data(),
+    "Modified property record is still shared.");
+  test(frozen.integerProperty(touched.entity(), "index")[0] == 0, "Snapshot property changed.");
+
+  // Const lookups on the snapshot never copy.
+  EntityPtr shared = frozen.findEntity(model.entity());
+  test(frozen.findEntity(model.entity()) == shared, "Const lookup copied a record.");
+
+  // Reading the live manager through entity references does not copy either.
+  test(untouched.isValid() && untouched.dimension() == 0 && untouched.isVertex(),
+    "Could not read the unmodified vertex.");
+  test(model.cells().size() == 1 && model.cells()[0] == touched, "Could not read model cells.");
+  test(!untouched.flagSummary().empty() && untouched.embeddedIn() == EntityRef(),
+    "Could not summarize the unmodified vertex.");
+  test(untouched.entityRecord() == frozen.findEntity(untouched.entity()),
+    "Reading an entity copied its record.");
+}
+
+void testConcurrentReads()
+{
+  ManagerPtr manager = Manager::create();
+  Model model = manager->addModel(3, 3, "model");
+  Vertices verts;
+  for (int i = 0; i < 1000; ++i)
+  {
+    verts.push_back(manager->addVertex());
+    verts.back().setIntegerProperty("index", i);
+  }
+  ManagerPtr snapshot = manager->snapshot();
+  std::size_t numberOfEntities = snapshot->topology().size();
+
+  // Read the snapshot on another thread while the live manager changes,
+  // including the records the snapshot shares.
+  std::atomic<bool> consistent(true);
+  std::thread reader([&snapshot, &verts, &consistent, numberOfEntities]() {
+    for (int pass = 0; pass < 20; ++pass)
+    {
+      const Manager& frozen(*snapshot);
+      std::size_t count = 0;
+      for (auto& entry : frozen.topology())
+      {
+        if (entry.second->entityFlags() & VERTEX)
+        {
+          ++count;
+        }
+      }
+      if (count + 1 != numberOfEntities || frozen.topology().size() != numberOfEntities)
+      {
+        consistent = false;
+      }
+      for (std::size_t i = 0; i < verts.size(); ++i)
+      {
+        const IntegerList& index(frozen.integerProperty(verts[i].entity(), "index"));
+        if (index.size() != 1 || index[0] != static_cast<Integer>(i))
+        {
+          consistent = false;
+        }
+      }
+    }
+  });
+  for (int i = 0; i < 1000; ++i)
+  {
+    manager->addVertex().setIntegerProperty("index", i);
+    verts[i].setIntegerProperty("index", -i);
+    model.addCell(verts[i]);
+  }
+  reader.join();
+  test(consistent, "Snapshot changed while it was read.");
+  test(manager->topology().size() == numberOfEntities + 1000, "Live manager not modified.");
+}
+}
+
+int main()
+{
+  testSnapshotIsolation();
+  testPerEntitySharing();
+  testConcurrentReads();
+  return 0;
+}
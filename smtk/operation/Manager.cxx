@@ -20,6 +20,10 @@
 #include "smtk/io/AttributeReader.h"
 #include "smtk/io/Logger.h"
 
+#include "smtk/common/ThreadPool.h"
+
+#include "smtk/resource/Resource.h"
+
 namespace smtk
 {
 namespace operation
@@ -27,6 +31,7 @@ namespace operation
 Manager::Dictionary Manager::s_dictionary;
 
 Manager::Manager()
+  : m_numberOfThreads(0)
 {
   this->m_operatorCollection = smtk::attribute::Collection::create();
 
@@ -114,6 +119,32 @@ bool Manager::importOperatorXML(
   return ok;
 }
 
+std::future<Operator::Result> Manager::launch(OperatorPtr op)
+{
+  std::unique_lock<std::mutex> guard(this->m_threadPoolMutex);
+  if (!this->m_threadPool)
+  {
+    this->m_threadPool.reset(new smtk::common::ThreadPool(this->m_numberOfThreads));
+  }
+  return (*this->m_threadPool)([op]() {
+    if (!op)
+    {
+      return Operator::Result();
+    }
+    return op->operate();
+  });
+}
+
+void Manager::setNumberOfThreads(std::size_t numberOfThreads)
+{
+  std::unique_lock<std::mutex> guard(this->m_threadPoolMutex);
+  if (numberOfThreads != this->m_numberOfThreads)
+  {
+    this->m_numberOfThreads = numberOfThreads;
+    this->m_threadPool.reset();
+  }
+}
+
 smtk::operation::OperatorPtr Manager::create(Operator::Index index)
 {
   auto info = this->s_dictionary.find(index);
@@ -21,12 +21,20 @@
 
 #include "smtk/operation/Operator.h"
 
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <typeinfo>
 #include <unordered_map>
 
 namespace smtk
 {
+namespace common
+{
+class ThreadPool;
+}
 namespace operation
 {
 class SMTKCORE_EXPORT Manager : smtkEnableSharedPtr(Manager)
@@ -46,6 +54,23 @@ public:
   template <class OperatorType>
   smtk::shared_ptr<OperatorType> create();
 
+  // Run \a op on a worker thread and return a future for its result.
+  //
+  // Operator::operate() locks each resource returned by op->resourcesToLock(),
+  // so operators with disjoint or read-only access run concurrently while
+  // conflicting ones (launched or run directly) wait for each other.
+  // Observers of the operator are notified on the worker thread while those
+  // locks are held; they must not block on a thread that needs the same
+  // resources (e.g., by waiting synchronously on the GUI thread). Operators
+  // launched this way must not be run synchronously while they are pending.
+  std::future<Operator::Result> launch(OperatorPtr op);
+
+  // Set the number of worker threads used by launch(); zero (the default)
+  // uses one per hardware thread. Changing it waits for launched operators
+  // to finish.
+  void setNumberOfThreads(std::size_t numberOfThreads);
+  std::size_t numberOfThreads() const { return this->m_numberOfThreads; }
+
   // TODO: All of the registration methods have way too much boilerplate info.
   // This much information about each operator cannot be required (not to
   // mention the implicit requirement that names in the xml description match
@@ -86,6 +111,10 @@ private:
   // A map between the Operator's type_index and its constructor.
   static Dictionary s_dictionary;
   smtk::attribute::CollectionPtr m_operatorCollection;
+
+  std::unique_ptr<smtk::common::ThreadPool> m_threadPool;
+  std::size_t m_numberOfThreads;
+  std::mutex m_threadPoolMutex;
 };
 
 template <class OperatorType>
@@ -9,6 +9,8 @@
 //=========================================================================
 #include "smtk/operation/Operator.h"
 
+#include "smtk/operation/OperatorTrace.h"
+
 #include "smtk/io/Logger.h"
 #include "smtk/io/SaveJSON.h"
 
@@ -24,12 +26,22 @@
 #include "smtk/attribute/ModelEntityItem.h"
 #include "smtk/attribute/RefItem.h"
 #include "smtk/attribute/StringItem.h"
+#include "smtk/attribute/ValueItem.h"
 #include "smtk/attribute/VoidItem.h"
 
 #include "smtk/common/UUID.h"
 
+#include "smtk/mesh/core/Collection.h"
+#include "smtk/mesh/core/MeshSet.h"
+
+#include "smtk/model/EntityRef.h"
+#include "smtk/model/Manager.h"
+
+#include "smtk/resource/Resource.h"
+
 #include "cJSON.h"
 
+#include <map>
 #include <sstream>
 
 using smtk::attribute::IntItem;
@@ -50,6 +62,56 @@ namespace smtk
 namespace operation
 {
 
+namespace
+{
+void requestWriteAccess(Operator::ResourceAccessMap& access, smtk::resource::ResourcePtr resource)
+{
+  if (resource)
+  {
+    access[resource] = smtk::resource::LockType::Write;
+  }
+}
+
+void addResourcesOfItem(Operator::ResourceAccessMap& access, smtk::attribute::ItemPtr item)
+{
+  if (!item || !item->isEnabled())
+  {
+    return;
+  }
+  if (auto entityItem = smtk::dynamic_pointer_cast<ModelEntityItem>(item))
+  {
+    for (std::size_t i = 0; i < entityItem->numberOfValues(); ++i)
+    {
+      requestWriteAccess(access, entityItem->value(i).manager());
+    }
+  }
+  else if (auto meshItem = smtk::dynamic_pointer_cast<MeshItem>(item))
+  {
+    for (std::size_t i = 0; i < meshItem->numberOfValues(); ++i)
+    {
+      requestWriteAccess(access, meshItem->value(i).collection());
+    }
+  }
+  else if (auto groupItem = smtk::dynamic_pointer_cast<GroupItem>(item))
+  {
+    for (std::size_t i = 0; i < groupItem->numberOfGroups(); ++i)
+    {
+      for (std::size_t j = 0; j < groupItem->numberOfItemsPerGroup(); ++j)
+      {
+        addResourcesOfItem(access, groupItem->item(i, j));
+      }
+    }
+  }
+  else if (auto valueItem = smtk::dynamic_pointer_cast<smtk::attribute::ValueItem>(item))
+  {
+    for (std::size_t i = 0; i < valueItem->numberOfActiveChildrenItems(); ++i)
+    {
+      addResourcesOfItem(access, valueItem->activeChildItem(static_cast<int>(i)));
+    }
+  }
+}
+}
+
 Operator::Operator()
 {
   this->m_debugLevel = 0;
@@ -79,25 +141,52 @@ bool Operator::ableToOperate()
   * invoking ableToOperate(). If it returns true, then the
   * operateInternal() method (implemented by subclasses) is invoked.
   *
+  * Before anything else, the resources returned by resourcesToLock() are
+  * locked; they remain locked until operate() returns. This holds whether
+  * the operator is run directly or by smtk::operation::Manager::launch().
+  * An operator run from within another operator on the same thread does not
+  * lock the resources its enclosing operator already holds.
+  *
   * You may register callbacks to observe how the operation is
   * proceeding: you can be signaled when the operation is about
   * to be executed and just after it does execute. Neither will
   * be called if the ableToOperate method returns false.
+  * Observers are invoked on the thread calling operate() (a worker thread
+  * for launched operators) while the resource locks are held. They may
+  * read or modify the locked resources but must not lock them, launch and
+  * wait on operators that need them, or wait on another thread that does.
+  *
+  * When OperatorTrace is enabled, the time spent in each of these
+  * steps is recorded.
   */
 Operator::Result Operator::operate()
 {
   // Remember where the log was so we only serialize messages for this operation:
   std::size_t logStart = this->log().numberOfRecords();
+  OperatorTrace::Recorder trace(*this);
+
+  ResourceLocks locks(*this);
 
   Operator::Result result;
-  if (this->ableToOperate())
+  bool able;
+  {
+    OperatorTrace::Phase phase(trace, "ableToOperate");
+    able = this->ableToOperate();
+  }
+  if (able)
   {
     // Set the debug level if specified as a convenience for subclasses:
     smtk::attribute::IntItem::Ptr debugItem = this->specification()->findInt("debug level");
     this->m_debugLevel = (debugItem->isEnabled() ? debugItem->value() : 0);
     // Run the operation if possible:
-    if (!this->trigger(WILL_OPERATE))
+    int canceled;
     {
+      OperatorTrace::Phase phase(trace, "observe WILL_OPERATE");
+      canceled = this->trigger(WILL_OPERATE);
+    }
+    if (!canceled)
+    {
+      OperatorTrace::Phase phase(trace, "operateInternal");
       result = this->operateInternal();
     }
     else
@@ -105,21 +194,27 @@ Operator::Result Operator::operate()
       result = this->createResult(OPERATION_CANCELED);
     }
 
-    this->generateSummary(result);
-
-    // Now grab all log messages and serialize them into the result attribute.
-    std::size_t logEnd = this->log().numberOfRecords();
-    if (logEnd > logStart)
-    { // Serialize relevant log records to JSON.
-      cJSON* array = cJSON_CreateArray();
-      smtk::io::SaveJSON::forLog(array, this->log(), logStart, logEnd);
-      char* logstr = cJSON_Print(array);
-      cJSON_Delete(array);
-      result->findString("log")->appendValue(logstr);
-      free(logstr);
+    {
+      OperatorTrace::Phase phase(trace, "transcribe result");
+      this->generateSummary(result);
+
+      // Now grab all log messages and serialize them into the result attribute.
+      std::size_t logEnd = this->log().numberOfRecords();
+      if (logEnd > logStart)
+      { // Serialize relevant log records to JSON.
+        cJSON* array = cJSON_CreateArray();
+        smtk::io::SaveJSON::forLog(array, this->log(), logStart, logEnd);
+        char* logstr = cJSON_Print(array);
+        cJSON_Delete(array);
+        result->findString("log")->appendValue(logstr);
+        free(logstr);
+      }
     }
     // Inform observers that the operation completed.
-    this->trigger(DID_OPERATE, result);
+    {
+      OperatorTrace::Phase phase(trace, "observe DID_OPERATE");
+      this->trigger(DID_OPERATE, result);
+    }
   }
   else
   {
@@ -137,9 +232,89 @@ Operator::Result Operator::operate()
       free(logstr);
     }
   }
+  if (trace.isRecording())
+  {
+    trace.setOutcome(result->findInt("outcome")->value());
+  }
   return result;
 }
 
+/**\brief Return the resources this operation reads or writes.
+  *
+  * operate() acquires a lock of the given type on each of these resources
+  * before running the operator, so that operators launched with disjoint
+  * (or read-only) access may run concurrently.
+  *
+  * By default, every model manager and mesh collection that owns an
+  * entity or mesh set in the specification's associations or (enabled)
+  * items is locked for writing. Subclasses that only read some of their
+  * inputs, or that touch resources not named by their parameters, should
+  * override this method.
+  */
+Operator::ResourceAccessMap Operator::resourcesToLock() const
+{
+  ResourceAccessMap access;
+  Specification spec = this->specification();
+  if (!spec)
+  {
+    return access;
+  }
+  addResourcesOfItem(access, spec->associations());
+  for (std::size_t i = 0; i < spec->numberOfItems(); ++i)
+  {
+    addResourcesOfItem(access, spec->item(static_cast<int>(i)));
+  }
+  return access;
+}
+
+namespace
+{
+// The resources locked by operators running on this thread.
+thread_local std::map<smtk::resource::Resource*, smtk::resource::LockType> s_heldResources;
+}
+
+/**\brief Lock the resources \a op accesses.
+  *
+  * Locks are acquired in the (pointer) order of the access map so that
+  * operators that share resources cannot deadlock. A resource this thread
+  * already holds is skipped; if it is held for reading but \a op asks to
+  * write it, a warning is logged since the lock cannot be upgraded.
+  */
+Operator::ResourceLocks::ResourceLocks(Operator& op)
+{
+  ResourceAccessMap access = op.resourcesToLock();
+  for (auto& entry : access)
+  {
+    if (!entry.first || entry.second == smtk::resource::LockType::Unlocked)
+    {
+      continue;
+    }
+    auto held = s_heldResources.find(entry.first.get());
+    if (held != s_heldResources.end())
+    {
+      if (held->second == smtk::resource::LockType::Read &&
+        entry.second == smtk::resource::LockType::Write)
+      {
+        smtkWarningMacro(op.log(), "Operator \"" << op.name() << "\" writes a resource that its"
+                                                  << " enclosing operator only reads.");
+      }
+      continue;
+    }
+    entry.first->lock().lock(entry.second);
+    s_heldResources[entry.first.get()] = entry.second;
+    this->m_acquired.insert(entry);
+  }
+}
+
+Operator::ResourceLocks::~ResourceLocks()
+{
+  for (auto it = this->m_acquired.rbegin(); it != this->m_acquired.rend(); ++it)
+  {
+    s_heldResources.erase(it->first.get());
+    it->first->lock().unlock(it->second);
+  }
+}
+
 /// Add an observer of WILL_OPERATE events on this operator.
 void Operator::observe(EventType event, Callback functionHandle, void* callData)
 {
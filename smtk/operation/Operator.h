@@ -16,6 +16,9 @@
 #include "smtk/PublicPointerDefs.h"
 #include "smtk/SharedFromThis.h"
 
+#include "smtk/resource/Lock.h"
+
+#include <map>
 #include <string>
 #include <typeindex>
 #include <utility>
@@ -139,6 +142,9 @@ public:
   typedef smtk::shared_ptr<smtk::attribute::Definition> Definition;
   typedef smtk::shared_ptr<smtk::attribute::Attribute> Specification;
 
+  // The resources an operation accesses and how it accesses them.
+  typedef std::map<smtk::resource::ResourcePtr, smtk::resource::LockType> ResourceAccessMap;
+
   /**\brief Enumerate events that an operator may encounter.
  *
  * No event is provided for operator deletion because
@@ -193,6 +199,7 @@ public:
   virtual std::string className() const = 0;
   virtual bool ableToOperate();
   virtual Result operate();
+  virtual ResourceAccessMap resourcesToLock() const;
 
   void observe(EventType event, Callback functionHandle, void* callData);
   void observe(EventType event, CallbackWithResult functionHandle, void* callData);
@@ -224,6 +231,23 @@ protected:
   virtual Operator::Result operateInternal() = 0;
   virtual void generateSummary(Operator::Result& res);
 
+  // Hold the locks returned by resourcesToLock() for the lifetime of an
+  // operation. Resources that the calling thread already holds (because
+  // this operator runs inside another one) are not locked again; the
+  // nested operator runs under the enclosing operator's locks.
+  class SMTKCORE_EXPORT ResourceLocks
+  {
+  public:
+    ResourceLocks(Operator& op);
+    ~ResourceLocks();
+
+  private:
+    ResourceLocks(const ResourceLocks&) = delete;
+    ResourceLocks& operator=(const ResourceLocks&) = delete;
+
+    ResourceAccessMap m_acquired;
+  };
+
   Specification m_specification;
   std::set<Observer> m_willOperateTriggers;
   std::set<ObserverWithResult> m_didOperateTriggers;
@@ -0,0 +1,308 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/operation/OperatorTrace.h"
+
+#include "smtk/operation/Operator.h"
+
+#include "cJSON.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+namespace smtk
+{
+namespace operation
+{
+
+namespace
+{
+
+std::atomic<bool> s_enabled(false);
+
+// Invocations are kept in a ring buffer holding at most m_capacity entries;
+// once it is full, m_oldest is the index of the entry overwritten next.
+struct TraceData
+{
+  std::mutex m_mutex;
+  std::vector<OperatorTrace::Invocation> m_invocations;
+  std::size_t m_capacity = 4096;
+  std::size_t m_oldest = 0;
+  std::map<std::thread::id, int> m_threads;
+  std::chrono::steady_clock::time_point m_epoch = std::chrono::steady_clock::now();
+
+  // Move the oldest invocation to the front. The caller must hold m_mutex.
+  void linearize()
+  {
+    std::rotate(this->m_invocations.begin(),
+      this->m_invocations.begin() + static_cast<std::ptrdiff_t>(this->m_oldest),
+      this->m_invocations.end());
+    this->m_oldest = 0;
+  }
+
+  // Keep \a invocation, discarding the oldest one if full. The caller must hold m_mutex.
+  void record(OperatorTrace::Invocation&& invocation)
+  {
+    if (this->m_invocations.size() < this->m_capacity)
+    {
+      this->m_invocations.push_back(std::move(invocation));
+    }
+    else if (this->m_capacity > 0)
+    {
+      this->m_invocations[this->m_oldest] = std::move(invocation);
+      this->m_oldest = (this->m_oldest + 1) % this->m_capacity;
+    }
+  }
+};
+
+TraceData& traceData()
+{
+  static TraceData data;
+  return data;
+}
+
+// Microseconds since the trace began.
+double now()
+{
+  return std::chrono::duration<double, std::micro>(
+           std::chrono::steady_clock::now() - traceData().m_epoch)
+    .count();
+}
+
+// The peak resident set size of the process in kilobytes (or 0 if unknown).
+long peakResidentKB()
+{
+#ifndef _WIN32
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+  {
+#ifdef __APPLE__
+    return static_cast<long>(usage.ru_maxrss / 1024);
+#else
+    return static_cast<long>(usage.ru_maxrss);
+#endif
+  }
+#endif
+  return 0;
+}
+
+cJSON* createEvent(const std::string& name, const char* category, const char* phase, double ts,
+  int thread)
+{
+  cJSON* event = cJSON_CreateObject();
+  cJSON_AddStringToObject(event, "name", name.c_str());
+  cJSON_AddStringToObject(event, "cat", category);
+  cJSON_AddStringToObject(event, "ph", phase);
+  cJSON_AddNumberToObject(event, "ts", ts);
+  cJSON_AddNumberToObject(event, "pid", 0);
+  cJSON_AddNumberToObject(event, "tid", thread);
+  return event;
+}
+}
+
+OperatorTrace::Recorder::Recorder(const Operator& op)
+{
+  if (!s_enabled.load(std::memory_order_relaxed))
+  {
+    return;
+  }
+  this->m_invocation.reset(new Invocation);
+  this->m_invocation->operatorName = op.name();
+  this->m_invocation->className = op.className();
+  this->m_invocation->thread = 0;
+  this->m_invocation->outcome = Operator::OUTCOME_UNKNOWN;
+  this->m_invocation->peakMemory = peakResidentKB();
+  this->m_invocation->start = now();
+}
+
+OperatorTrace::Recorder::~Recorder()
+{
+  if (!this->m_invocation)
+  {
+    return;
+  }
+  Invocation& invocation(*this->m_invocation);
+  invocation.duration = now() - invocation.start;
+  long peak = peakResidentKB();
+  invocation.peakMemoryDelta = peak - invocation.peakMemory;
+  invocation.peakMemory = peak;
+
+  TraceData& data(traceData());
+  std::lock_guard<std::mutex> guard(data.m_mutex);
+  auto thread = data.m_threads.insert(
+    std::make_pair(std::this_thread::get_id(), static_cast<int>(data.m_threads.size())));
+  invocation.thread = thread.first->second;
+  data.record(std::move(invocation));
+}
+
+void OperatorTrace::Recorder::setOutcome(int outcome)
+{
+  if (this->m_invocation)
+  {
+    this->m_invocation->outcome = outcome;
+  }
+}
+
+OperatorTrace::Phase::Phase(Recorder& recorder, const char* name)
+  : m_invocation(recorder.m_invocation.get())
+  , m_index(0)
+{
+  if (this->m_invocation)
+  {
+    this->m_index = this->m_invocation->phases.size();
+    Span span = { name, now(), 0. };
+    this->m_invocation->phases.push_back(span);
+  }
+}
+
+OperatorTrace::Phase::~Phase()
+{
+  if (this->m_invocation)
+  {
+    Span& span(this->m_invocation->phases[this->m_index]);
+    span.duration = now() - span.start;
+  }
+}
+
+/**\brief Turn tracing of operator invocations on or off.
+  *
+  * Invocations that are running when tracing is turned on are not recorded.
+  * Recorded invocations are kept until clear() is called or, once capacity()
+  * invocations have been recorded, until newer ones replace them.
+  */
+void OperatorTrace::setEnabled(bool enabled)
+{
+  s_enabled.store(enabled);
+}
+
+bool OperatorTrace::enabled()
+{
+  return s_enabled.load();
+}
+
+/**\brief Set the number of invocations kept.
+  *
+  * Once this many invocations have been recorded, each new one replaces the
+  * oldest. Shrinking the capacity discards the oldest invocations kept.
+  * The default is 4096; a capacity of 0 keeps nothing.
+  */
+void OperatorTrace::setCapacity(std::size_t capacity)
+{
+  TraceData& data(traceData());
+  std::lock_guard<std::mutex> guard(data.m_mutex);
+  data.linearize();
+  if (data.m_invocations.size() > capacity)
+  {
+    data.m_invocations.erase(data.m_invocations.begin(),
+      data.m_invocations.end() - static_cast<std::ptrdiff_t>(capacity));
+  }
+  data.m_capacity = capacity;
+}
+
+std::size_t OperatorTrace::capacity()
+{
+  TraceData& data(traceData());
+  std::lock_guard<std::mutex> guard(data.m_mutex);
+  return data.m_capacity;
+}
+
+std::vector<OperatorTrace::Invocation> OperatorTrace::invocations()
+{
+  TraceData& data(traceData());
+  std::lock_guard<std::mutex> guard(data.m_mutex);
+  std::vector<Invocation> result;
+  result.reserve(data.m_invocations.size());
+  result.insert(result.end(),
+    data.m_invocations.begin() + static_cast<std::ptrdiff_t>(data.m_oldest),
+    data.m_invocations.end());
+  result.insert(result.end(), data.m_invocations.begin(),
+    data.m_invocations.begin() + static_cast<std::ptrdiff_t>(data.m_oldest));
+  return result;
+}
+
+void OperatorTrace::clear()
+{
+  TraceData& data(traceData());
+  std::lock_guard<std::mutex> guard(data.m_mutex);
+  data.m_invocations.clear();
+  data.m_oldest = 0;
+}
+
+/**\brief Return the recorded invocations in the Chrome trace event format.
+  *
+  * Each invocation is a complete ("X") event named for its operator, with the
+  * operator's class name, outcome and growth in peak memory as arguments.
+  * Its phases are complete events nested inside it, and a counter ("C")
+  * event tracks the peak resident set size of the process.
+  */
+std::string OperatorTrace::chromeTrace()
+{
+  std::vector<Invocation> records = OperatorTrace::invocations();
+
+  cJSON* trace = cJSON_CreateObject();
+  cJSON* events = cJSON_CreateArray();
+  cJSON_AddItemToObject(trace, "traceEvents", events);
+  cJSON_AddStringToObject(trace, "displayTimeUnit", "ms");
+  for (auto& invocation : records)
+  {
+    cJSON* event =
+      createEvent(invocation.operatorName, "operator", "X", invocation.start, invocation.thread);
+    cJSON_AddNumberToObject(event, "dur", invocation.duration);
+    cJSON* args = cJSON_CreateObject();
+    cJSON_AddStringToObject(args, "className", invocation.className.c_str());
+    cJSON_AddStringToObject(args, "outcome", outcomeAsString(invocation.outcome).c_str());
+    cJSON_AddNumberToObject(args, "peakMemoryDeltaKB", invocation.peakMemoryDelta);
+    cJSON_AddItemToObject(event, "args", args);
+    cJSON_AddItemToArray(events, event);
+
+    for (auto& phase : invocation.phases)
+    {
+      event = createEvent(phase.name, "phase", "X", phase.start, invocation.thread);
+      cJSON_AddNumberToObject(event, "dur", phase.duration);
+      cJSON_AddItemToArray(events, event);
+    }
+
+    event = createEvent("peak memory", "memory", "C", invocation.start + invocation.duration,
+      invocation.thread);
+    args = cJSON_CreateObject();
+    cJSON_AddNumberToObject(args, "KB", invocation.peakMemory);
+    cJSON_AddItemToObject(event, "args", args);
+    cJSON_AddItemToArray(events, event);
+  }
+
+  char* json = cJSON_PrintUnformatted(trace);
+  std::string result(json);
+  free(json);
+  cJSON_Delete(trace);
+  return result;
+}
+
+bool OperatorTrace::writeChromeTrace(const std::string& filename)
+{
+  std::ofstream file(filename.c_str());
+  if (!file.good())
+  {
+    return false;
+  }
+  file << OperatorTrace::chromeTrace() << "\n";
+  return file.good();
+}
+
+} // namespace operation
+} // namespace smtk
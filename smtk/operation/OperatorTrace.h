@@ -0,0 +1,124 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_operation_OperatorTrace_h
+#define smtk_operation_OperatorTrace_h
+
+#include "smtk/CoreExports.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace smtk
+{
+namespace operation
+{
+
+class Operator;
+
+/**\brief Record where time and memory go inside operator invocations.
+  *
+  * When enabled, Operator::operate() records one Invocation per call, with
+  * the wall time spent in each of its phases: ableToOperate(), observers of
+  * WILL_OPERATE, operateInternal(), transcribing the result (summaries, log
+  * serialization and so on) and observers of DID_OPERATE; model operators
+  * also time the manager events they batch and the meshes they discard.
+  * Each invocation notes how much the process' peak resident set size grew
+  * while it ran.
+  *
+  * Invocations may be queried in-process or exported as a Chrome trace, which
+  * chrome://tracing and Perfetto can display. Operators that run other
+  * operators appear nested inside them on the same thread.
+  *
+  * Tracing is disabled by default; a disabled trace costs a single flag
+  * test per operation. Only the most recent invocations are kept (see
+  * setCapacity()), so a trace left enabled in a long-running application
+  * uses a bounded amount of memory.
+  */
+class SMTKCORE_EXPORT OperatorTrace
+{
+public:
+  /// A named span of time; times are in microseconds since the trace began.
+  struct Span
+  {
+    std::string name;
+    double start;
+    double duration;
+  };
+
+  /// The record of a single call to Operator::operate().
+  struct Invocation
+  {
+    std::string operatorName;
+    std::string className;
+    int thread; // a small integer identifying the thread the operator ran on
+    double start;
+    double duration;
+    int outcome;
+    long peakMemory;      // peak resident set size after the operation, in kilobytes
+    long peakMemoryDelta; // how much the peak grew during the operation, in kilobytes
+    std::vector<Span> phases;
+  };
+
+  class Phase;
+
+  /// Records an invocation (if tracing is enabled) from construction to destruction.
+  class SMTKCORE_EXPORT Recorder
+  {
+  public:
+    Recorder(const Operator& op);
+    ~Recorder();
+    Recorder(const Recorder&) = delete;
+    Recorder& operator=(const Recorder&) = delete;
+
+    bool isRecording() const { return !!this->m_invocation; }
+    void setOutcome(int outcome);
+
+  private:
+    friend class Phase;
+    std::unique_ptr<Invocation> m_invocation;
+  };
+
+  /// Times one phase of an invocation from construction to destruction.
+  class SMTKCORE_EXPORT Phase
+  {
+  public:
+    Phase(Recorder& recorder, const char* name);
+    ~Phase();
+    Phase(const Phase&) = delete;
+    Phase& operator=(const Phase&) = delete;
+
+  private:
+    Invocation* m_invocation;
+    std::size_t m_index;
+  };
+
+  static void setEnabled(bool enabled);
+  static bool enabled();
+
+  /// Set or get the number of invocations kept; older invocations are discarded first.
+  static void setCapacity(std::size_t capacity);
+  static std::size_t capacity();
+
+  /// Return a copy of the invocations kept (oldest first) since tracing began or was last cleared.
+  static std::vector<Invocation> invocations();
+  static void clear();
+
+  /// Return the recorded invocations in the Chrome trace event format.
+  static std::string chromeTrace();
+  /// Write chromeTrace() to \a filename, returning true on success.
+  static bool writeChromeTrace(const std::string& filename);
+};
+
+} // namespace operation
+} // namespace smtk
+
+#endif // smtk_operation_OperatorTrace_h
@@ -0,0 +1,314 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/operation/Manager.h"
+#include "smtk/operation/Operator.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Collection.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/IntItemDefinition.h"
+#include "smtk/attribute/ModelEntityItem.h"
+#include "smtk/attribute/ModelEntityItemDefinition.h"
+#include "smtk/attribute/StringItemDefinition.h"
+
+#include "smtk/io/Logger.h"
+
+#include "smtk/model/EntityRef.h"
+#include "smtk/model/Manager.h"
+#include "smtk/model/Model.h"
+
+#include "smtk/resource/Resource.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+class TestResource : public smtk::resource::Resource
+{
+public:
+  smtkTypeMacro(TestResource);
+  smtkCreateMacro(TestResource);
+  smtkSharedFromThisMacro(smtk::resource::Resource);
+
+  Type type() const override { return Type::ATTRIBUTE; }
+
+  smtk::resource::ComponentPtr find(const smtk::common::UUID&) const override
+  {
+    return smtk::resource::ComponentPtr();
+  }
+
+  // The number of operators currently running on this resource and the most
+  // that ever ran on it at once.
+  std::atomic<int> m_active;
+  std::atomic<int> m_maximumActive;
+
+protected:
+  TestResource()
+    : Resource()
+    , m_active(0)
+    , m_maximumActive(0)
+  {
+  }
+};
+
+void recordMaximum(std::atomic<int>& maximum, int value)
+{
+  int current = maximum.load();
+  while (value > current && !maximum.compare_exchange_weak(current, value))
+  {
+  }
+}
+
+std::atomic<int> s_running(0);
+std::atomic<int> s_maximumRunning(0);
+
+// An operator that occupies a set of resources for a while.
+class SleepOperator : public smtk::operation::Operator
+{
+public:
+  smtkTypeMacro(SleepOperator);
+  smtkCreateMacro(SleepOperator);
+  smtkSharedFromThisMacro(smtk::operation::Operator);
+
+  std::string name() const override { return "sleep"; }
+  std::string className() const override { return "SleepOperator"; }
+  smtk::io::Logger& log() override { return this->m_log; }
+
+  ResourceAccessMap resourcesToLock() const override { return this->m_access; }
+
+  void setSpecification(smtk::attribute::CollectionPtr collection)
+  {
+    this->m_collection = collection;
+    this->m_specification = collection->createAttribute("operator");
+  }
+
+  ResourceAccessMap m_access;
+  // An operator to run from within this one and the lock states seen inside.
+  SleepOperator::Ptr m_nested;
+  std::vector<smtk::resource::LockType> m_lockStates;
+
+protected:
+  Result operateInternal() override
+  {
+    for (auto& entry : this->m_access)
+    {
+      this->m_lockStates.push_back(entry.first->lock().state());
+    }
+    if (this->m_nested)
+    {
+      this->m_nested->operate();
+    }
+    recordMaximum(s_maximumRunning, ++s_running);
+    for (auto& entry : this->m_access)
+    {
+      auto resource = smtk::dynamic_pointer_cast<TestResource>(entry.first);
+      recordMaximum(resource->m_maximumActive, ++resource->m_active);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    for (auto& entry : this->m_access)
+    {
+      --smtk::dynamic_pointer_cast<TestResource>(entry.first)->m_active;
+    }
+    --s_running;
+
+    // The attribute collection is shared by all of the operators.
+    static std::mutex collectionMutex;
+    std::lock_guard<std::mutex> guard(collectionMutex);
+    Result result = this->m_collection->createAttribute("result");
+    result->findInt("outcome")->setValue(OPERATION_SUCCEEDED);
+    return result;
+  }
+
+  smtk::io::Logger m_log;
+  smtk::attribute::CollectionPtr m_collection;
+};
+
+smtk::attribute::CollectionPtr createOperatorCollection()
+{
+  auto collection = smtk::attribute::Collection::create();
+  auto opDef = collection->createDefinition("operator");
+  auto debugLevelDef = smtk::attribute::IntItemDefinition::New("debug level");
+  debugLevelDef->setIsOptional(true);
+  opDef->addItemDefinition(debugLevelDef);
+  auto entityDef = smtk::attribute::ModelEntityItemDefinition::New("entity");
+  entityDef->setIsOptional(true);
+  entityDef->setNumberOfRequiredValues(1);
+  opDef->addItemDefinition(entityDef);
+
+  auto resultDef = collection->createDefinition("result");
+  auto outcomeDef = smtk::attribute::IntItemDefinition::New("outcome");
+  outcomeDef->setNumberOfRequiredValues(1);
+  resultDef->addItemDefinition(outcomeDef);
+  auto logDef = smtk::attribute::StringItemDefinition::New("log");
+  logDef->setNumberOfRequiredValues(0);
+  logDef->setIsExtensible(true);
+  resultDef->addItemDefinition(logDef);
+  return collection;
+}
+
+std::atomic<int> s_didOperate(0);
+
+int didOperate(smtk::operation::Operator::EventType event, const smtk::operation::Operator&,
+  smtk::operation::Operator::Result result, void*)
+{
+  if (event == smtk::operation::Operator::DID_OPERATE && result &&
+    result->findInt("outcome")->value() == smtk::operation::Operator::OPERATION_SUCCEEDED)
+  {
+    ++s_didOperate;
+  }
+  return 0;
+}
+
+// Launch one operator per entry of \a accesses and wait for them to finish.
+void launchAll(smtk::operation::Manager::Ptr manager, smtk::attribute::CollectionPtr collection,
+  const std::vector<smtk::operation::Operator::ResourceAccessMap>& accesses)
+{
+  std::vector<std::future<smtk::operation::Operator::Result> > results;
+  for (auto& access : accesses)
+  {
+    auto op = SleepOperator::create();
+    op->setSpecification(collection);
+    op->m_access = access;
+    op->observe(smtk::operation::Operator::DID_OPERATE, didOperate, nullptr);
+    results.push_back(manager->launch(op));
+  }
+  for (auto& result : results)
+  {
+    smtkTest(result.get()->findInt("outcome")->value() ==
+        smtk::operation::Operator::OPERATION_SUCCEEDED,
+      "Launched operator failed.");
+  }
+}
+
+void testLock()
+{
+  using smtk::resource::LockType;
+  smtk::resource::Lock lock;
+  smtkTest(lock.tryLock(LockType::Read) && lock.tryLock(LockType::Read), "Readers must share.");
+  smtkTest(!lock.tryLock(LockType::Write), "A writer must wait for readers.");
+  lock.unlock(LockType::Read);
+  lock.unlock(LockType::Read);
+  smtkTest(lock.state() == LockType::Unlocked, "Lock was not released.");
+  smtkTest(lock.tryLock(LockType::Write), "Could not lock for writing.");
+  smtkTest(!lock.tryLock(LockType::Read), "A reader must wait for a writer.");
+  lock.unlock(LockType::Write);
+}
+
+void testDefaultResources(smtk::attribute::CollectionPtr collection)
+{
+  auto modelManager = smtk::model::Manager::create();
+  smtk::model::Model model = modelManager->addModel(3, 3, "model");
+  auto op = SleepOperator::create();
+  op->setSpecification(collection);
+  smtkTest(op->smtk::operation::Operator::resourcesToLock().empty(),
+    "Expected no resources without parameters.");
+  auto entityItem = op->specification()->findModelEntity("entity");
+  entityItem->setIsEnabled(true);
+  smtkTest(entityItem->setValue(model), "Could not set the entity.");
+  auto access = op->smtk::operation::Operator::resourcesToLock();
+  smtkTest(access.size() == 1 && access.begin()->first == modelManager &&
+      access.begin()->second == smtk::resource::LockType::Write,
+    "Expected the model manager to be locked for writing.");
+}
+}
+
+void testSynchronousOperate(smtk::attribute::CollectionPtr collection)
+{
+  using smtk::resource::LockType;
+  auto a = TestResource::create();
+  auto b = TestResource::create();
+  auto op = SleepOperator::create();
+  op->setSpecification(collection);
+  op->m_access = { { a, LockType::Write }, { b, LockType::Read } };
+
+  // An operator run directly holds its locks while it operates.
+  smtkTest(op->operate()->findInt("outcome")->value() ==
+      smtk::operation::Operator::OPERATION_SUCCEEDED,
+    "Synchronous operator failed.");
+  smtkTest(op->m_lockStates.size() == 2 && op->m_lockStates[0] != LockType::Unlocked &&
+      op->m_lockStates[1] != LockType::Unlocked,
+    "Synchronous operator did not lock its resources.");
+  smtkTest(a->lock().state() == LockType::Unlocked && b->lock().state() == LockType::Unlocked,
+    "Resource locks were not released.");
+
+  // An operator run by another operator on the same resources does not deadlock.
+  op->m_lockStates.clear();
+  op->m_nested = SleepOperator::create();
+  op->m_nested->setSpecification(collection);
+  op->m_nested->m_access = { { a, LockType::Write } };
+  std::future<smtk::operation::Operator::Result> result =
+    std::async(std::launch::async, [op]() { return op->operate(); });
+  smtkTest(result.wait_for(std::chrono::seconds(10)) == std::future_status::ready,
+    "Nested operator deadlocked.");
+  smtkTest(result.get()->findInt("outcome")->value() ==
+      smtk::operation::Operator::OPERATION_SUCCEEDED,
+    "Nested operator failed.");
+  smtkTest(op->m_nested->m_lockStates.size() == 1 &&
+      op->m_nested->m_lockStates[0] == LockType::Write,
+    "Nested operator did not run under the enclosing operator's locks.");
+  smtkTest(a->lock().state() == LockType::Unlocked && b->lock().state() == LockType::Unlocked,
+    "Resource locks were not released.");
+}
+
+int TestAsyncOperators(int, char** const)
+{
+  using smtk::resource::LockType;
+  testLock();
+
+  auto collection = createOperatorCollection();
+  testDefaultResources(collection);
+  testSynchronousOperate(collection);
+
+  auto manager = smtk::operation::Manager::create();
+  manager->setNumberOfThreads(4);
+  auto a = TestResource::create();
+  auto b = TestResource::create();
+
+  // Writers of different resources run concurrently.
+  launchAll(manager, collection, { { { a, LockType::Write } }, { { b, LockType::Write } } });
+  smtkTest(s_maximumRunning == 2, "Independent writers did not run concurrently.");
+  smtkTest(s_didOperate == 2, "Observers were not notified.");
+
+  // Writers of the same resource are serialized.
+  s_maximumRunning = 0;
+  launchAll(manager, collection, { { { a, LockType::Write } }, { { a, LockType::Write } },
+                                   { { a, LockType::Write }, { b, LockType::Read } } });
+  smtkTest(a->m_maximumActive == 1, "Writers of the same resource overlapped.");
+
+  // Readers share a resource, but not with a writer.
+  s_maximumRunning = 0;
+  launchAll(manager, collection, { { { b, LockType::Read } }, { { b, LockType::Read } } });
+  smtkTest(b->m_maximumActive == 2, "Readers did not run concurrently.");
+  b->m_maximumActive = 0;
+  launchAll(manager, collection, { { { b, LockType::Read } }, { { b, LockType::Write } } });
+  smtkTest(b->m_maximumActive == 1, "A reader and writer overlapped.");
+
+  // Operators that lock several resources in different orders do not deadlock.
+  launchAll(manager, collection,
+    { { { a, LockType::Write }, { b, LockType::Write } },
+      { { b, LockType::Write }, { a, LockType::Write } }, { { a, LockType::Read } },
+      { { b, LockType::Write }, { a, LockType::Read } } });
+  smtkTest(s_didOperate == 13, "Observers were not notified.");
+  smtkTest(a->lock().state() == LockType::Unlocked && b->lock().state() == LockType::Unlocked,
+    "Resource locks were not released.");
+
+  return 0;
+}
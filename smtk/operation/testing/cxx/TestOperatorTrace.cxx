@@ -0,0 +1,215 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/operation/Operator.h"
+#include "smtk/operation/OperatorTrace.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Collection.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/IntItemDefinition.h"
+#include "smtk/attribute/StringItemDefinition.h"
+
+#include "smtk/io/Logger.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include "cJSON.h"
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+// An operator that sleeps and, optionally, runs another operator.
+class NapOperator : public smtk::operation::Operator
+{
+public:
+  smtkTypeMacro(NapOperator);
+  smtkCreateMacro(NapOperator);
+  smtkSharedFromThisMacro(smtk::operation::Operator);
+
+  std::string name() const override { return "nap"; }
+  std::string className() const override { return "NapOperator"; }
+  smtk::io::Logger& log() override { return this->m_log; }
+
+  void setSpecification(smtk::attribute::CollectionPtr collection)
+  {
+    this->m_collection = collection;
+    this->m_specification = collection->createAttribute("operator");
+  }
+
+  std::shared_ptr<NapOperator> m_nested;
+
+protected:
+  Result operateInternal() override
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    if (this->m_nested)
+    {
+      this->m_nested->operate();
+    }
+    smtkInfoMacro(this->m_log, "Napped.");
+    Result result = this->m_collection->createAttribute("result");
+    result->findInt("outcome")->setValue(OPERATION_SUCCEEDED);
+    return result;
+  }
+
+  smtk::io::Logger m_log;
+  smtk::attribute::CollectionPtr m_collection;
+};
+
+smtk::attribute::CollectionPtr createOperatorCollection()
+{
+  auto collection = smtk::attribute::Collection::create();
+  auto opDef = collection->createDefinition("operator");
+  auto debugLevelDef = smtk::attribute::IntItemDefinition::New("debug level");
+  debugLevelDef->setIsOptional(true);
+  opDef->addItemDefinition(debugLevelDef);
+
+  auto resultDef = collection->createDefinition("result");
+  auto outcomeDef = smtk::attribute::IntItemDefinition::New("outcome");
+  outcomeDef->setNumberOfRequiredValues(1);
+  resultDef->addItemDefinition(outcomeDef);
+  auto logDef = smtk::attribute::StringItemDefinition::New("log");
+  logDef->setNumberOfRequiredValues(0);
+  logDef->setIsExtensible(true);
+  resultDef->addItemDefinition(logDef);
+  return collection;
+}
+
+int slowObserver(smtk::operation::Operator::EventType, const smtk::operation::Operator&,
+  smtk::operation::Operator::Result, void*)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  return 0;
+}
+
+const smtk::operation::OperatorTrace::Span* findPhase(
+  const smtk::operation::OperatorTrace::Invocation& invocation, const std::string& name)
+{
+  for (auto& phase : invocation.phases)
+  {
+    if (phase.name == name)
+    {
+      return &phase;
+    }
+  }
+  return nullptr;
+}
+}
+
+int TestOperatorTrace(int, char** const)
+{
+  using smtk::operation::OperatorTrace;
+
+  auto collection = createOperatorCollection();
+  auto outer = NapOperator::create();
+  outer->setSpecification(collection);
+  outer->observe(smtk::operation::Operator::DID_OPERATE, slowObserver, nullptr);
+
+  // Nothing is recorded by default.
+  smtkTest(!OperatorTrace::enabled(), "Tracing should be disabled by default.");
+  outer->operate();
+  smtkTest(OperatorTrace::invocations().empty(), "Recorded an invocation while disabled.");
+
+  OperatorTrace::setEnabled(true);
+  outer->m_nested = NapOperator::create();
+  outer->m_nested->setSpecification(collection);
+  outer->operate();
+  OperatorTrace::setEnabled(false);
+  outer->operate();
+
+  // The nested invocation finishes (and is recorded) first.
+  std::vector<OperatorTrace::Invocation> invocations = OperatorTrace::invocations();
+  smtkTest(invocations.size() == 2, "Expected the outer and nested invocations.");
+  const OperatorTrace::Invocation& nested(invocations[0]);
+  const OperatorTrace::Invocation& invocation(invocations[1]);
+  smtkTest(invocation.operatorName == "nap" && invocation.className == "NapOperator",
+    "Bad operator names.");
+  smtkTest(invocation.outcome == smtk::operation::Operator::OPERATION_SUCCEEDED,
+    "Bad outcome.");
+  smtkTest(nested.start >= invocation.start &&
+      nested.start + nested.duration <= invocation.start + invocation.duration &&
+      nested.thread == invocation.thread,
+    "The nested invocation should lie within the outer one.");
+
+  const char* expected[] = { "ableToOperate", "observe WILL_OPERATE", "operateInternal",
+    "transcribe result", "observe DID_OPERATE" };
+  smtkTest(invocation.phases.size() == 5, "Expected 5 phases.");
+  double end = invocation.start;
+  for (std::size_t i = 0; i < 5; ++i)
+  {
+    const OperatorTrace::Span& phase(invocation.phases[i]);
+    smtkTest(phase.name == expected[i], "Phase " << i << " is " << phase.name);
+    smtkTest(phase.start >= end && phase.duration >= 0., "Phases should not overlap.");
+    end = phase.start + phase.duration;
+  }
+  smtkTest(end <= invocation.start + invocation.duration, "Phases should lie within the call.");
+  smtkTest(findPhase(invocation, "operateInternal")->duration >= 40000. &&
+      findPhase(nested, "operateInternal")->duration >= 20000.,
+    "operateInternal was too fast.");
+  smtkTest(findPhase(invocation, "observe DID_OPERATE")->duration >= 10000. &&
+      findPhase(nested, "observe DID_OPERATE")->duration < 10000.,
+    "Observers were not timed.");
+  smtkTest(invocation.peakMemory >= 0 && invocation.peakMemoryDelta >= 0, "Bad memory usage.");
+
+  // The exported trace holds a complete event per invocation and phase.
+  cJSON* trace = cJSON_Parse(OperatorTrace::chromeTrace().c_str());
+  smtkTest(trace != nullptr, "Could not parse the trace.");
+  cJSON* events = cJSON_GetObjectItem(trace, "traceEvents");
+  int numComplete = 0;
+  int numOperators = 0;
+  for (cJSON* event = events ? events->child : nullptr; event; event = event->next)
+  {
+    if (std::strcmp(cJSON_GetObjectItem(event, "ph")->valuestring, "X") == 0)
+    {
+      ++numComplete;
+      numOperators += std::strcmp(cJSON_GetObjectItem(event, "cat")->valuestring, "operator") == 0;
+    }
+  }
+  cJSON_Delete(trace);
+  smtkTest(numOperators == 2 && numComplete == 12, "Bad trace events.");
+
+  OperatorTrace::clear();
+  smtkTest(OperatorTrace::invocations().empty(), "Invocations were not cleared.");
+
+  // Only the most recent invocations are kept.
+  smtkTest(OperatorTrace::capacity() > 0, "Tracing should keep invocations by default.");
+  OperatorTrace::setCapacity(3);
+  OperatorTrace::setEnabled(true);
+  outer->m_nested.reset();
+  std::vector<std::shared_ptr<NapOperator> > ops;
+  for (int i = 0; i < 5; ++i)
+  {
+    ops.push_back(NapOperator::create());
+    ops.back()->setSpecification(collection);
+    ops.back()->operate();
+  }
+  OperatorTrace::setEnabled(false);
+  invocations = OperatorTrace::invocations();
+  smtkTest(invocations.size() == 3, "Expected the trace to be bounded.");
+  for (std::size_t i = 1; i < invocations.size(); ++i)
+  {
+    smtkTest(invocations[i - 1].start < invocations[i].start, "Invocations are out of order.");
+  }
+  OperatorTrace::setCapacity(2);
+  std::vector<OperatorTrace::Invocation> kept = OperatorTrace::invocations();
+  smtkTest(kept.size() == 2 && kept[0].start == invocations[1].start &&
+      kept[1].start == invocations[2].start,
+    "Shrinking the capacity should keep the newest invocations.");
+  OperatorTrace::clear();
+  return 0;
+}
@@ -0,0 +1,92 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/resource/Lock.h"
+
+namespace smtk
+{
+namespace resource
+{
+
+Lock::Lock()
+  : m_readers(0)
+  , m_waitingWriters(0)
+  , m_writer(false)
+{
+}
+
+void Lock::lock(LockType type)
+{
+  std::unique_lock<std::mutex> guard(this->m_mutex);
+  if (type == LockType::Read)
+  {
+    this->m_condition.wait(
+      guard, [this]() { return !this->m_writer && this->m_waitingWriters == 0; });
+    ++this->m_readers;
+  }
+  else if (type == LockType::Write)
+  {
+    ++this->m_waitingWriters;
+    this->m_condition.wait(guard, [this]() { return !this->m_writer && this->m_readers == 0; });
+    --this->m_waitingWriters;
+    this->m_writer = true;
+  }
+}
+
+bool Lock::tryLock(LockType type)
+{
+  std::unique_lock<std::mutex> guard(this->m_mutex);
+  if (type == LockType::Read)
+  {
+    if (this->m_writer || this->m_waitingWriters > 0)
+    {
+      return false;
+    }
+    ++this->m_readers;
+  }
+  else if (type == LockType::Write)
+  {
+    if (this->m_writer || this->m_readers > 0)
+    {
+      return false;
+    }
+    this->m_writer = true;
+  }
+  return true;
+}
+
+void Lock::unlock(LockType type)
+{
+  {
+    std::unique_lock<std::mutex> guard(this->m_mutex);
+    if (type == LockType::Read && this->m_readers > 0)
+    {
+      --this->m_readers;
+    }
+    else if (type == LockType::Write)
+    {
+      this->m_writer = false;
+    }
+    else
+    {
+      return;
+    }
+  }
+  this->m_condition.notify_all();
+}
+
+LockType Lock::state() const
+{
+  std::unique_lock<std::mutex> guard(this->m_mutex);
+  return this->m_writer ? LockType::Write
+                        : (this->m_readers > 0 ? LockType::Read : LockType::Unlocked);
+}
+}
+}
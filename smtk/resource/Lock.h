@@ -0,0 +1,66 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_resource_Lock_h
+#define smtk_resource_Lock_h
+
+#include "smtk/CoreExports.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+namespace smtk
+{
+namespace resource
+{
+
+/// The kinds of access an operation may require of a resource.
+enum class LockType
+{
+  Unlocked,
+  Read,
+  Write
+};
+
+/// A readers-writer lock held by each resource. Any number of readers may
+/// hold the lock at once, while a writer holds it exclusively. Waiting
+/// writers block new readers so that they are not starved. The lock is not
+/// recursive: a thread must not acquire a lock it already holds.
+class SMTKCORE_EXPORT Lock
+{
+public:
+  Lock();
+  Lock(const Lock&) = delete;
+  Lock& operator=(const Lock&) = delete;
+
+  // Block until access of the given type is granted.
+  void lock(LockType type);
+
+  // Acquire access of the given type if it is available without blocking.
+  bool tryLock(LockType type);
+
+  // Release access previously granted by lock() or tryLock().
+  void unlock(LockType type);
+
+  // Return the type of access currently granted (Unlocked if none).
+  LockType state() const;
+
+private:
+  mutable std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::size_t m_readers;
+  std::size_t m_waitingWriters;
+  bool m_writer;
+};
+}
+}
+
+#endif // smtk_resource_Lock_h
@@ -17,6 +17,8 @@
 #include "smtk/SystemConfig.h"
 #include "smtk/common/UUID.h"
 
+#include "smtk/resource/Lock.h"
+
 #include <string>
 #include <typeindex>
 
@@ -69,6 +71,9 @@ public:
   // Resources that are managed have a non-null pointer to their manager.
   Manager* manager() const { return this->m_manager; }
 
+  // The lock that operations acquire before reading or writing this resource.
+  Lock& lock() const { return this->m_lock; }
+
   static std::string type2String(Resource::Type t);
   static Resource::Type string2Type(const std::string& s);
 
@@ -81,6 +86,7 @@ private:
   std::string m_location;
 
   Manager* m_manager;
+  mutable Lock m_lock;
 };
 }
 }